@@ -0,0 +1,165 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file ascii_tokenizer.hpp
+//! \brief Find the field delimiters of an ASCII message body.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef ASCII_TOKENIZER_HPP
+#define ASCII_TOKENIZER_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//============================================================================
+//! \class AsciiTokenizer
+//! \brief Finds every delimiter in an ASCII or abbreviated ASCII body once,
+//! so that each field can be found without scanning the body again.
+//
+//! The body is classified 64 bytes at a time (with AVX2 or SSE2 where the
+//! compiler targets them) into one bitmap per delimiter, marking where each
+//! of ',', '*', ' ', '\r', '\n', '"' and the terminating NUL are.
+//! FindFirstOf() then answers the same question as strcspn() from the
+//! bitmaps, which costs a few instructions instead of a scan.
+//
+//! Like strcspn(), the tokenizer reads until it finds the delimiter it was
+//! asked for or a NUL, so the body needs no known length.  It never reads
+//! before the body or past its NUL: the blocks at either end that the body
+//! only partly covers are copied into a padded buffer before they are
+//! classified.
+//============================================================================
+class AsciiTokenizer
+{
+public:
+   //! Delimiters that FindFirstOf() can look for.  The NUL that ends the
+   //! body is always looked for.
+   enum DELIMITER : uint8_t
+   {
+      COMMA = 0x01,    //!< ','
+      ASTERISK = 0x02, //!< '*', which starts the CRC.
+      SPACE = 0x04,    //!< ' '
+      CR = 0x08,       //!< '\r'
+      LF = 0x10,       //!< '\n'
+      QUOTE = 0x20,    //!< '"'
+      END = 0x40       //!< The NUL that ends the body.
+   };
+
+   //----------------------------------------------------------------------------
+   //! \brief Start tokenizing a new body.
+   //
+   //! \param[in] pcBody_ The body.  It must stay valid until the next call.
+   //----------------------------------------------------------------------------
+   void Reset(const char* pcBody_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Find the next delimiter at or after a position in the body.
+   //
+   //! \param[in] pcPosition_ A position in the body.
+   //! \param[in] ucDelimiters_ The DELIMITERs to look for.
+   //
+   //! \return The number of bytes before the first delimiter, as strcspn()
+   //! would return it.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] size_t FindFirstOf(const char* pcPosition_, uint8_t ucDelimiters_)
+   {
+      const auto ullOffset = static_cast<size_t>(pcPosition_ - pcMyFirstBlock);
+      size_t ullBlock = ullOffset / uiBLOCK_SIZE;
+      uint64_t ullFromPosition = ~0ULL << (ullOffset % uiBLOCK_SIZE);
+
+      // Inlined, the delimiters are usually constant and the loop over them
+      // folds away.
+      while (true)
+      {
+         while (ullBlock >= vMyBlocks.size())
+         {
+            // A position past the NUL is past the body, where strcspn() would
+            // find nothing either.
+            if (bMyEndFound)
+               return 0;
+            ScanBlock();
+         }
+
+         const std::array<uint64_t, uiMASK_COUNT>& aullMasks = vMyBlocks[ullBlock];
+         uint64_t ullMatches = aullMasks[uiEND_INDEX];
+         for (uint32_t i = 0; i < uiEND_INDEX; ++i)
+         {
+            if (ucDelimiters_ & (1U << i))
+               ullMatches |= aullMasks[i];
+         }
+
+         ullMatches &= ullFromPosition;
+         if (ullMatches != 0)
+         {
+            return ullBlock * uiBLOCK_SIZE + CountTrailingZeros(ullMatches) - ullOffset;
+         }
+
+         ++ullBlock;
+         ullFromPosition = ~0ULL;
+      }
+   }
+
+private:
+   static constexpr uint32_t uiBLOCK_SIZE = 64;
+   //! The index of the NUL's bitmap.  There is one more bitmap than
+   //! delimiters so that a block is a power of two in size.
+   static constexpr uint32_t uiEND_INDEX = 6;
+   static constexpr uint32_t uiMASK_COUNT = 8;
+
+   //! Classify the next block of the body.
+   void ScanBlock();
+
+   static uint32_t CountTrailingZeros(uint64_t ullMask_)
+   {
+#if defined(_MSC_VER)
+      unsigned long ulIndex = 0;
+      _BitScanForward64(&ulIndex, ullMask_);
+      return static_cast<uint32_t>(ulIndex);
+#else
+      return static_cast<uint32_t>(__builtin_ctzll(ullMask_));
+#endif
+   }
+
+   const char* pcMyBody{ nullptr };
+   //! The 64-byte aligned address the first block starts at.
+   const char* pcMyFirstBlock{ nullptr };
+   bool bMyEndFound{ false };
+   //! For each block classified so far, a bitmap per DELIMITER of the bytes
+   //! that are that delimiter.
+   std::vector<std::array<uint64_t, uiMASK_COUNT>> vMyBlocks;
+};
+
+#endif // ASCII_TOKENIZER_HPP
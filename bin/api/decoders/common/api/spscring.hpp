@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file spscring.hpp
+//! \brief Bounded lock-free single-producer/single-consumer ring.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef SPSCRING_HPP
+#define SPSCRING_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+//============================================================================
+//! \class SpscRing
+//! \brief A bounded ring that one thread pushes to and one other thread pops
+//! from without taking a lock.
+//
+//! The head and tail counters only ever increase, and each is written by a
+//! single thread, so the ring needs no compare-and-swap.  They are kept on
+//! separate cache lines so the producer and consumer do not contend.
+//============================================================================
+template <typename T> class SpscRing
+{
+private:
+   static constexpr size_t ullCACHE_LINE_SIZE = 64;
+
+   std::vector<T> vMyItems;
+   uint64_t ullMyMask{ 0 };
+   alignas(ullCACHE_LINE_SIZE) std::atomic<uint64_t> ullMyHead{ 0 }; //!< Next item to pop, written by the consumer.
+   alignas(ullCACHE_LINE_SIZE) std::atomic<uint64_t> ullMyTail{ 0 }; //!< Next free item, written by the producer.
+
+public:
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the SpscRing class.
+   //
+   //! \param[in] uiCapacity_ The number of items the ring can hold.  Must be a
+   //! power of two.
+   //----------------------------------------------------------------------------
+   SpscRing(uint32_t uiCapacity_) : vMyItems(uiCapacity_), ullMyMask(uiCapacity_ - 1)
+   {
+      if (uiCapacity_ == 0 || (uiCapacity_ & (uiCapacity_ - 1)) != 0)
+      {
+         throw std::invalid_argument("SpscRing(): capacity must be a power of two.");
+      }
+   }
+
+   SpscRing(const SpscRing&) = delete;
+   SpscRing& operator=(const SpscRing&) = delete;
+
+   //----------------------------------------------------------------------------
+   //! \brief Push an item.  Only call this from the producer thread.
+   //
+   //! \return false if the ring is full.
+   //----------------------------------------------------------------------------
+   bool
+   TryPush(const T& tItem_)
+   {
+      const uint64_t ullTail = ullMyTail.load(std::memory_order_relaxed);
+      if (ullTail - ullMyHead.load(std::memory_order_acquire) > ullMyMask)
+      {
+         return false;
+      }
+      vMyItems[ullTail & ullMyMask] = tItem_;
+      ullMyTail.store(ullTail + 1, std::memory_order_release);
+      return true;
+   }
+
+   //----------------------------------------------------------------------------
+   //! \brief Pop an item.  Only call this from the consumer thread.
+   //
+   //! \return false if the ring is empty.
+   //----------------------------------------------------------------------------
+   bool
+   TryPop(T& tItem_)
+   {
+      const uint64_t ullHead = ullMyHead.load(std::memory_order_relaxed);
+      if (ullHead == ullMyTail.load(std::memory_order_acquire))
+      {
+         return false;
+      }
+      tItem_ = std::move(vMyItems[ullHead & ullMyMask]);
+      ullMyHead.store(ullHead + 1, std::memory_order_release);
+      return true;
+   }
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the number of items in the ring.  From any thread other than
+   //! the producer or consumer, this is only an estimate.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] uint32_t
+   Size() const
+   {
+      return static_cast<uint32_t>(ullMyTail.load(std::memory_order_acquire) - ullMyHead.load(std::memory_order_acquire));
+   }
+
+   //----------------------------------------------------------------------------
+   //! \brief Is the ring empty?
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   IsEmpty() const
+   {
+      return Size() == 0;
+   }
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the number of items the ring can hold.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] uint32_t
+   GetCapacity() const
+   {
+      return static_cast<uint32_t>(ullMyMask + 1);
+   }
+};
+
+#endif // SPSCRING_HPP
@@ -0,0 +1,51 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file common_logger.hpp
+//! \brief DLL-exposed spdlog logger functionality.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef DYNAMIC_LIBRARY_LOGGER_HPP
+#define DYNAMIC_LIBRARY_LOGGER_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "decoders_export.h"
+
+#include <string>
+
+extern "C" {
+   DECODERS_EXPORT void common_logger_setup();
+   DECODERS_EXPORT void common_logger_setup_from_file(char* pcLoggerConfigPath_);
+   DECODERS_EXPORT bool common_logger_set_logger_level(int32_t iLogLevel_);
+   DECODERS_EXPORT void common_logger_shutdown_logger();
+   DECODERS_EXPORT bool common_logger_log(int32_t iLogLevel_, char* pucMessage_);
+}
+
+#endif //DYNAMIC_LIBRARY_LOGGER_HPP
\ No newline at end of file
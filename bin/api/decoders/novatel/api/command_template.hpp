@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file command_template.hpp
+//! \brief Precompiled OEM commands with positional parameter slots.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef NOVATEL_COMMAND_TEMPLATE_HPP
+#define NOVATEL_COMMAND_TEMPLATE_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <type_traits>
+
+#include "decoders/common/api/common.hpp"
+#include "decoders/common/api/jsonreader.hpp"
+#include "decoders/novatel/api/common.hpp"
+#include "decoders/novatel/api/encoder.hpp"
+#include "decoders/novatel/api/message_decoder.hpp"
+
+namespace novatel::edie::oem {
+
+//============================================================================
+//! \class CommandTemplate
+//! \brief A command that has been looked up, decoded and had its headers
+//! encoded ahead of time by Commander::Compile().  Each top-level field of
+//! the command is a positional parameter slot which can be overwritten
+//! before every call to Encode().
+//
+//! Filling slots and encoding do not touch the message database or allocate
+//! memory.  A template refers to the Commander that compiled it and must not
+//! outlive it.
+//============================================================================
+class CommandTemplate
+{
+   friend class Commander;
+
+   //! NOTE: FieldContainer cannot be copied, so neither can a template.
+   CommandTemplate(const CommandTemplate&) = delete;
+   CommandTemplate& operator=(const CommandTemplate&) = delete;
+
+public:
+   //! \brief uiMAX_HEADER_LENGTH: Space reserved for each precompiled header.
+   static constexpr uint32_t uiMAX_HEADER_LENGTH = 256;
+
+private:
+   Encoder* pclMyEncoder{ nullptr };
+   MetaDataStruct stMyMetaData;
+   IntermediateMessage stMyParameters;
+
+   unsigned char aucMyAsciiHeader[uiMAX_HEADER_LENGTH]{};
+   uint32_t uiMyAsciiHeaderLength{ 0 };
+   unsigned char aucMyBinaryHeader[uiMAX_HEADER_LENGTH]{};
+   uint32_t uiMyBinaryHeaderLength{ 0 };
+
+   [[nodiscard]] STATUS GetSlot(uint32_t uiSlot_, FieldContainer** ppclSlot_);
+
+public:
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the CommandTemplate class.  The template is
+   //! empty until it is passed to Commander::Compile().
+   //----------------------------------------------------------------------------
+   CommandTemplate() = default;
+
+   CommandTemplate(CommandTemplate&&) = default;
+   CommandTemplate& operator=(CommandTemplate&&) = default;
+
+   //----------------------------------------------------------------------------
+   //! \brief Has this template been compiled?
+   //
+   //! \return true if the template can be encoded.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   IsCompiled() const
+   {
+      return pclMyEncoder != nullptr;
+   }
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the number of positional parameter slots in the command.
+   //
+   //! \return The number of top-level fields in the command definition.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] uint32_t
+   GetParameterCount() const
+   {
+      return static_cast<uint32_t>(stMyParameters.size());
+   }
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the field definition behind a parameter slot.
+   //
+   //! \param [in] uiSlot_ The zero-based position of the parameter.
+   //
+   //! \return The field definition, or nullptr if uiSlot_ is out of range.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] const BaseField*
+   GetParameterDefinition(uint32_t uiSlot_) const
+   {
+      return uiSlot_ < stMyParameters.size() ? stMyParameters[uiSlot_].field_def : nullptr;
+   }
+
+   //----------------------------------------------------------------------------
+   //! \brief Set a numeric, boolean or enum parameter.  The value is converted
+   //! to the type the slot was compiled with.  Enum slots take the numeric
+   //! value of the enumerator.
+   //
+   //! \param [in] uiSlot_ The zero-based position of the parameter.
+   //! \param [in] tValue_ The new value of the parameter.
+   //
+   //! \return An error code describing the result.
+   //!   SUCCESS: The parameter was set.
+   //!   MALFORMED_INPUT: uiSlot_ is out of range or does not hold a numeric
+   //! value.
+   //----------------------------------------------------------------------------
+   template <typename T>
+   [[nodiscard]] STATUS
+   SetParameter(uint32_t uiSlot_, T tValue_)
+   {
+      static_assert(std::is_arithmetic_v<T>, "SetParameter() requires a numeric value or a string.");
+
+      FieldContainer* pclSlot = nullptr;
+      const STATUS eStatus = GetSlot(uiSlot_, &pclSlot);
+      if (eStatus != STATUS::SUCCESS)
+      {
+         return eStatus;
+      }
+
+      return std::visit([tValue_](auto& tSlotValue) {
+         using SlotType = std::decay_t<decltype(tSlotValue)>;
+         if constexpr (std::is_arithmetic_v<SlotType>)
+         {
+            tSlotValue = static_cast<SlotType>(tValue_);
+            return STATUS::SUCCESS;
+         }
+         else
+         {
+            return STATUS::MALFORMED_INPUT;
+         }
+      }, pclSlot->field_value);
+   }
+
+   //----------------------------------------------------------------------------
+   //! \brief Set a string parameter, or an enum parameter by enumerator name.
+   //
+   //! \param [in] uiSlot_ The zero-based position of the parameter.
+   //! \param [in] pcValue_ A null-terminated string without quotes.
+   //
+   //! \return An error code describing the result.
+   //!   SUCCESS: The parameter was set.
+   //!   NULL_PROVIDED: pcValue_ is a null pointer.
+   //!   BUFFER_FULL: pcValue_ is longer than the string field allows.
+   //!   MALFORMED_INPUT: uiSlot_ is out of range, the slot is not a string or
+   //! enum, or pcValue_ does not name an enumerator.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   SetParameter(uint32_t uiSlot_, const char* pcValue_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Encode the command with the current parameter values.
+   //
+   //! \param[out] pcEncodeBuffer_ The buffer to return the encoded command to.
+   //! \param[in, out] uiEncodeBufferSize_ The length of pcEncodeBuffer_, upon
+   //! return will indicate the length of the encoded message.
+   //! \param[in] eEncodeFormat_ The format to encode the command to.
+   //
+   //! \return An error code describing the result of encoding.
+   //!   SUCCESS: The command was successfully encoded and is now contained in
+   //! pcEncodeBuffer_.
+   //!   NULL_PROVIDED: pcEncodeBuffer_ is a null pointer.
+   //!   NO_DEFINITION: The template has not been compiled.
+   //!   UNSUPPORTED: eEncodeFormat_ is not ASCII or BINARY.
+   //!   BUFFER_FULL: The command does not fit in pcEncodeBuffer_.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Encode(char* pcEncodeBuffer_, uint32_t& uiEncodeBufferSize_, ENCODEFORMAT eEncodeFormat_);
+};
+
+}
+
+#endif // NOVATEL_COMMAND_TEMPLATE_HPP
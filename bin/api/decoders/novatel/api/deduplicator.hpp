@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file deduplicator.hpp
+//! \brief Drop logs that have already been seen, such as the same log
+//! received over two ports.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef NOVATEL_DEDUPLICATOR_HPP
+#define NOVATEL_DEDUPLICATOR_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <vector>
+
+#include "decoders/common/api/common.hpp"
+#include "decoders/novatel/api/common.hpp"
+
+namespace novatel::edie::oem {
+
+//============================================================================
+//! \class Deduplicator
+//! \brief Recognize logs that have been seen recently.
+//
+//! Each log is reduced to a 64-bit fingerprint of its message ID,
+//! measurement source, GPS week and milliseconds, header sequence number and
+//! the frame CRC found by the Framer.  The fingerprints of the logs seen in
+//! the last window of GPS time are kept in a fixed size open addressing
+//! table, with a ring in arrival order to expire them, so each log costs a
+//! constant amount of work and memory does not grow.  When more logs than
+//! the capacity arrive within the window, the oldest are forgotten early.
+//! When GPS time goes back by more than the window, everything is forgotten.
+//
+//! The frame CRC covers the header, which holds the port the log was sent
+//! on, so the same log received on two ports has two frame CRCs.
+//! SetMatchAcrossPorts() hashes the message body instead.
+//============================================================================
+class Deduplicator
+{
+public:
+   //! \brief dDEFAULT_WINDOW_MILLISECONDS: how long a log is remembered by
+   //! default, in GPS milliseconds.
+   static constexpr double dDEFAULT_WINDOW_MILLISECONDS = 5000.0;
+   //! \brief uiDEFAULT_CAPACITY: the default number of logs remembered.
+   static constexpr uint32_t uiDEFAULT_CAPACITY = 4096;
+
+private:
+   struct HistoryEntry
+   {
+      uint64_t ullFingerprint;
+      double dTime;
+   };
+
+   const double dMyWindowMilliseconds;
+   const uint32_t uiMyCapacity;
+   bool bMyMatchAcrossPorts{ false };
+
+   std::vector<uint64_t> vMyTable; //!< Linear probing, 0 marks an empty bucket.
+   std::vector<HistoryEntry> vMyHistory;
+   uint32_t uiMyHistoryHead{ 0 };
+   uint32_t uiMyHistorySize{ 0 };
+   double dMyLatestTime{ 0.0 };
+
+   uint64_t ullMyUniqueCount{ 0 };
+   uint64_t ullMyDuplicateCount{ 0 };
+
+   [[nodiscard]] uint64_t Fingerprint(const IntermediateHeader& stHeader_, const MetaDataStruct& stMetaData_, const unsigned char* pucFrame_) const;
+   [[nodiscard]] bool Insert(uint64_t ullFingerprint_);
+   void Erase(uint64_t ullFingerprint_);
+   void ExpireOldest();
+
+public:
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the Deduplicator class.
+   //
+   //! \param[in] dWindowMilliseconds_ How long a log is remembered, measured
+   //! back from the latest GPS time seen.
+   //! \param[in] uiCapacity_ The most logs remembered at once.
+   //----------------------------------------------------------------------------
+   Deduplicator(double dWindowMilliseconds_ = dDEFAULT_WINDOW_MILLISECONDS, uint32_t uiCapacity_ = uiDEFAULT_CAPACITY);
+
+   //----------------------------------------------------------------------------
+   //! \brief Set whether the same log received on different ports is a
+   //! duplicate.
+   //
+   //! \param [in] bMatchAcrossPorts_ true to fingerprint the message body
+   //! rather than the frame CRC.  This costs a CRC over the body.
+   //----------------------------------------------------------------------------
+   void
+   SetMatchAcrossPorts(bool bMatchAcrossPorts_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get whether the same log received on different ports is a
+   //! duplicate.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   GetMatchAcrossPorts() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Check a framed log with a decoded header against the logs seen
+   //! recently, and remember it.
+   //
+   //! \param [in] stHeader_ The log's decoded header.
+   //! \param [in] stMetaData_ The log's meta data, from the Framer and
+   //! HeaderDecoder.
+   //! \param [in] pucFrame_ A pointer to the framed log.
+   //
+   //! \return true if the log has been seen within the window.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   IsDuplicate(const IntermediateHeader& stHeader_, const MetaDataStruct& stMetaData_, const unsigned char* pucFrame_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the number of logs that were not duplicates.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] uint64_t
+   GetUniqueCount() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the number of duplicate logs found.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] uint64_t
+   GetDuplicateCount() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Forget every log seen and zero the counters.
+   //----------------------------------------------------------------------------
+   void
+   Clear();
+};
+}
+
+#endif // NOVATEL_DEDUPLICATOR_HPP
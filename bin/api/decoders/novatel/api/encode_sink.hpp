@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file encode_sink.hpp
+//! \brief Destinations for encoded messages that are not limited to a
+//! fixed size buffer.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef NOVATEL_ENCODE_SINK_HPP
+#define NOVATEL_ENCODE_SINK_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <cstdint>
+#include <memory>
+
+#include "decoders/common/api/common.hpp"
+#include "decoders/novatel/api/common.hpp"
+#include "hw_interface/stream_interface/api/outputstreaminterface.hpp"
+
+namespace novatel::edie::oem {
+
+//============================================================================
+//! \class EncodeSink
+//! \brief Somewhere for the Encoder to write messages.
+//
+//! The Encoder reserves a contiguous block, encodes a message into it and
+//! commits the bytes it used.  If the block is too small it asks for a
+//! larger one and encodes the message again, so a message is never limited
+//! to a buffer chosen before its size is known.
+//============================================================================
+class EncodeSink
+{
+public:
+   virtual ~EncodeSink() = default;
+
+   //----------------------------------------------------------------------------
+   //! \brief Reserve a contiguous block to encode a message into.  The block
+   //! is valid until the next call to Reserve().
+   //
+   //! \param [in] uiSize_ The least number of bytes needed.
+   //! \param [out] uiReserved_ The number of bytes in the block, which may be
+   //! more than uiSize_.
+   //
+   //! \return A pointer to the block, or nullptr if the sink cannot hold
+   //! uiSize_ bytes.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] virtual unsigned char*
+   Reserve(uint32_t uiSize_, uint32_t& uiReserved_) = 0;
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the largest block Reserve() can return.  The Encoder does
+   //! not ask for more.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] virtual uint32_t
+   GetMaxSize() const
+   {
+      return UINT32_MAX;
+   }
+
+   //----------------------------------------------------------------------------
+   //! \brief Keep a message written to the start of the reserved block.
+   //
+   //! \param [in] uiSize_ The length of the message.
+   //----------------------------------------------------------------------------
+   virtual void
+   Commit(uint32_t uiSize_) = 0;
+
+   //----------------------------------------------------------------------------
+   //! \brief Copy a message that was encoded elsewhere, such as a converted
+   //! RXCONFIG log, into the sink.
+   //
+   //! \param [in, out] stMessageData_ The message to copy.  Its pointers are
+   //! moved to the copy.
+   //
+   //! \return SUCCESS, or BUFFER_FULL if the sink cannot hold the message.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Append(MessageDataStruct& stMessageData_);
+};
+
+//============================================================================
+//! \class GrowableEncodeSink
+//! \brief Hold the last message committed in a buffer that grows to fit it.
+//
+//! The buffer is kept between messages, so it only grows when a message is
+//! larger than any before it.
+//============================================================================
+class GrowableEncodeSink : public EncodeSink
+{
+public:
+   //! \brief uiDEFAULT_MAX_SIZE: the default limit on the size of a message.
+   static constexpr uint32_t uiDEFAULT_MAX_SIZE = 16 * 1024 * 1024;
+
+private:
+   const uint32_t uiMyMaxSize;
+   std::unique_ptr<unsigned char[]> pucMyBuffer;
+   uint32_t uiMyCapacity{ 0 };
+   uint32_t uiMySize{ 0 };
+
+public:
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the GrowableEncodeSink class.
+   //
+   //! \param[in] uiMaxSize_ The largest block the sink will reserve.  The
+   //! Encoder reserves at least MESSAGE_SIZE_MAX bytes for each message.
+   //----------------------------------------------------------------------------
+   GrowableEncodeSink(uint32_t uiMaxSize_ = uiDEFAULT_MAX_SIZE);
+
+   [[nodiscard]] unsigned char*
+   Reserve(uint32_t uiSize_, uint32_t& uiReserved_) override;
+
+   [[nodiscard]] uint32_t
+   GetMaxSize() const override;
+
+   void
+   Commit(uint32_t uiSize_) override;
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the last message committed.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] const unsigned char*
+   GetData() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the length of the last message committed, or 0 if a block
+   //! has been reserved since.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] uint32_t
+   GetSize() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the size the buffer has grown to.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] uint32_t
+   GetCapacity() const;
+};
+
+//============================================================================
+//! \class OutputStreamEncodeSink
+//! \brief Write each message committed to an OutputStreamInterface.
+//
+//! Messages are encoded into a GrowableEncodeSink and handed to
+//! OutputStreamInterface::WriteData() as they are committed, so the caller
+//! does not copy them out of a MessageDataStruct.  Only the message bytes
+//! are passed on, so a stream that splits its output by log writes each
+//! message to whichever file it selected last.  Select the file before each
+//! message is encoded, or write split output with the stream's own
+//! WriteData() overloads.
+//============================================================================
+class OutputStreamEncodeSink : public GrowableEncodeSink
+{
+   OutputStreamInterface* pclMyStream;
+   uint64_t ullMyBytesWritten{ 0 };
+
+public:
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the OutputStreamEncodeSink class.
+   //
+   //! \param[in] pclStream_ The stream to write messages to.
+   //! \param[in] uiMaxSize_ The largest message the sink will hold.
+   //----------------------------------------------------------------------------
+   OutputStreamEncodeSink(OutputStreamInterface* pclStream_, uint32_t uiMaxSize_ = uiDEFAULT_MAX_SIZE);
+
+   void
+   Commit(uint32_t uiSize_) override;
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the number of bytes the stream reported writing.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] uint64_t
+   GetBytesWritten() const;
+};
+}
+
+#endif // NOVATEL_ENCODE_SINK_HPP
@@ -0,0 +1,429 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file fileparser.hpp
+//! \brief FileParser class that manages parsing an input file stream.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef NOVATEL_FILEPARSER_HPP
+#define NOVATEL_FILEPARSER_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <unordered_map>
+#include "decoders/common/api/common.hpp"
+#include "decoders/novatel/api/file_index.hpp"
+#include "decoders/novatel/api/parser.hpp"
+#include "hw_interface/stream_interface/api/inputfilestream.hpp"
+#include "hw_interface/stream_interface/api/outputfilestream.hpp"
+
+namespace novatel::edie::oem {
+
+//============================================================================
+//! \class FileParser
+//! \brief Frame, decode and re-encode OEM logs from an InputFileStream.
+//============================================================================
+class FileParser
+{
+public:
+   //! \brief uiSEEK_SCAN_BYTES: SeekToTime() bisects until the log it is
+   //! looking for is within this many bytes, then scans forward.
+   static constexpr uint32_t uiSEEK_SCAN_BYTES = 65536;
+
+   //! TODO: Manage copy/move/assignment constructors better.
+   //! NOTE: The following constructors prevent this class from ever being
+   //! constructed from a copy, move or assignment.
+   FileParser(const FileParser&) = delete;
+   FileParser(const FileParser&&) = delete;
+   FileParser& operator=(const FileParser&) = delete;
+
+private:
+   std::shared_ptr<spdlog::logger> pclMyLogger;
+   LogRateLimiter clMyLogRateLimiter;
+
+   Parser clMyParser;
+   InputFileStream* pclMyInputStream;
+   StreamReadStatus stMyStreamReadStatus;
+   ReadDataStructure stMyReadData;
+   unsigned char* const pcMyStreamReadBuffer;
+
+   std::vector<FileIndexRange> vMyReadRanges;
+   size_t ullMyReadRange{ 0 };
+   uint64_t ullMyStreamPosition{ 0 };
+
+   // Components for probing the stream in SeekToTime()
+   Framer clMySeekFramer;
+   HeaderDecoder clMySeekHeaderDecoder;
+
+   [[nodiscard]] bool ReadStream();
+   template <typename MessageData> [[nodiscard]] STATUS ReadMessage(MessageData& tMessageData_, MetaDataStruct& stMetaData_);
+   void SeekToReadRange();
+   [[nodiscard]] bool FindTimedFrame(uint64_t ullPosition_, uint64_t ullTarget_, unsigned char* pucFrameBuffer_, uint64_t& ullFrameOffset_, uint64_t& ullFrameTime_);
+
+public:
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the FileParser class.
+   //
+   //! \param[in] sDbPath_ Filepath to a JSON message DB.
+   //----------------------------------------------------------------------------
+   FileParser(const std::string sDbPath_);
+
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the FileParser class.
+   //
+   //! \param[in] sDbPath_ Filepath to a JSON message DB.
+   //----------------------------------------------------------------------------
+   FileParser(const std::u32string sDbPath_);
+
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the FileParser class.
+   //
+   //! \param[in] pclJsonDb_ A pointer to a JsonReader object.  Defaults to nullptr.
+   //----------------------------------------------------------------------------
+   FileParser(JsonReader* pclJsonDb_ = nullptr);
+
+   //----------------------------------------------------------------------------
+   //! \brief A destructor for the FileParser class.
+   //----------------------------------------------------------------------------
+   ~FileParser();
+
+   //----------------------------------------------------------------------------
+   //! \brief Load a JsonReader object.
+   //
+   //! \param[in] pclJsonDb_ A pointer to a JsonReader object.
+   //----------------------------------------------------------------------------
+   void
+   LoadJsonDb(JsonReader* pclJsonDb_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the internal logger.
+   //
+   //! \return A shared_ptr to the spdlog::logger.
+   //----------------------------------------------------------------------------
+   std::shared_ptr<spdlog::logger>
+   GetLogger();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the level of detail produced by the internal components'
+   //! internal loggers
+   //
+   //! \param [in] eLevel_ The logging level to enable.
+   //! \param [in] sFileName_ The logging level to enable.
+   //----------------------------------------------------------------------------
+   void
+   EnableFramerDecoderLogging(spdlog::level::level_enum eLevel_ = spdlog::level::debug, std::string sFileName_ = "edie.log");
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the level of detail produced by the internal logger.
+   //
+   //! \param[in] eLevel_ The logging level to enable.
+   //----------------------------------------------------------------------------
+   void
+   SetLoggerLevel(spdlog::level::level_enum eLevel_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Shutdown the internal logger.
+   //----------------------------------------------------------------------------
+   void
+   ShutdownLogger();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the abbreviated ASCII response option.
+   //
+   //! \param [in] bIgnoreAbbreivatedAsciiResponses_ true to ignore abbreivated
+   //! ASCII responses.
+   //----------------------------------------------------------------------------
+   void
+   SetIgnoreAbbreviatedAsciiResponses(bool bIgnoreAbbreivatedAsciiResponses_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the abbreviated ASCII response option.
+   //
+   //! \return The current option for ignoring abbreviated ASCII responses.
+   //----------------------------------------------------------------------------
+   bool
+   GetIgnoreAbbreviatedAsciiResponses(void);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the percent of the InputFileStream that has been parsed.
+   //
+   //! \return An integer percentage.
+   //----------------------------------------------------------------------------
+   uint32_t
+   GetPercentRead();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the decompression option for RANGECMP messages.
+   //
+   //! \param [in] bDecompressRangeCmp_ true to decompress RANGECMP messages.
+   //----------------------------------------------------------------------------
+   void
+   SetDecompressRangeCmp(bool bDecompressRangeCmp_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the decompression option for RANGECMP messages.
+   //
+   //! \return The current option for decompressing RANGECMP messages.
+   //----------------------------------------------------------------------------
+   bool
+   GetDecompressRangeCmp();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the return option for unknown bytes.
+   //
+   //! \param [in] bReturnUnknownBytes_ true to return unknown bytes.
+   //----------------------------------------------------------------------------
+   void
+   SetReturnUnknownBytes(bool bReturnUnknownBytes_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the return option for unknown bytes.
+   //
+   //! \return The current option for returning unknown bytes.
+   //----------------------------------------------------------------------------
+   bool
+   GetReturnUnknownBytes();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the encode format for messages.
+   //
+   //! \param [in] eFormat_ the encode format for future messages.
+   //----------------------------------------------------------------------------
+   void
+   SetEncodeFormat(ENCODEFORMAT eFormat_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the encode format for messages.
+   //
+   //! \return The current encode format for messages.
+   //----------------------------------------------------------------------------
+   ENCODEFORMAT
+   GetEncodeFormat();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the encode formats of Read(std::vector<MessageDataStruct>&,
+   //! MetaDataStruct&).  See Parser::SetEncodeFormats().
+   //
+   //! \param [in] vFormats_ The encode formats for future messages.
+   //----------------------------------------------------------------------------
+   void
+   SetEncodeFormats(const std::vector<ENCODEFORMAT>& vFormats_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the encode formats of Read(std::vector<MessageDataStruct>&,
+   //! MetaDataStruct&).
+   //
+   //! \return The current encode formats for messages.
+   //----------------------------------------------------------------------------
+   const std::vector<ENCODEFORMAT>&
+   GetEncodeFormats() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the Filter for the FileParser.
+   //
+   //! \param [in] pclFilter_ A pointer to an OEM message Filter object.
+   //----------------------------------------------------------------------------
+   void
+   SetFilter(Filter* pclFilter_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the config for the FileParser.
+   //
+   //! \return A pointer to the FileParser's OEM message Filter object.
+   //----------------------------------------------------------------------------
+   Filter*
+   GetFilter();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the Deduplicator for the FileParser.
+   //
+   //! \param [in] pclDeduplicator_ A pointer to a Deduplicator, or nullptr to
+   //! keep duplicate logs.
+   //----------------------------------------------------------------------------
+   void
+   SetDeduplicator(Deduplicator* pclDeduplicator_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the Deduplicator for the FileParser.
+   //
+   //! \return A pointer to the FileParser's Deduplicator, if one is set.
+   //----------------------------------------------------------------------------
+   Deduplicator*
+   GetDeduplicator();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set an EncodeSink for the FileParser to encode messages into.
+   //! See Parser::SetEncodeSink().
+   //
+   //! \param [in] pclEncodeSink_ A pointer to an EncodeSink, or nullptr to
+   //! encode into the internal buffer.
+   //----------------------------------------------------------------------------
+   void
+   SetEncodeSink(EncodeSink* pclEncodeSink_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the EncodeSink for the FileParser.
+   //
+   //! \return A pointer to the FileParser's EncodeSink, if one is set.
+   //----------------------------------------------------------------------------
+   EncodeSink*
+   GetEncodeSink();
+
+   //----------------------------------------------------------------------------
+   //! \brief Enable or disable the collection of statistics by the internal
+   //! Parser.  Do not call this while another thread is inside Read().
+   //
+   //! \param [in] bEnable_ true to collect statistics.
+   //----------------------------------------------------------------------------
+   void
+   EnableStatistics(bool bEnable_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get a snapshot of the internal Parser's statistics.  This may be
+   //! called from another thread while the FileParser is reading.
+   //
+   //! \return A snapshot of the statistics collected so far.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] ParserStatistics
+   GetStatistics() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Zero the internal Parser's statistics.
+   //----------------------------------------------------------------------------
+   void
+   ResetStatistics();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the InputFileStream for the FileParser.  Compressed files
+   //! can be read through an InputCompressedFileStream.
+   //
+   //! \param [in] pclInputStream_ A pointer to the input stream.
+   //
+   //! \return A boolean describing if the operation was successful
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   SetStream(InputFileStream* pclInputStream_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Restrict the FileParser to ranges of bytes in the stream, such as
+   //! those selected by a FileIndex.  The ranges are read in order, and the
+   //! bytes outside of them are skipped.  Setting a new stream clears them.
+   //
+   //! \param [in] vRanges_ The ranges to read, in file order.  An empty vector
+   //! reads the whole stream again.
+   //
+   //! \return false if no stream has been set.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   SetReadRanges(const std::vector<FileIndexRange>& vRanges_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Move the stream to the first log at or after a GPS time, without
+   //! an index.  The file is bisected: at each probe position the stream is
+   //! re-framed until a log header with a GPS time is found.  Logs are assumed
+   //! to be written in time order, and logs without a GPS time are skipped
+   //! over.  Any read ranges are cleared.  A stream that is not random access,
+   //! such as a compressed file, is scanned from the start instead.
+   //
+   //! \param [in] uiWeek_ The GPS week to seek to.
+   //! \param [in] dSec_ The GPS seconds to seek to.
+   //
+   //! \return false if there is no stream or no log at or after the time, in
+   //! which case the FileParser is left where it was.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   SeekToTime(uint32_t uiWeek_, double dSec_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Read a log from the FileParser.
+   //
+   //! \param [out] stMessageData_ A reference to a MessageDataStruct to be
+   //! populated by the FileParser.
+   //! \param [out] stMetaData_ A reference to a MetaDataStruct to be populated
+   //! by the FileParser.
+   //
+   //! \return An error code describing the result of parsing.
+   //!   SUCCESS: A message was framed, decoded, filtered, encoded and stored
+   //! internally, pointed to by stMessageData_.
+   //!   UNKNOWN: A message could not be found and unknown bytes were returned
+   //! if requested in the ParserConfigStruct given to SetConfig().
+   //!   FILE_EMPTY: There are no more bytes to parse in the file provided.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Read a log from the FileParser and encode it into each of the
+   //! formats set by SetEncodeFormats().
+   //
+   //! \param [out] vMessageData_ Resized to one MessageDataStruct per encode
+   //! format.  See Parser::Read(std::vector<MessageDataStruct>&,
+   //! MetaDataStruct&, bool).
+   //! \param [out] stMetaData_ A reference to a MetaDataStruct to be populated
+   //! by the FileParser.
+   //
+   //! \return An error code describing the result of parsing, as in
+   //! Read(MessageDataStruct&, MetaDataStruct&).
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Read(std::vector<MessageDataStruct>& vMessageData_, MetaDataStruct& stMetaData_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Reset the InputFileStream, and flush all bytes from the internal
+   //! FileParser.  If read ranges are set, the stream is reset to the start of
+   //! the first one.
+   //
+   //! \return A boolean describing if the operation was successful.
+   //----------------------------------------------------------------------------
+   bool
+   Reset();
+
+   //----------------------------------------------------------------------------
+   //! \brief Flush all bytes from the internal Parser.
+   //
+   //! \param [in] pcBuffer_ A buffer to contain flushed bytes, if desired.
+   //! Defaults to nullptr.
+   //! \param [in] ulBufferSize_ The length of ulBufferSize_, if provided.
+   //
+   //! \return The number of bytes flushed from the internal Parser.
+   //----------------------------------------------------------------------------
+   uint32_t
+   Flush(unsigned char* pucBuffer_ = nullptr, uint32_t uiBufferSize_ = Parser::uiPARSER_INTERNAL_BUFFER_SIZE);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get a pointer to the current framed log raw data.
+   //
+   //! \return A pointer to the internal Parser's internal encode buffer.
+   //----------------------------------------------------------------------------
+   unsigned char*
+   GetInternalBuffer();
+};
+
+}
+#endif // NOVATEL_FILEPARSER_HPP
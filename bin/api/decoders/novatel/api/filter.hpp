@@ -0,0 +1,436 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file filter.hpp
+//! \brief Filter messages based on information contained in the
+//! MetaDataStruct
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef NOVATEL_FILTER_HPP
+#define NOVATEL_FILTER_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <array>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include "decoders/common/api/common.hpp"
+#include "decoders/common/api/jsonreader.hpp"
+#include "decoders/novatel/api/common.hpp"
+#include "decoders/novatel/api/header_decoder.hpp"
+#include "logger/logger.hpp"
+
+namespace novatel::edie::oem {
+
+//-----------------------------------------------------------------------
+//! \enum FIELD_COMPARISON
+//! \brief How a field value filter compares a field with its value.
+//-----------------------------------------------------------------------
+enum class FIELD_COMPARISON
+{
+   EQUAL,            //!< The field equals the value.
+   NOT_EQUAL,        //!< The field does not equal the value.
+   LESS,             //!< The field is less than the value.
+   LESS_OR_EQUAL,    //!< The field is less than or equal to the value.
+   GREATER,          //!< The field is greater than the value.
+   GREATER_OR_EQUAL  //!< The field is greater than or equal to the value.
+};
+
+//============================================================================
+//! \class Filter
+//! \brief Filter notifies the caller if a message should be accepted or
+//! rejected based on the Filter's configuration and the message's
+//! MetaData. An unconfigured filter will notify the caller to accept all
+//! messages.
+//============================================================================
+class Filter
+{
+private:
+   std::shared_ptr<spdlog::logger> pclMyLogger;
+
+   std::vector<bool (Filter::*)(const MetaDataStruct&)> vMyFilterFunctions;
+
+   // Filtering members
+   std::vector<TIME_STATUS> vMyTimeStatusFilters;
+   bool bMyInvertTimeStatusFilter;
+
+   std::vector<std::tuple<uint32_t, HEADERFORMAT, MEASUREMENT_SOURCE>> vMyMessageIdFilters;
+   bool bMyInvertMessageIdFilter;
+
+   std::vector<std::tuple<std::string, HEADERFORMAT, MEASUREMENT_SOURCE>> vMyMessageNameFilters;
+   bool bMyInvertMessageNameFilter;
+
+   uint32_t uiMyLowerWeek;
+   uint32_t uiMyLowerMSec;
+   bool bMyFilterLowerTime;
+   uint32_t uiMyUpperWeek;
+   uint32_t uiMyUpperMSec;
+   bool bMyFilterUpperTime;
+   bool bMyInvertTimeFilter;
+
+   uint32_t uiMyDecimationPeriodMS;
+   bool bMyDecimate;
+   bool bMyInvertDecimation;
+
+   bool bMyIncludeNMEA_;
+
+   //! The decimation of one message ID.
+   struct MessageDecimation
+   {
+      //! The period in milliseconds, or 0 if the message is not decimated.
+      double dPeriodMilliseconds{ 0.0 };
+      //! The GPS time in milliseconds, counted from week 0, of the last message
+      //! kept from each antenna source, or a negative number if none was kept.
+      std::array<double, static_cast<size_t>(MEASUREMENT_SOURCE::MAX)> adLastKeptMilliseconds{ -1.0, -1.0 };
+   };
+
+   //! Per-message decimation, indexed by message ID.
+   std::vector<MessageDecimation> vMyMessageDecimation;
+
+   //! A comparison of one field, resolved against one version (CRC) of a
+   //! message.
+   struct FieldValueFilter
+   {
+      //! The offset of the field, or of the count of its FIELD_ARRAY, by the
+      //! address of the body modulo 4.  Fields are aligned to their absolute
+      //! address.
+      std::array<uint32_t, 4> auiOffsets{};
+      //! The size of each FIELD_ARRAY element, or 0 for a field of the
+      //! message itself.
+      uint32_t uiElementSize{ 0 };
+      //! The offset of the field in each FIELD_ARRAY element.
+      uint32_t uiElementOffset{ 0 };
+      DATA_TYPE_NAME eDataType{ DATA_TYPE_NAME::UNKNOWN };
+      uint16_t usLength{ 0 };
+      FIELD_COMPARISON eComparison{ FIELD_COMPARISON::EQUAL };
+      double dValue{ 0.0 };
+   };
+
+   //! The field value filters of a message, by the CRC of each version.
+   struct MessageValueFilters
+   {
+      std::unordered_map<uint32_t, std::vector<FieldValueFilter>> umVersions;
+      uint32_t uiLatestCrc{ 0 };
+   };
+
+   JsonReader* pclMyMsgDb{ nullptr };
+   //! Field value filters, by message ID.
+   std::unordered_map<uint32_t, MessageValueFilters> umMyFieldValueFilters;
+
+   void PushUnique(bool (Filter::* filter)(const MetaDataStruct&));
+
+   bool FilterTime(const MetaDataStruct& stMetaData_);
+   bool FilterTimeStatus(const MetaDataStruct& stMetaData_);
+   bool FilterMessageId(const MetaDataStruct& stMetaData_);
+   bool FilterMessage(const MetaDataStruct& stMetaData_);
+   bool FilterDecimation(const MetaDataStruct& stMetaData_);
+   bool FilterMessageDecimation(const MetaDataStruct& stMetaData_);
+   bool FilterMetaData(const MetaDataStruct& stMetaData_);
+   bool FilterFieldValues(const MetaDataStruct& stMetaData_, const unsigned char* pucMessageBody_) const;
+
+   [[nodiscard]] STATUS AddFieldValueFilter(const std::string& strMsgName_, const std::string& strFieldPath_, FIELD_COMPARISON eComparison_, double dValue_, const std::string* pstrEnumerator_);
+   [[nodiscard]] static STATUS ResolveFieldValueFilter(const std::vector<BaseField*>& vMsgDefFields_, const std::string& strFieldPath_, FieldValueFilter& stFilter_, const BaseField*& pclField_);
+
+public:
+   //----------------------------------------------------------------------------
+   //! \brief Constructor for the Filter class.
+   //----------------------------------------------------------------------------
+   Filter();
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the internal logger.
+   //
+   //! \return A shared_ptr to the spdlog::logger.
+   //----------------------------------------------------------------------------
+   std::shared_ptr<spdlog::logger>
+   GetLogger();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the level of detail produced by the internal logger.
+   //
+   //! \param[in] eLevel_ The logging level to enable.
+   //----------------------------------------------------------------------------
+   void
+   SetLoggerLevel(spdlog::level::level_enum eLevel_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Shutdown the internal logger.
+   //----------------------------------------------------------------------------
+   void
+   ShutdownLogger();
+
+   //----------------------------------------------------------------------------
+   //! \brief Include messages at and above the lower time bound (inclusive).
+   //
+   //! \param [in] uiWeek_  The week lower bound.
+   //! \param [in] dSec_   The second lower bound.
+   //----------------------------------------------------------------------------
+   void
+   SetIncludeLowerTimeBound(uint32_t uiWeek_, double dSec_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Include messages at and below the upper time bound (inclusive).
+   //
+   //! \param [in] uiWeek_  The week upper bound.
+   //! \param [in] dSec_   The second upper bound.
+   //----------------------------------------------------------------------------
+   void
+   SetIncludeUpperTimeBound(uint32_t uiWeek_, double dSec_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Invert the time range/span filter.
+   //!
+   //! For example, if the lower time bound is set and invert time filter is
+   //! true, then the lower time bound acts as an upper time bound but excludes
+   //! the bound. If both the lower and upper bounds are set with invert time
+   //! filter as true, then only messages outside the timespan are kept (excludes
+   //! the bounds).
+   //
+   //! \param [in] bInvert_  True to invert the time filter.
+   //----------------------------------------------------------------------------
+   void
+   InvertTimeFilter(bool bInvert_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Include messages that match the decimation period.
+   //!
+   //! For example, keep all messages with a decimation period of 500
+   //! milliseconds.
+   //
+   //! \param [in] dPeriodSec_  Period in milliseconds.
+   //----------------------------------------------------------------------------
+   void
+   SetIncludeDecimation(double dPeriodSec_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Include one message of a message ID per decimation period.
+   //!
+   //! Each message ID has its own period, and messages of other IDs are not
+   //! decimated.  For example, keep RANGE at 1 Hz and BESTPOS at 10 Hz with
+   //! SetIncludeDecimation(43, 1.0) and SetIncludeDecimation(42, 0.1).  A
+   //! message is kept if a period has passed since the last message kept with
+   //! the same ID and antenna source, so message times need not be multiples
+   //! of the period.  A message is only counted as kept once every other
+   //! filter has kept it.  The invert decimation filter does not apply.
+   //
+   //! \param [in] uiMessageId_  The message ID.
+   //! \param [in] dPeriodSec_  The period in seconds, or 0 to stop decimating
+   //! the message ID.
+   //----------------------------------------------------------------------------
+   void
+   SetIncludeDecimation(uint32_t uiMessageId_, double dPeriodSec_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Invert the decimation filter.
+   //!
+   //! For example, if the decimation period is set to one thousand milliseconds
+   //! and invert decimation is true, then keep all messages that do not have a
+   //! period of one thousand milliseconds.
+   //
+   //! \param [in] bInvert_  True to invert the decimation filter.
+   //----------------------------------------------------------------------------
+   void
+   InvertDecimationFilter(bool bInvert_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Include messages that match the time status.
+   //
+   //! \param [in] eTimeStatus_  The time status.
+   //----------------------------------------------------------------------------
+   void
+   IncludeTimeStatus(TIME_STATUS eTimeStatus_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Include messages that match multiple time statuses.
+   //!
+   //! For example, include messages with either the "COARSE" or "FINE" status.
+   //
+   //! \param [in] eTimeStatus_  Multiple time statuses.
+   //----------------------------------------------------------------------------
+   void
+   IncludeTimeStatus(std::vector<TIME_STATUS> vTimeStatuses_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Invert the time status filter.
+   //
+   //! \param [in] bInvert_  True to invert the time status filter.
+   //----------------------------------------------------------------------------
+   void
+   InvertTimeStatusFilter(bool bInvert_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Include messages that match the message ID.
+   //
+   //! \param [in] uiId_  The message ID.
+   //! \param [in] eFormat_  The message format.
+   //! \param [in] eSource_  The antenna source.
+   //----------------------------------------------------------------------------
+   void
+   IncludeMessageId(uint32_t uiId_, HEADERFORMAT eFormat_ = HEADERFORMAT::ALL, MEASUREMENT_SOURCE eSource_= MEASUREMENT_SOURCE::PRIMARY);
+
+   //----------------------------------------------------------------------------
+   //! \brief Include messages that match multiple message IDs.
+   //
+   //! \param [in] vIds_  Vector of tuples containing: message ID, message format,
+   //! and antenna source.
+   //----------------------------------------------------------------------------
+   void
+   IncludeMessageId(std::vector<std::tuple<uint32_t, HEADERFORMAT, MEASUREMENT_SOURCE>> &vIds_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Invert the message ID filter.
+   //
+   //! \param [in] bInvert_   True to invert the message ID filter.
+   //----------------------------------------------------------------------------
+   void
+   InvertMessageIdFilter(bool bInvert_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Include messages that match the message name.
+   //
+   //! \param [in] szMsgName_  The message name.
+   //! \param [in] eFormat_  The message format.
+   //! \param [in] eSource_  The antenna source.
+   //----------------------------------------------------------------------------
+   void
+   IncludeMessageName(std::string szMsgName_, HEADERFORMAT eFormat_ = HEADERFORMAT::ALL, MEASUREMENT_SOURCE eSource_ = MEASUREMENT_SOURCE::PRIMARY);
+
+   //----------------------------------------------------------------------------
+   //! \brief Include messages that match multiple message names.
+   //
+   //! \param [in] vNames_  Vector of tuples containing: message name,
+   //! message format, and antenna source.
+   //----------------------------------------------------------------------------
+   void
+   IncludeMessageName(std::vector<std::tuple<std::string, HEADERFORMAT, MEASUREMENT_SOURCE>> &vNames_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Invert the message name filter.
+   //
+   //! \param [in] bInvert_  True to invert the message name filter.
+   //----------------------------------------------------------------------------
+   void
+   InvertMessageNameFilter(bool bInvert_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Include NMEA logs.
+   //!
+   //! Defaults to false (exclude NMEA logs).
+   //
+   //! \param [in] bIncludeNMEA_  True to keep/include NMEA logs.
+   //----------------------------------------------------------------------------
+   void
+   IncludeNMEAMessages(bool bIncludeNMEA_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Load a new database, which field value filters are resolved
+   //! against.  Field value filters resolved against the previous database are
+   //! cleared.
+   //
+   //! \param [in] pclJsonDb_  A pointer to a JsonReader object.
+   //----------------------------------------------------------------------------
+   void
+   LoadJsonDb(JsonReader* pclJsonDb_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Include messages whose field compares with a value.
+   //!
+   //! For example, only keep the RANGE messages where any observation has a
+   //! C/No above 35 with IncludeFieldValue("RANGE", "obs.cno",
+   //! FIELD_COMPARISON::GREATER, 35).  The field is looked up in every version
+   //! of the message once, when the filter is added, and read directly from the
+   //! body of each binary message, so rejected messages are never decoded.
+   //! Messages in other formats, and other messages, are not checked.  All of
+   //! the field value filters of a message must match.  They are only applied
+   //! by DoFiltering(MetaDataStruct&, const unsigned char*).
+   //
+   //! \param [in] strMsgName_  The message name, such as "BESTPOS".
+   //! \param [in] strFieldPath_  The name of a number or enum field.  A field
+   //! of each element of a FIELD_ARRAY is named "array.field", and matches if
+   //! it matches in any element.
+   //! \param [in] eComparison_  How the field is compared with the value.
+   //! \param [in] dValue_  The value to compare the field with.
+   //
+   //! \return An error code describing the result.
+   //!   SUCCESS: The filter was added.
+   //!   NO_DATABASE: No database was loaded into this filter.
+   //!   NO_DEFINITION: The message or the field is not in the database.
+   //!   UNSUPPORTED: The field is not a number or an enum, or it does not have
+   //! a fixed offset in the body, in some version of the message.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   IncludeFieldValue(const std::string& strMsgName_, const std::string& strFieldPath_, FIELD_COMPARISON eComparison_, double dValue_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Include messages whose enum field compares with an enumerator.
+   //!
+   //! For example, only keep the BESTPOS messages with a NARROW_INT solution
+   //! with IncludeFieldValue("BESTPOS", "position_type",
+   //! FIELD_COMPARISON::EQUAL, "NARROW_INT").
+   //
+   //! \param [in] strMsgName_  The message name, such as "BESTPOS".
+   //! \param [in] strFieldPath_  The name of an enum field, as above.
+   //! \param [in] eComparison_  How the field is compared with the enumerator.
+   //! \param [in] strEnumerator_  The name of the enumerator.
+   //
+   //! \return An error code describing the result, as above.  NO_DEFINITION
+   //! is also returned if the field does not have the enumerator.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   IncludeFieldValue(const std::string& strMsgName_, const std::string& strFieldPath_, FIELD_COMPARISON eComparison_, const std::string& strEnumerator_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Clear all current filter settings.
+   //----------------------------------------------------------------------------
+   void
+   ClearFilters();
+
+   //----------------------------------------------------------------------------
+   //! \brief Filter the MetaDataStruct based on the current Filter
+   //! settings.
+   //
+   //! \param [in] stMetaData_  The MetaDataStruct to filter.
+   //----------------------------------------------------------------------------
+   bool
+   DoFiltering(MetaDataStruct& stMetaData_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Filter a message based on its MetaDataStruct and the values of
+   //! its fields.
+   //
+   //! \param [in] stMetaData_  The MetaDataStruct to filter.
+   //! \param [in] pucMessageBody_  The body of the message, which starts
+   //! after its header.
+   //----------------------------------------------------------------------------
+   bool
+   DoFiltering(MetaDataStruct& stMetaData_, const unsigned char* pucMessageBody_);
+};
+}
+#endif // NOVATEL_FILTER_HPP
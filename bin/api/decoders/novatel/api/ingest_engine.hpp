@@ -0,0 +1,243 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file ingest_engine.hpp
+//! \brief Parse OEM logs from many file descriptors on one thread.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef NOVATEL_INGEST_ENGINE_HPP
+#define NOVATEL_INGEST_ENGINE_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "decoders/novatel/api/parser.hpp"
+#include "hw_interface/stream_interface/api/inputfdstream.hpp"
+
+namespace novatel::edie::oem {
+
+//============================================================================
+//! \class IngestEngine
+//! \brief Multiplex many live byte sources onto one thread with epoll.
+//
+//! Each InputFdStream added to the engine gets its own Parser, so partial
+//! frames from one source never mix with another.  Poll() waits for any of
+//! the descriptors to become readable, reads what is available from each,
+//! and delivers every log the Parsers produce to the message callback,
+//! tagged with the stream's ID.  Streams are read at most uiREAD_SIZE bytes
+//! per wakeup so a busy source cannot starve the others.
+//
+//! All methods except Stop() must be called from the thread running Poll().
+//============================================================================
+class IngestEngine
+{
+   IngestEngine(const IngestEngine&) = delete;
+   IngestEngine(const IngestEngine&&) = delete;
+   IngestEngine& operator=(const IngestEngine&) = delete;
+
+public:
+   //! \brief uiREAD_SIZE: the most bytes read from one stream per wakeup.
+   static constexpr uint32_t uiREAD_SIZE = 16384;
+   //! \brief uiINVALID_STREAM_ID: returned by AddStream() on failure.
+   static constexpr uint32_t uiINVALID_STREAM_ID = 0;
+
+   //! \brief Called for each log read from a stream, with the Parser::Read()
+   //! status and data.  The data is valid until the callback returns.
+   using MessageCallback = std::function<void(uint32_t uiStreamId_, STATUS eStatus_, MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_)>;
+   //! \brief Called once the end of a stream is reached, after its remaining
+   //! logs have been delivered.  The stream is removed from the engine.
+   using StreamClosedCallback = std::function<void(uint32_t uiStreamId_)>;
+
+private:
+   struct Stream
+   {
+      InputFdStream* pclInputStream;
+      std::unique_ptr<Parser> pclParser;
+      std::chrono::steady_clock::time_point tpLastWrite;
+      bool bIdleReadPending{ false }; //!< Bytes were written to the Parser since it was last read for being idle.
+   };
+
+   std::shared_ptr<spdlog::logger> pclMyLogger;
+
+   JsonReader clMyJsonReader;
+   JsonReader* pclMyJsonDb{ nullptr };
+
+   int32_t iMyEpollFd{ -1 };
+   int32_t iMyWakeFd{ -1 };
+   std::atomic<bool> bMyStop{ false };
+   bool bMyPolling{ false };
+
+   uint32_t uiMyNextStreamId{ 1 };
+   std::unordered_map<uint32_t, Stream> mMyStreams;
+   std::vector<Stream> vMyRetiredStreams; //!< Streams removed inside a callback, destroyed once Poll() returns.
+   std::unique_ptr<char[]> pcMyReadBuffer;
+
+   MessageCallback fnMyMessageCallback;
+   StreamClosedCallback fnMyStreamClosedCallback;
+
+   void Initialize();
+   uint32_t ReadStream(uint32_t uiStreamId_);
+   uint32_t DeliverLogs(uint32_t uiStreamId_, Parser& clParser_);
+   uint32_t DeliverIdleLogs();
+   int32_t GetIdleTimeout() const;
+
+public:
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the IngestEngine class.
+   //
+   //! \param[in] sDbPath_ Filepath to a JSON message DB.
+   //----------------------------------------------------------------------------
+   IngestEngine(const std::string sDbPath_);
+
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the IngestEngine class.
+   //
+   //! \param[in] pclJsonDb_ A pointer to a JsonReader object shared by every
+   //! stream's Parser.
+   //----------------------------------------------------------------------------
+   IngestEngine(JsonReader* pclJsonDb_);
+
+   //----------------------------------------------------------------------------
+   //! \brief A destructor for the IngestEngine class.  The streams themselves
+   //! are not closed.
+   //----------------------------------------------------------------------------
+   ~IngestEngine();
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the internal logger.
+   //
+   //! \return A shared_ptr to the spdlog::logger.
+   //----------------------------------------------------------------------------
+   std::shared_ptr<spdlog::logger>
+   GetLogger();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the level of detail produced by the internal logger.
+   //
+   //! \param[in] eLevel_ The logging level to enable.
+   //----------------------------------------------------------------------------
+   void
+   SetLoggerLevel(spdlog::level::level_enum eLevel_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the callback that receives the parsed logs.
+   //
+   //! \param[in] fnCallback_ The callback.
+   //----------------------------------------------------------------------------
+   void
+   SetMessageCallback(MessageCallback fnCallback_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the callback that is told when a stream ends.
+   //
+   //! \param[in] fnCallback_ The callback.
+   //----------------------------------------------------------------------------
+   void
+   SetStreamClosedCallback(StreamClosedCallback fnCallback_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Add a stream to the engine.
+   //
+   //! \param[in] pclInputStream_ The stream to read.  It must outlive its
+   //! membership in the engine.
+   //
+   //! \return The ID that tags the stream's logs, or uiINVALID_STREAM_ID if
+   //! the descriptor could not be watched.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] uint32_t
+   AddStream(InputFdStream* pclInputStream_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Stop reading a stream.  Logs still buffered in its Parser are
+   //! discarded.
+   //
+   //! \param[in] uiStreamId_ The ID returned by AddStream().
+   //
+   //! \return false if there is no such stream.
+   //----------------------------------------------------------------------------
+   bool
+   RemoveStream(uint32_t uiStreamId_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the Parser of a stream, to set its Filter, encode format and
+   //! other options.
+   //
+   //! \param[in] uiStreamId_ The ID returned by AddStream().
+   //
+   //! \return The stream's Parser, or nullptr if there is no such stream.
+   //----------------------------------------------------------------------------
+   Parser*
+   GetParser(uint32_t uiStreamId_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the number of streams being read.
+   //----------------------------------------------------------------------------
+   uint32_t
+   GetStreamCount() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Wait for data on any stream and deliver the resulting logs.
+   //! Then each stream that has been quiet for its Parser's abbreviated ASCII
+   //! idle time is read again, whatever the other streams did, so that logs
+   //! held for more data are released.  See
+   //! Parser::SetAbbrevAsciiCompletion().
+   //
+   //! \param[in] iTimeoutMs_ The longest time to wait, in milliseconds.  -1
+   //! waits until data arrives or Stop() is called, so pass no more than the
+   //! idle time to release held logs on time.
+   //
+   //! \return The number of logs delivered, or -1 if epoll failed.
+   //----------------------------------------------------------------------------
+   int32_t
+   Poll(int32_t iTimeoutMs_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Call Poll() until Stop() is called, or every stream has ended.
+   //! Each Poll() waits no longer than the first held log takes to become
+   //! idle.
+   //----------------------------------------------------------------------------
+   void
+   Run();
+
+   //----------------------------------------------------------------------------
+   //! \brief Make Run() return, and wake a blocked Poll().  This may be called
+   //! from any thread.
+   //----------------------------------------------------------------------------
+   void
+   Stop();
+};
+
+}
+#endif // NOVATEL_INGEST_ENGINE_HPP
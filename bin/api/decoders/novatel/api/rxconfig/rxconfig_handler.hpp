@@ -0,0 +1,242 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file rxconfig_handler.hpp
+//! \brief Class description for the RxConfigHandler.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef RXCONFIG_HANDLER_HPP
+#define RXCONFIG_HANDLER_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "decoders/common/api/common.hpp"
+#include "decoders/common/api/jsonreader.hpp"
+#include "decoders/novatel/api/common.hpp"
+#include "decoders/novatel/api/framer.hpp"
+#include "decoders/novatel/api/header_decoder.hpp"
+#include "decoders/novatel/api/message_decoder.hpp"
+#include "decoders/novatel/api/encoder.hpp"
+
+namespace novatel::edie::oem {
+
+   constexpr uint16_t usRXConfigMsgID = 128;
+   constexpr uint16_t usRXConfigUserMsgID = 2474;
+
+//============================================================================
+//! \class RxConfigHandler
+//! \brief Class to handle RXCONFIGA and RXCONFIGB messages, which are
+//! outliers with regards to OEM message protocol.  This class should have
+//! bytes containing RXCONFIG messages written to it with calls to Write()
+//! and the converted data should be retrieved with calls to Convert().
+//============================================================================
+class RxConfigHandler
+{
+   //! TODO: Manage copy/move/assignment constructors better.
+   //! NOTE: The following constructors prevent this class from ever being
+   //! constructed from a copy, move or assignment.
+   RxConfigHandler(const RxConfigHandler&) = delete;
+   RxConfigHandler(const RxConfigHandler&&) = delete;
+   RxConfigHandler& operator=(const RxConfigHandler&) = delete;
+
+private:
+   Framer clMyFramer;
+   HeaderDecoder clMyHeaderDecoder;
+   MessageDecoder clMyMessageDecoder;
+   Encoder clMyEncoder;
+
+   std::shared_ptr<spdlog::logger> pclMyLogger;
+   JsonReader* pclMyMsgDB{ nullptr };
+   EnumDefinition* vMyCommandDefns{ nullptr };
+   EnumDefinition* vMyPortAddrDefns{ nullptr };
+   EnumDefinition* vMyGPSTimeStatusDefns{ nullptr };
+   MessageDefinition stMyRXConfigMsgDef;
+
+   //! Scratch RXCONFIG message, built once against the fields of
+   //! stMyRXConfigMsgDef and decoded into in place on every conversion.
+   IntermediateMessage stMyRxConfigMessage;
+
+   uint32_t uiMyBufferBytesRemaining;
+
+   static const char* szAbbrevASCIIEmbeddedHeaderPrefix;
+   static constexpr uint32_t uiINTERNAL_BUFFER_SIZE = MESSAGE_SIZE_MAX;
+   unsigned char* const pcMyFrameBuffer;
+   unsigned char* pucMyFrameBufferPointer;
+   unsigned char* const pcMyEncodeBuffer;
+   unsigned char* pucMyEncodeBufferPointer;
+
+   // Inline buffer functions
+   [[nodiscard]] bool PrintToBuffer(char** ppcBuffer_, const char* szFormat_, ...)
+   {
+      va_list args;
+      va_start(args, szFormat_);
+      uint32_t uiBytesBuffered = vsnprintf(*ppcBuffer_, uiMyBufferBytesRemaining, szFormat_, args);
+      va_end(args);
+      if (uiMyBufferBytesRemaining < uiBytesBuffered)
+      {
+         return false;
+      }
+      *ppcBuffer_ += uiBytesBuffered;
+      uiMyBufferBytesRemaining -= uiBytesBuffered;
+      return true;
+   }
+
+   template <typename T>
+   [[nodiscard]] bool CopyToBuffer(unsigned char** ppucBuffer_, T* ptItem_, uint32_t uiItemSize_)
+   {
+      if (uiMyBufferBytesRemaining < uiItemSize_)
+      {
+         return false;
+      }
+      memcpy(*ppucBuffer_, ptItem_, uiItemSize_);
+      *ppucBuffer_ += uiItemSize_;
+      uiMyBufferBytesRemaining -= uiItemSize_;
+      return true;
+   }
+
+   bool IsRXConfigTypeMsg(uint16_t usMessageID_);
+   uint32_t MsgNameToMsgId(std::string sMsgName_);
+   std::string MsgIdToMsgName(const uint32_t uiMessageID_);
+   void CreateRXConfigMsgDefn();
+
+public:
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the RxConfigHandler class.
+   //
+   //! \param[in] pclJsonDb_ A pointer to a JsonReader object. Defaults to nullptr.
+   //----------------------------------------------------------------------------
+   RxConfigHandler(JsonReader* pclJsonDb_ = nullptr);
+
+   //----------------------------------------------------------------------------
+   //! \brief A destructor for the RxConfigHandler class.
+   //----------------------------------------------------------------------------
+   ~RxConfigHandler();
+
+   //----------------------------------------------------------------------------
+   //! \brief Load a JsonReader object.
+   //
+   //! \param[in] pclJsonDb_ A pointer to a JsonReader object.
+   //----------------------------------------------------------------------------
+   void
+   LoadJsonDb(JsonReader* pclJsonDb_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the internal logger.
+   //
+   //! \return A shared_ptr to the spdlog::logger.
+   //----------------------------------------------------------------------------
+   std::shared_ptr<spdlog::logger>
+   GetLogger();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the level of detail produced by the internal logger.
+   //
+   //! \param[in] eLevel_  The logging level to enable.
+   //----------------------------------------------------------------------------
+   void
+   SetLoggerLevel(spdlog::level::level_enum eLevel_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Shutdown the internal logger.
+   //----------------------------------------------------------------------------
+   void
+   ShutdownLogger();
+
+   //----------------------------------------------------------------------------
+   //! \brief Write bytes to the RxConfigHandler to be converted.
+   //
+   //! \param [in] pucData_ Buffer containing data to be written.
+   //! \param [in] uiDataSize_ Size of data to be written.
+   //
+   //! \return The number of bytes successfully written to the RxConfigHandler.
+   //----------------------------------------------------------------------------
+   uint32_t
+   Write(unsigned char* pucData_, uint32_t uiDataSize_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Read and convert an RXCONFIG message from the handler.
+   //
+   //! \param [out] stRxConfigMessageData_ A reference to a MessageDataStruct to be
+   //! populated by the handler, referring to the RXCONFIG message.
+   //! \param [out] stRxConfigMetaData_ A reference to a MetaDataStruct to be populated
+   //! by the handler, referring to the RXCONFIG message.
+   //! \param [out] stEmbeddedMessageData_ A reference to a MessageDataStruct to be
+   //! populated by the handler, referring to the embedded message in RXCONFIG.
+   //! \param [out] stEmbeddedMetaData_ A reference to a MetaDataStruct to be populated
+   //! by the handler, referring to the embedded message in RXCONFIG.
+   //! \param[in] eEncodeFormat_ An enum describing the format to encode the message to.
+   //
+   //! \return An error code describing the result of decoding and converting.
+   //! See novatel::edie::oem::STATUS.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Convert(MessageDataStruct& stRxConfigMessageData_, MetaDataStruct& stRxConfigMetaData_, MessageDataStruct& stEmbeddedMessageData_, MetaDataStruct& stEmbeddedMetaData_, ENCODEFORMAT eEncodeFormat_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Convert an RXCONFIG message that has already been framed.
+   //! This bypasses the internal Framer entirely, so no bytes need to be
+   //! written to the handler beforehand.  The decoded message is held in
+   //! storage owned by the handler and reused between calls.
+   //
+   //! \param [in] pucFrame_ Buffer containing one complete RXCONFIG frame, as
+   //! returned by Framer::GetFrame().  Abbreviated ASCII frames are modified in
+   //! place while the embedded header is decoded.
+   //! \param [out] stRxConfigMessageData_ A reference to a MessageDataStruct to be
+   //! populated by the handler, referring to the RXCONFIG message.
+   //! \param [in,out] stRxConfigMetaData_ A reference to the MetaDataStruct
+   //! produced when pucFrame_ was framed.  It is completed by the handler.
+   //! \param [out] stEmbeddedMessageData_ A reference to a MessageDataStruct to be
+   //! populated by the handler, referring to the embedded message in RXCONFIG.
+   //! \param [out] stEmbeddedMetaData_ A reference to a MetaDataStruct to be populated
+   //! by the handler, referring to the embedded message in RXCONFIG.
+   //! \param[in] eEncodeFormat_ An enum describing the format to encode the message to.
+   //
+   //! \return An error code describing the result of decoding and converting.
+   //! See novatel::edie::oem::STATUS.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Convert(unsigned char* pucFrame_, MessageDataStruct& stRxConfigMessageData_, MetaDataStruct& stRxConfigMetaData_, MessageDataStruct& stEmbeddedMessageData_, MetaDataStruct& stEmbeddedMetaData_, ENCODEFORMAT eEncodeFormat_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Flush all bytes from the internal Framer.
+   //
+   //! \param [in] pucBuffer_ A buffer to contain flushed bytes, if desired.
+   //! Defaults to NULL.
+   //! \param [in] uiBufferSize_ The length of ulBufferSize_, if provided.
+   //! Defaults to the size of the internal buffer (64kB).
+   //
+   //! \return The number of bytes flushed from the internal Framer.
+   //----------------------------------------------------------------------------
+   uint32_t
+   Flush(unsigned char* pucBuffer_ = nullptr, uint32_t uiBufferSize_ = uiINTERNAL_BUFFER_SIZE);
+};
+
+}
+
+#endif // EXTENSION_RXCONFIG_HANDLER_HPP
@@ -0,0 +1,476 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/*! \file multioutputfilestream.hpp
+ *  \brief
+ *  Created to satisfy the need of maintaining multiple output files at a time. It will mainly be used for file split functionalities.
+ *  It also provides an API called SelectFileStream to select the active file stream based on passed filename key.
+ */
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef MULTIOUTPUTFILESTREAM_HPP
+#define MULTIOUTPUTFILESTREAM_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "outputstreaminterface.hpp"
+#include "asyncfilewriter.hpp"
+#include "compressedfilewriter.hpp"
+#include "filestream.hpp"
+#include "decoders/common/api/common.hpp"
+#include "decoders/common/api/nexcept.h"
+#include "decoders/novatel/api/common.hpp"
+#include <list>
+#include <string>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+/*! \def MIN_TIME_SPLIT_SEC
+ *  \brief Minimum split time in seconds.
+ *
+ */
+#define MIN_TIME_SPLIT_SEC    36
+
+/*! \def MIN_FILE_SPLIT_SIZE
+ *  \brief Minimum splitting size of file in mb.
+ *
+ */
+#define MIN_FILE_SPLIT_SIZE    1
+
+/*! \def HR_TO_SEC
+ *  \brief Number of seconds in a Hour.
+ *
+ */
+#define HR_TO_SEC    3600
+
+/*! \def MBYTE_TO_BYTE
+ *  \brief Number of bytes in one mega byte?.
+ *
+ */
+#define MBYTE_TO_BYTE    1024*1024
+
+/*! \class MultiOutputFileStream
+ *  \brief A class will provide API's to writing decoded output into multiple out files.
+ *
+ *  Derived from parent OutputStreamInterface class.
+ */
+class MultiOutputFileStream : public OutputStreamInterface
+{
+public:
+    /*! A Constructor
+	 *  \brief  Default class constructor.
+	 *
+	 *  \remark All private members default to 0.
+	 */
+   MultiOutputFileStream() = default;
+
+    /*! A virtual Destructor
+	 *  \brief  Class destructor.
+	 *
+	 *  \remark Will delete dynamically created objects in constructor
+	 */
+   virtual ~MultiOutputFileStream();
+
+   /*! \fn void SelectFileStream(std::wstring stFileName)
+    *  \brief Sets the output file in which to be decoded ouput will be written.
+    *  \param [in] stFileName - Name of the File to be created.
+    *  \sa FileStream
+    *  \remark FileStream Object will be created and added to map.
+    *  If already created, The file with name stFileName will be set for writing.
+    */
+   void SelectFileStream(std::u32string s32FileName_);
+
+   /*! \fn void ClearWCFileStreamMap()
+    *  \brief Delete all the output files assosiated Wide Character FileStream objects.
+    *  \remark Clears the map in which all the output file stream objects will be saved.
+    */
+
+   void ClearWCFileStreamMap();
+
+   /*! \fn void ConfigureBaseFileName(std::wstring stFileName)
+    *  \brief Gets base file name with wide characters and extension of it.
+    *  \param [in] stFileName - Name of the File.
+    *  \remark Sets Base file name (before '.' in file name)
+    *          Sets Extension of the file.
+    */
+   void ConfigureBaseFileName(std::u32string s32FileName_);
+
+
+   /*! \fn void SelectWCLogFile(std::string strMsgName_)
+    *  \brief Sets the output file name  from the log name from strMsgName_.
+    *  \param [in] std::string strMsgName_
+    *  \remark Sets output file name like "basename_logname".
+    */
+   void SelectWCLogFile(std::string strMsgName_);
+
+   /*! \fn void SelectWCSizeFile(uint32_t uiSize_)
+    *  \brief Sets the output file name(with Wide Characters) included with the split size
+    *  \param [in] uint32_t uiSize_
+    *  \remark Example: output files could be basename_part<1/2/3...etc>
+    */
+   void SelectWCSizeFile(uint32_t uiSize_);
+
+   /*! \fn void SelectWCTimeFile(TIME_STATUS eStatus_, uint16_t usWeek_, double dMilliseconds_)
+    *  \brief Sets the number of output files can be created based the time provided
+    *  \param [in] TIME_STATUS eStatus_
+    *  \param [in] uint16_t usWeek_
+    *  \param [in] double dMilliseconds_
+    *  \remark Example: output files could be basename_part<1/2/3...etc>
+    */
+   void SelectWCTimeFile(novatel::edie::TIME_STATUS eStatus_, uint16_t usWeek_, double dMilliseconds_);
+
+   /*! \fn uint32_t WriteData(char* pcData_, uint32_t uiDataLength_, std::string strMsgName_, uint32_t uiSize_, novatel::edie::oem::TIME_STATUS eStatus_, uint16_t usWeek_, DOUBLE dMilliseconds_)
+    *  \param [in] char* pcData_
+    *  \param [in] uint32_t uiDataLength_
+    *  \param [in] std::string strMsgName_
+    *  \param [in] uint32_t uiSize_
+    *  \param [in] novatel::edie::oem::TIME_STATUS eStatus_
+    *  \param [in] uint16_t usWeek_
+    *  \param [in] double dMilliseconds_
+    *  \return Number of bytes written to output file.
+    *  \remark Set Split type and write data to output files. If split type was not set,
+    *  Then writing can be done to only one file.
+    */
+   uint32_t WriteData(
+      char* pcData_,
+      uint32_t uiDataLength_,
+      std::string strMsgName_,
+      uint32_t uiSize_,
+      novatel::edie::TIME_STATUS eStatus_,
+      uint16_t usWeek_,
+      double dMilliseconds_);
+
+   /*! \fn uint32_t WriteData(char* pcData_, uint32_t uiDataLength_, uint32_t uiMessageId_, const std::string& strMsgName_, uint32_t uiSize_, novatel::edie::TIME_STATUS eStatus_, uint16_t usWeek_, double dMilliseconds_)
+    *  \brief As the WriteData above, but when splitting by log the output file
+    *  is looked up by message ID.  The file name is only built the first time
+    *  an ID is seen.
+    *  \param [in] char* pcData_
+    *  \param [in] uint32_t uiDataLength_
+    *  \param [in] uint32_t uiMessageId_ The log's message ID.  Logs with the
+    *  same ID must have the same strMsgName_.
+    *  \param [in] std::string strMsgName_
+    *  \param [in] uint32_t uiSize_
+    *  \param [in] novatel::edie::TIME_STATUS eStatus_
+    *  \param [in] uint16_t usWeek_
+    *  \param [in] double dMilliseconds_
+    *  \return Number of bytes written to output file.
+    */
+   uint32_t WriteData(
+      char* pcData_,
+      uint32_t uiDataLength_,
+      uint32_t uiMessageId_,
+      const std::string& strMsgName_,
+      uint32_t uiSize_,
+      novatel::edie::TIME_STATUS eStatus_,
+      uint16_t usWeek_,
+      double dMilliseconds_);
+
+   /*! \fn uint32_t WriteData(CHAR *pcFrameBuf_, uint32_t uiLength)
+    *  \brief Write Buffer to outputfile.
+    *  \param [in] *pcFrameBuf_ pointer to buffer to be written to output file
+    *  \param [in] uiLength Length of the buffer to be written to output file
+    *  \return Number of bytes written to output file.
+    *  \remark Set Split type and write data to output files. If split type was not set,
+    *  Then writing can be done to only one file.
+    */
+   uint32_t WriteData(char* pcData_, uint32_t uiDataLength_);
+
+   /*! \fn void SelectFileStream(std::string stFileName)
+    *  \brief Sets the output file in which to be decoded ouput will be written.
+    *  \param [in] stFileName - Name of the File to be created.
+    *  \sa FileStream
+    *  \remark FileStream Object will be created and added to map.
+    *  If already created, The file with name stFileName will be set for writing.
+    */
+   void SelectFileStream(std::string stFileName);
+
+   /*! \fn void ConfigureBaseFileName(std::string stFileName)
+    *  \brief Gets base file name and extension of it.
+    *  \param [in] stFileName - Name of the File.
+    *  \remark Sets Base file name (before '.' in file name)
+    *          Sets Extension of the file.
+    */
+   void ConfigureBaseFileName(std::string stFileName);
+
+   /*! \fn void ClearFileStreamMap()
+    *  \brief Delete all the output files assosiated FileStream objects.
+    *  \remark Clears the map in which all the output file stream objects will be saved.
+    */
+   void ClearFileStreamMap();
+
+   /*! \fn void ConfigureSplitByLog(bool)
+    *  \brief Enalbe/Diable Splitting of logs into different output files.
+    *  \param [in] bStatus
+    *  \remark Enable/Disable log Splitting. If enable, split type will be set to SPLIT_LOG
+    *  If disabled split type will be set to SPLIT_NONE
+    */
+   void ConfigureSplitByLog(bool bStatus);
+
+   /*! \fn void SelectLogFile(std::string strMsgName_)
+    *  \brief Sets the output file name  from the log name from strMsgName_.
+    *  \param [in] std::string strMsgName_
+    *  \remark Sets output file name like "basename_logname".
+    */
+   void SelectLogFile(std::string strMsgName_);
+
+   /*! \fn void ConfigureSplitBySize(uint64_t )
+    *  \brief Split file into different output file with defined size.
+    *  \param [in] ullFileSplitSize
+    *  \remark Output files with ullFileSplitSize size will be created while writing to the output.
+    */
+   void ConfigureSplitBySize(uint64_t  ullFileSplitSize);
+
+   /*! \fn void SelectSizeFile(uint32_t uiSize_)
+    *  \brief Sets the output file name included with the split size
+    *  \param [in] uint32_t uiSize_
+    *  \remark Example: output files could be basename_part<1/2/3...etc>
+    */
+   void SelectSizeFile(uint32_t uiSize_);
+
+   /*! \fn void ConfigureSplitByTime(double dFileSplitTime)
+    *  \brief Sets the interval of time the file to be splitted.
+    *  \param [in] dFileSplitTime
+    *  \remark Diffrent output files will be created with the logs,
+    *  in which will be captured in the tiem interval provided.
+    */
+   void ConfigureSplitByTime(double dFileSplitTime);
+
+
+   /*! \fn void SelectTimeFile(TIME_STATUS eStatus_, uint16_t usWeek_, double dMilliseconds_)
+    *  \brief Sets the number of output files can be created based the time provided
+    *  \param [in] TIME_STATUS eStatus_
+    *  \param [in] uint16_t usWeek_
+    *  \param [in] double dMilliseconds_
+    *  \remark Example: output files could be basename_part<1/2/3...etc>
+    */
+   void SelectTimeFile(novatel::edie::TIME_STATUS eStatus_, uint16_t usWeek_, double dMilliseconds_);
+
+   /*! \fn void ConfigureCompression(COMPRESSION eCompression_, int32_t iLevel_)
+    *  \brief Compress the output files on a background thread.
+    *  \param [in] eCompression_ The compression, or COMPRESSION::NONE for raw output.
+    *  \param [in] iLevel_ The compression level, or -1 for the format's default.
+    *  \remark Files already open are closed.  Files opened afterwards get ".gz"
+    *  or ".zst" appended to their names.  Each one is finished as a complete
+    *  compressed stream when the output is split to a new file or this object is
+    *  destroyed.  Split sizes count the bytes before compression.
+    *  If eCompression_ is not built in, exception "compression not supported"
+    *  will be thrown.
+    */
+   void ConfigureCompression(COMPRESSION eCompression_, int32_t iLevel_ = -1);
+
+   /*! \fn void ConfigureAsyncWrite(bool bEnable_, uint64_t ullMaxQueuedBytes_)
+    *  \brief Write the output files on a background thread, so that WriteData
+    *  does not wait for the disk.
+    *  \param [in] bEnable_ true to write in the background, false to write
+    *  each message before WriteData returns.
+    *  \param [in] ullMaxQueuedBytes_ Bytes that can be queued before WriteData waits.
+    *  \remark Files already open are closed.  Compressed output is always
+    *  written by the compression thread, so this only applies without compression.
+    *  \sa AsyncFileWriter
+    */
+   void ConfigureAsyncWrite(bool bEnable_, uint64_t ullMaxQueuedBytes_ = AsyncFileWriter::ullDEFAULT_MAX_QUEUED_BYTES);
+
+   /*! \fn void Flush()
+    *  \brief Wait until everything written so far has reached the output files.
+    *  With ConfigureAsyncWrite the files are also synced to disk.
+    */
+   void Flush();
+
+   /*! \fn void ConfigureMaxOpenFiles(uint32_t uiMaxOpenFiles_)
+    *  \brief Limit the number of output files held open at once.
+    *  \param [in] uiMaxOpenFiles_ The maximum number of open files, or 0 for no limit.
+    *  \remark When a file has to be opened beyond the limit, the least recently
+    *  written one is closed.  It is reopened in append mode the next time it
+    *  is written to.  Compressed files keep their compressor state while closed.
+    *  Setting the limit back to 0 reopens every closed file.
+    */
+   void ConfigureMaxOpenFiles(uint32_t uiMaxOpenFiles_);
+
+   /*! \fn std::map<std::string, FileStream*> GetFileMap()
+    *  \brief Gets the output file map
+    *  \return Map with filename and FileStream Struct as key-value pair
+    *  \sa FileStream
+    */
+   std::map<std::string, FileStream*> GetFileMap() { return mMyFstreamMap;}
+
+   /*! \fn std::map<std::u32string, FileStream*> GetFileMap()
+    *  \brief Gets the output file map
+    *  \return Map with filename and FileStream Struct as key-value pair
+    *  \sa FileStream
+    */
+   std::map<std::u32string, FileStream*> Get32FileMap() { return wmMyFstreamMap;}
+
+   /*! \fn void SetExtensionName(std::string
+    *  \brief Sets the extension name of the output file
+    *  \param [in] strExt std::string - Output file name
+    */
+   void SetExtensionName(std::string strExt) { stMyExtentionName = strExt; umMyLogFiles.clear(); }
+   void SetExtensionName(std::u32string strExt) { s32MyExtentionName = strExt; umMyLogFiles.clear(); }
+
+   /*! Frind class to test private methods. */
+   friend class MultiOutputFileStreamTest;
+
+private:
+	/*! Private Copy Constructor
+	 *
+	 *  A copy constructor is a member function which initializes an object using another object of the same class.
+	 */
+   MultiOutputFileStream(const MultiOutputFileStream& clTemp);
+
+	/*! Private assignment operator
+	 *
+	 *  The copy assignment operator is called whenever selected by overload resolution,
+	 *  e.g. when an object appears on the left side of an assignment expression.
+	 */
+   const MultiOutputFileStream& operator= (const MultiOutputFileStream& clTemp);
+
+   /*! \fn void CloseFileStream(FileStream* pclFileStream_)
+    *  \brief Close and delete an output file, finishing its compressed
+    *  stream first if compression is configured.
+    */
+   void CloseFileStream(FileStream* pclFileStream_);
+
+   /*! \fn void KeepFileStreamOpen(FileStream* pclFileStream_)
+    *  \brief Mark an output file as the most recently used one, reopening it
+    *  if it was closed to stay within uiMyMaxOpenFiles.  The least recently
+    *  used files are closed to make room.
+    */
+   void KeepFileStreamOpen(FileStream* pclFileStream_);
+
+   /*! \fn void EvictLeastRecent()
+    *  \brief Close the least recently used open output file, or suspend it
+    *  if a background writer owns it.
+    */
+   void EvictLeastRecent();
+
+   /*! Maximum number of open output files, 0 for no limit */
+   uint32_t uiMyMaxOpenFiles{ 0 };
+
+   /*! Open output files, most recently used first, if uiMyMaxOpenFiles is set */
+   std::list<FileStream*> lMyOpenFiles;
+
+   /*! Position of each open output file in lMyOpenFiles */
+   std::unordered_map<FileStream*, std::list<FileStream*>::iterator> umMyOpenFiles;
+
+   /*! Output file of each message ID, when splitting by log */
+   std::unordered_map<uint32_t, FileStream*> umMyLogFiles;
+
+   /*! Compression applied to files opened from now on */
+   COMPRESSION eMyCompression{ COMPRESSION::NONE };
+
+   /*! Compresses and writes the output files, if compression is configured */
+   std::unique_ptr<CompressedFileWriter> pMyCompressedFileWriter;
+
+   /*! Writes the uncompressed output files, if asynchronous writes are configured */
+   std::unique_ptr<AsyncFileWriter> pMyAsyncFileWriter;
+
+   /*! FileStream class object pointer
+    * \sa FileStream
+    */
+   FileStream* pLocalFileStream{ nullptr };
+
+   /*! \var eMyFileSplitMethodEnum.
+    * \sa FileSplitMethodEnum
+    *
+    * An enumaration variable
+    */
+   FileSplitMethodEnum eMyFileSplitMethodEnum{ SPLIT_NONE };
+
+   /*! \var bMyFileSplit
+    *  \remark Values can be true or false.
+    *
+    *  Boolean variable to enable/disable split mechanism.
+    */
+   bool bMyFileSplit{ false };
+
+   /*! \var uiMyFileCount
+    *
+    * Number of output files created.
+    */
+   uint32_t uiMyFileCount{ 0 };
+
+   /*! \var dMyTimeSplitSize
+    *
+    *  Time interval to be used for splitting of file.
+    */
+   double dMyTimeSplitSize{ 0.0 };
+
+   /*! \var dMyTimeInSeconds
+    *
+    * Time interval to be used for calculating start/end time of logs to be written to output.
+    */
+   double dMyTimeInSeconds{ 0.0 };
+
+   /*! \var dMyStartTimeInSeconds
+    *
+    * Start time of the Logs to be written to the output.
+    */
+   double dMyStartTimeInSeconds{ 0.0 };
+
+   /*! \var dMyStartTimeInSeconds
+    *
+    * Start GPS Week of the Logs to be written to the output.
+    */
+   uint32_t ulMyStartWeek{ 0UL };
+
+   /*! \var dMyStartTimeInSeconds
+    *
+    * Start GPS Week of the Logs to be written to the output.
+    */
+   uint32_t ulMyWeek{ 0UL };
+
+   /*! Wide Character Base name of the output file */
+   std::u32string s32MyBaseName{ U"DefaultBase" };
+   /*! Wide Character extension name of the output file */
+   std::u32string s32MyExtentionName{ U"DefaultExt" };
+
+   /*! std::map to save output file name with wide charater and associated FileStream class object. */
+   typedef std::map<std::u32string, FileStream* > WCFstreamMap;
+   /*! Wide Character file Map variable */
+   WCFstreamMap wmMyFstreamMap;
+   /*! Enable or Disable Wide Character support of file names.*/
+#ifdef WIDE_CHAR_SUPPORT
+   bool bEnableWideCharSupport{ true };
+#else
+   bool bEnableWideCharSupport{ false };
+#endif
+   /*! Base name of the output file */
+   std::string stMyBaseName{ "DefaultBase" };
+   /*! Extension name of the output file */
+   std::string stMyExtentionName{ "DefaultExt" };
+   /*! std::map to save output file name and associated FileStream class object. */
+   typedef std::map<std::string, FileStream*> FstreamMap;
+   /*! Map variable */
+   FstreamMap mMyFstreamMap;
+   /*! The splitted output file size */
+   uint64_t  ullMyFileSplitSize{ 0ULL };
+   /*! Total File size */
+   uint64_t  ullMyFileSize{ 0ULL };
+};
+
+#endif
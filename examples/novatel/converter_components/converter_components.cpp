@@ -206,7 +206,7 @@ int main(int argc, char* argv[])
             if(eDecoderStatus == STATUS::SUCCESS)
             {
                // Filter the log, pass over this log if we don't want it.
-               if(!clFilter.DoFiltering(stMetaData))
+               if(!clFilter.DoFiltering(stMetaData, pucFrameBuffer + stMetaData.uiHeaderLength))
                {
                   continue;
                }
@@ -35,18 +35,29 @@
 #ifndef LOGGER_H
 #define LOGGER_H
 
-// Set the default logging level for SPDLOG_XXX macros
+// Set the default logging level for SPDLOG_XXX macros.  Calls below this level
+// are compiled out, so release builds drop SPDLOG_LOGGER_DEBUG/TRACE entirely.
+#ifndef SPDLOG_ACTIVE_LEVEL
+#ifdef NDEBUG
+#define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
+#else
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_DEBUG
+#endif
+#endif
 
 //-----------------------------------------------------------------------
 // Includes
 //-----------------------------------------------------------------------
 #include "spdlog/spdlog.h"
+#include "spdlog/async.h"
 #include "spdlog/sinks/rotating_file_sink.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
 #include "spdlog_setup/conf.h"
+#include <chrono>
 #include <iostream>
 #include <map>
+#include <string>
+#include <unordered_map>
 
 
 // Typically, we would create a static instance of the Logger,
@@ -63,6 +74,34 @@ private:
 
    inline static std::map<std::string, std::shared_ptr<spdlog::sinks::rotating_file_sink_mt> > mRotatingFiles;
 
+   // Asynchronous logging settings, see EnableAsyncLogging()
+   inline static bool bMyAsync = false;
+   inline static size_t ullMyAsyncQueueSize = 8192;
+   inline static size_t ullMyAsyncThreadCount = 1;
+   inline static spdlog::async_overflow_policy eMyAsyncOverflowPolicy = spdlog::async_overflow_policy::overrun_oldest;
+
+   /*! \brief Create a synchronous or asynchronous logger over the given sinks.
+    *
+    *  Must be called with mLoggerMutex held.  The spdlog thread pool is
+    *  (re)created on demand, since spdlog::shutdown() releases it.
+    */
+   template <typename It>
+   static std::shared_ptr<spdlog::logger> CreateLogger(std::string sLoggerName_, It itBegin_, It itEnd_)
+   {
+      if (!bMyAsync)
+      {
+         return std::make_shared<spdlog::logger>(sLoggerName_, itBegin_, itEnd_);
+      }
+
+      std::shared_ptr<spdlog::details::thread_pool> pclThreadPool = spdlog::thread_pool();
+      if (!pclThreadPool)
+      {
+         spdlog::init_thread_pool(ullMyAsyncQueueSize, ullMyAsyncThreadCount);
+         pclThreadPool = spdlog::thread_pool();
+      }
+      return std::make_shared<spdlog::async_logger>(sLoggerName_, itBegin_, itEnd_, pclThreadPool, eMyAsyncOverflowPolicy);
+   }
+
 public:
 
    /*! \brief Construct a new default Logger object.
@@ -79,12 +118,13 @@ public:
          pclMyRootLogger = spdlog::get("root");
          if (!pclMyRootLogger)
          {
-            pclMyRootLogger = std::make_shared<spdlog::logger>("root");
+            std::vector<spdlog::sink_ptr> vNoSinks;
+            pclMyRootLogger = CreateLogger("root", vNoSinks.begin(), vNoSinks.end());
             pclMyRootLogger->set_level(spdlog::level::info);
             spdlog::register_logger(pclMyRootLogger);
 
             spdlog::set_default_logger(pclMyRootLogger);
-            pclMyRootLogger->flush_on(spdlog::level::debug);
+            pclMyRootLogger->flush_on(spdlog::level::warn);
             pclMyRootLogger->debug("Default Logger intialized");
          }
       }
@@ -127,7 +167,7 @@ public:
             pclMyRootLogger = spdlog::get("root");
 
             spdlog::set_default_logger(pclMyRootLogger);
-            pclMyRootLogger->flush_on(spdlog::level::debug);
+            pclMyRootLogger->flush_on(spdlog::level::warn);
             pclMyRootLogger->debug("Logger intialized from file: {}", sLoggerConfigPath_);
          }
       }
@@ -155,6 +195,34 @@ public:
       spdlog::shutdown();
    }
 
+   /*! \brief Log through spdlog's thread pool rather than on the calling thread.
+    *
+    *  Loggers created after this call format and write their messages on a
+    *  background thread, so a decode loop only pays for queueing a message.
+    *  Call this before constructing any EDIE component so that the root
+    *  logger and every component logger are created asynchronous.
+    *
+    *  \param [in] ullQueueSize_  Number of messages the queue can hold.
+    *  \param [in] ullThreadCount_  Number of background logging threads.
+    *  \param [in] bBlockWhenFull_  Block the caller when the queue is full
+    *  instead of discarding the oldest queued message.
+    */
+   static void EnableAsyncLogging(size_t ullQueueSize_ = 8192, size_t ullThreadCount_ = 1, bool bBlockWhenFull_ = false)
+   {
+      std::lock_guard<std::mutex> lock(mLoggerMutex);
+      bMyAsync = true;
+      ullMyAsyncQueueSize = ullQueueSize_;
+      ullMyAsyncThreadCount = ullThreadCount_;
+      eMyAsyncOverflowPolicy = bBlockWhenFull_ ? spdlog::async_overflow_policy::block : spdlog::async_overflow_policy::overrun_oldest;
+   }
+
+   /*! \brief Is asynchronous logging enabled?
+    */
+   static bool IsAsyncLogging()
+   {
+      return bMyAsync;
+   }
+
    /*! \brief Change the global spdlog logging level
     */
    static void SetLoggingLevel(spdlog::level::level_enum eLevel_)
@@ -178,7 +246,7 @@ public:
          {
             // Get the root logger sinks
             std::vector<spdlog::sink_ptr> vRootSinks = pclMyRootLogger->sinks();
-            pclLogger = std::make_shared<spdlog::logger>(sLoggerName_, begin(vRootSinks), end(vRootSinks));
+            pclLogger = CreateLogger(sLoggerName_, begin(vRootSinks), end(vRootSinks));
             // Inherit the root logger level by default
             pclLogger->set_level(pclMyRootLogger->level());
             spdlog::register_logger(pclLogger);
@@ -231,4 +299,104 @@ public:
    }
 };
 
+//============================================================================
+//! \class LogRateLimiter
+//! \brief Suppress repeated diagnostics from a component.
+//
+//! Diagnostics are identified by a component, a status and a message ID.
+//! Within each interval only the first uiBurst_ diagnostics with the same
+//! identity are let through; the rest are counted and the count is handed
+//! back with the next diagnostic that is let through.  Not thread-safe, in
+//! keeping with the components that own it.
+//============================================================================
+class LogRateLimiter
+{
+public:
+   //! \brief uiMAX_ENTRIES: Distinct diagnostics tracked before the history is reset.
+   static constexpr uint32_t uiMAX_ENTRIES = 4096;
+
+   /*! \brief Construct a new LogRateLimiter object.
+    *
+    *  \param [in] clInterval_  Length of each rate limiting window.
+    *  \param [in] uiBurst_  Diagnostics of one identity allowed per window.
+    */
+   LogRateLimiter(std::chrono::steady_clock::duration clInterval_ = std::chrono::seconds(1), uint32_t uiBurst_ = 1) :
+      clMyInterval(clInterval_), uiMyBurst(uiBurst_)
+   {
+   }
+
+   /*! \brief Should a diagnostic be logged now?
+    *
+    *  \param [in] uiComponent_  Identifies the part of the owner reporting
+    *  the status, for owners with several stages, or 0.
+    *  \param [in] uiStatus_  The status being reported.
+    *  \param [in] uiMessageId_  The message ID the status relates to, or 0.
+    *  \param [out] ullSuppressed_  Number of identical diagnostics suppressed
+    *  since the last one that was let through.
+    *  \return true if the diagnostic should be logged.
+    */
+   bool ShouldLog(uint32_t uiComponent_, uint32_t uiStatus_, uint32_t uiMessageId_, uint64_t& ullSuppressed_)
+   {
+      const uint64_t ullKey = (static_cast<uint64_t>(uiComponent_ & 0xFFFF) << 48) | (static_cast<uint64_t>(uiStatus_ & 0xFFFF) << 32) | uiMessageId_;
+      const std::chrono::steady_clock::time_point clNow = std::chrono::steady_clock::now();
+
+      auto itEntry = mMyEntries.find(ullKey);
+      if (itEntry == mMyEntries.end())
+      {
+         if (mMyEntries.size() >= uiMAX_ENTRIES)
+         {
+            mMyEntries.clear();
+         }
+         itEntry = mMyEntries.emplace(ullKey, Entry{ clNow, 0, 0 }).first;
+      }
+
+      Entry& stEntry = itEntry->second;
+      if (clNow - stEntry.clWindowStart >= clMyInterval)
+      {
+         stEntry.clWindowStart = clNow;
+         stEntry.uiCount = 0;
+      }
+
+      if (stEntry.uiCount < uiMyBurst)
+      {
+         stEntry.uiCount++;
+         ullSuppressed_ = stEntry.ullSuppressed;
+         stEntry.ullSuppressed = 0;
+         return true;
+      }
+
+      stEntry.ullSuppressed++;
+      return false;
+   }
+
+   /*! \brief Describe a suppressed count for the end of a diagnostic.
+    *
+    *  \param [in] ullSuppressed_  The count returned by ShouldLog().
+    *  \return " (N repeats suppressed)", or an empty string if none were.
+    */
+   static std::string Suppressed(uint64_t ullSuppressed_)
+   {
+      return ullSuppressed_ == 0 ? std::string() : " (" + std::to_string(ullSuppressed_) + " repeats suppressed)";
+   }
+
+   /*! \brief Forget every diagnostic seen so far.
+    */
+   void Reset()
+   {
+      mMyEntries.clear();
+   }
+
+private:
+   struct Entry
+   {
+      std::chrono::steady_clock::time_point clWindowStart;
+      uint32_t uiCount;
+      uint64_t ullSuppressed;
+   };
+
+   std::chrono::steady_clock::duration clMyInterval;
+   uint32_t uiMyBurst;
+   std::unordered_map<uint64_t, Entry> mMyEntries;
+};
+
 #endif // LOGGER_H
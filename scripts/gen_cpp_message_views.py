@@ -0,0 +1,334 @@
+import os
+import re
+import sys
+import json
+import argparse
+import warnings
+
+from gen_flat_cpp_structs import NOVATEL_TO_CTYPES, RESERVED_CPP_NAMES
+
+TAB_CHAR = ' ' * 3
+
+CTYPE_SIZES = {
+    'bool': 1, 'char': 1, 'unsigned char': 1, 'int8_t': 1, 'uint8_t': 1, 'int16_t': 2, 'uint16_t': 2,
+    'int32_t': 4, 'uint32_t': 4, 'int64_t': 8, 'uint64_t': 8, 'float': 4, 'double': 8, 'long double': 16
+}
+
+# Types to store a value in when the C++ type from NOVATEL_TO_CTYPES is a different size, such as the 4 byte BOOL.
+SIZED_CTYPES = {1: 'uint8_t', 2: 'uint16_t', 4: 'uint32_t', 8: 'uint64_t'}
+SIZED_FLOAT_CTYPES = {4: 'float', 8: 'double'}
+
+CPP_KEYWORDS = {
+    'alignas', 'alignof', 'and', 'asm', 'auto', 'bool', 'break', 'case', 'catch', 'char', 'class', 'const', 'constexpr',
+    'continue', 'default', 'delete', 'do', 'double', 'else', 'enum', 'explicit', 'export', 'extern', 'false', 'float',
+    'for', 'friend', 'goto', 'if', 'inline', 'int', 'long', 'mutable', 'namespace', 'new', 'not', 'or', 'private',
+    'protected', 'public', 'register', 'return', 'short', 'signed', 'sizeof', 'static', 'struct', 'template', 'this',
+    'throw', 'true', 'try', 'typedef', 'typename', 'union', 'unsigned', 'using', 'virtual', 'void', 'volatile', 'while',
+    'xor'
+}
+
+# Field types whose size does not depend on the message contents.
+FIXED_TYPES = {'SIMPLE', 'ENUM', 'FIXED_LENGTH_ARRAY'}
+
+
+class UnsupportedField(Exception):
+    pass
+
+
+def cpp_name(name: str, used: set) -> str:
+    """Turn a field name into a unique C++ identifier."""
+    name = RESERVED_CPP_NAMES.get(name, name)
+    name = re.sub(r'\W', '_', name)
+    if not name or name[0].isdigit():
+        name = f'f_{name}'
+    if name in CPP_KEYWORDS:
+        name = f'{name}_'
+    unique_name, count = name, 2
+    while unique_name in used:
+        unique_name = f'{name}_{count}'
+        count += 1
+    used.add(unique_name)
+    return unique_name
+
+
+def ctype(field: dict) -> str:
+    """The C++ type that holds one value of the field, the same size as the database says it is."""
+    if field['type'] == 'ENUM':
+        return 'int32_t'
+    data_type = field['dataType']
+    length = data_type['length']
+    mapped = NOVATEL_TO_CTYPES.get(data_type['name'])
+    if mapped is not None and CTYPE_SIZES.get(mapped) == length:
+        return mapped
+    if mapped in ('float', 'double', 'long double') and length in SIZED_FLOAT_CTYPES:
+        return SIZED_FLOAT_CTYPES[length]
+    if length in SIZED_CTYPES:
+        return SIZED_CTYPES[length]
+    raise UnsupportedField(f'{field["name"]} has data type {data_type["name"]} of length {length}')
+
+
+def align(offset: int, length: int) -> int:
+    """Same as AlignBinaryOffset() in message_view.hpp."""
+    alignment = 4 if length >= 4 else max(length, 1)
+    return offset if offset % alignment == 0 else offset + alignment - offset % alignment
+
+
+def loader_field_size(fields: list) -> int:
+    """The element size JsonReader uses for a FIELD_ARRAY's fieldSize, which the flattened encoding is padded to."""
+    size = 0
+    for field in fields:
+        if field['type'] in ('SIMPLE', 'ENUM'):
+            size += field['dataType']['length']
+        elif field['type'] in ('FIXED_LENGTH_ARRAY', 'VARIABLE_LENGTH_ARRAY', 'STRING'):
+            size += field['dataType']['length'] * field['arrayLength']
+    return size
+
+
+class MessageGenerator:
+    """Generates the flattened structs and views for one message definition (CRC)."""
+
+    def __init__(self, msg: dict, crc: str):
+        self.msg = msg
+        self.crc = crc
+        self.type_name = f'{msg["name"]}_{crc}'
+        self.code = []
+
+    def generate(self) -> str:
+        fields = self.msg['fields'][self.crc]
+        structs = self.gen_struct(self.type_name, fields)
+        if structs is not None:
+            self.code.extend(structs[0])
+        else:
+            self.code.append(f'// {self.type_name} has no flattened struct, as its flattened encoding has no fixed layout.\n\n')
+        self.gen_view(self.type_name, fields, top_level=True)
+        return ''.join(self.code)
+
+    def gen_struct(self, struct_name: str, fields: list):
+        """The code of the packed structs matching the FLATTENED_BINARY encoding, with the structs of any field
+        array elements first, and the size of the struct.  None if the encoding does not have a fixed layout."""
+        if not fields:
+            return None
+        structs, members, asserts, used = [], [], [], set()
+        offset = 0
+        for field in fields:
+            name = cpp_name(field['name'], used)
+            field_type = field['type']
+            start = align(offset, field['dataType']['length'])
+            if start != offset:
+                members.append(f'uint8_t padding{offset}[{start - offset}]')
+            offset = start
+
+            if field_type in ('SIMPLE', 'ENUM'):
+                members.append(f'{ctype(field)} {name}')
+                offset += field['dataType']['length']
+            elif field_type == 'FIXED_LENGTH_ARRAY':
+                if not field['arrayLength']:
+                    return None
+                members.append(f'{ctype(field)} {name}[{field["arrayLength"]}]')
+                offset += field['dataType']['length'] * field['arrayLength']
+            elif field_type == 'STRING':
+                if not field['arrayLength']:
+                    return None
+                members.append(f'char {name}[{field["dataType"]["length"] * field["arrayLength"]}]')
+                offset += field['dataType']['length'] * field['arrayLength']
+            elif field_type == 'VARIABLE_LENGTH_ARRAY':
+                if not field['arrayLength']:
+                    return None
+                members.append(f'uint32_t {name}_arraylength')
+                asserts.append((f'{name}_arraylength', offset))
+                offset += 4
+                members.append(f'{ctype(field)} {name}[{field["arrayLength"]}]')
+                offset += field['dataType']['length'] * field['arrayLength']
+                asserts.append((name, offset - field['dataType']['length'] * field['arrayLength']))
+                continue
+            elif field_type == 'FIELD_ARRAY':
+                element_name = f'{struct_name}_{name}'
+                element = self.gen_struct(element_name, field['fields'])
+                if element is None:
+                    return None
+                element_code, element_size = element
+                # The encoder pads the elements to fieldSize, so the elements only have a fixed
+                # layout if they fill it exactly, and every element starts on a 4 byte boundary.
+                if (not field['arrayLength'] or element_size % 4 != 0
+                        or element_size != loader_field_size(field['fields'])):
+                    return None
+                structs.extend(element_code)
+                members.append(f'uint32_t {name}_arraylength')
+                asserts.append((f'{name}_arraylength', offset))
+                offset += 4
+                members.append(f'{element_name} {name}[{field["arrayLength"]}]')
+                asserts.append((name, offset))
+                offset += element_size * field['arrayLength']
+                continue
+            else:
+                raise UnsupportedField(f'{field["name"]} has field type {field_type}')
+            asserts.append((name, start))
+
+        code = f'struct {struct_name}\n{{\n'
+        code += ''.join(f'{TAB_CHAR}{member};\n' for member in members)
+        code += '};\n'
+        code += ''.join(f'static_assert(offsetof({struct_name}, {member}) == {member_offset}, '
+                        f'"{struct_name}::{member} does not match the message definition");\n'
+                        for member, member_offset in asserts)
+        code += f'static_assert(sizeof({struct_name}) == {offset}, "{struct_name} does not match the message definition");\n\n'
+        structs.append(code)
+        return structs, offset
+
+    def gen_view(self, type_name: str, fields: list, top_level: bool):
+        """Emit the view over the binary encoding of the fields, and the views of its field arrays first."""
+        view_name = f'{type_name}View'
+        used = set()
+        names = [cpp_name(field['name'], used) for field in fields]
+        element_views = {}
+        for field, name in zip(fields, names):
+            if field['type'] == 'FIELD_ARRAY':
+                element_views[name] = self.gen_view(f'{type_name}_{name}', field['fields'], top_level=False)
+            elif field['type'] not in FIXED_TYPES | {'STRING', 'VARIABLE_LENGTH_ARRAY'}:
+                raise UnsupportedField(f'{field["name"]} has field type {field["type"]}')
+
+        # Work out the offset of every field whose offset does not depend on the contents.  A message body
+        # starts on a 4 byte boundary, as do the elements of a field array whose fields are all fixed as long
+        # as each element is a multiple of 4 bytes long.  Any other element can start anywhere.
+        fixed_size = all(field['type'] in FIXED_TYPES for field in fields)
+        constant_offsets = []
+        offset = 0
+        for field in fields:
+            offset = align(offset, field['dataType']['length'])
+            constant_offsets.append(offset)
+            if field['type'] not in FIXED_TYPES:
+                break
+            offset += field['dataType']['length'] * (field['arrayLength'] if field['type'] == 'FIXED_LENGTH_ARRAY' else 1)
+        if not top_level and fixed_size and offset % 4 != 0:
+            fixed_size = False
+        if not top_level and not fixed_size:
+            constant_offsets = []
+        dynamic_count = len(fields) - len(constant_offsets)
+
+        def offset_expr(index: int) -> str:
+            if index < len(constant_offsets):
+                return f'uiMyOffset + {constant_offsets[index]}' if constant_offsets[index] else 'uiMyOffset'
+            return f'auiMyOffsets[{index - len(constant_offsets)}]'
+
+        def end_expr(index: int) -> str:
+            field, name, start = fields[index], names[index], offset_expr(index)
+            length = field['dataType']['length']
+            if field['type'] in ('SIMPLE', 'ENUM'):
+                return f'{start} + {length}'
+            if field['type'] == 'FIXED_LENGTH_ARRAY':
+                return f'{start} + {length * field["arrayLength"]}'
+            if field['type'] == 'VARIABLE_LENGTH_ARRAY':
+                return f'{start} + 4 + ReadBinaryValue<uint32_t>(pucMyBody + {start}) * {length}'
+            if field['type'] == 'STRING':
+                return f'BinaryStringEnd(pucMyBody, {start})'
+            return f'{name}().End()'
+
+        code = f'class {view_name}\n{{\n public:\n'
+        if top_level:
+            code += f'{TAB_CHAR}static constexpr uint32_t uiMESSAGE_ID = {self.msg["messageID"]};\n'
+            code += f'{TAB_CHAR}static constexpr uint32_t uiMESSAGE_CRC = {self.crc};\n'
+            code += f'{TAB_CHAR}static constexpr const char* szMESSAGE_NAME = "{self.msg["name"]}";\n'
+        code += f'{TAB_CHAR}static constexpr bool bFIXED_SIZE = {"true" if fixed_size else "false"};\n\n'
+
+        code += f'{TAB_CHAR}//! pucBody_ is the start of the message body, and uiOffset_ is where these fields start in it.\n'
+        code += f'{TAB_CHAR}{"explicit " if top_level else ""}{view_name}(const unsigned char* pucBody_, uint32_t uiOffset_{" = 0" if top_level else ""})\n'
+        code += f'{TAB_CHAR}{TAB_CHAR}: pucMyBody(pucBody_), uiMyOffset(uiOffset_)\n{TAB_CHAR}{{\n'
+        for index in range(len(constant_offsets), len(fields)):
+            previous_end = end_expr(index - 1) if index > 0 else 'uiMyOffset'
+            code += f'{TAB_CHAR}{TAB_CHAR}{offset_expr(index)} = AlignBinaryOffset({previous_end}, {fields[index]["dataType"]["length"]});\n'
+        code += f'{TAB_CHAR}}}\n\n'
+
+        for index, (field, name) in enumerate(zip(fields, names)):
+            start = offset_expr(index)
+            field_type = field['type']
+            if field_type in ('SIMPLE', 'ENUM'):
+                value_type = ctype(field)
+                code += f'{TAB_CHAR}[[nodiscard]] {value_type} {name}() const {{ return ReadBinaryValue<{value_type}>(pucMyBody + {start}); }}\n'
+            elif field_type == 'FIXED_LENGTH_ARRAY':
+                value_type = ctype(field)
+                code += (f'{TAB_CHAR}[[nodiscard]] BinaryArrayView<{value_type}> {name}() const '
+                         f'{{ return {{ pucMyBody + {start}, {field["arrayLength"]} }}; }}\n')
+            elif field_type == 'VARIABLE_LENGTH_ARRAY':
+                value_type = ctype(field)
+                code += (f'{TAB_CHAR}[[nodiscard]] BinaryArrayView<{value_type}> {name}() const\n{TAB_CHAR}{{\n'
+                         f'{TAB_CHAR}{TAB_CHAR}return {{ pucMyBody + {start} + 4, ReadBinaryValue<uint32_t>(pucMyBody + {start}) }};\n'
+                         f'{TAB_CHAR}}}\n')
+            elif field_type == 'STRING':
+                code += (f'{TAB_CHAR}[[nodiscard]] std::string_view {name}() const '
+                         f'{{ return reinterpret_cast<const char*>(pucMyBody + {start}); }}\n')
+            else:
+                element_view = element_views[name]
+                code += (f'{TAB_CHAR}[[nodiscard]] BinaryFieldArrayView<{element_view}> {name}() const\n{TAB_CHAR}{{\n'
+                         f'{TAB_CHAR}{TAB_CHAR}return {{ pucMyBody, {start} + 4, ReadBinaryValue<uint32_t>(pucMyBody + {start}) }};\n'
+                         f'{TAB_CHAR}}}\n')
+
+        code += f'\n{TAB_CHAR}//! Offset of the end of these fields.  For a message this is the length of its body, without the CRC.\n'
+        code += f'{TAB_CHAR}[[nodiscard]] uint32_t End() const {{ return {end_expr(len(fields) - 1) if fields else "uiMyOffset"}; }}\n\n'
+        code += f' private:\n{TAB_CHAR}const unsigned char* pucMyBody;\n{TAB_CHAR}uint32_t uiMyOffset;\n'
+        if dynamic_count:
+            code += f'{TAB_CHAR}uint32_t auiMyOffsets[{dynamic_count}];\n'
+        code += '};\n\n'
+        self.code.append(code)
+        return view_name
+
+
+def gen_message_views(msg_database: dict, out_file: str = 'novatel_message_views.hpp', messages: list = None,
+                      latest_only: bool = False):
+    body = ''
+    for msg in msg_database['messages']:
+        if messages and msg['name'] not in messages:
+            continue
+        crcs = [msg['latestMsgDefCrc']] if latest_only else sorted(msg['fields'], key=int)
+        for crc in crcs:
+            try:
+                body += f'//{"-" * 71}\n// {msg["name"]}, message ID {msg["messageID"]}, definition CRC {crc}\n//{"-" * 71}\n'
+                body += MessageGenerator(msg, crc).generate()
+            except UnsupportedField as error:
+                warnings.warn(f'Skipping {msg["name"]} CRC {crc}: {error}')
+                body += f'// Not generated: {error}\n\n'
+        if msg['latestMsgDefCrc'] in crcs:
+            latest = f'{msg["name"]}_{msg["latestMsgDefCrc"]}'
+            if f'struct {latest}\n' in body:
+                body += f'using {msg["name"]} = {latest};\n'
+            if f'class {latest}View\n' in body:
+                body += f'using {msg["name"]}View = {latest}View;\n\n'
+
+    os.makedirs(os.path.dirname(os.path.abspath(out_file)), exist_ok=True)
+    with open(out_file, 'w') as fp:
+        fp.write('// Generated by scripts/gen_cpp_message_views.py.  Do not edit.\n\n')
+        fp.write('#ifndef NOVATEL_MESSAGE_VIEWS_HPP\n#define NOVATEL_MESSAGE_VIEWS_HPP\n\n')
+        fp.write('#ifdef PASSTHROUGH\n   #undef PASSTHROUGH // Fix name collision in wingdi.h (included by spdlog)\n#endif\n\n')
+        fp.write('#include <cstddef>\n#include <cstdint>\n#include <string_view>\n\n')
+        fp.write('#include "decoders/novatel/api/message_view.hpp"\n\n')
+        fp.write('namespace novatel::edie::oem::messages {\n\n')
+        fp.write('#pragma pack(push, 1)\n\n')
+        fp.write(body)
+        fp.write('#pragma pack(pop)\n\n')
+        fp.write('} // namespace novatel::edie::oem::messages\n\n')
+        fp.write('#endif // NOVATEL_MESSAGE_VIEWS_HPP\n')
+
+
+def is_valid_file(parser, arg):
+    if not os.path.exists(arg):
+        parser.error(f'The file {arg} does not exist!')
+    else:
+        return open(arg, 'r')
+
+
+def parse_args():
+    p = argparse.ArgumentParser()
+    p.add_argument('json_db', help='Path to the NovAtel JSON database', type=lambda x: is_valid_file(p, x))
+    p.add_argument('-o', '--out_file', help='Output header file name. Defaults to "novatel_message_views.hpp"',
+                   default='novatel_message_views.hpp')
+    p.add_argument('-m', '--messages', nargs='*', default=None,
+                   help='Names of the messages to generate. Default is every message in the database')
+    p.add_argument('-l', '--latest-only', action='store_true', default=False,
+                   help='Only generate the latest definition (CRC) of each message')
+    return p.parse_args()
+
+
+if __name__ == '__main__':
+    args = parse_args()
+    msg_defs = json.load(args.json_db)
+    gen_message_views(msg_defs, out_file=args.out_file, messages=args.messages, latest_only=args.latest_only)
+    print(f'{args.out_file} generated')
+    sys.exit()
@@ -0,0 +1,514 @@
+import os
+import sys
+import json
+import argparse
+import warnings
+
+from gen_cpp_message_views import CTYPE_SIZES, UnsupportedField, align, loader_field_size
+
+TAB_CHAR = ' ' * 3
+
+# The types MessageDecoder::DecodeBinaryField() and Encoder::FieldToBinary() use for each data type.
+DATA_TYPE_CTYPES = {
+    'BOOL': 'bool', 'HEXBYTE': 'uint8_t', 'UCHAR': 'uint8_t', 'CHAR': 'int8_t', 'USHORT': 'uint16_t', 'SHORT': 'int16_t',
+    'UINT': 'uint32_t', 'ULONG': 'uint32_t', 'INT': 'int32_t', 'LONG': 'int32_t', 'ULONGLONG': 'uint64_t',
+    'LONGLONG': 'int64_t', 'FLOAT': 'float', 'DOUBLE': 'double'
+}
+
+
+def stripped_conversion(conversion: str) -> str:
+    """Same as BaseField::parseConversion(), which strips the widths and precision from a conversion string."""
+    stripped, i = '', 0
+    conversion = conversion or ''
+    while i < len(conversion):
+        if conversion[i:i + 2] == '0x' and conversion[i:] != '0x':
+            i += 2
+            continue
+        if conversion[i].isalpha() or conversion[i] == '%':
+            stripped += conversion[i]
+        i += 1
+    return stripped
+
+
+def decode_ctype(field: dict) -> str:
+    """The type MessageDecoder::DecodeBinaryField() decodes a value of the field to."""
+    conversion = stripped_conversion(field.get('conversionString'))
+    if conversion in ('%m', '%T', '%id'):
+        return 'uint32_t'
+    if conversion in ('%XB', '%P', '%Z'):
+        return 'uint8_t'
+    if conversion == '%k':
+        return 'float'
+    if conversion == '%lk':
+        return 'double'
+    return DATA_TYPE_CTYPES.get(field['dataType']['name'])
+
+
+def encode_ctype(field: dict) -> str:
+    """The type Encoder::FieldToBinary() expects a value of the field to hold."""
+    conversion = stripped_conversion(field.get('conversionString'))
+    data_type = field['dataType']
+    if conversion in ('%m', '%T', '%id'):
+        return 'uint32_t'
+    if conversion in ('%UB', '%P', '%XB'):
+        return 'uint8_t'
+    if conversion == '%B':
+        return 'int8_t'
+    if conversion == '%k':
+        return 'float'
+    if conversion == '%lk':
+        return 'double'
+    if conversion == '%c':
+        if data_type['length'] == 1:
+            return 'uint8_t'
+        return 'uint32_t' if data_type['length'] == 4 and data_type['name'] == 'ULONG' else None
+    return DATA_TYPE_CTYPES.get(data_type['name'])
+
+
+def value_ctype(field: dict) -> str:
+    """The type of the field's values, if it is decoded and encoded the same way and fills the field."""
+    length = field['dataType']['length']
+    if field['type'] == 'ENUM':
+        if length != 4:
+            raise UnsupportedField(f'{field["name"]} is an enum of length {length}')
+        return 'int32_t'
+    value_type = decode_ctype(field)
+    if value_type is None or value_type != encode_ctype(field):
+        raise UnsupportedField(f'{field["name"]} is not decoded and encoded as the same type')
+    # A BOOL is decoded from its first byte and encoded as 4 bytes.
+    if (length != 4) if value_type == 'bool' else (CTYPE_SIZES[value_type] != length):
+        raise UnsupportedField(f'{field["name"]} is {length} bytes long, not the size of {value_type}')
+    return value_type
+
+
+def prepare_fields(fields: list, in_element: bool = False) -> list:
+    """Describe the fields for the code generator, or raise UnsupportedField if their layout is not fixed."""
+    prepared = []
+    for field in fields:
+        field_type = field['type']
+        stField = {'kind': field_type, 'name': field['name'], 'length': field['dataType']['length']}
+        if field_type in ('SIMPLE', 'ENUM'):
+            stField['ctype'] = value_ctype(field)
+        elif field_type in ('FIXED_LENGTH_ARRAY', 'VARIABLE_LENGTH_ARRAY'):
+            if not field['arrayLength'] or (in_element and field_type == 'VARIABLE_LENGTH_ARRAY'):
+                raise UnsupportedField(f'{field["name"]} does not have a fixed size')
+            stField['ctype'] = value_ctype(field)
+            stField['count'] = field['arrayLength']
+        elif field_type == 'FIELD_ARRAY' and not in_element:
+            stField['elements'] = prepare_fields(field['fields'], in_element=True)
+            offset = 0
+            for stElementField in stField['elements']:
+                offset = align(offset, stElementField['length'])
+                stElementField['offset'] = offset
+                offset += stElementField['length'] * stElementField.get('count', 1)
+            # Every element must start on a 4 byte boundary for its fields to be at fixed offsets.
+            if offset % 4 != 0:
+                raise UnsupportedField(f'the elements of {field["name"]} are not a multiple of 4 bytes long')
+            stField['element_size'] = offset
+            stField['field_size'] = (field['arrayLength'] or 0) * loader_field_size(field['fields'])
+        elif field_type == 'STRING' and not in_element:
+            # A string ends wherever its null is, so only the fields after it move.
+            if not field['arrayLength']:
+                raise UnsupportedField(f'{field["name"]} does not have a maximum length')
+            stField['count'] = field['arrayLength']
+        else:
+            raise UnsupportedField(f'{field["name"]} has field type {field_type}')
+        prepared.append(stField)
+    return prepared
+
+
+def read_expr(ctype: str, pointer: str) -> str:
+    if ctype == 'bool':
+        return f'ReadBinaryValue<uint8_t>({pointer}) != 0'
+    return f'ReadBinaryValue<{ctype}>({pointer})'
+
+
+def write_stmt(ctype: str, pointer: str, value: str) -> str:
+    if ctype == 'bool':
+        return f'WriteBinaryValue<int32_t>({pointer}, static_cast<int32_t>({value}));'
+    return f'WriteBinaryValue<{ctype}>({pointer}, {value});'
+
+
+class CodeWriter:
+    def __init__(self):
+        self.lines = []
+        self.depth = 0
+
+    def line(self, text: str = ''):
+        self.lines.append(f'{TAB_CHAR * self.depth}{text}' if text else '')
+
+    def open(self, text: str = ''):
+        if text:
+            self.line(text)
+        self.line('{')
+        self.depth += 1
+
+    def close(self, text: str = '}'):
+        self.depth -= 1
+        self.line(text)
+
+    def code(self) -> str:
+        return '\n'.join(self.lines) + '\n'
+
+
+def gen_decoder(out: CodeWriter, function_name: str, fields: list):
+    out.open(f'inline STATUS {function_name}(MsgFieldsVector& vMsgDefFields_, const unsigned char* pucBody_, uint32_t uiBodyLength_, '
+             f'IntermediateMessage& stIntermediateMessage_)')
+    out.open(f'if (vMsgDefFields_.size() != {len(fields)} || reinterpret_cast<uintptr_t>(pucBody_) % 4 != 0)')
+    out.line('return STATUS::UNSUPPORTED;')
+    out.close()
+
+    # Check the whole message is in the body before decoding any of it.
+    out.line()
+    out.line('uint64_t ullEnd = 0;')
+    for stField in fields:
+        kind, length = stField['kind'], stField['length']
+        if kind in ('SIMPLE', 'ENUM'):
+            out.line(f'ullEnd = AlignBinaryOffset(static_cast<uint32_t>(ullEnd), {length}) + {length};')
+        elif kind == 'FIXED_LENGTH_ARRAY':
+            out.line(f'ullEnd = AlignBinaryOffset(static_cast<uint32_t>(ullEnd), {length}) + {length * stField["count"]};')
+        elif kind == 'STRING':
+            # The null and the padding after it to a multiple of 4 bytes.
+            if length > 1:
+                out.line(f'ullEnd = AlignBinaryOffset(static_cast<uint32_t>(ullEnd), {length});')
+            out.open('if (ullEnd >= uiBodyLength_)')
+            out.line('return STATUS::UNSUPPORTED;')
+            out.close()
+            out.open()
+            out.line("const void* pvNull = memchr(pucBody_ + ullEnd, '\\0', uiBodyLength_ - ullEnd);")
+            out.open('if (!pvNull)')
+            out.line('return STATUS::UNSUPPORTED;')
+            out.close()
+            out.line('ullEnd = AlignBinaryOffset(static_cast<uint32_t>(static_cast<const unsigned char*>(pvNull) - pucBody_) + 1, 4);')
+            out.close()
+        else:
+            element_size = length if kind == 'VARIABLE_LENGTH_ARRAY' else stField['element_size']
+            out.line(f'ullEnd = AlignBinaryOffset(static_cast<uint32_t>(ullEnd), {length}) + 4;')
+            out.open('if (ullEnd > uiBodyLength_)')
+            out.line('return STATUS::UNSUPPORTED;')
+            out.close()
+            out.line(f'ullEnd += static_cast<uint64_t>(ReadBinaryValue<uint32_t>(pucBody_ + ullEnd - 4)) * {element_size};')
+    out.open('if (ullEnd > uiBodyLength_)')
+    out.line('return STATUS::UNSUPPORTED;')
+    out.close()
+
+    out.line()
+    out.line(f'stIntermediateMessage_.reserve(stIntermediateMessage_.size() + {len(fields)});')
+    out.line('uint32_t uiOffset = 0;')
+    for index, stField in enumerate(fields):
+        kind, length = stField['kind'], stField['length']
+        field_def = f'vMsgDefFields_[{index}]'
+        out.line(f'// {stField["name"]}')
+        if length > 1:
+            out.line(f'uiOffset = AlignBinaryOffset(uiOffset, {length});')
+        if kind in ('SIMPLE', 'ENUM'):
+            out.line(f'stIntermediateMessage_.emplace_back({read_expr(stField["ctype"], "pucBody_ + uiOffset")}, {field_def});')
+            out.line(f'uiOffset += {length};')
+            continue
+        if kind == 'STRING':
+            out.open()
+            out.line(f'const auto& strValue = std::get<std::string>(stIntermediateMessage_.emplace_back('
+                     f'std::string(reinterpret_cast<const char*>(pucBody_ + uiOffset)), {field_def}).field_value);')
+            out.line('uiOffset = AlignBinaryOffset(uiOffset + static_cast<uint32_t>(strValue.size()) + 1, 4);')
+            out.close()
+            continue
+
+        out.open()
+        if kind == 'FIXED_LENGTH_ARRAY':
+            out.line(f'const uint32_t uiCount = {stField["count"]};')
+        else:
+            out.line('const uint32_t uiCount = ReadBinaryValue<uint32_t>(pucBody_ + uiOffset);')
+            out.line('uiOffset += 4;')
+        out.line(f'auto& vArray = std::get<std::vector<FieldContainer>>(stIntermediateMessage_.emplace_back(std::vector<FieldContainer>(), {field_def}).field_value);')
+        out.line('vArray.reserve(uiCount);')
+        if kind != 'FIELD_ARRAY':
+            out.open(f'for (uint32_t i = 0; i < uiCount; i++, uiOffset += {length})')
+            out.line(f'vArray.emplace_back({read_expr(stField["ctype"], "pucBody_ + uiOffset")}, {field_def});')
+            out.close()
+        else:
+            elements = stField['elements']
+            out.line(f'const auto& vSubFields = static_cast<const FieldArrayField*>({field_def})->fields;')
+            out.open(f'if (vSubFields.size() != {len(elements)})')
+            out.line('return STATUS::UNSUPPORTED;')
+            out.close()
+            out.open(f'for (uint32_t i = 0; i < uiCount; i++, uiOffset += {stField["element_size"]})')
+            out.line('const unsigned char* pucElement = pucBody_ + uiOffset;')
+            out.line(f'auto& vElement = std::get<std::vector<FieldContainer>>(vArray.emplace_back(std::vector<FieldContainer>(), {field_def}).field_value);')
+            out.line(f'vElement.reserve({len(elements)});')
+            for sub_index, stElementField in enumerate(elements):
+                sub_def = f'vSubFields[{sub_index}]'
+                pointer = f'pucElement + {stElementField["offset"]}'
+                if stElementField['kind'] in ('SIMPLE', 'ENUM'):
+                    out.line(f'vElement.emplace_back({read_expr(stElementField["ctype"], pointer)}, {sub_def});')
+                    continue
+                out.open()
+                out.line(f'auto& vSubArray = std::get<std::vector<FieldContainer>>(vElement.emplace_back(std::vector<FieldContainer>(), {sub_def}).field_value);')
+                out.line(f'vSubArray.reserve({stElementField["count"]});')
+                out.open(f'for (uint32_t j = 0; j < {stElementField["count"]}; j++)')
+                element_pointer = f'{pointer} + j * {stElementField["length"]}'
+                out.line(f'vSubArray.emplace_back({read_expr(stElementField["ctype"], element_pointer)}, {sub_def});')
+                out.close()
+                out.close()
+            out.close()
+        out.close()
+    out.line('return STATUS::SUCCESS;')
+    out.close()
+
+
+def gen_encoder(out: CodeWriter, function_name: str, fields: list):
+    out.open(f'inline STATUS {function_name}(const IntermediateMessage& stMessage_, unsigned char** ppucBuffer_, '
+             f'uint32_t& uiBufferBytesRemaining_, [[maybe_unused]] bool bFlatten_)')
+    out.open(f'if (stMessage_.size() != {len(fields)} || reinterpret_cast<uintptr_t>(*ppucBuffer_) % 4 != 0)')
+    out.line('return STATUS::UNSUPPORTED;')
+    out.close()
+
+    # Work out the size of the body, which only depends on the number of values in each array.
+    out.line()
+    out.line('uint64_t ullEnd = 0;')
+    for index, stField in enumerate(fields):
+        kind, length = stField['kind'], stField['length']
+        if kind in ('SIMPLE', 'ENUM'):
+            out.line(f'ullEnd = AlignBinaryOffset(static_cast<uint32_t>(ullEnd), {length}) + {length};')
+            continue
+        if kind == 'STRING':
+            # Like the dynamic encoder, a string is padded with nulls to its maximum length when flattened, and
+            # otherwise to the next multiple of 4 bytes, which always includes at least one null.
+            out.line(f'const auto* ps{index} = std::get_if<std::string>(&stMessage_[{index}].field_value);')
+            out.open(f'if (!ps{index})')
+            out.line('return STATUS::UNSUPPORTED;')
+            out.close()
+            out.line(f'const auto uiLength{index} = static_cast<uint32_t>(strlen(ps{index}->c_str()));')
+            if length > 1:
+                out.line(f'ullEnd = AlignBinaryOffset(static_cast<uint32_t>(ullEnd), {length});')
+            out.line(f'ullEnd = bFlatten_ ? ullEnd + std::max<uint64_t>(uiLength{index}, {length * stField["count"]}) '
+                     f': AlignBinaryOffset(static_cast<uint32_t>(ullEnd + uiLength{index} + 1), 4);')
+            if index + 1 < len(fields):
+                out.open('if (ullEnd > uiBufferBytesRemaining_)')
+                out.line('return STATUS::BUFFER_FULL;')
+                out.close()
+            continue
+        out.line(f'const auto* pv{index} = std::get_if<std::vector<FieldContainer>>(&stMessage_[{index}].field_value);')
+        if kind == 'FIXED_LENGTH_ARRAY':
+            out.open(f'if (!pv{index} || pv{index}->size() != {stField["count"]})')
+            out.line('return STATUS::UNSUPPORTED;')
+            out.close()
+            out.line(f'ullEnd = AlignBinaryOffset(static_cast<uint32_t>(ullEnd), {length}) + {length * stField["count"]};')
+            continue
+        out.open(f'if (!pv{index})')
+        out.line('return STATUS::UNSUPPORTED;')
+        out.close()
+        if kind == 'VARIABLE_LENGTH_ARRAY':
+            element_size, flattened_size = length, length * stField['count']
+        else:
+            element_size, flattened_size = stField['element_size'], stField['field_size']
+        out.line(f'ullEnd = AlignBinaryOffset(static_cast<uint32_t>(ullEnd), {length}) + 4 '
+                 f'+ std::max<uint64_t>(pv{index}->size() * {element_size}, bFlatten_ ? {flattened_size} : 0);')
+        if index + 1 < len(fields):
+            out.open('if (ullEnd > uiBufferBytesRemaining_)')
+            out.line('return STATUS::BUFFER_FULL;')
+            out.close()
+    out.open('if (ullEnd > uiBufferBytesRemaining_)')
+    out.line('return STATUS::BUFFER_FULL;')
+    out.close()
+
+    out.line()
+    out.line('unsigned char* pucOut = *ppucBuffer_;')
+    out.line('uint32_t uiOffset = 0;')
+
+    def gen_pad_to_alignment(length: int):
+        if length > 1:
+            out.line(f'memset(pucOut + uiOffset, 0, AlignBinaryOffset(uiOffset, {length}) - uiOffset);')
+            out.line(f'uiOffset = AlignBinaryOffset(uiOffset, {length});')
+
+    def gen_write_value(ctype: str, container: str, pointer: str):
+        out.line(f'const auto* pValue = std::get_if<{ctype}>(&{container}.field_value);')
+        out.open('if (!pValue)')
+        out.line('return STATUS::UNSUPPORTED;')
+        out.close()
+        out.line(write_stmt(ctype, pointer, '*pValue'))
+
+    for index, stField in enumerate(fields):
+        kind, length = stField['kind'], stField['length']
+        out.line(f'// {stField["name"]}')
+        gen_pad_to_alignment(length)
+        out.open()
+        if kind in ('SIMPLE', 'ENUM'):
+            gen_write_value(stField['ctype'], f'stMessage_[{index}]', 'pucOut + uiOffset')
+            out.line(f'uiOffset += {length};')
+            out.close()
+            continue
+        if kind == 'STRING':
+            out.line(f'memcpy(pucOut + uiOffset, ps{index}->c_str(), uiLength{index});')
+            out.line(f'uiOffset += uiLength{index};')
+            max_length = length * stField['count']
+            out.line(f'const uint32_t uiPadding = bFlatten_ ? (uiLength{index} < {max_length} ? {max_length} - uiLength{index} : 0) '
+                     f': AlignBinaryOffset(uiOffset + 1, 4) - uiOffset;')
+            out.line('memset(pucOut + uiOffset, 0, uiPadding);')
+            out.line('uiOffset += uiPadding;')
+            out.close()
+            continue
+
+        out.line(f'const auto& vArray = *pv{index};')
+        if kind != 'FIXED_LENGTH_ARRAY':
+            out.line('WriteBinaryValue<uint32_t>(pucOut + uiOffset, static_cast<uint32_t>(vArray.size()));')
+            out.line('uiOffset += 4;')
+        if kind != 'FIELD_ARRAY':
+            out.open(f'for (const auto& clValue : vArray)')
+            gen_write_value(stField['ctype'], 'clValue', 'pucOut + uiOffset')
+            out.line(f'uiOffset += {length};')
+            out.close()
+            flattened_size, written = length * stField['count'], f'vArray.size() * {length}'
+        else:
+            elements = stField['elements']
+            out.open('for (const auto& clElement : vArray)')
+            out.line('const auto* pvElement = std::get_if<std::vector<FieldContainer>>(&clElement.field_value);')
+            out.open(f'if (!pvElement || pvElement->size() != {len(elements)})')
+            out.line('return STATUS::UNSUPPORTED;')
+            out.close()
+            out.line('unsigned char* pucElement = pucOut + uiOffset;')
+            # Padding inside an element is at the same place in every element.
+            offset = 0
+            for stElementField in elements:
+                if stElementField['offset'] != offset:
+                    out.line(f'memset(pucElement + {offset}, 0, {stElementField["offset"] - offset});')
+                offset = stElementField['offset'] + stElementField['length'] * stElementField.get('count', 1)
+            for sub_index, stElementField in enumerate(elements):
+                pointer = f'pucElement + {stElementField["offset"]}'
+                out.open()
+                if stElementField['kind'] in ('SIMPLE', 'ENUM'):
+                    gen_write_value(stElementField['ctype'], f'(*pvElement)[{sub_index}]', pointer)
+                else:
+                    out.line(f'const auto* pvSubArray = std::get_if<std::vector<FieldContainer>>(&(*pvElement)[{sub_index}].field_value);')
+                    out.open(f'if (!pvSubArray || pvSubArray->size() != {stElementField["count"]})')
+                    out.line('return STATUS::UNSUPPORTED;')
+                    out.close()
+                    out.open(f'for (uint32_t j = 0; j < {stElementField["count"]}; j++)')
+                    gen_write_value(stElementField['ctype'], '(*pvSubArray)[j]', f'{pointer} + j * {stElementField["length"]}')
+                    out.close()
+                out.close()
+            out.line(f'uiOffset += {stField["element_size"]};')
+            out.close()
+            flattened_size, written = stField['field_size'], f'vArray.size() * {stField["element_size"]}'
+        if kind != 'FIXED_LENGTH_ARRAY':
+            # The encoder pads a flattened array to its largest size.
+            out.open(f'if (bFlatten_ && {written} < {flattened_size})')
+            out.line(f'memset(pucOut + uiOffset, 0, {flattened_size} - {written});')
+            out.line(f'uiOffset += static_cast<uint32_t>({flattened_size} - {written});')
+            out.close()
+        out.close()
+
+    out.line()
+    out.line('*ppucBuffer_ += uiOffset;')
+    out.line('uiBufferBytesRemaining_ -= uiOffset;')
+    out.line('return STATUS::SUCCESS;')
+    out.close()
+
+
+def gen_dispatch(out: CodeWriter, function_name: str, parameters: str, arguments: str, definitions: dict, prefix: str):
+    out.open(f'inline STATUS {function_name}(uint16_t usMessageID_, uint32_t uiMessageCRC_, {parameters})')
+    out.open('switch (usMessageID_)')
+    for message_id, names in sorted(definitions.items()):
+        out.line(f'case {message_id}:')
+        out.depth += 1
+        for crc, type_name in names:
+            out.open(f'if (uiMessageCRC_ == {crc})')
+            out.line(f'return {prefix}{type_name}({arguments});')
+            out.close()
+        out.line('break;')
+        out.depth -= 1
+    out.line('default:')
+    out.line(f'{TAB_CHAR}break;')
+    out.close()
+    out.line('return STATUS::UNSUPPORTED;')
+    out.close()
+
+
+def gen_specialized_codec(msg_database: dict, out_file: str = 'novatel_specialized_codec.hpp', messages: list = None,
+                          latest_only: bool = False):
+    out = CodeWriter()
+    definitions = {}
+    for msg in msg_database['messages']:
+        if messages and msg['name'] not in messages:
+            continue
+        crcs = [msg['latestMsgDefCrc']] if latest_only else sorted(msg['fields'], key=int)
+        for crc in crcs:
+            type_name = f'{msg["name"]}_{crc}'
+            try:
+                if not msg['fields'][crc]:
+                    raise UnsupportedField('it has no fields')
+                fields = prepare_fields(msg['fields'][crc])
+            except UnsupportedField as error:
+                warnings.warn(f'Skipping {msg["name"]} CRC {crc}: {error}')
+                out.line(f'// {type_name} is left to the dynamic decoder and encoder: {error}')
+                out.line()
+                continue
+            out.line(f'//{"-" * 71}')
+            out.line(f'// {msg["name"]}, message ID {msg["messageID"]}, definition CRC {crc}')
+            out.line(f'//{"-" * 71}')
+            gen_decoder(out, f'Decode{type_name}', fields)
+            out.line()
+            gen_encoder(out, f'Encode{type_name}', fields)
+            out.line()
+            definitions.setdefault(msg['messageID'], []).append((crc, type_name))
+
+    out.line(f'//{"-" * 71}')
+    out.line('//! \\brief Decode the binary body of a message, if it was generated.')
+    out.line('//! A SpecializedBinaryDecoder for MessageDecoder::SetSpecializedDecoder().')
+    out.line(f'//{"-" * 71}')
+    gen_dispatch(out, 'DecodeBinary',
+                 'MsgFieldsVector& vMsgDefFields_, const unsigned char* pucBody_, uint32_t uiBodyLength_, IntermediateMessage& stIntermediateMessage_',
+                 'vMsgDefFields_, pucBody_, uiBodyLength_, stIntermediateMessage_', definitions, 'Decode')
+    out.line()
+    out.line(f'//{"-" * 71}')
+    out.line('//! \\brief Encode the binary body of a message, if it was generated.')
+    out.line('//! A SpecializedBinaryEncoder for Encoder::SetSpecializedEncoder().')
+    out.line(f'//{"-" * 71}')
+    gen_dispatch(out, 'EncodeBinary',
+                 'const IntermediateMessage& stMessage_, unsigned char** ppucBuffer_, uint32_t& uiBufferBytesRemaining_, bool bFlatten_',
+                 'stMessage_, ppucBuffer_, uiBufferBytesRemaining_, bFlatten_', definitions, 'Encode')
+    out.line()
+    out.line('//! Decode the generated messages with the generated code.')
+    out.line('inline void Install(MessageDecoder& clDecoder_) { clDecoder_.SetSpecializedDecoder(&DecodeBinary); }')
+    out.line()
+    out.line('//! Encode the generated messages with the generated code.')
+    out.line('inline void Install(Encoder& clEncoder_) { clEncoder_.SetSpecializedEncoder(&EncodeBinary); }')
+
+    os.makedirs(os.path.dirname(os.path.abspath(out_file)), exist_ok=True)
+    with open(out_file, 'w') as fp:
+        fp.write('// Generated by scripts/gen_cpp_specialized_codec.py.  Do not edit.\n\n')
+        fp.write('#ifndef NOVATEL_SPECIALIZED_CODEC_HPP\n#define NOVATEL_SPECIALIZED_CODEC_HPP\n\n')
+        fp.write('#include <algorithm>\n#include <cstdint>\n#include <cstring>\n#include <string>\n#include <variant>\n#include <vector>\n\n')
+        fp.write('#include "decoders/novatel/api/encoder.hpp"\n')
+        fp.write('#include "decoders/novatel/api/message_decoder.hpp"\n')
+        fp.write('#include "decoders/novatel/api/message_view.hpp"\n\n')
+        fp.write('namespace novatel::edie::oem::specialized {\n\n')
+        fp.write(out.code())
+        fp.write('\n} // namespace novatel::edie::oem::specialized\n\n')
+        fp.write('#endif // NOVATEL_SPECIALIZED_CODEC_HPP\n')
+
+
+def is_valid_file(parser, arg):
+    if not os.path.exists(arg):
+        parser.error(f'The file {arg} does not exist!')
+    else:
+        return open(arg, 'r')
+
+
+def parse_args():
+    p = argparse.ArgumentParser()
+    p.add_argument('json_db', help='Path to the NovAtel JSON database', type=lambda x: is_valid_file(p, x))
+    p.add_argument('-o', '--out_file', help='Output header file name. Defaults to "novatel_specialized_codec.hpp"',
+                   default='novatel_specialized_codec.hpp')
+    p.add_argument('-m', '--messages', nargs='*', default=None,
+                   help='Names of the messages to generate. Default is every message in the database')
+    p.add_argument('-l', '--latest-only', action='store_true', default=False,
+                   help='Only generate the latest definition (CRC) of each message')
+    return p.parse_args()
+
+
+if __name__ == '__main__':
+    args = parse_args()
+    msg_defs = json.load(args.json_db)
+    gen_specialized_codec(msg_defs, out_file=args.out_file, messages=args.messages, latest_only=args.latest_only)
+    print(f'{args.out_file} generated')
+    sys.exit()
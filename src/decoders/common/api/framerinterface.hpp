@@ -73,7 +73,7 @@ public:
       pclMyLogger(Logger().RegisterLogger(strLoggerName_))
    {
       clMyCircularDataBuffer.Clear();
-      pclMyLogger->debug("Framer initialized");
+      SPDLOG_LOGGER_DEBUG(pclMyLogger, "Framer initialized");
    }
 
    //----------------------------------------------------------------------------
@@ -130,6 +130,18 @@ public:
       return clMyCircularDataBuffer.GetCapacity() - clMyCircularDataBuffer.GetLength();
    }
 
+   //----------------------------------------------------------------------------
+   //! \brief Get the number of bytes written to the framer that have not yet
+   //! been returned in a frame.
+   //
+   //! \return The number of bytes held in the internal circular buffer.
+   //----------------------------------------------------------------------------
+   uint32_t
+   GetBufferedByteCount() const
+   {
+      return clMyCircularDataBuffer.GetLength();
+   }
+
    //----------------------------------------------------------------------------
    //! \brief Write new bytes to the internal circular buffer.
    //
@@ -631,6 +631,14 @@ public:
    //----------------------------------------------------------------------------
    novatel::edie::EnumDefinition* GetEnumDef(const std::string& sEnumNameOrID_);
 
+   //----------------------------------------------------------------------------
+   //! \brief Get every UI DB message definition.
+   //----------------------------------------------------------------------------
+   const std::vector<novatel::edie::MessageDefinition>& GetMessageDefinitions() const
+   {
+      return vMessageDefinitions;
+   }
+
 private:
    void GenerateMappings()
    {
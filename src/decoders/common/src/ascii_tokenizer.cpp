@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file ascii_tokenizer.cpp
+//! \brief Find the field delimiters of an ASCII message body.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "ascii_tokenizer.hpp"
+
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ASCII_TOKENIZER_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+//! The delimiters, in the order of the DELIMITER bits.
+constexpr char acDelimiters[] = { ',', '*', ' ', '\r', '\n', '"', '\0' };
+constexpr uint32_t uiDELIMITER_COUNT = sizeof(acDelimiters);
+//! Fills the bytes of a copied block that are outside the body.  It is not a
+//! delimiter.
+constexpr char cPADDING = 'x';
+} // namespace
+
+//---------------------------------------------------------------------------
+void AsciiTokenizer::Reset(const char* pcBody_)
+{
+   pcMyBody = pcBody_;
+   pcMyFirstBlock = reinterpret_cast<const char*>(reinterpret_cast<uintptr_t>(pcBody_) & ~static_cast<uintptr_t>(uiBLOCK_SIZE - 1));
+   bMyEndFound = false;
+   vMyBlocks.clear();
+}
+
+//---------------------------------------------------------------------------
+void AsciiTokenizer::ScanBlock()
+{
+   const char* pcBlock = pcMyFirstBlock + vMyBlocks.size() * uiBLOCK_SIZE;
+   std::array<uint64_t, uiMASK_COUNT>& aullMasks = vMyBlocks.emplace_back();
+   aullMasks.fill(0);
+
+   // Only the bytes from the start of the body to its NUL may be read.
+   const uint32_t uiStart = pcBlock < pcMyBody ? static_cast<uint32_t>(pcMyBody - pcBlock) : 0;
+   const void* pvEnd = std::memchr(pcBlock + uiStart, '\0', uiBLOCK_SIZE - uiStart);
+   const uint32_t uiEnd = pvEnd != nullptr ? static_cast<uint32_t>(static_cast<const char*>(pvEnd) - pcBlock) + 1 : uiBLOCK_SIZE;
+
+#if defined(__AVX2__) || defined(ASCII_TOKENIZER_SSE2)
+   // A block the body only partly covers is copied first, so that the
+   // aligned loads below stay within the body.
+   alignas(uiBLOCK_SIZE) char acPadded[uiBLOCK_SIZE];
+   if (uiStart != 0 || uiEnd != uiBLOCK_SIZE)
+   {
+      std::memset(acPadded, cPADDING, sizeof(acPadded));
+      std::memcpy(acPadded + uiStart, pcBlock + uiStart, uiEnd - uiStart);
+      pcBlock = acPadded;
+   }
+#endif
+
+#if defined(__AVX2__)
+   const __m256i clLow = _mm256_load_si256(reinterpret_cast<const __m256i*>(pcBlock));
+   const __m256i clHigh = _mm256_load_si256(reinterpret_cast<const __m256i*>(pcBlock + 32));
+   for (uint32_t i = 0; i < uiDELIMITER_COUNT; ++i)
+   {
+      const __m256i clDelimiter = _mm256_set1_epi8(acDelimiters[i]);
+      aullMasks[i] = static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(clLow, clDelimiter))))
+                   | static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(clHigh, clDelimiter)))) << 32;
+   }
+#elif defined(ASCII_TOKENIZER_SSE2)
+   __m128i aclBytes[4];
+   for (uint32_t j = 0; j < 4; ++j)
+   {
+      aclBytes[j] = _mm_load_si128(reinterpret_cast<const __m128i*>(pcBlock + j * 16));
+   }
+   for (uint32_t i = 0; i < uiDELIMITER_COUNT; ++i)
+   {
+      const __m128i clDelimiter = _mm_set1_epi8(acDelimiters[i]);
+      uint64_t ullMask = 0;
+      for (uint32_t j = 0; j < 4; ++j)
+      {
+         ullMask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(aclBytes[j], clDelimiter)))) << (j * 16);
+      }
+      aullMasks[i] = ullMask;
+   }
+#else
+   for (uint32_t j = uiStart; j < uiEnd; ++j)
+   {
+      for (uint32_t i = 0; i < uiDELIMITER_COUNT; ++i)
+      {
+         if (pcBlock[j] == acDelimiters[i])
+         {
+            aullMasks[i] |= 1ULL << j;
+            break;
+         }
+      }
+   }
+#endif
+
+   bMyEndFound = aullMasks[uiEND_INDEX] != 0;
+}
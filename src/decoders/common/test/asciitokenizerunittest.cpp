@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file asciitokenizerunittest.cpp
+//! \brief Unit test cases for the ASCII body tokenizer.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "decoders/common/api/ascii_tokenizer.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+// -------------------------------------------------------------------------------------------------------
+// AsciiTokenizer Unit Tests
+// -------------------------------------------------------------------------------------------------------
+TEST(AsciiTokenizerTest, MATCHES_STRCSPN)
+{
+   const std::pair<uint8_t, const char*> aDelimiterSets[] = {
+      { AsciiTokenizer::COMMA | AsciiTokenizer::ASTERISK, ",*" },
+      { AsciiTokenizer::QUOTE | AsciiTokenizer::ASTERISK, "\"*" },
+      { AsciiTokenizer::ASTERISK, "*" },
+      { AsciiTokenizer::SPACE | AsciiTokenizer::CR | AsciiTokenizer::LF, " \r\n" },
+      { AsciiTokenizer::QUOTE | AsciiTokenizer::CR, "\"\r" },
+      { AsciiTokenizer::SPACE | AsciiTokenizer::CR, " \r" },
+      { AsciiTokenizer::CR, "\r" }
+   };
+
+   // Bodies longer than a block, made mostly of delimiters, at every alignment.
+   const char acAlphabet[] = ",* \r\n\"abc1.-";
+   std::mt19937 clRandom(7);
+   alignas(64) char acBuffer[512];
+   AsciiTokenizer clTokenizer;
+   for (uint32_t uiTrial = 0; uiTrial < 200; ++uiTrial)
+   {
+      const uint32_t uiStart = uiTrial % 64;
+      const uint32_t uiLength = clRandom() % 300;
+      for (uint32_t i = 0; i < uiLength; ++i)
+         acBuffer[uiStart + i] = acAlphabet[clRandom() % (sizeof(acAlphabet) - 1)];
+      acBuffer[uiStart + uiLength] = '\0';
+
+      const char* pcBody = acBuffer + uiStart;
+      clTokenizer.Reset(pcBody);
+      // Mostly move forward, as the decoders do, but sometimes step back.
+      for (uint32_t uiSearch = 0; uiSearch < 100; ++uiSearch)
+      {
+         const uint32_t uiOffset = uiSearch % 10 == 9 ? clRandom() % (uiLength + 1) : std::min(uiLength, uiSearch * uiLength / 100);
+         const auto& stDelimiters = aDelimiterSets[clRandom() % (sizeof(aDelimiterSets) / sizeof(aDelimiterSets[0]))];
+         ASSERT_EQ(strcspn(pcBody + uiOffset, stDelimiters.second), clTokenizer.FindFirstOf(pcBody + uiOffset, stDelimiters.first))
+            << "trial " << uiTrial << " offset " << uiOffset << " delimiters \"" << stDelimiters.second << "\"";
+      }
+   }
+}
+
+TEST(AsciiTokenizerTest, BODY_WITHIN_BLOCK)
+{
+   // Delimiters before the body and after its NUL, in the same block, are
+   // not part of the body.
+   alignas(64) char acBuffer[64];
+   std::fill(std::begin(acBuffer), std::end(acBuffer), ',');
+   memcpy(acBuffer + 20, "ab*cd", 6);
+
+   AsciiTokenizer clTokenizer;
+   clTokenizer.Reset(acBuffer + 20);
+   ASSERT_EQ(2U, clTokenizer.FindFirstOf(acBuffer + 20, AsciiTokenizer::COMMA | AsciiTokenizer::ASTERISK));
+   ASSERT_EQ(5U, clTokenizer.FindFirstOf(acBuffer + 20, AsciiTokenizer::COMMA));
+   ASSERT_EQ(2U, clTokenizer.FindFirstOf(acBuffer + 23, AsciiTokenizer::COMMA));
+
+   // A body that ends exactly where its allocation does.
+   const std::string strBody = "SOL_COMPUTED,SINGLE";
+   std::vector<char> vBody(strBody.c_str(), strBody.c_str() + strBody.size() + 1);
+   clTokenizer.Reset(vBody.data());
+   ASSERT_EQ(12U, clTokenizer.FindFirstOf(vBody.data(), AsciiTokenizer::COMMA));
+   ASSERT_EQ(6U, clTokenizer.FindFirstOf(vBody.data() + 13, AsciiTokenizer::COMMA));
+}
+
+TEST(AsciiTokenizerTest, LOG_BODY)
+{
+   const std::string strBody = "SOL_COMPUTED,SINGLE,51.15043874397,\"WGS, 84\",1.3648*b1f6\r\n";
+   AsciiTokenizer clTokenizer;
+   clTokenizer.Reset(strBody.c_str());
+
+   const char* pcPosition = strBody.c_str();
+   ASSERT_EQ(12U, clTokenizer.FindFirstOf(pcPosition, AsciiTokenizer::COMMA | AsciiTokenizer::ASTERISK));
+   pcPosition += 13;
+   ASSERT_EQ(6U, clTokenizer.FindFirstOf(pcPosition, AsciiTokenizer::COMMA | AsciiTokenizer::ASTERISK));
+   pcPosition = strchr(pcPosition, '"');
+   ASSERT_EQ(7U, clTokenizer.FindFirstOf(pcPosition + 1, AsciiTokenizer::QUOTE | AsciiTokenizer::ASTERISK));
+   pcPosition = strchr(pcPosition + 1, '"') + 2;
+   ASSERT_EQ(6U, clTokenizer.FindFirstOf(pcPosition, AsciiTokenizer::COMMA | AsciiTokenizer::ASTERISK));
+   ASSERT_EQ(11U, clTokenizer.FindFirstOf(pcPosition, AsciiTokenizer::CR));
+   ASSERT_EQ(13U, clTokenizer.FindFirstOf(pcPosition, 0));
+}
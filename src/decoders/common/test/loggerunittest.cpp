@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file loggerunittest.cpp
+//! \brief Unit test cases for the logger helpers.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "logger/logger.hpp"
+
+#include <gtest/gtest.h>
+#include <thread>
+
+// -------------------------------------------------------------------------------------------------------
+// LogRateLimiter Unit Tests
+// -------------------------------------------------------------------------------------------------------
+TEST(LogRateLimiterTest, SUPPRESS_REPEATS)
+{
+   LogRateLimiter clLimiter(std::chrono::hours(1), 2);
+   uint64_t ullSuppressed = 99;
+
+   ASSERT_TRUE(clLimiter.ShouldLog(0, 7, 42, ullSuppressed));
+   ASSERT_EQ(ullSuppressed, 0ULL);
+   ASSERT_TRUE(clLimiter.ShouldLog(0, 7, 42, ullSuppressed));
+
+   for (int i = 0; i < 10; i++)
+   {
+      ASSERT_FALSE(clLimiter.ShouldLog(0, 7, 42, ullSuppressed));
+   }
+
+   // Any difference in component, status or message ID is a different diagnostic.
+   ASSERT_TRUE(clLimiter.ShouldLog(1, 7, 42, ullSuppressed));
+   ASSERT_TRUE(clLimiter.ShouldLog(0, 8, 42, ullSuppressed));
+   ASSERT_TRUE(clLimiter.ShouldLog(0, 7, 43, ullSuppressed));
+
+   clLimiter.Reset();
+   ASSERT_TRUE(clLimiter.ShouldLog(0, 7, 42, ullSuppressed));
+   ASSERT_EQ(ullSuppressed, 0ULL);
+}
+
+TEST(LogRateLimiterTest, REPORT_SUPPRESSED_COUNT)
+{
+   LogRateLimiter clLimiter(std::chrono::milliseconds(20));
+   uint64_t ullSuppressed = 0;
+
+   ASSERT_TRUE(clLimiter.ShouldLog(0, 7, 42, ullSuppressed));
+   for (int i = 0; i < 5; i++)
+   {
+      ASSERT_FALSE(clLimiter.ShouldLog(0, 7, 42, ullSuppressed));
+   }
+
+   std::this_thread::sleep_for(std::chrono::milliseconds(30));
+   ASSERT_TRUE(clLimiter.ShouldLog(0, 7, 42, ullSuppressed));
+   ASSERT_EQ(ullSuppressed, 5ULL);
+
+   // The count is only mentioned when something was suppressed.
+   ASSERT_EQ(LogRateLimiter::Suppressed(ullSuppressed), " (5 repeats suppressed)");
+   ASSERT_EQ(LogRateLimiter::Suppressed(0), "");
+}
+
+// -------------------------------------------------------------------------------------------------------
+// Async Logger Unit Tests
+// -------------------------------------------------------------------------------------------------------
+TEST(LoggerTest, ASYNC_LOGGING)
+{
+   Logger::EnableAsyncLogging(1024);
+   ASSERT_TRUE(Logger::IsAsyncLogging());
+
+   std::shared_ptr<spdlog::logger> pclLogger = Logger().RegisterLogger("async_logger_test");
+   ASSERT_NE(std::dynamic_pointer_cast<spdlog::async_logger>(pclLogger), nullptr);
+   pclLogger->info("Logged from the thread pool");
+
+   // The thread pool is released on shutdown and recreated on demand.
+   Logger::Shutdown();
+   pclLogger = Logger().RegisterLogger("async_logger_test");
+   ASSERT_NE(std::dynamic_pointer_cast<spdlog::async_logger>(pclLogger), nullptr);
+   pclLogger->info("Logged from a new thread pool");
+   Logger::Shutdown();
+}
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file spscringunittest.cpp
+//! \brief Unit test cases for the single-producer/single-consumer ring.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "decoders/common/api/spscring.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+
+// -------------------------------------------------------------------------------------------------------
+// SpscRing Unit Tests
+// -------------------------------------------------------------------------------------------------------
+TEST(SpscRingTest, CAPACITY)
+{
+   ASSERT_THROW(SpscRing<uint32_t>(0), std::invalid_argument);
+   ASSERT_THROW(SpscRing<uint32_t>(12), std::invalid_argument);
+
+   SpscRing<uint32_t> clRing(4);
+   ASSERT_EQ(clRing.GetCapacity(), 4U);
+   ASSERT_TRUE(clRing.IsEmpty());
+}
+
+TEST(SpscRingTest, PUSH_POP)
+{
+   SpscRing<uint32_t> clRing(4);
+   uint32_t uiItem = 0;
+   ASSERT_FALSE(clRing.TryPop(uiItem));
+
+   // Wrap around the ring several times.
+   for (uint32_t uiRound = 0; uiRound < 3; uiRound++)
+   {
+      for (uint32_t i = 0; i < 4; i++)
+      {
+         ASSERT_TRUE(clRing.TryPush(uiRound * 4 + i));
+      }
+      ASSERT_FALSE(clRing.TryPush(99));
+      ASSERT_EQ(clRing.Size(), 4U);
+
+      for (uint32_t i = 0; i < 4; i++)
+      {
+         ASSERT_TRUE(clRing.TryPop(uiItem));
+         ASSERT_EQ(uiItem, uiRound * 4 + i);
+      }
+      ASSERT_FALSE(clRing.TryPop(uiItem));
+   }
+}
+
+TEST(SpscRingTest, THREADED_ORDER)
+{
+   constexpr uint32_t uiItems = 100000;
+   SpscRing<uint32_t> clRing(16);
+
+   std::thread clProducer([&clRing]() {
+      for (uint32_t i = 0; i < uiItems; i++)
+      {
+         while (!clRing.TryPush(i))
+         {
+            std::this_thread::yield();
+         }
+      }
+   });
+
+   uint32_t uiExpected = 0;
+   uint32_t uiItem = 0;
+   uint32_t uiOutOfOrder = 0;
+   while (uiExpected < uiItems)
+   {
+      if (clRing.TryPop(uiItem))
+      {
+         uiOutOfOrder += uiItem != uiExpected;
+         uiExpected++;
+      }
+      else
+      {
+         std::this_thread::yield();
+      }
+   }
+   clProducer.join();
+   ASSERT_EQ(uiOutOfOrder, 0U);
+   ASSERT_TRUE(clRing.IsEmpty());
+}
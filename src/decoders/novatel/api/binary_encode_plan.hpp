@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file binary_encode_plan.hpp
+//! \brief Precompiled steps for encoding a message body to binary.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef NOVATEL_BINARY_ENCODE_PLAN_HPP
+#define NOVATEL_BINARY_ENCODE_PLAN_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <vector>
+
+#include "decoders/common/api/jsonreader.hpp"
+#include "decoders/novatel/api/message_decoder.hpp"
+
+namespace novatel::edie::oem {
+
+//============================================================================
+//! \class BinaryEncodePlan
+//! \brief The steps for encoding one version (CRC) of a message's body to
+//! BINARY or FLATTENED_BINARY.
+//
+//! Compile() works out everything Encoder::EncodeBinaryBody() decides per
+//! field from the field definitions: the alignment, how each value is
+//! written, its size and the size a flattened array or string is padded
+//! to.  Encode() then only has to check that each field is the one the
+//! plan expects before copying it, and reserves space for a whole array at
+//! once.  The output is byte-for-byte the same as EncodeBinaryBody(), so
+//! Encode() gives up on anything it was not planned for and leaves the
+//! message to EncodeBinaryBody().
+//============================================================================
+class BinaryEncodePlan
+{
+   using FieldValue = decltype(FieldContainer::field_value);
+   //! Copies a value to the buffer, returning false if it does not hold the
+   //! type the plan expects.
+   using CopyFunction = bool (*)(const FieldValue&, unsigned char*);
+
+   enum class STEP_TYPE
+   {
+      SIMPLE,
+      FIXED_ARRAY,
+      VARIABLE_ARRAY,
+      STRING,
+      RESPONSE_STRING,
+      FIELD_ARRAY
+   };
+
+   struct Step
+   {
+      const BaseField* pclField{ nullptr };
+      STEP_TYPE eType{ STEP_TYPE::SIMPLE };
+      uint32_t uiAlignment{ 1 };
+      CopyFunction pfCopy{ nullptr };
+      uint32_t uiSize{ 0 };               //!< Bytes written by pfCopy for each value.
+      uint32_t uiFlattenedSize{ 0 };      //!< Bytes a flattened array or string is padded to.
+      std::vector<Step> vFieldArraySteps; //!< The steps for each element of a FIELD_ARRAY.
+   };
+
+   std::vector<Step> vMySteps;
+
+   [[nodiscard]] static bool CompileSteps(const std::vector<BaseField*>& vFields_, std::vector<Step>& vSteps_);
+   [[nodiscard]] static bool CompileCopy(const BaseField* pclField_, Step& stStep_);
+   [[nodiscard]] static bool EncodeArray(const Step& stStep_, const std::vector<FieldContainer>& vElements_, unsigned char*& pucBuffer_, uint32_t& uiBufferBytesRemaining_, bool bFlatten_);
+   [[nodiscard]] static bool EncodeSteps(const std::vector<Step>& vSteps_, const std::vector<FieldContainer>& vFields_, unsigned char*& pucBuffer_, uint32_t& uiBufferBytesRemaining_, bool bFlatten_);
+
+public:
+   //----------------------------------------------------------------------------
+   //! \brief Compile the plan for a version of a message.
+   //
+   //! \param[in] vFields_ The field definitions of the message, for one CRC.
+   //
+   //! \return false if a field cannot be planned.  Messages of that version
+   //! should be left to Encoder::EncodeBinaryBody().
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   Compile(const std::vector<BaseField*>& vFields_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Encode a message body to binary.
+   //
+   //! \param[in] stMessage_ The decoded message, which must have been decoded
+   //! with the field definitions the plan was compiled from.
+   //! \param[in, out] ppucBuffer_ The buffer to encode to, which is advanced
+   //! past the body on success.
+   //! \param[in, out] uiBufferBytesRemaining_ The space left in the buffer.
+   //! \param[in] bFlatten_ Pad arrays and strings to their maximum size.
+   //
+   //! \return false if the body does not fit in the buffer, or a field is not
+   //! what the plan expects.  The buffer is left unchanged in that case, and
+   //! the message should be encoded by Encoder::EncodeBinaryBody() instead.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   Encode(const IntermediateMessage& stMessage_, unsigned char** ppucBuffer_, uint32_t& uiBufferBytesRemaining_, bool bFlatten_) const;
+};
+
+}
+#endif // NOVATEL_BINARY_ENCODE_PLAN_HPP
@@ -39,6 +39,7 @@
 #include "decoders/common/api/common.hpp"
 #include "decoders/common/api/jsonreader.hpp"
 #include "decoders/novatel/api/common.hpp"
+#include "decoders/novatel/api/command_template.hpp"
 #include "decoders/novatel/api/encoder.hpp"
 #include "decoders/novatel/api/message_decoder.hpp"
 
@@ -68,6 +69,9 @@ private:
    void InitEnumDefns();
    void CreateResponseMsgDefns();
 
+   [[nodiscard]] STATUS
+   DecodeCommand(const char* pcAbbrevAsciiCommand_, uint32_t uiAbbrevAsciiCommandLength_, IntermediateHeader& stIntermediateHeader_, IntermediateMessage& stIntermediateMessage_, MetaDataStruct& stMetaData_);
+
 public:
    //----------------------------------------------------------------------------
    //! \brief A constructor for the Commander class.
@@ -140,6 +144,32 @@ public:
       uint32_t& uiEncodeBufferSize_,
       ENCODEFORMAT eEncodeFormat_);
 
+   //----------------------------------------------------------------------------
+   //! \brief Compile an abbreviated ASCII command into a reusable template.
+   //! The command is looked up, decoded and its ASCII and BINARY headers are
+   //! encoded once.  The parameters given here become the initial values of
+   //! the template's parameter slots.
+   //
+   //! \param[in] pcAbbrevAsciiCommand_ A buffer containing the abbreviated
+   //! ASCII command to be compiled.
+   //! \param[in] uiAbbrevAsciiCommandLength_ The length of the command contained
+   //! within pcAbbrevAsciiCommand_.
+   //! \param[out] clCommandTemplate_ The template to compile the command into.
+   //
+   //! \return An error code describing the result of compiling.
+   //!   SUCCESS: The command was compiled into clCommandTemplate_.
+   //!   NULL_PROVIDED: pcAbbrevAsciiCommand_ is a null pointer.
+   //!   NO_DATABASE: No database was ever loaded into this component.
+   //!   NO_DEFINITION: No definition was found in the database that corresponds
+   //! to the provided Abbreviated ASCII command.
+   //!   BUFFER_FULL: An encoded header does not fit in the template.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Compile(
+      const char* pcAbbrevAsciiCommand_,
+      uint32_t uiAbbrevAsciiCommandLength_,
+      CommandTemplate& clCommandTemplate_);
+
    //----------------------------------------------------------------------------
    //! \brief A static method to encode an abbreviated ASCII command to a full
    //! ASCII or BINARY command.
@@ -181,6 +181,7 @@ struct MetaDataStruct
    uint32_t uiHeaderLength{ 0 }; //!< The length of the message header.  Used for NovAtel logs.
    uint16_t usMessageID{ 0 };
    uint32_t uiMessageCRC{ 0 };
+   uint32_t uiFrameCRC{ 0 }; //!< The CRC32 at the end of a binary or ASCII frame, set by the Framer.  0 for other formats.
    char acMessageName[OEM4_ASCII_MESSAGE_NAME_MAX + 1]{ '\0' }; //!< +1 for NULL-termination.
 
    MetaDataStruct() = default;
@@ -38,7 +38,9 @@
 //-----------------------------------------------------------------------
 #include "decoders/common/api/common.hpp"
 #include "decoders/common/api/jsonreader.hpp"
+#include "decoders/novatel/api/binary_encode_plan.hpp"
 #include "decoders/novatel/api/common.hpp"
+#include "decoders/novatel/api/encode_sink.hpp"
 #include "decoders/novatel/api/message_decoder.hpp"
 
 #include <nlohmann/json.hpp>
@@ -50,6 +52,13 @@ using nlohmann::json;
 
 namespace novatel::edie::oem {
 
+//! Encodes the binary bodies of the message definitions it was generated
+//! for, such as EncodeBinary() in the header generated by
+//! scripts/gen_cpp_specialized_codec.py.  It returns UNSUPPORTED for any
+//! other message, or one whose values are not the types it expects.
+using SpecializedBinaryEncoder = STATUS (*)(uint16_t usMessageID_, uint32_t uiMessageCRC_, const IntermediateMessage& stMessage_,
+                                            unsigned char** ppucBuffer_, uint32_t& uiBufferBytesRemaining_, bool bFlatten_);
+
 //============================================================================
 //! \class Encoder
 //! \brief Class to encode OEM messages.
@@ -58,6 +67,7 @@ class Encoder
 {
 private:
    std::shared_ptr<spdlog::logger> pclMyLogger;
+   mutable LogRateLimiter clMyLogRateLimiter;
    uint32_t uiMyAbbrevAsciiIndentationLevel;
    JsonReader* pclMyMsgDb{ nullptr };
    MessageDefinition stMyRespDef;
@@ -65,6 +75,9 @@ private:
    EnumDefinition* vMyCommandDefns{ nullptr };
    EnumDefinition* vMyPortAddrDefns{ nullptr };
    EnumDefinition* vMyGPSTimeStatusDefns{ nullptr };
+   //! Binary encode plans, keyed by the first field definition of each version of each message.
+   std::unordered_map<const BaseField*, BinaryEncodePlan> umMyBinaryEncodePlans;
+   SpecializedBinaryEncoder pfMySpecializedEncoder{ nullptr };
 
    // Inline buffer functions
    [[nodiscard]] bool PrintToBuffer(char** ppcBuffer_, uint32_t& uiBufferBytesRemaining_, const char* szFormat_, ...)
@@ -73,7 +86,8 @@ private:
       va_start(args, szFormat_);
       const uint32_t uiBytesBuffered = vsnprintf(*ppcBuffer_, uiBufferBytesRemaining_, szFormat_, args);
       va_end(args);
-      if (uiBufferBytesRemaining_ < uiBytesBuffered)
+      // vsnprintf() drops the last character to fit its terminator.
+      if (uiBytesBuffered > 0 && uiBufferBytesRemaining_ <= uiBytesBuffered)
       {
          return false;
       }
@@ -140,6 +154,7 @@ private:
    // Enum util functions
    void InitEnumDefns();
    void CreateResponseMsgDefns();
+   void CompileBinaryEncodePlans();
    uint32_t MsgNameToMsgId(std::string sMsgName_) const;
    std::string MsgIdToMsgName(uint32_t uiMessageID_) const;
    std::string JsonHeaderToMsgName(const IntermediateHeader& stIntermediateHeader_) const;
@@ -177,7 +192,8 @@ public:
    Encoder(JsonReader* pclJsonDb_ = nullptr);
 
    //----------------------------------------------------------------------------
-   //! \brief Load a JsonReader object.
+   //! \brief Load a JsonReader object, and compile the plans used to encode
+   //! each message to binary.  Load it again if the JsonReader is changed.
    //
    //! \param[in] pclJsonDb_ A pointer to a JsonReader object.
    //----------------------------------------------------------------------------
@@ -206,6 +222,19 @@ public:
    static void
    ShutdownLogger();
 
+   //----------------------------------------------------------------------------
+   //! \brief Encode messages to BINARY and FLATTENED_BINARY with code
+   //! generated for their definitions.
+   //
+   //! Each message is first given to pfEncoder_, and is only encoded from
+   //! its field definitions if pfEncoder_ returns UNSUPPORTED.
+   //
+   //! \param[in] pfEncoder_ The generated encoder, or nullptr to encode every
+   //! message from its field definitions again.
+   //----------------------------------------------------------------------------
+   void
+   SetSpecializedEncoder(SpecializedBinaryEncoder pfEncoder_);
+
    //----------------------------------------------------------------------------
    //! \brief Encode an OEM message from the provided intermediate structures.
    //
@@ -239,6 +268,36 @@ public:
    [[nodiscard]] STATUS
    Encode(unsigned char** ppucEncodeBuffer_, uint32_t uiEncodeBufferSize_, IntermediateHeader& stHeader_, IntermediateMessage& stMessage_, MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, ENCODEFORMAT eEncodeFormat_);
 
+   //----------------------------------------------------------------------------
+   //! \brief Encode an OEM message from the provided intermediate structures
+   //! into an EncodeSink.
+   //
+   //! The message is encoded into a block reserved from the sink, starting at
+   //! MESSAGE_SIZE_MAX bytes.  Whenever the block is too small, a block twice
+   //! its size is reserved and the message is encoded again, so large ASCII
+   //! and JSON messages are limited only by the sink.
+   //
+   //! \param[in] clSink_ The sink to encode the message into.  The message is
+   //! committed to it if encoding succeeds.
+   //! \param[in] stHeader_ A reference to the decoded header intermediate.
+   //! This must be populated by the HeaderDecoder.
+   //! \param[in] stMessage_ A reference to the decoded message intermediate.
+   //! This must be populated by the MessageDecoder.
+   //! \param[out] stMessageData_ A reference to a MessageDataStruct to be
+   //! populated by the encoder.  It points into the sink's block.
+   //! \param[in] stMetaData_ A reference to a populated MetaDataStruct
+   //! containing relevant information about the decoded log.
+   //! This must be populated by the Framer and HeaderDecoder.
+   //! \param[in] eEncodeFormat_ The format to encode the message to.
+   //
+   //! \return An error code describing the result of encoding, as for
+   //! Encode() into a buffer.
+   //!   BUFFER_FULL: The sink could not reserve a block large enough for the
+   //! message.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Encode(EncodeSink& clSink_, IntermediateHeader& stHeader_, IntermediateMessage& stMessage_, MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, ENCODEFORMAT eEncodeFormat_);
+
    //----------------------------------------------------------------------------
    //! \brief Encode an OEM message header from the provided intermediate header.
    //
@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file file_index.hpp
+//! \brief Sidecar index of the frames in a log file, for seeking by time
+//! and message ID.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef NOVATEL_FILE_INDEX_HPP
+#define NOVATEL_FILE_INDEX_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+#include "decoders/common/api/jsonreader.hpp"
+#include "decoders/novatel/api/common.hpp"
+#include "hw_interface/stream_interface/api/inputfilestream.hpp"
+
+namespace novatel::edie::oem {
+
+//-----------------------------------------------------------------------
+//! \struct FileIndexEntry
+//! \brief The location and header fields of one framed log.  This is the
+//! on-disk record of the sidecar file.
+//-----------------------------------------------------------------------
+struct FileIndexEntry
+{
+   uint64_t ullOffset{ 0 };          //!< Offset of the first byte of the frame.
+   uint32_t uiLength{ 0 };           //!< Length of the frame in bytes.
+   uint32_t uiMilliseconds{ 0 };     //!< GPS milliseconds of the log.
+   uint16_t usWeek{ 0 };             //!< GPS week of the log, 0 if the log has no time.
+   uint16_t usMessageId{ 0 };        //!< Message ID of the log.
+   uint8_t ucFormat{ 0 };            //!< HEADERFORMAT of the frame.
+   uint8_t ucMeasurementSource{ 0 }; //!< MEASUREMENT_SOURCE of the log.
+   uint16_t usReserved{ 0 };
+};
+static_assert(sizeof(FileIndexEntry) == 24, "FileIndexEntry is an on-disk record");
+
+//-----------------------------------------------------------------------
+//! \struct FileIndexRange
+//! \brief A range of bytes [ullBegin, ullEnd) in a log file.
+//-----------------------------------------------------------------------
+struct FileIndexRange
+{
+   uint64_t ullBegin{ 0 };
+   uint64_t ullEnd{ 0 };
+};
+
+//============================================================================
+//! \class FileIndex
+//! \brief Index of the frames in a log file.
+//
+//! Build() frames and decodes the header of every log in a file once, and
+//! records where each one is.  The index can be saved next to the file and
+//! loaded in place of a rescan.  Select() then turns a time window and/or a
+//! set of message IDs into the byte ranges FileParser::SetReadRanges()
+//! should read, so a small part of a large file can be extracted without
+//! framing the rest of it.
+//
+//! Logs are not guaranteed to be in time order, so Select() uses the running
+//! maximum of the log times to find where a window can begin, and the running
+//! minimum from the end to find where it must end.  The ranges returned may
+//! contain logs just outside the window; use the Filter's time bounds to drop
+//! them.  Logs without a GPS time (such as NMEA) are only included when they
+//! fall between logs in the window.
+//============================================================================
+class FileIndex
+{
+   std::vector<FileIndexEntry> vMyEntries;
+   std::vector<uint64_t> vMyRunningMaxTime; //!< Largest time of entries [0, i].
+   std::vector<uint64_t> vMyRunningMinTime; //!< Smallest time of entries [i, end).
+
+   void BuildTimeBounds();
+   std::vector<FileIndexRange> SelectEntries(size_t ullBegin_, size_t ullEnd_, const std::vector<uint32_t>& vMessageIds_) const;
+
+public:
+   //! \brief The file extension appended to a log file's name by
+   //! GetSidecarPath().
+   static constexpr const char* szSIDECAR_EXTENSION = ".edieidx";
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the default path of the sidecar index for a log file.
+   //
+   //! \param[in] sLogFilePath_ The path of the log file.
+   //
+   //! \return sLogFilePath_ with szSIDECAR_EXTENSION appended.
+   //----------------------------------------------------------------------------
+   static std::string
+   GetSidecarPath(const std::string& sLogFilePath_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Index every log in a file.  The stream is read from the start and
+   //! left positioned at the start.
+   //
+   //! \param[in] pclInputStream_ The file to index.
+   //! \param[in] pclJsonDb_ The message DB, used to decode ASCII headers.
+   //
+   //! \return false if pclInputStream_ or pclJsonDb_ is null.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   Build(InputFileStream* pclInputStream_, JsonReader* pclJsonDb_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Save the index to a sidecar file.
+   //
+   //! \param[in] sPath_ The path of the sidecar file.
+   //
+   //! \return false if the file could not be written.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   Save(const std::string& sPath_) const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Load an index from a sidecar file.
+   //
+   //! \param[in] sPath_ The path of the sidecar file.
+   //
+   //! \return false if the file is missing, truncated or not an index.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   Load(const std::string& sPath_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the indexed frames, in file order.
+   //----------------------------------------------------------------------------
+   const std::vector<FileIndexEntry>&
+   GetEntries() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Find the byte ranges that contain the logs in a time window.
+   //
+   //! \param[in] uiLowerWeek_ GPS week of the start of the window.
+   //! \param[in] dLowerSec_ GPS seconds of the start of the window.
+   //! \param[in] uiUpperWeek_ GPS week of the end of the window, inclusive.
+   //! \param[in] dUpperSec_ GPS seconds of the end of the window, inclusive.
+   //! \param[in] vMessageIds_ If not empty, only the logs with these message
+   //! IDs are selected.
+   //
+   //! \return The ranges in file order.  Adjacent selected logs are merged into
+   //! one range.
+   //----------------------------------------------------------------------------
+   std::vector<FileIndexRange>
+   Select(uint32_t uiLowerWeek_, double dLowerSec_, uint32_t uiUpperWeek_, double dUpperSec_, const std::vector<uint32_t>& vMessageIds_ = {}) const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Find the byte ranges that contain the logs with some message IDs.
+   //
+   //! \param[in] vMessageIds_ The message IDs to select.
+   //
+   //! \return The ranges in file order.
+   //----------------------------------------------------------------------------
+   std::vector<FileIndexRange>
+   Select(const std::vector<uint32_t>& vMessageIds_) const;
+};
+
+}
+#endif // NOVATEL_FILE_INDEX_HPP
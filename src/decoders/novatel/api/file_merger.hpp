@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file file_merger.hpp
+//! \brief Merge the logs of several FileParsers into one GPS time ordered
+//! stream.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef NOVATEL_FILE_MERGER_HPP
+#define NOVATEL_FILE_MERGER_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "decoders/novatel/api/fileparser.hpp"
+
+namespace novatel::edie::oem {
+
+//============================================================================
+//! \class FileMerger
+//! \brief Read logs from several FileParsers, such as recordings of the same
+//! session from different receivers or ports, in GPS time order.
+//
+//! Each FileParser is read on its own thread into a fixed pool of look-ahead
+//! entries, so memory use does not depend on the size of the files.  Read()
+//! keeps a min-heap of the logs taken from the pools one at a time, keyed on
+//! the week and milliseconds of their MetaDataStruct, so the order returned
+//! does not depend on thread timing.  It returns the earliest log once
+//! every other source has read past its time by more than the reorder
+//! window.  Logs that a source writes up to the window behind its latest
+//! log are therefore still returned in order.  Logs without a GPS time, such
+//! as unknown bytes, take the time of the log before them in their source.
+//! Logs with the same time are returned by source, in the order the sources
+//! were added, and then in the order they were read.
+//
+//! If a source's look-ahead is exhausted while it is still within the
+//! window of another source, its earliest log is returned anyway, so a
+//! window that is too wide for the look-ahead only weakens the ordering.
+//
+//! The FileParsers must be configured before the first Read(), and must not
+//! be used directly while the FileMerger is reading them.  Read() must be
+//! called from a single thread.
+//============================================================================
+class FileMerger
+{
+   FileMerger(const FileMerger&) = delete;
+   FileMerger(const FileMerger&&) = delete;
+   FileMerger& operator=(const FileMerger&) = delete;
+
+public:
+   //! \brief uiDEFAULT_LOOK_AHEAD: the default number of logs buffered per
+   //! source.
+   static constexpr uint32_t uiDEFAULT_LOOK_AHEAD = 64;
+
+private:
+   struct Entry
+   {
+      STATUS eStatus{ STATUS::UNKNOWN };
+      MetaDataStruct stMetaData;
+      MessageDataStruct stMessageData;
+      std::vector<unsigned char> vData; //!< A copy of the log, which stMessageData points into.
+      double dTime{ 0.0 };              //!< GPS milliseconds since the start of week 0.
+      uint64_t ullSequence{ 0 };        //!< Position of the log in its source.
+   };
+
+   struct Source
+   {
+      FileParser* pclFileParser{ nullptr };
+      std::unique_ptr<Entry[]> pstEntries;
+
+      // Shared with the source's thread, guarded by clMutex.
+      std::mutex clMutex;
+      std::condition_variable clCondition;
+      std::vector<uint32_t> vFree;
+      std::deque<uint32_t> dqReady;
+      bool bFinished{ false };
+      std::thread clThread;
+
+      // Used only by Read().
+      uint32_t uiInHeap{ 0 };
+      bool bDrained{ false };
+      double dLatestTime{ 0.0 };
+      bool bHasLatestTime{ false };
+   };
+
+   struct HeapItem
+   {
+      double dTime;
+      uint32_t uiSource;
+      uint64_t ullSequence;
+      uint32_t uiEntry;
+   };
+
+   std::shared_ptr<spdlog::logger> pclMyLogger;
+
+   const double dMyWindowMilliseconds;
+   const uint32_t uiMyLookAhead;
+   std::vector<std::unique_ptr<Source>> vpclMySources;
+   std::vector<HeapItem> vMyHeap;
+   std::atomic<bool> bMyStop{ false };
+   bool bMyStarted{ false };
+   bool bMyHoldingEntry{ false };
+   HeapItem stMyHeldItem{};
+   double dMyLastTime{ 0.0 };
+
+   [[nodiscard]] static bool IsLater(const HeapItem& stLhs_, const HeapItem& stRhs_);
+
+   void Start();
+   void RunSource(Source& clSource_);
+   [[nodiscard]] bool IsBlocking(const Source& clSource_) const;
+   void Pull(uint32_t uiSource_);
+   void ReleaseEntry();
+
+public:
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the FileMerger class.
+   //
+   //! \param[in] dWindowMilliseconds_ How far behind the latest log of its
+   //! source a log may be written and still be returned in order.
+   //! \param[in] uiLookAhead_ The number of logs buffered per source.
+   //----------------------------------------------------------------------------
+   FileMerger(double dWindowMilliseconds_ = 0.0, uint32_t uiLookAhead_ = uiDEFAULT_LOOK_AHEAD);
+
+   //----------------------------------------------------------------------------
+   //! \brief A destructor for the FileMerger class.  Stops and joins the
+   //! source threads.
+   //----------------------------------------------------------------------------
+   ~FileMerger();
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the internal logger.
+   //
+   //! \return A shared_ptr to the spdlog::logger.
+   //----------------------------------------------------------------------------
+   std::shared_ptr<spdlog::logger>
+   GetLogger();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the level of detail produced by the internal logger.
+   //
+   //! \param[in] eLevel_ The logging level to enable.
+   //----------------------------------------------------------------------------
+   void
+   SetLoggerLevel(spdlog::level::level_enum eLevel_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Add a FileParser to merge.  Its stream must already be set.
+   //
+   //! \param [in] pclFileParser_ A pointer to the FileParser, which must
+   //! outlive the FileMerger.
+   //
+   //! \return false if the FileParser is null or Read() has been called.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   AddSource(FileParser* pclFileParser_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the number of FileParsers added.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] uint32_t
+   GetSourceCount() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Read the next log in GPS time order.  The sources' threads are
+   //! started by the first call.
+   //
+   //! \param [out] stMessageData_ A reference to a MessageDataStruct to be
+   //! populated.  It stays valid until the next call.
+   //! \param [out] stMetaData_ A reference to a MetaDataStruct to be
+   //! populated.
+   //! \param [out] uiSource_ The index of the source the log was read from,
+   //! in the order the sources were added.
+   //
+   //! \return An error code describing the result of parsing.
+   //!   SUCCESS: A log was returned.
+   //!   UNKNOWN: Unknown bytes were returned by a FileParser configured to
+   //! return them.
+   //!   STREAM_EMPTY: Every source has been read to its end.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, uint32_t& uiSource_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Read the next log in GPS time order.
+   //
+   //! \param [out] stMessageData_ A reference to a MessageDataStruct to be
+   //! populated.  It stays valid until the next call.
+   //! \param [out] stMetaData_ A reference to a MetaDataStruct to be
+   //! populated.
+   //
+   //! \return An error code describing the result of parsing, see above.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_);
+};
+}
+
+#endif // NOVATEL_FILE_MERGER_HPP
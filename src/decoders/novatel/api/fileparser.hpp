@@ -38,6 +38,7 @@
 //-----------------------------------------------------------------------
 #include <unordered_map>
 #include "decoders/common/api/common.hpp"
+#include "decoders/novatel/api/file_index.hpp"
 #include "decoders/novatel/api/parser.hpp"
 #include "hw_interface/stream_interface/api/inputfilestream.hpp"
 #include "hw_interface/stream_interface/api/outputfilestream.hpp"
@@ -50,6 +51,11 @@ namespace novatel::edie::oem {
 //============================================================================
 class FileParser
 {
+public:
+   //! \brief uiSEEK_SCAN_BYTES: SeekToTime() bisects until the log it is
+   //! looking for is within this many bytes, then scans forward.
+   static constexpr uint32_t uiSEEK_SCAN_BYTES = 65536;
+
    //! TODO: Manage copy/move/assignment constructors better.
    //! NOTE: The following constructors prevent this class from ever being
    //! constructed from a copy, move or assignment.
@@ -59,6 +65,7 @@ class FileParser
 
 private:
    std::shared_ptr<spdlog::logger> pclMyLogger;
+   LogRateLimiter clMyLogRateLimiter;
 
    Parser clMyParser;
    InputFileStream* pclMyInputStream;
@@ -66,7 +73,18 @@ private:
    ReadDataStructure stMyReadData;
    unsigned char* const pcMyStreamReadBuffer;
 
+   std::vector<FileIndexRange> vMyReadRanges;
+   size_t ullMyReadRange{ 0 };
+   uint64_t ullMyStreamPosition{ 0 };
+
+   // Components for probing the stream in SeekToTime()
+   Framer clMySeekFramer;
+   HeaderDecoder clMySeekHeaderDecoder;
+
    [[nodiscard]] bool ReadStream();
+   template <typename MessageData> [[nodiscard]] STATUS ReadMessage(MessageData& tMessageData_, MetaDataStruct& stMetaData_);
+   void SeekToReadRange();
+   [[nodiscard]] bool FindTimedFrame(uint64_t ullPosition_, uint64_t ullTarget_, unsigned char* pucFrameBuffer_, uint64_t& ullFrameOffset_, uint64_t& ullFrameTime_);
 
 public:
    //----------------------------------------------------------------------------
@@ -208,6 +226,24 @@ public:
    ENCODEFORMAT
    GetEncodeFormat();
 
+   //----------------------------------------------------------------------------
+   //! \brief Set the encode formats of Read(std::vector<MessageDataStruct>&,
+   //! MetaDataStruct&).  See Parser::SetEncodeFormats().
+   //
+   //! \param [in] vFormats_ The encode formats for future messages.
+   //----------------------------------------------------------------------------
+   void
+   SetEncodeFormats(const std::vector<ENCODEFORMAT>& vFormats_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the encode formats of Read(std::vector<MessageDataStruct>&,
+   //! MetaDataStruct&).
+   //
+   //! \return The current encode formats for messages.
+   //----------------------------------------------------------------------------
+   const std::vector<ENCODEFORMAT>&
+   GetEncodeFormats() const;
+
    //----------------------------------------------------------------------------
    //! \brief Set the Filter for the FileParser.
    //
@@ -225,7 +261,67 @@ public:
    GetFilter();
 
    //----------------------------------------------------------------------------
-   //! \brief Set the InputFileStream for the FileParser.
+   //! \brief Set the Deduplicator for the FileParser.
+   //
+   //! \param [in] pclDeduplicator_ A pointer to a Deduplicator, or nullptr to
+   //! keep duplicate logs.
+   //----------------------------------------------------------------------------
+   void
+   SetDeduplicator(Deduplicator* pclDeduplicator_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the Deduplicator for the FileParser.
+   //
+   //! \return A pointer to the FileParser's Deduplicator, if one is set.
+   //----------------------------------------------------------------------------
+   Deduplicator*
+   GetDeduplicator();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set an EncodeSink for the FileParser to encode messages into.
+   //! See Parser::SetEncodeSink().
+   //
+   //! \param [in] pclEncodeSink_ A pointer to an EncodeSink, or nullptr to
+   //! encode into the internal buffer.
+   //----------------------------------------------------------------------------
+   void
+   SetEncodeSink(EncodeSink* pclEncodeSink_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the EncodeSink for the FileParser.
+   //
+   //! \return A pointer to the FileParser's EncodeSink, if one is set.
+   //----------------------------------------------------------------------------
+   EncodeSink*
+   GetEncodeSink();
+
+   //----------------------------------------------------------------------------
+   //! \brief Enable or disable the collection of statistics by the internal
+   //! Parser.  Do not call this while another thread is inside Read().
+   //
+   //! \param [in] bEnable_ true to collect statistics.
+   //----------------------------------------------------------------------------
+   void
+   EnableStatistics(bool bEnable_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get a snapshot of the internal Parser's statistics.  This may be
+   //! called from another thread while the FileParser is reading.
+   //
+   //! \return A snapshot of the statistics collected so far.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] ParserStatistics
+   GetStatistics() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Zero the internal Parser's statistics.
+   //----------------------------------------------------------------------------
+   void
+   ResetStatistics();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the InputFileStream for the FileParser.  Compressed files
+   //! can be read through an InputCompressedFileStream.
    //
    //! \param [in] pclInputStream_ A pointer to the input stream.
    //
@@ -234,6 +330,36 @@ public:
    [[nodiscard]] bool
    SetStream(InputFileStream* pclInputStream_);
 
+   //----------------------------------------------------------------------------
+   //! \brief Restrict the FileParser to ranges of bytes in the stream, such as
+   //! those selected by a FileIndex.  The ranges are read in order, and the
+   //! bytes outside of them are skipped.  Setting a new stream clears them.
+   //
+   //! \param [in] vRanges_ The ranges to read, in file order.  An empty vector
+   //! reads the whole stream again.
+   //
+   //! \return false if no stream has been set.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   SetReadRanges(const std::vector<FileIndexRange>& vRanges_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Move the stream to the first log at or after a GPS time, without
+   //! an index.  The file is bisected: at each probe position the stream is
+   //! re-framed until a log header with a GPS time is found.  Logs are assumed
+   //! to be written in time order, and logs without a GPS time are skipped
+   //! over.  Any read ranges are cleared.  A stream that is not random access,
+   //! such as a compressed file, is scanned from the start instead.
+   //
+   //! \param [in] uiWeek_ The GPS week to seek to.
+   //! \param [in] dSec_ The GPS seconds to seek to.
+   //
+   //! \return false if there is no stream or no log at or after the time, in
+   //! which case the FileParser is left where it was.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   SeekToTime(uint32_t uiWeek_, double dSec_);
+
    //----------------------------------------------------------------------------
    //! \brief Read a log from the FileParser.
    //
@@ -252,9 +378,26 @@ public:
    [[nodiscard]] STATUS
    Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_);
 
+   //----------------------------------------------------------------------------
+   //! \brief Read a log from the FileParser and encode it into each of the
+   //! formats set by SetEncodeFormats().
+   //
+   //! \param [out] vMessageData_ Resized to one MessageDataStruct per encode
+   //! format.  See Parser::Read(std::vector<MessageDataStruct>&,
+   //! MetaDataStruct&, bool).
+   //! \param [out] stMetaData_ A reference to a MetaDataStruct to be populated
+   //! by the FileParser.
+   //
+   //! \return An error code describing the result of parsing, as in
+   //! Read(MessageDataStruct&, MetaDataStruct&).
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Read(std::vector<MessageDataStruct>& vMessageData_, MetaDataStruct& stMetaData_);
+
    //----------------------------------------------------------------------------
    //! \brief Reset the InputFileStream, and flush all bytes from the internal
-   //! FileParser.
+   //! FileParser.  If read ranges are set, the stream is reset to the start of
+   //! the first one.
    //
    //! \return A boolean describing if the operation was successful.
    //----------------------------------------------------------------------------
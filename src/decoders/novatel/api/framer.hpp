@@ -47,6 +47,12 @@ namespace novatel::edie::oem {
 //============================================================================
 class Framer : public FramerInterface
 {
+public:
+   //! \brief uiDEFAULT_ABBREV_ASCII_IDLE_MILLISECONDS: how long no bytes must
+   //! be written before a held abbreviated ASCII log is released, by default.
+   //! Long enough that gaps between reads of a serial port do not end a log.
+   static constexpr uint32_t uiDEFAULT_ABBREV_ASCII_IDLE_MILLISECONDS = 50;
+
 private:
 
    // -------------------------------------------------------------------------------------------------------
@@ -58,6 +64,10 @@ private:
    uint32_t uiMyJsonObjectOpenBraces{ 0 };
    uint32_t uiMyAbbrevAsciiHeaderPosition{ 0 };
 
+   bool bMyCompleteAbbrevAscii{ false };
+   uint32_t uiMyAbbrevAsciiIdleMilliseconds{ uiDEFAULT_ABBREV_ASCII_IDLE_MILLISECONDS };
+   uint64_t ullMyLastWriteNanoseconds{ 0 };
+
    virtual void HandleUnknownBytes(unsigned char* pucBuffer_, uint32_t uiUnknownBytes_);
 
    //----------------------------------------------------------------------------
@@ -70,6 +80,9 @@ private:
    bool IsSpaceCRLF(uint32_t uiCircularBufferPosition_) const;
    bool IsEmptyLine(uint32_t uiCircularBufferPosition_) const;
    bool IsAbbrevAsciiResponse() const;
+   uint32_t GetAbbrevAsciiIndentation(uint32_t uiLineStart_, uint32_t uiLineEnd_) const;
+   bool IsAbbrevAsciiArrayOpen() const;
+   bool IsAbbrevAsciiEndOfStream() const;
 
 public:
    //----------------------------------------------------------------------------
@@ -102,6 +115,54 @@ public:
    void
    SetPayloadOnly(bool bPayloadOnly_);
 
+   //----------------------------------------------------------------------------
+   //! \brief Should the Framer end an abbreviated ASCII log at the last bytes
+   //! written, rather than waiting for the next log to show that it is over?
+   //
+   //! Abbreviated ASCII logs have no terminator, so the last one received
+   //! on a live port is otherwise held until more data arrives.  When
+   //! enabled, a log whose buffered bytes end in a CRLF is released if:
+   //!   - the last line does not end with a separator, which the Framer
+   //! already takes to end a log, or
+   //!   - the last line is empty and indented deeper than the line before
+   //! it, which closes an empty array, or
+   //!   - no bytes have been written for uiIdleMilliseconds_ and every array
+   //! in the log has as many elements as its size.
+   //
+   //! A log with an array still missing elements is held however long the
+   //! stream pauses.
+   //
+   //! \param[in] bEnable_ true to release abbreviated ASCII logs early.
+   //! \param[in] uiIdleMilliseconds_ How long no bytes must be written before
+   //! a log with no array missing elements is released, or 0 to only use the
+   //! structure of the log.
+   //----------------------------------------------------------------------------
+   void
+   SetAbbrevAsciiCompletion(bool bEnable_, uint32_t uiIdleMilliseconds_ = uiDEFAULT_ABBREV_ASCII_IDLE_MILLISECONDS);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get how long no bytes must be written before a held abbreviated
+   //! ASCII log is released.
+   //
+   //! \return The idle time in milliseconds, or 0 if abbreviated ASCII
+   //! completion is disabled or only uses the structure of the log.
+   //----------------------------------------------------------------------------
+   uint32_t
+   GetAbbrevAsciiIdleMilliseconds() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Write new bytes to the internal circular buffer, noting when
+   //! they arrived if abbreviated ASCII completion is enabled.
+   //
+   //! \param[in] pucDataBuffer_ The data buffer containing the bytes to be
+   //! written into the framer buffer.
+   //! \param[in] uiDataBytes_ The number of bytes contained in pucDataBuffer_.
+   //
+   //! \return The number of bytes written to the internal circular buffer.
+   //----------------------------------------------------------------------------
+   uint32_t
+   Write(unsigned char* pucDataBuffer_, uint32_t uiDataBytes_) override;
+
    //----------------------------------------------------------------------------
    //! \brief Frame an OEM message from bytes written to the Framer.
    //
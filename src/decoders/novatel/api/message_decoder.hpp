@@ -36,6 +36,7 @@
 //-----------------------------------------------------------------------
 // Includes
 //-----------------------------------------------------------------------
+#include "decoders/common/api/ascii_tokenizer.hpp"
 #include "decoders/common/api/common.hpp"
 #include "decoders/common/api/crc32.hpp"
 #include "decoders/common/api/jsonreader.hpp"
@@ -46,6 +47,7 @@
 #include <logger/logger.hpp>
 #include <variant>
 #include <string>
+#include <unordered_map>
 #include <sstream>
 #include <cassert>
 #include <iostream>
@@ -84,6 +86,13 @@ struct FieldContainer
 typedef std::vector<FieldContainer> IntermediateMessage;
 typedef const std::vector<novatel::edie::BaseField*> MsgFieldsVector;
 
+//! Decodes the binary bodies of the message definitions it was generated
+//! for, such as DecodeBinary() in the header generated by
+//! scripts/gen_cpp_specialized_codec.py.  It returns UNSUPPORTED for any
+//! other message.
+using SpecializedBinaryDecoder = STATUS (*)(uint16_t usMessageID_, uint32_t uiMessageCRC_, MsgFieldsVector& vMsgDefFields_,
+                                            const unsigned char* pucBody_, uint32_t uiBodyLength_, IntermediateMessage& stIntermediateMessage_);
+
 //============================================================================
 //! \class MessageDecoder
 //! \brief Decode OEM message bodies.
@@ -92,6 +101,7 @@ class MessageDecoder
 {
 private:
    std::shared_ptr<spdlog::logger> pclMyLogger;
+   LogRateLimiter clMyLogRateLimiter;
    JsonReader* pclMyMsgDb{ nullptr };
    EnumDefinition* vMyRespDefns{ nullptr };
    EnumDefinition* vMyCommandDefns{ nullptr };
@@ -103,6 +113,34 @@ private:
    uint32_t uiMyBufferBytesRemaining;
    uint32_t uiMyAbbrevAsciiIndentationLevel;
    MessageDefinition stMyRespDef;
+   //! Delimiters of the ASCII body being decoded.
+   AsciiTokenizer clMyAsciiTokenizer;
+
+   //! A field of a message version, and how much of it a projection wants.
+   struct ProjectedField
+   {
+      const BaseField* pclField{ nullptr };
+      bool bDecode{ false };                  //!< Decode the whole field.
+      std::vector<ProjectedField> vSubFields; //!< The fields of each FIELD_ARRAY element, when only some of them are wanted.
+   };
+
+   //! The fields a projection wants from one version (CRC) of a message.
+   struct FieldProjection
+   {
+      //! The fields of the message, up to the last one wanted.
+      std::vector<ProjectedField> vFields;
+      //! The offsets of the wanted fields from a 4-byte aligned body, if none
+      //! of them follow a string or an array of variable length.
+      std::vector<std::pair<uint32_t, const BaseField*>> vFixedOffsets;
+      bool bFixedLayout{ false };
+   };
+
+   //! Field paths to decode, by message ID.
+   std::unordered_map<uint32_t, std::vector<std::string>> umMyProjectionPaths;
+   //! Compiled projections, by the fields of each message version.
+   std::unordered_map<MsgFieldsVector*, FieldProjection> umMyProjections;
+
+   SpecializedBinaryDecoder pfMySpecializedDecoder{ nullptr };
 
    // Inline buffer functions
    [[nodiscard]] bool PrintToBuffer(char** ppcBuffer_, char* szFormat_, ...)
@@ -155,9 +193,19 @@ private:
 
    // Decode binary body
    void DecodeBinaryField(const BaseField* MessageDataType_, unsigned char** ppcLogBuf_, std::vector<FieldContainer>& vIntermediateFormat);
+   [[nodiscard]] STATUS DecodeBinaryValue(const BaseField* pclField_, unsigned char** ppucLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_, uint32_t uiMessageLength_, const unsigned char* pucTempStart_);
+   void SkipBinaryValue(const BaseField* pclField_, unsigned char** ppucLogBuf_, uint32_t uiMessageLength_, const unsigned char* pucTempStart_);
+
+   // Decode projected binary body
+   [[nodiscard]] bool CompileProjectedFields(const std::vector<BaseField*>& vMsgDefFields_, const std::vector<std::string>& vFieldPaths_, std::vector<ProjectedField>& vProjectedFields_) const;
+   const FieldProjection& GetProjection(MsgFieldsVector* pvMsgDefFields_, const std::vector<std::string>& vFieldPaths_);
+   [[nodiscard]] STATUS DecodeBinaryProjection(const FieldProjection& stProjection_, unsigned char* pucLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_, uint32_t uiMessageLength_);
+   [[nodiscard]] STATUS DecodeBinaryProjectedFields(const std::vector<ProjectedField>& vFields_, unsigned char** ppucLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_, uint32_t uiMessageLength_);
 
    // Decode ascii body
    [[nodiscard]] STATUS DecodeAbbrevAscii(const std::vector<BaseField*> MsgDefFields_, char** ppcLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_);
+   [[nodiscard]] STATUS DecodeAbbrevAsciiFields(const std::vector<BaseField*>& MsgDefFields_, char** ppcLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_);
+   [[nodiscard]] STATUS DecodeAsciiFields(const std::vector<BaseField*>& MsgDefFields_, char** ppcLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_);
    void DecodeAsciiField(const BaseField* MessageDataType_, char** ppcToken_, const size_t tokenLength_, std::vector<FieldContainer>& vIntermediateFormat);
 
    // Decode json body
@@ -206,6 +254,48 @@ public:
    void
    ShutdownLogger();
 
+   //----------------------------------------------------------------------------
+   //! \brief Decode only some of the fields of a message from binary frames.
+   //
+   //! The message decoded holds just the wanted fields, in the order they
+   //! are defined.  Where the wanted fields are at fixed offsets in the body
+   //! they are read directly, and decoding stops after the last of them.
+   //! Messages in other formats are still decoded in full.  A message
+   //! decoded this way is incomplete, so it cannot be encoded.
+   //
+   //! \param[in] strMsgName_ The name of the message, such as "BESTPOS".
+   //! \param[in] vFieldPaths_ The names of the fields to decode.  A field of
+   //! each element of a FIELD_ARRAY is named "array.field".  An empty list
+   //! decodes the whole message again.
+   //
+   //! \return An error code describing the result.
+   //!   SUCCESS: The projection was set.
+   //!   NO_DATABASE: No database was ever loaded into this component.
+   //!   NO_DEFINITION: The message, or one of the fields, is not in the
+   //! database.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   SetProjection(const std::string& strMsgName_, const std::vector<std::string>& vFieldPaths_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Decode every message in full again.
+   //----------------------------------------------------------------------------
+   void
+   ClearProjections();
+
+   //----------------------------------------------------------------------------
+   //! \brief Decode binary messages with code generated for their definitions.
+   //
+   //! Each binary message is first given to pfDecoder_, and is only decoded
+   //! from the database if pfDecoder_ returns UNSUPPORTED.  Projections are
+   //! still applied first.
+   //
+   //! \param[in] pfDecoder_ The generated decoder, or nullptr to decode every
+   //! message from the database again.
+   //----------------------------------------------------------------------------
+   void
+   SetSpecializedDecoder(SpecializedBinaryDecoder pfDecoder_);
+
    //----------------------------------------------------------------------------
    //! \brief Decode an OEM message body from the provided frame.
    //
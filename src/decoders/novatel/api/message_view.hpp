@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file message_view.hpp
+//! \brief Helpers used by the message views and specialized decoders that
+//! scripts/gen_cpp_message_views.py and scripts/gen_cpp_specialized_codec.py
+//! generate from a JSON database.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef NOVATEL_MESSAGE_VIEW_HPP
+#define NOVATEL_MESSAGE_VIEW_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <stdint.h>
+#include <string.h>
+#include <iterator>
+#include <string_view>
+
+namespace novatel::edie::oem {
+
+//----------------------------------------------------------------------------
+//! \brief Align a body offset the way the receiver aligns a binary field
+//! whose data type is uiDataTypeLength_ bytes long.
+//
+//! Offsets are relative to the start of the message body, which follows
+//! the 28 byte OEM4 binary header and so is 4-byte aligned in the frame.
+//----------------------------------------------------------------------------
+constexpr uint32_t AlignBinaryOffset(uint32_t uiOffset_, uint32_t uiDataTypeLength_)
+{
+   const uint32_t uiAlignment = uiDataTypeLength_ >= 4 ? 4 : (uiDataTypeLength_ == 0 ? 1 : uiDataTypeLength_);
+   return uiOffset_ % uiAlignment == 0 ? uiOffset_ : uiOffset_ + uiAlignment - uiOffset_ % uiAlignment;
+}
+
+//----------------------------------------------------------------------------
+//! \brief Read a value from a binary message, which may not be aligned for
+//! the type.
+//----------------------------------------------------------------------------
+template <typename T> T ReadBinaryValue(const unsigned char* pucData_)
+{
+   T tValue;
+   memcpy(&tValue, pucData_, sizeof(T));
+   return tValue;
+}
+
+//----------------------------------------------------------------------------
+//! \brief Write a value to a binary message, which may not be aligned for
+//! the type.
+//----------------------------------------------------------------------------
+template <typename T> void WriteBinaryValue(unsigned char* pucData_, T tValue_)
+{
+   memcpy(pucData_, &tValue_, sizeof(T));
+}
+
+//----------------------------------------------------------------------------
+//! \brief Offset of the first field after a null-terminated string that
+//! starts at uiOffset_.  The string is padded to a multiple of 4 bytes.
+//----------------------------------------------------------------------------
+inline uint32_t BinaryStringEnd(const unsigned char* pucBody_, uint32_t uiOffset_)
+{
+   const auto uiEnd = static_cast<uint32_t>(uiOffset_ + strlen(reinterpret_cast<const char*>(pucBody_ + uiOffset_)) + 1);
+   return AlignBinaryOffset(uiEnd, 4);
+}
+
+//============================================================================
+//! \class BinaryArrayView
+//! \brief A fixed or variable length array of simple values in a binary
+//! message.  The values are read when they are accessed.
+//============================================================================
+template <typename T> class BinaryArrayView
+{
+ public:
+   BinaryArrayView(const unsigned char* pucData_, uint32_t uiSize_) : pucMyData(pucData_), uiMySize(uiSize_) {}
+
+   [[nodiscard]] uint32_t size() const { return uiMySize; }
+   [[nodiscard]] bool empty() const { return uiMySize == 0; }
+   [[nodiscard]] const unsigned char* data() const { return pucMyData; }
+   T operator[](uint32_t uiIndex_) const { return ReadBinaryValue<T>(pucMyData + uiIndex_ * sizeof(T)); }
+
+ private:
+   const unsigned char* pucMyData;
+   uint32_t uiMySize;
+};
+
+//============================================================================
+//! \class BinaryFieldArrayView
+//! \brief A field array in a binary message, viewed one element at a time
+//! through the generated element view V.
+//
+//! Elements may contain strings or variable length arrays, so they are
+//! found by walking the array.  Use the iterators to visit every element
+//! rather than operator[], which walks from the first element each time
+//! unless the elements have a fixed size.
+//============================================================================
+template <typename V> class BinaryFieldArrayView
+{
+ public:
+   class Iterator
+   {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = V;
+      using difference_type = std::ptrdiff_t;
+      using pointer = void;
+      using reference = V;
+
+      Iterator(const unsigned char* pucBody_, uint32_t uiOffset_, uint32_t uiIndex_)
+         : pucMyBody(pucBody_), uiMyOffset(uiOffset_), uiMyIndex(uiIndex_)
+      {
+      }
+
+      V operator*() const { return V(pucMyBody, uiMyOffset); }
+      Iterator& operator++()
+      {
+         uiMyOffset = V(pucMyBody, uiMyOffset).End();
+         uiMyIndex++;
+         return *this;
+      }
+      bool operator==(const Iterator& clOther_) const { return uiMyIndex == clOther_.uiMyIndex; }
+      bool operator!=(const Iterator& clOther_) const { return uiMyIndex != clOther_.uiMyIndex; }
+
+    private:
+      const unsigned char* pucMyBody;
+      uint32_t uiMyOffset;
+      uint32_t uiMyIndex;
+   };
+
+   BinaryFieldArrayView(const unsigned char* pucBody_, uint32_t uiOffset_, uint32_t uiSize_)
+      : pucMyBody(pucBody_), uiMyOffset(uiOffset_), uiMySize(uiSize_)
+   {
+   }
+
+   [[nodiscard]] uint32_t size() const { return uiMySize; }
+   [[nodiscard]] bool empty() const { return uiMySize == 0; }
+   [[nodiscard]] Iterator begin() const { return Iterator(pucMyBody, uiMyOffset, 0); }
+   [[nodiscard]] Iterator end() const { return Iterator(pucMyBody, uiMyOffset, uiMySize); }
+
+   V operator[](uint32_t uiIndex_) const
+   {
+      if constexpr (V::bFIXED_SIZE)
+      {
+         // Fixed size elements are a multiple of 4 bytes long, so they are equally spaced.
+         const V clFirst(pucMyBody, uiMyOffset);
+         return V(pucMyBody, uiMyOffset + uiIndex_ * (clFirst.End() - uiMyOffset));
+      }
+      else
+      {
+         auto itElement = begin();
+         for (uint32_t i = 0; i < uiIndex_; i++) { ++itElement; }
+         return *itElement;
+      }
+   }
+
+   //! Offset of the first field after the array.
+   [[nodiscard]] uint32_t End() const
+   {
+      if (uiMySize == 0) { return uiMyOffset; }
+      if constexpr (V::bFIXED_SIZE) { return uiMyOffset + uiMySize * (V(pucMyBody, uiMyOffset).End() - uiMyOffset); }
+      uint32_t uiEnd = uiMyOffset;
+      for (uint32_t i = 0; i < uiMySize; i++) { uiEnd = V(pucMyBody, uiEnd).End(); }
+      return uiEnd;
+   }
+
+ private:
+   const unsigned char* pucMyBody;
+   uint32_t uiMyOffset;
+   uint32_t uiMySize;
+};
+
+} // namespace novatel::edie::oem
+
+#endif // NOVATEL_MESSAGE_VIEW_HPP
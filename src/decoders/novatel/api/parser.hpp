@@ -37,13 +37,17 @@
 // Includes
 //-----------------------------------------------------------------------
 #include <exception>
+#include <memory>
+#include <vector>
 #include "decoders/common/api/common.hpp"
 #include "decoders/novatel/api/common.hpp"
+#include "decoders/novatel/api/deduplicator.hpp"
 #include "decoders/novatel/api/header_decoder.hpp"
 #include "decoders/novatel/api/message_decoder.hpp"
 #include "decoders/novatel/api/encoder.hpp"
 #include "decoders/novatel/api/filter.hpp"
 #include "decoders/novatel/api/framer.hpp"
+#include "decoders/novatel/api/parser_statistics.hpp"
 #include "decoders/novatel/api/rangecmp/common.hpp"
 #include "decoders/novatel/api/rangecmp/range_decompressor.hpp"
 #include "decoders/novatel/api/rxconfig/rxconfig_handler.hpp"
@@ -72,9 +76,16 @@ public:
 
 private:
    std::shared_ptr<spdlog::logger> pclMyLogger;
+   LogRateLimiter clMyLogRateLimiter;
+   ParserStatisticsCollector clMyStatistics;
 
    JsonReader clMyJsonReader;
+   //! The DB the Parser decodes with: clMyJsonReader, or one shared with the
+   //! caller, which must outlive the Parser.
+   JsonReader* pclMyJsonDb{ nullptr };
    Filter* pclMyUserFilter{ nullptr };
+   Deduplicator* pclMyDeduplicator{ nullptr };
+   EncodeSink* pclMyEncodeSink{ nullptr };
    Framer clMyFramer;
    HeaderDecoder clMyHeaderDecoder;
    MessageDecoder clMyMessageDecoder;
@@ -89,7 +100,6 @@ private:
    Filter clMyRxConfigFilter;
 
    unsigned char* const pcMyEncodeBuffer{ nullptr };
-   unsigned char* pucMyEncodeBufferPointer{ nullptr };
    unsigned char* const pcMyFrameBuffer{ nullptr };
    unsigned char* pucMyFrameBufferPointer{ nullptr };
 
@@ -99,6 +109,20 @@ private:
    bool bMyIgnoreAbbreviatedASCIIResponse{ true };
    ENCODEFORMAT eMyEncodeFormat{ ENCODEFORMAT::ASCII };
 
+   // Fan-out encoding
+   std::vector<ENCODEFORMAT> vMyEncodeFormats;
+   //! Encode buffers for every format after the first, which is encoded into
+   //! pcMyEncodeBuffer.
+   std::vector<std::unique_ptr<unsigned char[]>> vMyFanOutEncodeBuffers;
+
+   void LogStageStatus(PARSER_STAGE eStage_, STATUS eStatus_, uint32_t uiMessageId_);
+
+   unsigned char* GetEncodeBuffer(size_t ullFormat_);
+
+   [[nodiscard]] STATUS ReadFormats(MessageDataStruct* astMessageData_, const ENCODEFORMAT* aeFormats_, size_t ullFormatCount_, MetaDataStruct& stMetaData_, bool bDecodeIncompleteAbbv_);
+
+   [[nodiscard]] STATUS ConvertRxConfig(MessageDataStruct* astMessageData_, const ENCODEFORMAT* aeFormats_, size_t ullFormatCount_, MetaDataStruct& stMetaData_);
+
 public:
    //----------------------------------------------------------------------------
    //! \brief A constructor for the Parser class.
@@ -118,6 +142,7 @@ public:
    //! \brief A constructor for the Parser class.
    //
    //! \param[in] pclJsonDb_ A pointer to a JsonReader object. Defaults to nullptr.
+   //! The DB is shared, not copied, so it must outlive the Parser.
    //----------------------------------------------------------------------------
    Parser(JsonReader* pclJsonDb_ = nullptr);
 
@@ -183,6 +208,30 @@ public:
    bool
    GetIgnoreAbbreviatedAsciiResponses(void);
 
+   //----------------------------------------------------------------------------
+   //! \brief Release abbreviated ASCII logs once their last line has arrived,
+   //! rather than when the next log starts.  See
+   //! Framer::SetAbbrevAsciiCompletion().  Keep calling Read() while waiting
+   //! for data so that idle logs are released.
+   //
+   //! \param [in] bEnable_ true to release abbreviated ASCII logs early.
+   //! \param [in] uiIdleMilliseconds_ How long no bytes must be written
+   //! before a log with no array missing elements is released, or 0 to only
+   //! use the structure of the log.
+   //----------------------------------------------------------------------------
+   void
+   SetAbbrevAsciiCompletion(bool bEnable_, uint32_t uiIdleMilliseconds_ = Framer::uiDEFAULT_ABBREV_ASCII_IDLE_MILLISECONDS);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get how long no bytes must be written before a held abbreviated
+   //! ASCII log is released.
+   //
+   //! \return The idle time in milliseconds, or 0 if abbreviated ASCII
+   //! completion is disabled or only uses the structure of the log.
+   //----------------------------------------------------------------------------
+   uint32_t
+   GetAbbrevAsciiIdleMilliseconds() const;
+
    //----------------------------------------------------------------------------
    //! \brief Set the decompression option for RANGECMP messages.
    //
@@ -231,6 +280,28 @@ public:
    ENCODEFORMAT
    GetEncodeFormat();
 
+   //----------------------------------------------------------------------------
+   //! \brief Set the encode formats of Read(std::vector<MessageDataStruct>&,
+   //! MetaDataStruct&, bool).  Each message is framed and decoded once and
+   //! then encoded once per format, so several consumers can be fed from one
+   //! Parser.
+   //
+   //! \param [in] vFormats_ The encode formats for future messages, in the
+   //! order their MessageDataStructs are returned.  If empty, the format set
+   //! by SetEncodeFormat() is used.
+   //----------------------------------------------------------------------------
+   void
+   SetEncodeFormats(const std::vector<ENCODEFORMAT>& vFormats_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the encode formats of Read(std::vector<MessageDataStruct>&,
+   //! MetaDataStruct&, bool).
+   //
+   //! \return The current encode formats for messages.
+   //----------------------------------------------------------------------------
+   const std::vector<ENCODEFORMAT>&
+   GetEncodeFormats() const;
+
    //----------------------------------------------------------------------------
    //! \brief Set the Filter for the FileParser.
    //
@@ -247,6 +318,75 @@ public:
    Filter*
    GetFilter();
 
+   //----------------------------------------------------------------------------
+   //! \brief Set the Deduplicator for the Parser.  Logs that pass the Filter
+   //! and that the Deduplicator has seen recently are dropped.
+   //
+   //! \param [in] pclDeduplicator_ A pointer to a Deduplicator, or nullptr to
+   //! keep duplicate logs.
+   //----------------------------------------------------------------------------
+   void
+   SetDeduplicator(Deduplicator* pclDeduplicator_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the Deduplicator for the Parser.
+   //
+   //! \return A pointer to the Parser's Deduplicator, if one is set.
+   //----------------------------------------------------------------------------
+   Deduplicator*
+   GetDeduplicator();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set an EncodeSink for the Parser to encode messages into, rather
+   //! than its internal buffer.  This lifts the uiPARSER_INTERNAL_BUFFER_SIZE
+   //! limit on encoded messages, such as large logs encoded to JSON.
+   //!
+   //! Messages returned with SUCCESS, including converted RXCONFIG logs, are
+   //! committed to the sink and the MessageDataStruct points into it.  With
+   //! several encode formats only the first is written to the sink.
+   //! Abbreviated ASCII responses and unknown bytes are not written to it.
+   //
+   //! \param [in] pclEncodeSink_ A pointer to an EncodeSink, or nullptr to
+   //! encode into the internal buffer.
+   //----------------------------------------------------------------------------
+   void
+   SetEncodeSink(EncodeSink* pclEncodeSink_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the EncodeSink for the Parser.
+   //
+   //! \return A pointer to the Parser's EncodeSink, if one is set.
+   //----------------------------------------------------------------------------
+   EncodeSink*
+   GetEncodeSink();
+
+   //----------------------------------------------------------------------------
+   //! \brief Enable or disable the collection of statistics.  Collection is
+   //! disabled by default and costs nothing while disabled.  Do not call this
+   //! while another thread is inside Read().
+   //
+   //! \param [in] bEnable_ true to collect statistics.
+   //----------------------------------------------------------------------------
+   void
+   EnableStatistics(bool bEnable_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get a snapshot of the statistics collected so far.  This may be
+   //! called from another thread while the Parser is reading.
+   //
+   //! \return Per-stage call counts and cumulative nanoseconds, Read() result
+   //! counts per STATUS, decoded header counts per HEADERFORMAT and
+   //! message ID and the number of unknown bytes.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] ParserStatistics
+   GetStatistics() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Zero the statistics collected so far.
+   //----------------------------------------------------------------------------
+   void
+   ResetStatistics();
+
    //----------------------------------------------------------------------------
    //! \brief Get a pointer to the current framed log raw data.
    //
@@ -255,6 +395,14 @@ public:
    unsigned char*
    GetInternalBuffer();
 
+   //----------------------------------------------------------------------------
+   //! \brief Get the message DB used by the Parser.
+   //
+   //! \return A pointer to the JSON message DB, or nullptr if none is loaded.
+   //----------------------------------------------------------------------------
+   JsonReader*
+   GetJsonDb();
+
    //----------------------------------------------------------------------------
    //! \brief Write bytes to the Parser to be parsed.
    //
@@ -287,6 +435,30 @@ public:
    [[nodiscard]] STATUS
    Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, bool bDecodeIncompleteAbbv = false);
 
+   //----------------------------------------------------------------------------
+   //! \brief Read a log from the Parser and encode it into each of the formats
+   //! set by SetEncodeFormats().
+   //!
+   //! Each format is encoded into its own internal buffer, which is valid
+   //! until the next call to Read().  Unknown bytes and messages that are not
+   //! encoded, such as abbreviated ASCII responses, are returned as is in
+   //! every MessageDataStruct.
+   //
+   //! \param [out] vMessageData_ Resized to one MessageDataStruct per encode
+   //! format, each populated as in Read(MessageDataStruct&, MetaDataStruct&,
+   //! bool).
+   //! \param [out] stMetaData_ A reference to a MetaDataStruct to be populated
+   //! by the Parser.
+   //! \param [in] bDecodeIncompleteAbbv As in Read(MessageDataStruct&,
+   //! MetaDataStruct&, bool).
+   //
+   //! \return An error code describing the result of parsing, as in
+   //! Read(MessageDataStruct&, MetaDataStruct&, bool).  SUCCESS is only
+   //! returned once the message is encoded in every format.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Read(std::vector<MessageDataStruct>& vMessageData_, MetaDataStruct& stMetaData_, bool bDecodeIncompleteAbbv = false);
+
    //----------------------------------------------------------------------------
    //! \brief Flush all bytes from the internal Parser.
    //
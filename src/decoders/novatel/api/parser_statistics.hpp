@@ -0,0 +1,287 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file parser_statistics.hpp
+//! \brief Throughput and latency counters for the Parser pipeline.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef NOVATEL_PARSER_STATISTICS_HPP
+#define NOVATEL_PARSER_STATISTICS_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+
+#include "decoders/common/api/common.hpp"
+#include "decoders/novatel/api/common.hpp"
+
+namespace novatel::edie::oem {
+
+//-----------------------------------------------------------------------
+//! \enum PARSER_STAGE
+//! \brief Stages of the Parser pipeline.
+//-----------------------------------------------------------------------
+enum class PARSER_STAGE : uint32_t
+{
+   FRAMER,             //!< Framer::GetFrame()
+   HEADER_DECODER,     //!< HeaderDecoder::Decode()
+   FILTER,             //!< The user Filter, if one is set.
+   DEDUPLICATOR,       //!< Deduplicator::IsDuplicate(), if one is set.
+   RANGE_DECOMPRESSOR, //!< RangeDecompressor::Decompress()
+   RXCONFIG_HANDLER,   //!< RxConfigHandler::Convert()
+   MESSAGE_DECODER,    //!< MessageDecoder::Decode()
+   ENCODER,            //!< Encoder::Encode()
+   COUNT               //!< Number of stages.
+};
+
+//! \brief uiSTATUS_COUNT: Number of STATUS values.
+constexpr uint32_t uiSTATUS_COUNT = static_cast<uint32_t>(STATUS::DECOMPRESSION_FAILURE) + 1;
+//! \brief uiHEADERFORMAT_COUNT: Number of HEADERFORMAT values, indexed by their value.
+constexpr uint32_t uiHEADERFORMAT_COUNT = static_cast<uint32_t>(HEADERFORMAT::ALL) + 1;
+//! \brief uiPARSER_STAGE_COUNT: Number of PARSER_STAGE values.
+constexpr uint32_t uiPARSER_STAGE_COUNT = static_cast<uint32_t>(PARSER_STAGE::COUNT);
+
+//-----------------------------------------------------------------------
+//! \struct StageStatistics
+//! \brief Counters for a single stage of the Parser pipeline.
+//-----------------------------------------------------------------------
+struct StageStatistics
+{
+   uint64_t ullCalls{ 0 };       //!< Number of times the stage ran.
+   uint64_t ullNanoseconds{ 0 }; //!< Cumulative time spent in the stage.
+};
+
+//-----------------------------------------------------------------------
+//! \struct ParserStatistics
+//! \brief A snapshot of the Parser's counters.
+//-----------------------------------------------------------------------
+struct ParserStatistics
+{
+   std::array<StageStatistics, uiPARSER_STAGE_COUNT> astStages{};  //!< Per-stage counters, indexed by PARSER_STAGE.
+   std::array<uint64_t, uiSTATUS_COUNT> aullReadStatus{};          //!< Parser::Read() results, indexed by STATUS.
+   std::array<uint64_t, uiHEADERFORMAT_COUNT> aullHeaderFormat{};  //!< Decoded headers, indexed by HEADERFORMAT.
+   std::map<uint16_t, uint64_t> mMessageIds;                       //!< Decoded headers per message ID, zero counts omitted.
+   uint64_t ullUnknownBytes{ 0 };                                  //!< Bytes the Framer could not identify.
+
+   const StageStatistics& GetStage(PARSER_STAGE eStage_) const { return astStages[static_cast<uint32_t>(eStage_)]; }
+   uint64_t GetReadStatus(STATUS eStatus_) const { return aullReadStatus[static_cast<uint32_t>(eStatus_)]; }
+   uint64_t GetHeaderFormat(HEADERFORMAT eFormat_) const { return aullHeaderFormat[static_cast<uint32_t>(eFormat_)]; }
+};
+
+//============================================================================
+//! \class ParserStatisticsCollector
+//! \brief Live counters behind ParserStatistics.
+//
+//! Counters are only updated by the thread running the Parser, so each
+//! update is a relaxed load and store rather than a locked read-modify-write.
+//! GetSnapshot() may be called from any thread while the Parser is running.
+//! While collection is disabled, no clock is read and nothing is updated.
+//============================================================================
+class ParserStatisticsCollector
+{
+   static constexpr uint32_t uiMESSAGE_ID_COUNT = 1U << 16;
+
+   struct AtomicStage
+   {
+      std::atomic<uint64_t> ullCalls{ 0 };
+      std::atomic<uint64_t> ullNanoseconds{ 0 };
+   };
+
+   bool bMyEnabled{ false };
+   std::array<AtomicStage, uiPARSER_STAGE_COUNT> astMyStages;
+   std::array<std::atomic<uint64_t>, uiSTATUS_COUNT> aullMyReadStatus{};
+   std::array<std::atomic<uint64_t>, uiHEADERFORMAT_COUNT> aullMyHeaderFormat{};
+   std::unique_ptr<std::atomic<uint64_t>[]> pullMyMessageIds;
+   std::atomic<uint64_t> ullMyUnknownBytes{ 0 };
+
+   static void Add(std::atomic<uint64_t>& ullCounter_, uint64_t ullValue_)
+   {
+      ullCounter_.store(ullCounter_.load(std::memory_order_relaxed) + ullValue_, std::memory_order_relaxed);
+   }
+
+public:
+   //----------------------------------------------------------------------------
+   //! \brief Enable or disable collection.  The message ID table is only
+   //! allocated the first time collection is enabled.
+   //
+   //! \param [in] bEnable_ true to collect statistics.
+   //----------------------------------------------------------------------------
+   void
+   SetEnabled(bool bEnable_)
+   {
+      if (bEnable_ && !pullMyMessageIds)
+      {
+         pullMyMessageIds = std::make_unique<std::atomic<uint64_t>[]>(uiMESSAGE_ID_COUNT);
+         for (uint32_t i = 0; i < uiMESSAGE_ID_COUNT; i++)
+         {
+            pullMyMessageIds[i].store(0, std::memory_order_relaxed);
+         }
+      }
+      bMyEnabled = bEnable_;
+   }
+
+   [[nodiscard]] bool
+   IsEnabled() const
+   {
+      return bMyEnabled;
+   }
+
+   //----------------------------------------------------------------------------
+   //! \brief Zero every counter.
+   //----------------------------------------------------------------------------
+   void
+   Reset()
+   {
+      for (AtomicStage& stStage : astMyStages)
+      {
+         stStage.ullCalls.store(0, std::memory_order_relaxed);
+         stStage.ullNanoseconds.store(0, std::memory_order_relaxed);
+      }
+      for (std::atomic<uint64_t>& ullCount : aullMyReadStatus) { ullCount.store(0, std::memory_order_relaxed); }
+      for (std::atomic<uint64_t>& ullCount : aullMyHeaderFormat) { ullCount.store(0, std::memory_order_relaxed); }
+      if (pullMyMessageIds)
+      {
+         for (uint32_t i = 0; i < uiMESSAGE_ID_COUNT; i++)
+         {
+            pullMyMessageIds[i].store(0, std::memory_order_relaxed);
+         }
+      }
+      ullMyUnknownBytes.store(0, std::memory_order_relaxed);
+   }
+
+   //----------------------------------------------------------------------------
+   //! \brief Mark the start of a stage.
+   //
+   //! \return A timestamp to pass to StageEnd(), or 0 if disabled.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] uint64_t
+   StageStart() const
+   {
+      return bMyEnabled ? static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()) : 0;
+   }
+
+   //----------------------------------------------------------------------------
+   //! \brief Record a run of a stage.
+   //
+   //! \param [in] eStage_ The stage that ran.
+   //! \param [in] ullStart_ The value returned by StageStart().
+   //----------------------------------------------------------------------------
+   void
+   StageEnd(PARSER_STAGE eStage_, uint64_t ullStart_)
+   {
+      if (bMyEnabled)
+      {
+         AtomicStage& stStage = astMyStages[static_cast<uint32_t>(eStage_)];
+         Add(stStage.ullCalls, 1);
+         Add(stStage.ullNanoseconds, StageStart() - ullStart_);
+      }
+   }
+
+   void
+   CountReadStatus(STATUS eStatus_)
+   {
+      if (bMyEnabled && static_cast<uint32_t>(eStatus_) < uiSTATUS_COUNT)
+      {
+         Add(aullMyReadStatus[static_cast<uint32_t>(eStatus_)], 1);
+      }
+   }
+
+   void
+   CountHeaderFormat(HEADERFORMAT eFormat_)
+   {
+      if (bMyEnabled && static_cast<uint32_t>(eFormat_) < uiHEADERFORMAT_COUNT)
+      {
+         Add(aullMyHeaderFormat[static_cast<uint32_t>(eFormat_)], 1);
+      }
+   }
+
+   void
+   CountMessageId(uint16_t usMessageId_)
+   {
+      if (bMyEnabled)
+      {
+         Add(pullMyMessageIds[usMessageId_], 1);
+      }
+   }
+
+   void
+   CountUnknownBytes(uint32_t uiBytes_)
+   {
+      if (bMyEnabled)
+      {
+         Add(ullMyUnknownBytes, uiBytes_);
+      }
+   }
+
+   //----------------------------------------------------------------------------
+   //! \brief Copy the counters into a snapshot.  Each counter is read
+   //! atomically, but counters may be from slightly different moments.
+   //
+   //! \return A snapshot of the counters.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] ParserStatistics
+   GetSnapshot() const
+   {
+      ParserStatistics stStatistics;
+      for (uint32_t i = 0; i < uiPARSER_STAGE_COUNT; i++)
+      {
+         stStatistics.astStages[i].ullCalls = astMyStages[i].ullCalls.load(std::memory_order_relaxed);
+         stStatistics.astStages[i].ullNanoseconds = astMyStages[i].ullNanoseconds.load(std::memory_order_relaxed);
+      }
+      for (uint32_t i = 0; i < uiSTATUS_COUNT; i++)
+      {
+         stStatistics.aullReadStatus[i] = aullMyReadStatus[i].load(std::memory_order_relaxed);
+      }
+      for (uint32_t i = 0; i < uiHEADERFORMAT_COUNT; i++)
+      {
+         stStatistics.aullHeaderFormat[i] = aullMyHeaderFormat[i].load(std::memory_order_relaxed);
+      }
+      if (pullMyMessageIds)
+      {
+         for (uint32_t i = 0; i < uiMESSAGE_ID_COUNT; i++)
+         {
+            const uint64_t ullCount = pullMyMessageIds[i].load(std::memory_order_relaxed);
+            if (ullCount > 0)
+            {
+               stStatistics.mMessageIds[static_cast<uint16_t>(i)] = ullCount;
+            }
+         }
+      }
+      stStatistics.ullUnknownBytes = ullMyUnknownBytes.load(std::memory_order_relaxed);
+      return stStatistics;
+   }
+};
+
+}
+
+#endif // NOVATEL_PARSER_STATISTICS_HPP
@@ -0,0 +1,364 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file pipelined_parser.hpp
+//! \brief Parse bytes for OEM logs, decoding and encoding on worker threads.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef NOVATEL_PIPELINED_PARSER_HPP
+#define NOVATEL_PIPELINED_PARSER_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "decoders/common/api/spscring.hpp"
+#include "decoders/novatel/api/parser.hpp"
+
+namespace novatel::edie::oem {
+
+//============================================================================
+//! \class PipelinedParser
+//! \brief Parse OEM logs like Parser, but spread the work over threads.
+//
+//! A framing thread frames the written bytes, verifies their CRC, decodes
+//! the headers and applies the Filter.  Each framed log is placed in a slot
+//! of a fixed ring and handed to one of the worker threads over a lock-free
+//! queue.  The workers decompress, decode and encode logs in parallel.  Read()
+//! consumes the slots in the order they were framed, so logs are returned in
+//! the same order, with the same statuses, as Parser would return them.
+//
+//! RANGECMP logs from the same measurement source are always given to the
+//! same worker, which processes its queue in order, so the lock time history
+//! kept by its RangeDecompressor sees them in stream order.
+//
+//! Write(), Read() and Flush() must be called from a single thread.
+//============================================================================
+class PipelinedParser
+{
+   PipelinedParser(const PipelinedParser&) = delete;
+   PipelinedParser(const PipelinedParser&&) = delete;
+   PipelinedParser& operator=(const PipelinedParser&) = delete;
+
+public:
+   //! \brief uiDEFAULT_QUEUE_DEPTH: the default number of logs in flight.
+   static constexpr uint32_t uiDEFAULT_QUEUE_DEPTH = 64;
+
+private:
+   enum class SLOT_STATE : uint32_t
+   {
+      FREE,     //!< Available to the framing thread.
+      DECODING, //!< Queued for, or being processed by, a worker.
+      DONE      //!< Ready to be returned by Read().
+   };
+
+   enum class SLOT_ACTION : uint32_t
+   {
+      DECODE,     //!< Decode and encode the log.
+      DECOMPRESS, //!< Decompress the RANGECMP log, then decode and encode it.
+      RXCONFIG    //!< Convert the log with the RxConfigHandler.
+   };
+
+   struct Slot
+   {
+      std::atomic<SLOT_STATE> eState{ SLOT_STATE::FREE };
+      SLOT_ACTION eAction{ SLOT_ACTION::DECODE };
+      ENCODEFORMAT eEncodeFormat{ ENCODEFORMAT::ASCII };
+      bool bDropped{ false }; //!< The log failed to decode or encode and is not returned.
+      STATUS eStatus{ STATUS::UNKNOWN };
+      IntermediateHeader stHeader;
+      MetaDataStruct stMetaData;
+      MessageDataStruct stMessageData;
+      std::unique_ptr<unsigned char[]> pucFrameBuffer{ new unsigned char[Parser::uiPARSER_INTERNAL_BUFFER_SIZE] };
+      std::unique_ptr<unsigned char[]> pucEncodeBuffer{ new unsigned char[Parser::uiPARSER_INTERNAL_BUFFER_SIZE] };
+   };
+
+   struct Worker
+   {
+      MessageDecoder clMessageDecoder;
+      Encoder clEncoder;
+      RangeDecompressor clRangeDecompressor;
+      RxConfigHandler clRxConfigHandler;
+      LogRateLimiter clLogRateLimiter;
+      IntermediateMessage stMessage;
+
+      SpscRing<uint32_t> clQueue; //!< Slot indices, pushed by the framing thread.
+      std::mutex clMutex;
+      std::condition_variable clCondition;
+      std::thread clThread;
+
+      Worker(JsonReader* pclJsonDb_, uint32_t uiQueueDepth_);
+   };
+
+   std::shared_ptr<spdlog::logger> pclMyLogger;
+
+   JsonReader clMyJsonReader;
+   JsonReader* pclMyJsonDb{ nullptr };
+
+   // Framing thread components
+   Framer clMyFramer;
+   MetaDataStruct stMyFramerMetaData; //!< Carries the Framer's state across partial frames, as Parser's caller does.
+   HeaderDecoder clMyHeaderDecoder;
+   Filter clMyRangeCmpFilter;
+   Filter clMyRxConfigFilter;
+   LogRateLimiter clMyLogRateLimiter;
+
+   const uint32_t uiMyQueueDepth;
+   std::unique_ptr<Slot[]> pstMySlots;
+   std::vector<std::unique_ptr<Worker>> vpclMyWorkers;
+   std::thread clMyFramingThread;
+
+   // Input, guarded by clMyInputMutex.  The framing thread also waits on
+   // clMyInputCondition for free slots.
+   std::mutex clMyInputMutex;
+   std::condition_variable clMyInputCondition;
+   std::vector<unsigned char> vMyPendingInput;
+   bool bMyPauseRequested{ false };
+   bool bMyPaused{ false };
+   std::atomic<bool> bMyStop{ false };
+   std::atomic<bool> bMyFramerIdle{ true };
+
+   // Progress, the reader waits on clMyReaderCondition.
+   std::mutex clMyReaderMutex;
+   std::condition_variable clMyReaderCondition;
+   std::atomic<uint64_t> ullMyFramedSequence{ 0 }; //!< Number of slots the framing thread has filled.
+   std::atomic<uint32_t> uiMyInFlight{ 0 };         //!< Number of slots given to workers and not yet done.
+   uint64_t ullMyReadSequence{ 0 };                 //!< Next slot to return from Read().
+   bool bMyHoldingSlot{ false };                    //!< Read() returned the current slot, which is released by the next call.
+
+   // Configuration options
+   std::atomic<Filter*> pclMyUserFilter{ nullptr };
+   std::atomic<bool> bMyDecompressRangeCmp{ true };
+   std::atomic<bool> bMyReturnUnknownBytes{ true };
+   std::atomic<bool> bMyIgnoreAbbreviatedASCIIResponse{ true };
+   std::atomic<ENCODEFORMAT> eMyEncodeFormat{ ENCODEFORMAT::ASCII };
+
+   void Start(uint32_t uiWorkerCount_);
+   Slot& GetSlot(uint64_t ullSequence_) { return pstMySlots[ullSequence_ & (uiMyQueueDepth - 1)]; }
+   void NotifyReader();
+   void ReleaseSlot();
+
+   void RunFramer();
+   void FrameLogs(std::unique_lock<std::mutex>& clLock_);
+   bool FrameLog(Slot& stSlot_, uint64_t ullSequence_);
+   void Dispatch(Slot& stSlot_, uint64_t ullSequence_);
+
+   void RunWorker(Worker& clWorker_);
+   void ProcessSlot(Worker& clWorker_, Slot& stSlot_);
+
+   void LogStageStatus(LogRateLimiter& clLogRateLimiter_, PARSER_STAGE eStage_, STATUS eStatus_, uint32_t uiMessageId_);
+
+public:
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the PipelinedParser class.
+   //
+   //! \param[in] sDbPath_ Filepath to a JSON message DB.
+   //! \param[in] uiWorkerCount_ The number of decode/encode threads.  0 uses
+   //! the hardware concurrency less the framing and reading threads.
+   //! \param[in] uiQueueDepth_ The number of logs that can be in flight
+   //! between framing and Read().  Rounded up to a power of two.
+   //----------------------------------------------------------------------------
+   PipelinedParser(const std::string sDbPath_, uint32_t uiWorkerCount_ = 0, uint32_t uiQueueDepth_ = uiDEFAULT_QUEUE_DEPTH);
+
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the PipelinedParser class.
+   //
+   //! \param[in] pclJsonDb_ A pointer to a JsonReader object, which must
+   //! outlive the PipelinedParser.
+   //! \param[in] uiWorkerCount_ The number of decode/encode threads.  0 uses
+   //! the hardware concurrency less the framing and reading threads.
+   //! \param[in] uiQueueDepth_ The number of logs that can be in flight
+   //! between framing and Read().  Rounded up to a power of two.
+   //----------------------------------------------------------------------------
+   PipelinedParser(JsonReader* pclJsonDb_, uint32_t uiWorkerCount_ = 0, uint32_t uiQueueDepth_ = uiDEFAULT_QUEUE_DEPTH);
+
+   //----------------------------------------------------------------------------
+   //! \brief A destructor for the PipelinedParser class.  Stops and joins
+   //! all threads.
+   //----------------------------------------------------------------------------
+   ~PipelinedParser();
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the internal logger.
+   //
+   //! \return A shared_ptr to the spdlog::logger.
+   //----------------------------------------------------------------------------
+   std::shared_ptr<spdlog::logger>
+   GetLogger();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the level of detail produced by the internal logger.
+   //
+   //! \param[in] eLevel_ The logging level to enable.
+   //----------------------------------------------------------------------------
+   void
+   SetLoggerLevel(spdlog::level::level_enum eLevel_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the number of decode/encode threads.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] uint32_t
+   GetWorkerCount() const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the abbreviated ASCII response option.  Applies to logs
+   //! framed after the call.
+   //
+   //! \param [in] bIgnoreAbbreivatedAsciiResponses_ true to ignore abbreivated
+   //! ASCII responses.
+   //----------------------------------------------------------------------------
+   void
+   SetIgnoreAbbreviatedAsciiResponses(bool bIgnoreAbbreivatedAsciiResponses_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the abbreviated ASCII response option.
+   //
+   //! \return The current option for ignoring abbreviated ASCII responses.
+   //----------------------------------------------------------------------------
+   bool
+   GetIgnoreAbbreviatedAsciiResponses();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the decompression option for RANGECMP messages.  Applies to
+   //! logs framed after the call.
+   //
+   //! \param [in] bDecompressRangeCmp_ true to decompress RANGECMP messages.
+   //----------------------------------------------------------------------------
+   void
+   SetDecompressRangeCmp(bool bDecompressRangeCmp_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the decompression option for RANGECMP messages.
+   //
+   //! \return The current option for decompressing RANGECMP messages.
+   //----------------------------------------------------------------------------
+   bool
+   GetDecompressRangeCmp();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the return option for unknown bytes.  Applies to bytes
+   //! framed after the call.
+   //
+   //! \param [in] bReturnUnknownBytes_ true to return unknown bytes.
+   //----------------------------------------------------------------------------
+   void
+   SetReturnUnknownBytes(bool bReturnUnknownBytes_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the return option for unknown bytes.
+   //
+   //! \return The current option for returning unknown bytes.
+   //----------------------------------------------------------------------------
+   bool
+   GetReturnUnknownBytes();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the encode format for messages.  Applies to logs framed after
+   //! the call.
+   //
+   //! \param [in] eFormat_ the encode format for future messages.
+   //----------------------------------------------------------------------------
+   void
+   SetEncodeFormat(ENCODEFORMAT eFormat_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the encode format for messages.
+   //
+   //! \return The current encode format for messages.
+   //----------------------------------------------------------------------------
+   ENCODEFORMAT
+   GetEncodeFormat();
+
+   //----------------------------------------------------------------------------
+   //! \brief Set the Filter for the PipelinedParser.  The Filter is used on
+   //! the framing thread, so do not modify it while bytes are being parsed.
+   //
+   //! \param [in] pclFilter_ A pointer to an OEM message Filter object.
+   //----------------------------------------------------------------------------
+   void
+   SetFilter(Filter* pclFilter_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Get the Filter for the PipelinedParser.
+   //
+   //! \return A pointer to the PipelinedParser's OEM message Filter object.
+   //----------------------------------------------------------------------------
+   Filter*
+   GetFilter();
+
+   //----------------------------------------------------------------------------
+   //! \brief Write bytes to the PipelinedParser to be parsed.  The bytes are
+   //! copied and framed on the framing thread.
+   //
+   //! \param [in] pucData_ Buffer containing data to be written.
+   //! \param [in] uiDataSize_ Size of data to be written.
+   //
+   //! \return The number of bytes successfully written to the PipelinedParser.
+   //----------------------------------------------------------------------------
+   uint32_t
+   Write(unsigned char* pucData_, uint32_t uiDataSize_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Read a log from the PipelinedParser.  Blocks until the next log
+   //! is ready, or until every byte written so far has been framed.
+   //
+   //! \param [out] stMessageData_ A reference to a MessageDataStruct to be
+   //! populated by the PipelinedParser.  Its pointers remain valid until the
+   //! next call to Read().
+   //! \param [out] stMetaData_ A reference to a MetaDataStruct to be populated
+   //! by the PipelinedParser.
+   //
+   //! \return An error code describing the result of parsing, as returned by
+   //! Parser::Read().
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Flush the bytes that have not been framed yet, and reset the
+   //! RANGECMP decompression history.  Logs that were already framed are still
+   //! returned by Read().
+   //
+   //! \param [in] pucBuffer_ A buffer to contain flushed bytes, if desired.
+   //! Defaults to nullptr.
+   //! \param [in] uiBufferSize_ The length of pucBuffer_, if provided.
+   //
+   //! \return The number of bytes flushed.
+   //----------------------------------------------------------------------------
+   uint32_t
+   Flush(unsigned char* pucBuffer_ = nullptr, uint32_t uiBufferSize_ = Parser::uiPARSER_INTERNAL_BUFFER_SIZE);
+};
+
+}
+#endif // NOVATEL_PIPELINED_PARSER_HPP
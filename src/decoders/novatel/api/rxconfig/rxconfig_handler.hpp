@@ -72,12 +72,16 @@ private:
    Encoder clMyEncoder;
 
    std::shared_ptr<spdlog::logger> pclMyLogger;
-   JsonReader* pclMyMsgDB;
-   EnumDefinition* vMyCommandDefns;
-   EnumDefinition* vMyPortAddrDefns;
-   EnumDefinition* vMyGPSTimeStatusDefns;
+   JsonReader* pclMyMsgDB{ nullptr };
+   EnumDefinition* vMyCommandDefns{ nullptr };
+   EnumDefinition* vMyPortAddrDefns{ nullptr };
+   EnumDefinition* vMyGPSTimeStatusDefns{ nullptr };
    MessageDefinition stMyRXConfigMsgDef;
 
+   //! Scratch RXCONFIG message, built once against the fields of
+   //! stMyRXConfigMsgDef and decoded into in place on every conversion.
+   IntermediateMessage stMyRxConfigMessage;
+
    uint32_t uiMyBufferBytesRemaining;
 
    static const char* szAbbrevASCIIEmbeddedHeaderPrefix;
@@ -194,6 +198,31 @@ public:
    [[nodiscard]] STATUS
    Convert(MessageDataStruct& stRxConfigMessageData_, MetaDataStruct& stRxConfigMetaData_, MessageDataStruct& stEmbeddedMessageData_, MetaDataStruct& stEmbeddedMetaData_, ENCODEFORMAT eEncodeFormat_);
 
+   //----------------------------------------------------------------------------
+   //! \brief Convert an RXCONFIG message that has already been framed.
+   //! This bypasses the internal Framer entirely, so no bytes need to be
+   //! written to the handler beforehand.  The decoded message is held in
+   //! storage owned by the handler and reused between calls.
+   //
+   //! \param [in] pucFrame_ Buffer containing one complete RXCONFIG frame, as
+   //! returned by Framer::GetFrame().  Abbreviated ASCII frames are modified in
+   //! place while the embedded header is decoded.
+   //! \param [out] stRxConfigMessageData_ A reference to a MessageDataStruct to be
+   //! populated by the handler, referring to the RXCONFIG message.
+   //! \param [in,out] stRxConfigMetaData_ A reference to the MetaDataStruct
+   //! produced when pucFrame_ was framed.  It is completed by the handler.
+   //! \param [out] stEmbeddedMessageData_ A reference to a MessageDataStruct to be
+   //! populated by the handler, referring to the embedded message in RXCONFIG.
+   //! \param [out] stEmbeddedMetaData_ A reference to a MetaDataStruct to be populated
+   //! by the handler, referring to the embedded message in RXCONFIG.
+   //! \param[in] eEncodeFormat_ An enum describing the format to encode the message to.
+   //
+   //! \return An error code describing the result of decoding and converting.
+   //! See novatel::edie::oem::STATUS.
+   //----------------------------------------------------------------------------
+   [[nodiscard]] STATUS
+   Convert(unsigned char* pucFrame_, MessageDataStruct& stRxConfigMessageData_, MetaDataStruct& stRxConfigMetaData_, MessageDataStruct& stEmbeddedMessageData_, MetaDataStruct& stEmbeddedMetaData_, ENCODEFORMAT eEncodeFormat_);
+
    //----------------------------------------------------------------------------
    //! \brief Flush all bytes from the internal Framer.
    //
@@ -0,0 +1,496 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file benchmarks.cpp
+//! \brief Throughput benchmarks for the OEM decoder components.
+//
+//! Usage: benchmarks <db path> [recorded files...] [benchmark options]
+//
+//! Every benchmark reports bytes/s and msgs/s.  Streams are produced by a
+//! StreamGenerator with a fixed seed so results are comparable between
+//! runs.  For trend tracking, write the results as JSON with
+//! --benchmark_out=<file> --benchmark_out_format=json.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "decoders/common/api/jsonreader.hpp"
+#include "decoders/novatel/api/encoder.hpp"
+#include "decoders/novatel/api/fileparser.hpp"
+#include "decoders/novatel/api/framer.hpp"
+#include "decoders/novatel/api/header_decoder.hpp"
+#include "decoders/novatel/api/message_decoder.hpp"
+#include "decoders/novatel/api/parser.hpp"
+#include "decoders/novatel/api/pipelined_parser.hpp"
+#include "decoders/novatel/api/rangecmp/range_decompressor.hpp"
+#include "hw_interface/stream_interface/api/inputfilestream.hpp"
+#include "hw_interface/stream_interface/api/multioutputfilestream.hpp"
+#include "stream_generator.hpp"
+
+#ifdef EDIE_SPECIALIZED_CODEC
+#include "novatel_specialized_codec.hpp"
+#endif
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+namespace {
+
+constexpr uint32_t uiRECORDS_PER_STREAM = 2000;
+constexpr uint32_t uiWRITE_CHUNK_SIZE = 4096;
+constexpr double dCORRUPTION_RATE = 0.05;
+constexpr uint32_t uiSPLIT_LOG_TYPES = 300;
+
+JsonReader clJsonDb;
+
+//-----------------------------------------------------------------------
+//! \brief Report throughput for a benchmark that processes the same data
+//! on every iteration.
+//-----------------------------------------------------------------------
+void SetThroughput(benchmark::State& clState_, size_t ullBytes_, size_t ullMessages_)
+{
+   clState_.SetBytesProcessed(static_cast<int64_t>(clState_.iterations() * ullBytes_));
+   clState_.counters["msgs/s"] = benchmark::Counter(static_cast<double>(ullMessages_), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+//-----------------------------------------------------------------------
+std::vector<unsigned char> Concatenate(const std::vector<std::vector<unsigned char>>& vRecords_)
+{
+   std::vector<unsigned char> vStream;
+   for (const auto& vRecord : vRecords_)
+   {
+      vStream.insert(vStream.end(), vRecord.begin(), vRecord.end());
+   }
+   return vStream;
+}
+
+//-----------------------------------------------------------------------
+StreamMix MixedStream(double dCorruptionRate_)
+{
+   StreamMix stMix;
+   stMix.auiWeights.fill(1);
+   stMix.auiWeights[static_cast<uint32_t>(STREAM_RECORD::BINARY)] = 4;
+   stMix.auiWeights[static_cast<uint32_t>(STREAM_RECORD::ASCII)] = 2;
+   stMix.dCorruptionRate = dCorruptionRate_;
+   return stMix;
+}
+
+//-----------------------------------------------------------------------
+void BenchmarkFramer(benchmark::State& clState_, const std::vector<unsigned char>& vStream_)
+{
+   Framer clFramer;
+   MetaDataStruct stMetaData;
+   std::vector<unsigned char> vFrame(MAX_ASCII_MESSAGE_LENGTH);
+   size_t ullFrames = 0;
+
+   for (auto _ : clState_)
+   {
+      ullFrames = 0;
+      for (size_t ullOffset = 0; ullOffset < vStream_.size(); ullOffset += uiWRITE_CHUNK_SIZE)
+      {
+         const uint32_t uiChunk = static_cast<uint32_t>(std::min<size_t>(uiWRITE_CHUNK_SIZE, vStream_.size() - ullOffset));
+         clFramer.Write(const_cast<unsigned char*>(vStream_.data()) + ullOffset, uiChunk);
+
+         STATUS eStatus = STATUS::SUCCESS;
+         while (eStatus != STATUS::BUFFER_EMPTY && eStatus != STATUS::INCOMPLETE)
+         {
+            eStatus = clFramer.GetFrame(vFrame.data(), static_cast<uint32_t>(vFrame.size()), stMetaData);
+            ullFrames += eStatus == STATUS::SUCCESS;
+         }
+      }
+      clFramer.Flush(nullptr, std::numeric_limits<uint32_t>::max());
+   }
+   SetThroughput(clState_, vStream_.size(), ullFrames);
+}
+
+//-----------------------------------------------------------------------
+void BenchmarkHeaderDecoder(benchmark::State& clState_, std::vector<std::vector<unsigned char>>& vRecords_, size_t ullBytes_)
+{
+   HeaderDecoder clHeaderDecoder(&clJsonDb);
+   IntermediateHeader stHeader;
+   MetaDataStruct stMetaData;
+
+   for (auto _ : clState_)
+   {
+      for (auto& vRecord : vRecords_)
+      {
+         benchmark::DoNotOptimize(clHeaderDecoder.Decode(vRecord.data(), stHeader, stMetaData));
+      }
+   }
+   SetThroughput(clState_, ullBytes_, vRecords_.size());
+}
+
+//-----------------------------------------------------------------------
+void BenchmarkMessageDecoder(benchmark::State& clState_, std::vector<std::vector<unsigned char>>& vRecords_, size_t ullBytes_, bool bSpecialized_ = false)
+{
+   HeaderDecoder clHeaderDecoder(&clJsonDb);
+   MessageDecoder clMessageDecoder(&clJsonDb);
+#ifdef EDIE_SPECIALIZED_CODEC
+   if (bSpecialized_)
+   {
+      specialized::Install(clMessageDecoder);
+   }
+#else
+   static_cast<void>(bSpecialized_);
+#endif
+   IntermediateHeader stHeader;
+   std::vector<MetaDataStruct> vMetaData(vRecords_.size());
+   for (size_t i = 0; i < vRecords_.size(); i++)
+   {
+      static_cast<void>(clHeaderDecoder.Decode(vRecords_[i].data(), stHeader, vMetaData[i]));
+   }
+
+   IntermediateMessage stMessage;
+   for (auto _ : clState_)
+   {
+      for (size_t i = 0; i < vRecords_.size(); i++)
+      {
+         stMessage.clear();
+         benchmark::DoNotOptimize(clMessageDecoder.Decode(vRecords_[i].data() + vMetaData[i].uiHeaderLength, stMessage, vMetaData[i]));
+      }
+   }
+   SetThroughput(clState_, ullBytes_, vRecords_.size());
+}
+
+//-----------------------------------------------------------------------
+void BenchmarkEncoder(benchmark::State& clState_, std::vector<std::vector<unsigned char>>& vRecords_, ENCODEFORMAT eFormat_, bool bSpecialized_ = false)
+{
+   HeaderDecoder clHeaderDecoder(&clJsonDb);
+   MessageDecoder clMessageDecoder(&clJsonDb);
+   Encoder clEncoder(&clJsonDb);
+#ifdef EDIE_SPECIALIZED_CODEC
+   if (bSpecialized_)
+   {
+      specialized::Install(clEncoder);
+   }
+#else
+   static_cast<void>(bSpecialized_);
+#endif
+
+   std::vector<IntermediateHeader> vHeaders(vRecords_.size());
+   std::vector<IntermediateMessage> vMessages(vRecords_.size());
+   std::vector<MetaDataStruct> vMetaData(vRecords_.size());
+   for (size_t i = 0; i < vRecords_.size(); i++)
+   {
+      if (clHeaderDecoder.Decode(vRecords_[i].data(), vHeaders[i], vMetaData[i]) != STATUS::SUCCESS
+       || clMessageDecoder.Decode(vRecords_[i].data() + vMetaData[i].uiHeaderLength, vMessages[i], vMetaData[i]) != STATUS::SUCCESS)
+      {
+         clState_.SkipWithError("Failed to decode the records to encode");
+         return;
+      }
+   }
+
+   std::vector<unsigned char> vEncodeBuffer(MAX_ASCII_MESSAGE_LENGTH);
+   MessageDataStruct stMessageData;
+   size_t ullBytes = 0;
+   for (auto _ : clState_)
+   {
+      ullBytes = 0;
+      for (size_t i = 0; i < vRecords_.size(); i++)
+      {
+         unsigned char* pucEncodeBuffer = vEncodeBuffer.data();
+         benchmark::DoNotOptimize(clEncoder.Encode(&pucEncodeBuffer, static_cast<uint32_t>(vEncodeBuffer.size()), vHeaders[i], vMessages[i], stMessageData, vMetaData[i], eFormat_));
+         ullBytes += stMessageData.uiMessageLength;
+      }
+   }
+   SetThroughput(clState_, ullBytes, vRecords_.size());
+}
+
+//-----------------------------------------------------------------------
+void BenchmarkRangeDecompressor(benchmark::State& clState_, std::vector<std::vector<unsigned char>>& vRecords_, size_t ullBytes_)
+{
+   HeaderDecoder clHeaderDecoder(&clJsonDb);
+   RangeDecompressor clRangeDecompressor(&clJsonDb);
+   IntermediateHeader stHeader;
+   std::vector<MetaDataStruct> vMetaData(vRecords_.size());
+   for (size_t i = 0; i < vRecords_.size(); i++)
+   {
+      static_cast<void>(clHeaderDecoder.Decode(vRecords_[i].data(), stHeader, vMetaData[i]));
+   }
+
+   // Decompress() overwrites its input, so every iteration works on a copy.
+   std::vector<unsigned char> vBuffer(MAX_ASCII_MESSAGE_LENGTH);
+   for (auto _ : clState_)
+   {
+      for (size_t i = 0; i < vRecords_.size(); i++)
+      {
+         std::copy(vRecords_[i].begin(), vRecords_[i].end(), vBuffer.begin());
+         MetaDataStruct stMetaData = vMetaData[i];
+         benchmark::DoNotOptimize(clRangeDecompressor.Decompress(vBuffer.data(), static_cast<uint32_t>(vBuffer.size()), stMetaData));
+      }
+   }
+   SetThroughput(clState_, ullBytes_, vRecords_.size());
+}
+
+//-----------------------------------------------------------------------
+template <typename ParserType>
+void BenchmarkParser(benchmark::State& clState_, const std::vector<unsigned char>& vStream_)
+{
+   ParserType clParser(&clJsonDb);
+   MessageDataStruct stMessageData;
+   MetaDataStruct stMetaData;
+   size_t ullMessages = 0;
+
+   for (auto _ : clState_)
+   {
+      ullMessages = 0;
+      for (size_t ullOffset = 0; ullOffset < vStream_.size(); ullOffset += uiWRITE_CHUNK_SIZE)
+      {
+         const uint32_t uiChunk = static_cast<uint32_t>(std::min<size_t>(uiWRITE_CHUNK_SIZE, vStream_.size() - ullOffset));
+         clParser.Write(const_cast<unsigned char*>(vStream_.data()) + ullOffset, uiChunk);
+
+         STATUS eStatus = STATUS::SUCCESS;
+         while (eStatus != STATUS::BUFFER_EMPTY)
+         {
+            eStatus = clParser.Read(stMessageData, stMetaData);
+            ullMessages += eStatus == STATUS::SUCCESS;
+         }
+      }
+      clParser.Flush(nullptr, std::numeric_limits<uint32_t>::max());
+   }
+   SetThroughput(clState_, vStream_.size(), ullMessages);
+}
+
+//-----------------------------------------------------------------------
+void BenchmarkFileParser(benchmark::State& clState_, const std::string& sFilePath_)
+{
+   FileParser clFileParser(&clJsonDb);
+   InputFileStream clInputFileStream(sFilePath_.c_str());
+   if (!clFileParser.SetStream(&clInputFileStream))
+   {
+      clState_.SkipWithError("Failed to open the input file");
+      return;
+   }
+
+   MessageDataStruct stMessageData;
+   MetaDataStruct stMetaData;
+   size_t ullMessages = 0;
+   for (auto _ : clState_)
+   {
+      ullMessages = 0;
+      STATUS eStatus = STATUS::SUCCESS;
+      while (eStatus != STATUS::STREAM_EMPTY)
+      {
+         eStatus = clFileParser.Read(stMessageData, stMetaData);
+         ullMessages += eStatus == STATUS::SUCCESS;
+      }
+      clFileParser.Reset();
+   }
+   SetThroughput(clState_, std::filesystem::file_size(sFilePath_), ullMessages);
+}
+
+//-----------------------------------------------------------------------
+//! \brief Write records of uiSPLIT_LOG_TYPES interleaved log types through
+//! a MultiOutputFileStream split by log, looking the file up by message name
+//! or by message ID, with an optional limit on the open files and optionally
+//! writing on a background thread.
+//-----------------------------------------------------------------------
+void BenchmarkSplitByLog(benchmark::State& clState_, bool bById_, uint32_t uiMaxOpenFiles_, bool bAsync_ = false)
+{
+   const std::filesystem::path clDirectory = std::filesystem::temp_directory_path() / "edie_benchmark_split_log";
+   std::filesystem::remove_all(clDirectory);
+   std::filesystem::create_directory(clDirectory);
+
+   std::vector<std::string> vNames;
+   std::vector<std::string> vRecords;
+   size_t ullBytes = 0;
+   for (uint32_t i = 0; i < uiSPLIT_LOG_TYPES; i++)
+   {
+      vNames.push_back("LOG" + std::to_string(i));
+      vRecords.push_back("#" + vNames.back() + "A,COM1,0,73.0,FINESTEERING,2072,511130.000,02000020,cdba,32768;SOL_COMPUTED,SINGLE*00000000\r\n");
+      ullBytes += vRecords.back().size();
+   }
+
+   {
+      MultiOutputFileStream clOutput;
+      clOutput.ConfigureAsyncWrite(bAsync_);
+      clOutput.ConfigureMaxOpenFiles(uiMaxOpenFiles_);
+      clOutput.ConfigureSplitByLog(true);
+      clOutput.ConfigureBaseFileName((clDirectory / "split.ASC").string());
+      for (auto _ : clState_)
+      {
+         for (uint32_t i = 0; i < uiSPLIT_LOG_TYPES; i++)
+         {
+            const uint32_t uiLength = static_cast<uint32_t>(vRecords[i].size());
+            if (bById_)
+               clOutput.WriteData(vRecords[i].data(), uiLength, i, vNames[i], uiLength, TIME_STATUS::FINESTEERING, 2072, 511130000.0);
+            else
+               clOutput.WriteData(vRecords[i].data(), uiLength, vNames[i], uiLength, TIME_STATUS::FINESTEERING, 2072, 511130000.0);
+         }
+      }
+   }
+   SetThroughput(clState_, ullBytes, uiSPLIT_LOG_TYPES);
+   std::filesystem::remove_all(clDirectory);
+}
+
+//-----------------------------------------------------------------------
+//! \brief Register the benchmarks of a single component on every record
+//! kind the database supports.
+//-----------------------------------------------------------------------
+void RegisterStageBenchmarks(StreamGenerator& clGenerator_)
+{
+   for (uint32_t i = 0; i < uiSTREAM_RECORD_COUNT; i++)
+   {
+      const auto eRecord = static_cast<STREAM_RECORD>(i);
+      if (!clGenerator_.IsAvailable(eRecord))
+      {
+         std::cerr << "Skipping " << StreamRecordName(eRecord) << " benchmarks, the database cannot decode its seed log." << std::endl;
+         continue;
+      }
+
+      clGenerator_.Reset();
+      auto vRecords = std::make_shared<std::vector<std::vector<unsigned char>>>(clGenerator_.GenerateRecords(eRecord, uiRECORDS_PER_STREAM));
+      auto vStream = std::make_shared<std::vector<unsigned char>>(Concatenate(*vRecords));
+      const std::string sName = StreamRecordName(eRecord);
+
+      benchmark::RegisterBenchmark(("Framer/" + sName).c_str(), [vStream](benchmark::State& clState_) { BenchmarkFramer(clState_, *vStream); });
+
+      // NMEA sentences are not decoded, they are passed through by the Parser.
+      if (eRecord == STREAM_RECORD::NMEA)
+      {
+         continue;
+      }
+
+      benchmark::RegisterBenchmark(("HeaderDecoder/" + sName).c_str(), [vRecords, vStream](benchmark::State& clState_) { BenchmarkHeaderDecoder(clState_, *vRecords, vStream->size()); });
+      benchmark::RegisterBenchmark(("MessageDecoder/" + sName).c_str(), [vRecords, vStream](benchmark::State& clState_) { BenchmarkMessageDecoder(clState_, *vRecords, vStream->size()); });
+#ifdef EDIE_SPECIALIZED_CODEC
+      // The code generated for the database only decodes binary bodies.
+      if (eRecord == STREAM_RECORD::BINARY)
+      {
+         benchmark::RegisterBenchmark(("SpecializedDecoder/" + sName).c_str(), [vRecords, vStream](benchmark::State& clState_) { BenchmarkMessageDecoder(clState_, *vRecords, vStream->size(), true); });
+      }
+#endif
+
+      if (eRecord == STREAM_RECORD::RANGECMP2 || eRecord == STREAM_RECORD::RANGECMP4)
+      {
+         benchmark::RegisterBenchmark(("RangeDecompressor/" + sName).c_str(), [vRecords, vStream](benchmark::State& clState_) { BenchmarkRangeDecompressor(clState_, *vRecords, vStream->size()); });
+      }
+   }
+
+   // Encode the decoded ASCII records into every output format.
+   if (clGenerator_.IsAvailable(STREAM_RECORD::ASCII))
+   {
+      clGenerator_.Reset();
+      auto vRecords = std::make_shared<std::vector<std::vector<unsigned char>>>(clGenerator_.GenerateRecords(STREAM_RECORD::ASCII, uiRECORDS_PER_STREAM));
+      for (const auto& [eFormat, sName] : std::vector<std::pair<ENCODEFORMAT, std::string>>{
+              { ENCODEFORMAT::BINARY, "BINARY" }, { ENCODEFORMAT::FLATTENED_BINARY, "FLATTENED_BINARY" }, { ENCODEFORMAT::ASCII, "ASCII" },
+              { ENCODEFORMAT::ABBREV_ASCII, "ABBREV_ASCII" }, { ENCODEFORMAT::JSON, "JSON" } })
+      {
+         benchmark::RegisterBenchmark(("Encoder/" + sName).c_str(), [vRecords, eFormat = eFormat](benchmark::State& clState_) { BenchmarkEncoder(clState_, *vRecords, eFormat); });
+#ifdef EDIE_SPECIALIZED_CODEC
+         if (eFormat == ENCODEFORMAT::BINARY || eFormat == ENCODEFORMAT::FLATTENED_BINARY)
+         {
+            benchmark::RegisterBenchmark(("SpecializedEncoder/" + sName).c_str(), [vRecords, eFormat = eFormat](benchmark::State& clState_) { BenchmarkEncoder(clState_, *vRecords, eFormat, true); });
+         }
+#endif
+      }
+   }
+}
+
+//-----------------------------------------------------------------------
+//! \brief Register the end-to-end benchmarks on the mixed streams, with and
+//! without corruption.
+//-----------------------------------------------------------------------
+void RegisterEndToEndBenchmarks(StreamGenerator& clGenerator_)
+{
+   for (const auto& [dCorruptionRate, sName] : std::vector<std::pair<double, std::string>>{ { 0.0, "MIXED" }, { dCORRUPTION_RATE, "MIXED_CORRUPT" } })
+   {
+      clGenerator_.Reset();
+      auto vStream = std::make_shared<std::vector<unsigned char>>(clGenerator_.GenerateStream(MixedStream(dCorruptionRate), uiRECORDS_PER_STREAM));
+
+      benchmark::RegisterBenchmark(("Framer/" + sName).c_str(), [vStream](benchmark::State& clState_) { BenchmarkFramer(clState_, *vStream); });
+      benchmark::RegisterBenchmark(("Parser/" + sName).c_str(), [vStream](benchmark::State& clState_) { BenchmarkParser<Parser>(clState_, *vStream); });
+      benchmark::RegisterBenchmark(("PipelinedParser/" + sName).c_str(), [vStream](benchmark::State& clState_) { BenchmarkParser<PipelinedParser>(clState_, *vStream); })->UseRealTime();
+
+      const std::string sFilePath = (std::filesystem::temp_directory_path() / ("edie_benchmark_" + sName + ".GPS")).string();
+      std::ofstream(sFilePath, std::ios::binary).write(reinterpret_cast<const char*>(vStream->data()), static_cast<std::streamsize>(vStream->size()));
+      benchmark::RegisterBenchmark(("FileParser/" + sName).c_str(), [sFilePath](benchmark::State& clState_) { BenchmarkFileParser(clState_, sFilePath); });
+   }
+}
+
+//-----------------------------------------------------------------------
+//! \brief Register the output benchmarks, which do not use the database.
+//-----------------------------------------------------------------------
+void RegisterOutputBenchmarks()
+{
+   benchmark::RegisterBenchmark("MultiOutputFileStream/SPLIT_LOG_BY_NAME", [](benchmark::State& clState_) { BenchmarkSplitByLog(clState_, false, 0); });
+   benchmark::RegisterBenchmark("MultiOutputFileStream/SPLIT_LOG_BY_ID", [](benchmark::State& clState_) { BenchmarkSplitByLog(clState_, true, 0); });
+   benchmark::RegisterBenchmark("MultiOutputFileStream/SPLIT_LOG_BY_ID_MAX_OPEN_64", [](benchmark::State& clState_) { BenchmarkSplitByLog(clState_, true, 64); });
+   benchmark::RegisterBenchmark("MultiOutputFileStream/SPLIT_LOG_BY_ID_ASYNC", [](benchmark::State& clState_) { BenchmarkSplitByLog(clState_, true, 0, true); })->UseRealTime();
+   benchmark::RegisterBenchmark("MultiOutputFileStream/SPLIT_LOG_BY_ID_MAX_OPEN_64_ASYNC", [](benchmark::State& clState_) { BenchmarkSplitByLog(clState_, true, 64, true); })->UseRealTime();
+}
+
+}
+
+int main(int argc, char** argv)
+{
+   benchmark::Initialize(&argc, argv);
+
+   if (argc < 2)
+   {
+      std::cerr << "Usage: " << argv[0] << " <db path> [recorded files...] [benchmark options]" << std::endl;
+      return 1;
+   }
+   if (!std::filesystem::exists(argv[1]))
+   {
+      std::cerr << "\"" << argv[1] << "\" does not exist" << std::endl;
+      return 1;
+   }
+
+   clJsonDb.LoadFile(std::string(argv[1]));
+   // Diagnostics for the injected corruption would otherwise dominate the run.
+   Logger::SetLoggingLevel(spdlog::level::off);
+
+   StreamGenerator clGenerator(&clJsonDb);
+   RegisterStageBenchmarks(clGenerator);
+   RegisterEndToEndBenchmarks(clGenerator);
+   RegisterOutputBenchmarks();
+
+   for (int32_t i = 2; i < argc; i++)
+   {
+      const std::string sFilePath = argv[i];
+      if (!std::filesystem::exists(sFilePath))
+      {
+         std::cerr << "\"" << sFilePath << "\" does not exist" << std::endl;
+         return 1;
+      }
+      benchmark::RegisterBenchmark(("FileParser/" + std::filesystem::path(sFilePath).filename().string()).c_str(),
+                                   [sFilePath](benchmark::State& clState_) { BenchmarkFileParser(clState_, sFilePath); });
+   }
+
+   benchmark::RunSpecifiedBenchmarks();
+   benchmark::Shutdown();
+   return 0;
+}
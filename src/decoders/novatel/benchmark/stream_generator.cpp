@@ -0,0 +1,312 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file stream_generator.cpp
+//! \brief Deterministic generator of mixed OEM data streams for the
+//! benchmarks.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "stream_generator.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+namespace {
+
+//-----------------------------------------------------------------------
+// Seed logs, taken from the unit tests.
+//-----------------------------------------------------------------------
+constexpr char acBESTPOS_SEED[] = "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n";
+constexpr char acRAWIMUSX_SEED[] = "%RAWIMUSXA,1692,484620.664;00,11,1692,484620.664389000,00801503,43110635,-817242,-202184,-215194,-41188,-9895*a5db8c7b\r\n";
+constexpr char acRANGECMP2_SEED[] = "#RANGECMP2A,COM1,0,56.0,FINESTEERING,2171,404649.000,02010000,1fe3,16248;1870,000200c8ba5b859afb2fe1ffff6b3f0651e830813d00e4ffff43bac60a006c803d0001140034b7f884a8ff2fe1ffff6b3fa428a83c82f0ffe4ffff439c4404c8cb82f0ff021d00043bfd04720330e1ffff6b3f2628086b811200e4ffff439ca605283f811200e5ffff095d860f50b081120003060020dbf8854ef94fe1ffff6b954a513855800a00e4ffff43d56a798813800a00e5ffff09782a88a836800a00e7ffff031ca4a8706980f7ff041f001822d685d8fc3fe1ffff6b5b483218a2003b00e4ffff43f1280ee054003b00e5ffff09b268154897003b00050900ac57ef85effe4fe1ffff6b948c0a705680f7ffe4ffff43d44c1ea87900f7ffe5ffff095bac23987d00f7ffe7ffff031fa249f0148116000612001813cb059e0640e1ffff6b59480fb0da802d00e4ffff43f38a07183e812d00e5ffff09966a12c0f3002e00e7ffff031b2669187782190007190048e81385abfb4fe1ffff2b3e6639208800eaffe4ffff039b4649586400eaffe5ffff095ee651583900eaffe7ffff031f827020ac00e0ff080500f8ce12059b0430e1ffff6b3f842c5829820c00e4ffff439c040b50e5820c00e5ffff095da414788b820c00091a00d4c6dd85140640e1ffff6b92ae0b289300ccffe4ffff43f30e35f0db80cbffe5ffff0978ce38a89100ccffe7ffff031c643a885081c8ff0b0c00e88f7105f0f83fe1ffff2b5c4686e805011c00e4ffff03b82669c03e801b00e5ffff097a866f70a0801b0010c270b8074e8a660030e1ffff2b78e840084080edffe3ffff0978884af01500edffe4ffff0319e671088f80f4ff14852054613589010010e1ffff63bba60ab02200c7ff158a208c6a2d89000010e1ffff63bc0880503f00260017832000972c89000010e1ffff63bb885f2007000000180d15640900851f0030e1ffff290fcd0f18f900deffe4ffff43564e4e70b001deffe3ffff49d30e4cf0a401deff190c168cd722052af93fe1ffff29b9a619283300f4ffe4ffff031b066e00bf80f3ffe3ffff499b266988b380f3ff1a171a60005285370610e1ffff69d7660410220114001b151be8a3298543fa3fe1ffff69d72608885800e2ffe4ffff033a4635788a00e2ffe3ffff499a663e306000e2ff1c16146892a3046bff3fe1ffff6911cd11d03300e8ffe4ffff43714c55482f01e8ffe3ffff09f12c5cf85101e8ff1d071c9c3942853f0730e1ffff69d6c60f705e01e8ffe4ffff0339463a98cf82e8ffe3ffff499ae641682083e8ff1e0e10fc64a785d90630e1ffff29f3ca0e1021801a00e4ffff4337aa7fe833811a00e3ffff09b8ca7610fa801a001f05188c42a9854ef93fe1ffff29f1ea06585080dbffe4ffff4372ea46280f01dbffe3ffff49f20c50504101dbff2006137c4000059e0010e1ffff690e3904080400c5ff261a5064418705fbfd4fe1ffff293f0406908b80ecffe2ffff031f6264f8e601e6ffe3ffff031fc22ec85801ebffe4ffff031fe22ae05681e8ff270c50ec595586230540e1ffff29950a02c04b801900e2ffff031ac6496035812200e3ffff031924168079001f00e4ffff031ca6110086802400280d50488d8506ebfa4fe1ffff29980839600500c9ffe2ffff031a668fd80681d2ffe3ffff0319066b801300bcffe4ffff031c8654401b80c1ff291f5034b8e385a5ff4fe1ffff295f640c683700e0ffe2ffff031f225b802581daffe3ffff031fe21d906b00d9ffe4ffff031f4221609780d8ff2b2150f8eac105a70240e1ffff293f641468ef802500e2ffff031f8240905c022000e3ffff031f82042888812900e4ffff031f6207e0a80124002c0850309a0206250040e1ffff2979e80eb8b9003100e2ffff031b044018e7013200e3ffff031c441dd036812300e4ffff031ea413e0650128002d0150f8db2f068afa4fe1ffff297ce63c0043001b00e2ffff031fe29948fa801a00e3ffff031e84589847801a00e4ffff031f045e883f001a002e0750dc257686740440e1ffff297a680f881f81d4ffe2ffff031e047970f102c2ffe3ffff031ea249f85e02bfffe4ffff031f244390fe81bfff2f1850d08c82065f0440e1ffff2998a803488b00e4ffe2ffff031b664f981202ccffe3ffff031bc40f201201cdffe4ffff031d4418602001ccff362d6040494c060f0420e1ffff6958e80fe837003d00f4ffff031ca4acd845823000371c60983fad8543fb2fe1ffff293a860f388f00cdfff4ffff031ee234b8c680ccff3b1e60ccf2a885dc0420e1ffff293b6606800701effff4ffff031e6446402f02edff3f3a607ca3168851fa1fe1ffff2957a8589829000700410e60701bf60529fc2fe1ffff2976e82a880101ebffe3ffff093ce40148e480e3ff422e607085ec05acfa2fe1ffff293a06614007002600f4ffff031e42e7b01981240044216008d2be85f6fe2fe1ffff293b060f0053813e00f4ffff031f22bf8111863b00451b6048481885190020e1ffff691f0204d06a001800f4ffff031f621b986e810f0047246044cfe4053cff2fe1ffff293bc60ea00a001700f4ffff031d249748ad8219004b29600c07b9859e0420e1ffff293b460e98a9011c00f4ffff031fe2de305f850700*2b134683\r\n";
+constexpr char acRANGECMP4_SEED[] = "#RANGECMP4A,COM1,0,88.5,FINESTEERING,1919,507977.000,02000020,fb0e,32768;295,030000421204000000009200df7688831f611fd87ca0b03a00638bbdf7b82f49b080fd0ec0ff1f091f8214ff4d4d00a1009cbf1751f6911f5141f87fd9571a96dbd7040c8090f87f0080fcf722fe9bfa8a49a8ff4f299d7f96fb9afefc771800fcffd0063f02cde01f3c7dd3ffb75240886f5fa2b0ff91f57f00003edf8b78868c882878014065dbf7d3ed6b722680d5fc0f00a4c08730fe7fecf8bffa3f003008000000002001f03fa019f8136a11273649b8fcefab9c434c7b89e71560dbfe070030b2e04fd841f33125320b80b0ecefa5ee21243ac0bb03e0ffc36a813fb13bbe5791a0f5ff9e3bdbffbb87f0cb8064f03f0000e4b67dd15bc5f4a50a3a006ca72fdee53ec86405b2c0fffa3fa450f725d5bfed7c49b1fb0fb16b45a87a9adb0740cbfe0700*7dd8f893\r\n";
+
+constexpr uint32_t uiENCODE_BUFFER_SIZE = MAX_ASCII_MESSAGE_LENGTH;
+constexpr double dRECORD_PERIOD_MS = 50.0;
+constexpr double dMILLISECONDS_IN_WEEK = 604800000.0;
+
+}
+
+//-----------------------------------------------------------------------
+const char* novatel::edie::oem::StreamRecordName(STREAM_RECORD eRecord_)
+{
+   switch (eRecord_)
+   {
+      case STREAM_RECORD::BINARY:       return "BINARY";
+      case STREAM_RECORD::ASCII:        return "ASCII";
+      case STREAM_RECORD::ABBREV_ASCII: return "ABBREV_ASCII";
+      case STREAM_RECORD::SHORT_BINARY: return "SHORT_BINARY";
+      case STREAM_RECORD::SHORT_ASCII:  return "SHORT_ASCII";
+      case STREAM_RECORD::NMEA:         return "NMEA";
+      case STREAM_RECORD::RANGECMP2:    return "RANGECMP2";
+      case STREAM_RECORD::RANGECMP4:    return "RANGECMP4";
+      default:                          return "UNKNOWN";
+   }
+}
+
+//-----------------------------------------------------------------------
+StreamGenerator::StreamGenerator(JsonReader* pclJsonDb_, uint32_t uiSeed_)
+   : clMyHeaderDecoder(pclJsonDb_), clMyMessageDecoder(pclJsonDb_), clMyEncoder(pclJsonDb_),
+     clMyRandom(uiSeed_), vMyEncodeBuffer(uiENCODE_BUFFER_SIZE)
+{
+   apclMySeeds[static_cast<uint32_t>(STREAM_RECORD::BINARY)]       = DecodeSeed(acBESTPOS_SEED,   ENCODEFORMAT::BINARY,       true);
+   apclMySeeds[static_cast<uint32_t>(STREAM_RECORD::ASCII)]        = DecodeSeed(acBESTPOS_SEED,   ENCODEFORMAT::ASCII,        true);
+   apclMySeeds[static_cast<uint32_t>(STREAM_RECORD::ABBREV_ASCII)] = DecodeSeed(acBESTPOS_SEED,   ENCODEFORMAT::ABBREV_ASCII, true);
+   apclMySeeds[static_cast<uint32_t>(STREAM_RECORD::SHORT_BINARY)] = DecodeSeed(acRAWIMUSX_SEED,  ENCODEFORMAT::BINARY,       true);
+   apclMySeeds[static_cast<uint32_t>(STREAM_RECORD::SHORT_ASCII)]  = DecodeSeed(acRAWIMUSX_SEED,  ENCODEFORMAT::ASCII,        true);
+   // The compressed range blocks are opaque bytes, perturbing them would only
+   // produce invalid observations.
+   apclMySeeds[static_cast<uint32_t>(STREAM_RECORD::RANGECMP2)]    = DecodeSeed(acRANGECMP2_SEED, ENCODEFORMAT::BINARY,       false);
+   apclMySeeds[static_cast<uint32_t>(STREAM_RECORD::RANGECMP4)]    = DecodeSeed(acRANGECMP4_SEED, ENCODEFORMAT::BINARY,       false);
+}
+
+//-----------------------------------------------------------------------
+std::unique_ptr<StreamGenerator::Seed>
+StreamGenerator::DecodeSeed(const char* pcLog_, ENCODEFORMAT eFormat_, bool bPerturb_)
+{
+   auto pclSeed = std::make_unique<Seed>();
+   std::vector<unsigned char> vLog(pcLog_, pcLog_ + strlen(pcLog_) + 1);
+
+   if (clMyHeaderDecoder.Decode(vLog.data(), pclSeed->stHeader, pclSeed->stMetaData) != STATUS::SUCCESS
+    || clMyMessageDecoder.Decode(vLog.data() + pclSeed->stMetaData.uiHeaderLength, pclSeed->stMessage, pclSeed->stMetaData) != STATUS::SUCCESS)
+   {
+      return nullptr;
+   }
+
+   // Make sure the database describes the log well enough to encode it in
+   // the requested format.  The Encoder throws on fields it cannot encode.
+   MessageDataStruct stMessageData;
+   MetaDataStruct stMetaData = pclSeed->stMetaData;
+   unsigned char* pucEncodeBuffer = vMyEncodeBuffer.data();
+   try
+   {
+      if (clMyEncoder.Encode(&pucEncodeBuffer, uiENCODE_BUFFER_SIZE, pclSeed->stHeader, pclSeed->stMessage, stMessageData, stMetaData, eFormat_) != STATUS::SUCCESS)
+      {
+         return nullptr;
+      }
+   }
+   catch (const std::exception&)
+   {
+      return nullptr;
+   }
+
+   pclSeed->eFormat = eFormat_;
+   pclSeed->bPerturb = bPerturb_;
+   return pclSeed;
+}
+
+//-----------------------------------------------------------------------
+bool
+StreamGenerator::IsAvailable(STREAM_RECORD eRecord_) const
+{
+   return eRecord_ == STREAM_RECORD::NMEA || apclMySeeds[static_cast<uint32_t>(eRecord_)] != nullptr;
+}
+
+//-----------------------------------------------------------------------
+void
+StreamGenerator::Reset(uint32_t uiSeed_)
+{
+   clMyRandom.seed(uiSeed_);
+   ullMyRecordIndex = 0;
+}
+
+//-----------------------------------------------------------------------
+void
+StreamGenerator::AppendNmea(std::vector<unsigned char>& vOut_)
+{
+   std::uniform_real_distribution<double> clNoise(-0.0005, 0.0005);
+   const double dSeconds = std::fmod(ullMyRecordIndex * dRECORD_PERIOD_MS / 1000.0, 86400.0);
+   const uint32_t uiHours = static_cast<uint32_t>(dSeconds / 3600.0);
+   const uint32_t uiMinutes = static_cast<uint32_t>(dSeconds / 60.0) % 60;
+
+   char acSentence[128];
+   int32_t iLength = snprintf(acSentence, sizeof(acSentence), "$GPGGA,%02u%02u%05.2f,%09.4f,N,%010.4f,W,1,18,0.9,%.1f,M,-17.0,M,,",
+                              uiHours, uiMinutes, std::fmod(dSeconds, 60.0),
+                              5109.0263 + clNoise(clMyRandom), 11401.8401 + clNoise(clMyRandom), 1097.7 + clNoise(clMyRandom) * 100.0);
+
+   uint8_t ucChecksum = 0;
+   for (int32_t i = 1; i < iLength; i++)
+   {
+      ucChecksum ^= static_cast<uint8_t>(acSentence[i]);
+   }
+   iLength += snprintf(acSentence + iLength, sizeof(acSentence) - iLength, "*%02X\r\n", ucChecksum);
+
+   vOut_.insert(vOut_.end(), acSentence, acSentence + iLength);
+}
+
+//-----------------------------------------------------------------------
+void
+StreamGenerator::AppendRecord(STREAM_RECORD eRecord_, std::vector<unsigned char>& vOut_)
+{
+   if (eRecord_ == STREAM_RECORD::NMEA)
+   {
+      AppendNmea(vOut_);
+      ullMyRecordIndex++;
+      return;
+   }
+
+   Seed* pclSeed = apclMySeeds[static_cast<uint32_t>(eRecord_)].get();
+   if (pclSeed == nullptr)
+   {
+      return;
+   }
+
+   IntermediateHeader stHeader = pclSeed->stHeader;
+   stHeader.dMilliseconds += ullMyRecordIndex * dRECORD_PERIOD_MS;
+   stHeader.usWeek += static_cast<uint16_t>(stHeader.dMilliseconds / dMILLISECONDS_IN_WEEK);
+   stHeader.dMilliseconds = std::fmod(stHeader.dMilliseconds, dMILLISECONDS_IN_WEEK);
+
+   // Perturb the seed in place rather than copying it, FieldContainer cannot
+   // be copied.  The drift this causes over a long stream is harmless.
+   if (pclSeed->bPerturb)
+   {
+      std::uniform_real_distribution<double> clNoise(-1.0E-4, 1.0E-4);
+      for (auto& stField : pclSeed->stMessage)
+      {
+         if (std::holds_alternative<double>(stField.field_value))
+         {
+            std::get<double>(stField.field_value) += clNoise(clMyRandom);
+         }
+         else if (std::holds_alternative<float>(stField.field_value))
+         {
+            std::get<float>(stField.field_value) += static_cast<float>(clNoise(clMyRandom));
+         }
+      }
+   }
+
+   MessageDataStruct stMessageData;
+   MetaDataStruct stMetaData = pclSeed->stMetaData;
+   unsigned char* pucEncodeBuffer = vMyEncodeBuffer.data();
+   if (clMyEncoder.Encode(&pucEncodeBuffer, uiENCODE_BUFFER_SIZE, stHeader, pclSeed->stMessage, stMessageData, stMetaData, pclSeed->eFormat) == STATUS::SUCCESS)
+   {
+      vOut_.insert(vOut_.end(), stMessageData.pucMessage, stMessageData.pucMessage + stMessageData.uiMessageLength);
+   }
+   ullMyRecordIndex++;
+}
+
+//-----------------------------------------------------------------------
+void
+StreamGenerator::Corrupt(std::vector<unsigned char>& vOut_, size_t ullRecordStart_)
+{
+   const size_t ullRecordLength = vOut_.size() - ullRecordStart_;
+   if (ullRecordLength < 2)
+   {
+      return;
+   }
+
+   switch (std::uniform_int_distribution<uint32_t>(0, 2)(clMyRandom))
+   {
+      case 0: // Flip a byte after the sync so the record frames but fails its CRC.
+      {
+         const size_t ullOffset = std::uniform_int_distribution<size_t>(1, ullRecordLength - 1)(clMyRandom);
+         vOut_[ullRecordStart_ + ullOffset] ^= 0x5A;
+         break;
+      }
+      case 1: // Truncate the record.
+         vOut_.resize(ullRecordStart_ + std::uniform_int_distribution<size_t>(1, ullRecordLength - 1)(clMyRandom));
+         break;
+      default: // Insert garbage in front of the record.
+      {
+         std::uniform_int_distribution<uint32_t> clByte(0, 0xFF);
+         std::vector<unsigned char> vGarbage(std::uniform_int_distribution<size_t>(8, 64)(clMyRandom));
+         for (auto& ucByte : vGarbage)
+         {
+            ucByte = static_cast<unsigned char>(clByte(clMyRandom));
+         }
+         vOut_.insert(vOut_.begin() + ullRecordStart_, vGarbage.begin(), vGarbage.end());
+         break;
+      }
+   }
+}
+
+//-----------------------------------------------------------------------
+std::vector<std::vector<unsigned char>>
+StreamGenerator::GenerateRecords(STREAM_RECORD eRecord_, uint32_t uiCount_)
+{
+   std::vector<std::vector<unsigned char>> vRecords;
+   if (!IsAvailable(eRecord_))
+   {
+      return vRecords;
+   }
+
+   vRecords.reserve(uiCount_);
+   for (uint32_t i = 0; i < uiCount_; i++)
+   {
+      AppendRecord(eRecord_, vRecords.emplace_back());
+   }
+   return vRecords;
+}
+
+//-----------------------------------------------------------------------
+std::vector<unsigned char>
+StreamGenerator::GenerateStream(const StreamMix& stMix_, uint32_t uiCount_, uint32_t* puiRecords_)
+{
+   std::vector<unsigned char> vStream;
+   uint32_t uiRecords = 0;
+
+   std::array<double, uiSTREAM_RECORD_COUNT> adWeights{};
+   bool bAnyAvailable = false;
+   for (uint32_t i = 0; i < uiSTREAM_RECORD_COUNT; i++)
+   {
+      if (IsAvailable(static_cast<STREAM_RECORD>(i)))
+      {
+         adWeights[i] = stMix_.auiWeights[i];
+         bAnyAvailable |= stMix_.auiWeights[i] != 0;
+      }
+   }
+
+   if (bAnyAvailable)
+   {
+      std::discrete_distribution<uint32_t> clKind(adWeights.begin(), adWeights.end());
+      std::bernoulli_distribution clCorrupt(stMix_.dCorruptionRate);
+
+      for (uint32_t i = 0; i < uiCount_; i++)
+      {
+         const size_t ullRecordStart = vStream.size();
+         AppendRecord(static_cast<STREAM_RECORD>(clKind(clMyRandom)), vStream);
+
+         if (clCorrupt(clMyRandom))
+         {
+            Corrupt(vStream, ullRecordStart);
+         }
+         else
+         {
+            uiRecords++;
+         }
+      }
+   }
+
+   if (puiRecords_ != nullptr)
+   {
+      *puiRecords_ = uiRecords;
+   }
+   return vStream;
+}
@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file stream_generator.hpp
+//! \brief Deterministic generator of mixed OEM data streams for the
+//! benchmarks.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef NOVATEL_STREAM_GENERATOR_HPP
+#define NOVATEL_STREAM_GENERATOR_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <array>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "decoders/common/api/jsonreader.hpp"
+#include "decoders/novatel/api/encoder.hpp"
+#include "decoders/novatel/api/header_decoder.hpp"
+#include "decoders/novatel/api/message_decoder.hpp"
+
+namespace novatel::edie::oem {
+
+//-----------------------------------------------------------------------
+//! \enum STREAM_RECORD
+//! \brief Kinds of record the StreamGenerator can produce.
+//-----------------------------------------------------------------------
+enum class STREAM_RECORD : uint32_t
+{
+   BINARY,       //!< BESTPOS in binary.
+   ASCII,        //!< BESTPOS in ASCII.
+   ABBREV_ASCII, //!< BESTPOS in abbreviated ASCII.
+   SHORT_BINARY, //!< RAWIMUSX in short binary.
+   SHORT_ASCII,  //!< RAWIMUSX in short ASCII.
+   NMEA,         //!< GPGGA sentences.
+   RANGECMP2,    //!< RANGECMP2 in binary.
+   RANGECMP4,    //!< RANGECMP4 in binary.
+   COUNT
+};
+
+//! \brief uiSTREAM_RECORD_COUNT: Number of STREAM_RECORD values.
+constexpr uint32_t uiSTREAM_RECORD_COUNT = static_cast<uint32_t>(STREAM_RECORD::COUNT);
+
+//! \brief Printable name of a STREAM_RECORD.
+const char* StreamRecordName(STREAM_RECORD eRecord_);
+
+//-----------------------------------------------------------------------
+//! \struct StreamMix
+//! \brief Relative weights of each record kind in a generated stream, and
+//! the fraction of records to corrupt.
+//-----------------------------------------------------------------------
+struct StreamMix
+{
+   std::array<uint32_t, uiSTREAM_RECORD_COUNT> auiWeights{};
+   double dCorruptionRate{ 0.0 };
+};
+
+//============================================================================
+//! \class StreamGenerator
+//! \brief Produce reproducible OEM data streams.
+//
+//! Each record kind is seeded from a real log which is decoded once.  Every
+//! generated record advances the header time and perturbs the floating
+//! point fields of the seed before it is encoded again, so records are
+//! distinct but the stream for a given seed value is always the same.
+//! Record kinds whose seed cannot be decoded with the provided database are
+//! unavailable and are skipped when generating mixed streams.
+//============================================================================
+class StreamGenerator
+{
+public:
+   //----------------------------------------------------------------------------
+   //! \brief A constructor for the StreamGenerator class.
+   //
+   //! \param[in] pclJsonDb_ A pointer to a JsonReader object.
+   //! \param[in] uiSeed_ Seed of the pseudo-random number generator.
+   //----------------------------------------------------------------------------
+   StreamGenerator(JsonReader* pclJsonDb_, uint32_t uiSeed_ = 0x5EED);
+
+   //----------------------------------------------------------------------------
+   //! \brief Can records of this kind be generated with the loaded database?
+   //----------------------------------------------------------------------------
+   [[nodiscard]] bool
+   IsAvailable(STREAM_RECORD eRecord_) const;
+
+   //----------------------------------------------------------------------------
+   //! \brief Restart the pseudo-random sequence and the record time.
+   //----------------------------------------------------------------------------
+   void
+   Reset(uint32_t uiSeed_ = 0x5EED);
+
+   //----------------------------------------------------------------------------
+   //! \brief Generate uncorrupted records of a single kind.
+   //
+   //! \param[in] eRecord_ The kind of record to generate.
+   //! \param[in] uiCount_ The number of records.
+   //
+   //! \return One framed record per element, or nothing if the kind is
+   //! unavailable.
+   //----------------------------------------------------------------------------
+   std::vector<std::vector<unsigned char>>
+   GenerateRecords(STREAM_RECORD eRecord_, uint32_t uiCount_);
+
+   //----------------------------------------------------------------------------
+   //! \brief Generate a stream of records mixed by weight.
+   //
+   //! \param[in] stMix_ The weights of each record kind and corruption rate.
+   //! \param[in] uiCount_ The number of records.
+   //! \param[out] puiRecords_ If provided, set to the number of uncorrupted
+   //! records in the stream.
+   //
+   //! \return The concatenated stream.
+   //----------------------------------------------------------------------------
+   std::vector<unsigned char>
+   GenerateStream(const StreamMix& stMix_, uint32_t uiCount_, uint32_t* puiRecords_ = nullptr);
+
+private:
+   struct Seed
+   {
+      IntermediateHeader stHeader;
+      IntermediateMessage stMessage;
+      MetaDataStruct stMetaData;
+      ENCODEFORMAT eFormat{ ENCODEFORMAT::BINARY };
+      bool bPerturb{ true };
+   };
+
+   HeaderDecoder clMyHeaderDecoder;
+   MessageDecoder clMyMessageDecoder;
+   Encoder clMyEncoder;
+   std::mt19937 clMyRandom;
+   std::array<std::unique_ptr<Seed>, uiSTREAM_RECORD_COUNT> apclMySeeds;
+   std::vector<unsigned char> vMyEncodeBuffer;
+   uint64_t ullMyRecordIndex{ 0 };
+
+   std::unique_ptr<Seed> DecodeSeed(const char* pcLog_, ENCODEFORMAT eFormat_, bool bPerturb_);
+   void AppendRecord(STREAM_RECORD eRecord_, std::vector<unsigned char>& vOut_);
+   void AppendNmea(std::vector<unsigned char>& vOut_);
+   void Corrupt(std::vector<unsigned char>& vOut_, size_t ullRecordStart_);
+};
+
+}
+
+#endif // NOVATEL_STREAM_GENERATOR_HPP
@@ -0,0 +1,279 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file specializedcodectest.cpp
+//! \brief Unit Tests comparing the binary codecs and message views
+//! generated for MESSAGE_VIEWS_DB with the dynamic MessageDecoder and Encoder.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "decoders/novatel/api/encoder.hpp"
+#include "decoders/novatel/api/header_decoder.hpp"
+#include "decoders/novatel/api/message_decoder.hpp"
+
+#include "novatel_message_views.hpp"
+#include "novatel_specialized_codec.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+// -------------------------------------------------------------------------------------------------------
+// Specialized Codec Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class SpecializedCodecTest : public ::testing::Test
+{
+protected:
+   class DynamicDecoder : public MessageDecoder
+   {
+   public:
+      DynamicDecoder(JsonReader* pclJsonDb_) : MessageDecoder(pclJsonDb_) {}
+
+      STATUS TestDecodeBinary(const std::vector<BaseField*>& MsgDefFields_, unsigned char** ppucLogBuf_, IntermediateMessage& stMessage_, uint32_t uiMessageLength_)
+      {
+         return MessageDecoder::DecodeBinary(MsgDefFields_, ppucLogBuf_, stMessage_, uiMessageLength_);
+      }
+   };
+
+   class DynamicEncoder : public Encoder
+   {
+   public:
+      DynamicEncoder(JsonReader* pclJsonDb_) : Encoder(pclJsonDb_) {}
+
+      bool TestEncodeBinaryBody(const IntermediateMessage& stMessage_, unsigned char** ppucOutBuf_, uint32_t uiBytes_, bool bFlatten_)
+      {
+         return Encoder::EncodeBinaryBody(stMessage_, ppucOutBuf_, uiBytes_, bFlatten_);
+      }
+   };
+
+   static std::unique_ptr<JsonReader> pclMyJsonDb;
+
+   // Per-test-suite setup
+   static void SetUpTestSuite()
+   {
+      pclMyJsonDb = std::make_unique<JsonReader>();
+      pclMyJsonDb->LoadFile(std::string(MESSAGE_VIEWS_DB_PATH));
+   }
+
+   // Per-test-suite teardown
+   static void TearDownTestSuite()
+   {
+      pclMyJsonDb.reset();
+   }
+
+   // Check a field decoded by the generated code against the same field decoded dynamically.
+   static void ExpectSameField(const FieldContainer& clField_, const FieldContainer& clDynamicField_)
+   {
+      ASSERT_EQ(clField_.field_def, clDynamicField_.field_def);
+      ASSERT_EQ(clField_.field_value.index(), clDynamicField_.field_value.index()) << clField_.field_def->name;
+      std::visit([&](const auto& value) {
+         using T = std::decay_t<decltype(value)>;
+         const auto& dynamic_value = std::get<T>(clDynamicField_.field_value);
+         if constexpr (std::is_same_v<T, std::vector<FieldContainer>>)
+         {
+            // The elements of an array, or the fields of a field array element.
+            ASSERT_EQ(value.size(), dynamic_value.size()) << clField_.field_def->name;
+            for (size_t i = 0; i < value.size(); ++i)
+               ExpectSameField(value[i], dynamic_value[i]);
+         }
+         else if constexpr (!std::is_same_v<T, IntermediateHeader>)
+         {
+            ASSERT_TRUE(value == dynamic_value) << clField_.field_def->name;
+         }
+      }, clField_.field_value);
+   }
+
+   // The value of a field decoded by the dynamic code.
+   template <typename T> static const T& DynamicValue(const std::vector<FieldContainer>& vFields_, const std::string& strName_)
+   {
+      const auto itField = std::find_if(vFields_.begin(), vFields_.end(), [&strName_](const FieldContainer& clField_) { return clField_.field_def->name == strName_; });
+      if (itField == vFields_.end())
+      {
+         throw std::runtime_error("no field " + strName_);
+      }
+      return std::get<T>(itField->field_value);
+   }
+
+   // Checks a message view of a BINARY body against the fields the dynamic code decoded from it.
+   using ViewCheck = std::function<void(const unsigned char* pucBody_, uint32_t uiBodyLength_, const IntermediateMessage& stDynamicMessage_)>;
+
+   // Convert an ASCII log to BINARY, then decode and encode its body with
+   // both the generated code and the dynamic code.
+   static void RoundTrip(const char* szLog_, const ViewCheck& fCheckView_ = nullptr)
+   {
+      HeaderDecoder clHeaderDecoder(pclMyJsonDb.get());
+      DynamicDecoder clDynamicDecoder(pclMyJsonDb.get());
+      DynamicEncoder clDynamicEncoder(pclMyJsonDb.get());
+
+      IntermediateHeader stHeader;
+      IntermediateMessage stAsciiMessage;
+      MetaDataStruct stMetaData;
+      MessageDataStruct stMessageData;
+      stMetaData.uiLength = static_cast<uint32_t>(strlen(szLog_)); // This would have been set by the framer.
+      auto* pucLog = reinterpret_cast<unsigned char*>(const_cast<char*>(szLog_));
+      ASSERT_EQ(STATUS::SUCCESS, clHeaderDecoder.Decode(pucLog, stHeader, stMetaData));
+      ASSERT_EQ(STATUS::SUCCESS, clDynamicDecoder.Decode(pucLog + stMetaData.uiHeaderLength, stAsciiMessage, stMetaData));
+
+      alignas(8) unsigned char acRecord[MAX_BINARY_MESSAGE_LENGTH];
+      unsigned char* pucRecord = acRecord;
+      ASSERT_EQ(STATUS::SUCCESS, clDynamicEncoder.Encode(&pucRecord, sizeof(acRecord), stHeader, stAsciiMessage, stMessageData, stMetaData, ENCODEFORMAT::BINARY));
+
+      // Decode the BINARY log as a framer would have handed it over.
+      MetaDataStruct stBinaryMetaData;
+      stBinaryMetaData.uiLength = stMessageData.uiMessageLength;
+      ASSERT_EQ(STATUS::SUCCESS, clHeaderDecoder.Decode(acRecord, stHeader, stBinaryMetaData));
+      const uint32_t uiBodyOffset = stBinaryMetaData.uiHeaderLength;
+      const uint32_t uiBodyLength = stBinaryMetaData.uiBinaryMsgLength;
+
+      const MessageDefinition* pclMessageDef = pclMyJsonDb->GetMsgDef(stBinaryMetaData.usMessageID);
+      ASSERT_NE(nullptr, pclMessageDef);
+      const auto itFields = pclMessageDef->fields.find(stBinaryMetaData.uiMessageCRC);
+      const auto& vMsgDefFields = itFields != pclMessageDef->fields.end() ? itFields->second : pclMessageDef->fields.at(pclMessageDef->latestMessageCrc);
+      const uint32_t uiMessageCRC = itFields != pclMessageDef->fields.end() ? stBinaryMetaData.uiMessageCRC : pclMessageDef->latestMessageCrc;
+
+      // FieldContainer cannot be copied, so the messages must not grow while they are decoded.
+      IntermediateMessage stDynamicMessage;
+      stDynamicMessage.reserve(vMsgDefFields.size());
+      unsigned char* pucBody = acRecord + uiBodyOffset;
+      ASSERT_EQ(STATUS::SUCCESS, clDynamicDecoder.TestDecodeBinary(vMsgDefFields, &pucBody, stDynamicMessage, uiBodyLength));
+
+      // UNSUPPORTED would mean the log was not generated and the comparison below proves nothing.
+      IntermediateMessage stSpecializedMessage;
+      stSpecializedMessage.reserve(vMsgDefFields.size());
+      ASSERT_EQ(STATUS::SUCCESS, specialized::DecodeBinary(stBinaryMetaData.usMessageID, uiMessageCRC, vMsgDefFields, acRecord + uiBodyOffset, uiBodyLength, stSpecializedMessage))
+         << pclMessageDef->name << " was not generated from " << MESSAGE_VIEWS_DB_PATH;
+      ASSERT_EQ(stSpecializedMessage.size(), stDynamicMessage.size());
+      for (size_t i = 0; i < stSpecializedMessage.size(); ++i)
+      {
+         ExpectSameField(stSpecializedMessage[i], stDynamicMessage[i]);
+      }
+      if (fCheckView_)
+      {
+         fCheckView_(acRecord + uiBodyOffset, uiBodyLength, stDynamicMessage);
+      }
+
+      for (const bool bFlatten : { false, true })
+      {
+         // Encode at the same offset as the original body, as padding depends on alignment.
+         alignas(8) unsigned char acDynamicBuffer[MAX_BINARY_MESSAGE_LENGTH];
+         unsigned char* pucDynamicBuffer = acDynamicBuffer + uiBodyOffset;
+         ASSERT_TRUE(clDynamicEncoder.TestEncodeBinaryBody(stDynamicMessage, &pucDynamicBuffer, sizeof(acDynamicBuffer) - uiBodyOffset, bFlatten));
+         const auto uiDynamicLength = static_cast<uint32_t>(pucDynamicBuffer - (acDynamicBuffer + uiBodyOffset));
+
+         alignas(8) unsigned char acSpecializedBuffer[MAX_BINARY_MESSAGE_LENGTH];
+         unsigned char* pucSpecializedBuffer = acSpecializedBuffer + uiBodyOffset;
+         uint32_t uiBytesRemaining = sizeof(acSpecializedBuffer) - uiBodyOffset;
+         ASSERT_EQ(STATUS::SUCCESS, specialized::EncodeBinary(stBinaryMetaData.usMessageID, uiMessageCRC, stSpecializedMessage, &pucSpecializedBuffer, uiBytesRemaining, bFlatten));
+         const auto uiSpecializedLength = static_cast<uint32_t>(pucSpecializedBuffer - (acSpecializedBuffer + uiBodyOffset));
+
+         ASSERT_EQ(uiDynamicLength, uiSpecializedLength) << "flatten " << bFlatten;
+         ASSERT_EQ(0, memcmp(acDynamicBuffer + uiBodyOffset, acSpecializedBuffer + uiBodyOffset, uiDynamicLength)) << "flatten " << bFlatten;
+         if (!bFlatten)
+         {
+            ASSERT_EQ(uiBodyLength, uiSpecializedLength);
+            ASSERT_EQ(0, memcmp(acRecord + uiBodyOffset, acSpecializedBuffer + uiBodyOffset, uiBodyLength));
+         }
+      }
+   }
+};
+
+std::unique_ptr<JsonReader> SpecializedCodecTest::pclMyJsonDb;
+
+TEST_F(SpecializedCodecTest, BESTPOS)
+{
+   // base_id is a string in a fixed length array.
+   RoundTrip("#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"131\",0.000,0.000,18,18,18,0,00,02,11,01*fe39c09d\r\n",
+             [](const unsigned char* pucBody_, uint32_t uiBodyLength_, const IntermediateMessage& stDynamicMessage_) {
+                const messages::BESTPOSView clView(pucBody_);
+                ASSERT_EQ(clView.End(), uiBodyLength_);
+                ASSERT_EQ(clView.solution_status(), DynamicValue<int32_t>(stDynamicMessage_, "solution_status"));
+                ASSERT_EQ(clView.position_type(), DynamicValue<int32_t>(stDynamicMessage_, "position_type"));
+                ASSERT_EQ(clView.latitude(), DynamicValue<double>(stDynamicMessage_, "latitude"));
+                ASSERT_EQ(clView.longitude(), DynamicValue<double>(stDynamicMessage_, "longitude"));
+                ASSERT_EQ(clView.height_std_dev(), DynamicValue<float>(stDynamicMessage_, "height_std_dev"));
+                ASSERT_EQ(clView.num_svs(), DynamicValue<uint8_t>(stDynamicMessage_, "num_svs"));
+
+                const auto& vBaseId = DynamicValue<std::vector<FieldContainer>>(stDynamicMessage_, "base_id");
+                ASSERT_EQ(clView.base_id().size(), vBaseId.size());
+                for (uint32_t i = 0; i < vBaseId.size(); i++)
+                {
+                   ASSERT_EQ(clView.base_id()[i], std::get<uint8_t>(vBaseId[i].field_value));
+                }
+
+                // The struct has the layout of the body.
+                messages::BESTPOS stBestPos;
+                memcpy(&stBestPos, pucBody_, sizeof(stBestPos));
+                ASSERT_EQ(stBestPos.latitude, clView.latitude());
+                ASSERT_EQ(stBestPos.num_soln_svs, clView.num_soln_svs());
+             });
+}
+
+TEST_F(SpecializedCodecTest, RANGE)
+{
+   RoundTrip("#RANGEA,COM1,0,6.5,COARSESTEERING,2180,407587.500,024c0020,5103,32768;3,8,0,22086479.072,0.079,-116065230.826912,0.008,827.920,48.3,20.465,0800bca4,32,0,22250341.055,0.070,-116926330.596180,0.007,3298.934,49.5,19.924,0800bce4,15,0,23310073.938,0.111,-122495264.853699,0.012,-3571.021,45.5,19.861,0800bda4*d32c11da\r\n",
+             [](const unsigned char* pucBody_, uint32_t uiBodyLength_, const IntermediateMessage& stDynamicMessage_) {
+                const messages::RANGEView clView(pucBody_);
+                ASSERT_EQ(clView.End(), uiBodyLength_);
+
+                const auto& vObservations = DynamicValue<std::vector<FieldContainer>>(stDynamicMessage_, "obs");
+                ASSERT_EQ(clView.obs().size(), 3U);
+                ASSERT_EQ(clView.obs().size(), vObservations.size());
+                uint32_t i = 0;
+                for (const auto clObservation : clView.obs())
+                {
+                   const auto& vFields = std::get<std::vector<FieldContainer>>(vObservations[i].field_value);
+                   ASSERT_EQ(clObservation.prn(), DynamicValue<uint16_t>(vFields, "prn"));
+                   ASSERT_EQ(clObservation.psr(), DynamicValue<double>(vFields, "psr"));
+                   ASSERT_EQ(clObservation.adr(), DynamicValue<double>(vFields, "adr"));
+                   ASSERT_EQ(clObservation.cno(), DynamicValue<float>(vFields, "cno"));
+                   ASSERT_EQ(clObservation.ch_tr_status(), DynamicValue<uint32_t>(vFields, "ch_tr_status"));
+                   ASSERT_EQ(clView.obs()[i].psr(), clObservation.psr());
+                   i++;
+                }
+             });
+}
+
+TEST_F(SpecializedCodecTest, CONFIGCODE)
+{
+   // Top-level strings, which move the fields after them.
+   RoundTrip("#CONFIGCODEA,THISPORT,0,0.0,UNKNOWN,0,0.000,00000000,dbc9,0;ERASE_TABLE,\"WJ4HDW\",\"GM5Z99\",\"T2M7DP\",\"KG2T8T\",\"KF7GKR\",\"TABLECLEAR\"*69419dec\r\n");
+   // Empty strings, strings a multiple of 4 bytes long and a string of its maximum length.
+   RoundTrip("#CONFIGCODEA,THISPORT,0,0.0,UNKNOWN,0,0.000,00000000,dbc9,0;ERASE_TABLE,\"\",\"ABCD\",\"T2M7DPQR\",\"K\",\"KF7GKRabcdefghijklmnopqrstuvwxyz\",\"TABLECLEARTABLE\"*3aca9715\r\n");
+}
+
+TEST_F(SpecializedCodecTest, RANGE_NO_OBSERVATIONS)
+{
+   RoundTrip("#RANGEA,COM1,0,5.5,UNKNOWN,0,25.000,024c00a0,5103,32768;0*943a8919\r\n");
+}
@@ -0,0 +1,416 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file binary_encode_plan.cpp
+//! \brief Precompiled steps for encoding a message body to binary.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "binary_encode_plan.hpp"
+
+#include <cstring>
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+//-----------------------------------------------------------------------
+template <typename T>
+static bool
+CopyValue(const std::variant<container_types>& clValue_, unsigned char* pucBuffer_)
+{
+   const T* ptValue = std::get_if<T>(&clValue_);
+   if (ptValue == nullptr)
+   {
+      return false;
+   }
+   memcpy(pucBuffer_, ptValue, sizeof(T));
+   return true;
+}
+
+//-----------------------------------------------------------------------
+//! Booleans are written as 4 bytes.
+static bool
+CopyBool(const std::variant<container_types>& clValue_, unsigned char* pucBuffer_)
+{
+   const bool* pbValue = std::get_if<bool>(&clValue_);
+   if (pbValue == nullptr)
+   {
+      return false;
+   }
+   const auto iValue = static_cast<int32_t>(*pbValue);
+   memcpy(pucBuffer_, &iValue, sizeof(iValue));
+   return true;
+}
+
+//-----------------------------------------------------------------------
+//! Character fields that are neither 1 nor 4 bytes are not written.
+static bool
+CopyNothing([[maybe_unused]] const std::variant<container_types>& clValue_, [[maybe_unused]] unsigned char* pucBuffer_)
+{
+   return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+BinaryEncodePlan::Compile(const std::vector<BaseField*>& vFields_)
+{
+   vMySteps.clear();
+   if (!CompileSteps(vFields_, vMySteps))
+   {
+      vMySteps.clear();
+      return false;
+   }
+   return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+BinaryEncodePlan::CompileSteps(const std::vector<BaseField*>& vFields_, std::vector<Step>& vSteps_)
+{
+   vSteps_.reserve(vFields_.size());
+   for (const BaseField* pclField : vFields_)
+   {
+      Step stStep;
+      stStep.pclField = pclField;
+
+      const uint32_t uiTypeLength = pclField->dataType.length;
+      if (uiTypeLength == 0)
+      {
+         return false;
+      }
+      stStep.uiAlignment = uiTypeLength >= 4 ? 4 : uiTypeLength;
+
+      switch (pclField->type)
+      {
+      case FIELD_TYPE::FIELD_ARRAY:
+      {
+         const auto* pclFieldArray = dynamic_cast<const FieldArrayField*>(pclField);
+         if (pclFieldArray == nullptr || !CompileSteps(pclFieldArray->fields, stStep.vFieldArraySteps))
+         {
+            return false;
+         }
+         stStep.eType = STEP_TYPE::FIELD_ARRAY;
+         stStep.uiFlattenedSize = pclFieldArray->fieldSize;
+         break;
+      }
+      case FIELD_TYPE::FIXED_LENGTH_ARRAY: [[fallthrough]];
+      case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: [[fallthrough]];
+      case FIELD_TYPE::STRING:
+      {
+         const auto* pclArray = dynamic_cast<const ArrayField*>(pclField);
+         if (pclArray == nullptr)
+         {
+            return false;
+         }
+         stStep.uiFlattenedSize = pclArray->arrayLength * uiTypeLength;
+         // Strings decoded from ASCII are arrays of characters, which are
+         // encoded as arrays.
+         const bool bCopyable = CompileCopy(pclField, stStep);
+         if (pclField->type == FIELD_TYPE::STRING)
+         {
+            stStep.eType = STEP_TYPE::STRING;
+            break;
+         }
+         if (!bCopyable)
+         {
+            return false;
+         }
+         stStep.eType = pclField->type == FIELD_TYPE::FIXED_LENGTH_ARRAY ? STEP_TYPE::FIXED_ARRAY : STEP_TYPE::VARIABLE_ARRAY;
+         break;
+      }
+      case FIELD_TYPE::ENUM: [[fallthrough]];
+      case FIELD_TYPE::RESPONSE_ID:
+         stStep.pfCopy = &CopyValue<int32_t>;
+         stStep.uiSize = sizeof(int32_t);
+         break;
+      case FIELD_TYPE::RESPONSE_STR:
+         stStep.eType = STEP_TYPE::RESPONSE_STRING;
+         break;
+      default:
+         if (!CompileCopy(pclField, stStep))
+         {
+            return false;
+         }
+         break;
+      }
+
+      vSteps_.push_back(std::move(stStep));
+   }
+   return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+BinaryEncodePlan::CompileCopy(const BaseField* pclField_, Step& stStep_)
+{
+   // The same choices as Encoder::FieldToBinary().
+   const auto SetCopy = [&stStep_](CopyFunction pfCopy_, uint32_t uiSize_) {
+      stStep_.pfCopy = pfCopy_;
+      stStep_.uiSize = uiSize_;
+      return true;
+   };
+
+   switch (pclField_->conversionStripped)
+   {
+   case CONVERSION_STRING::m:  [[fallthrough]];
+   case CONVERSION_STRING::T:  [[fallthrough]];
+   case CONVERSION_STRING::id: return SetCopy(&CopyValue<uint32_t>, sizeof(uint32_t));
+   case CONVERSION_STRING::UB: [[fallthrough]];
+   case CONVERSION_STRING::P:  [[fallthrough]];
+   case CONVERSION_STRING::XB: return SetCopy(&CopyValue<uint8_t>, sizeof(uint8_t));
+   case CONVERSION_STRING::B:  return SetCopy(&CopyValue<int8_t>, sizeof(int8_t));
+   case CONVERSION_STRING::k:  return SetCopy(&CopyValue<float>, sizeof(float));
+   case CONVERSION_STRING::lk: return SetCopy(&CopyValue<double>, sizeof(double));
+   case CONVERSION_STRING::c:
+      return (pclField_->dataType.length == 1)
+         ? SetCopy(&CopyValue<uint8_t>, sizeof(uint8_t))
+         : (pclField_->dataType.length == 4 && pclField_->dataType.name == DATA_TYPE_NAME::ULONG)
+         ? SetCopy(&CopyValue<uint32_t>, sizeof(uint32_t))
+         : SetCopy(&CopyNothing, 0);
+   default:
+      switch (pclField_->dataType.name)
+      {
+      case DATA_TYPE_NAME::BOOL:      return SetCopy(&CopyBool, sizeof(int32_t));
+      case DATA_TYPE_NAME::HEXBYTE:   [[fallthrough]];
+      case DATA_TYPE_NAME::UCHAR:     return SetCopy(&CopyValue<uint8_t>,  sizeof(uint8_t));
+      case DATA_TYPE_NAME::CHAR:      return SetCopy(&CopyValue<int8_t>,   sizeof(int8_t));
+      case DATA_TYPE_NAME::USHORT:    return SetCopy(&CopyValue<uint16_t>, sizeof(uint16_t));
+      case DATA_TYPE_NAME::SHORT:     return SetCopy(&CopyValue<int16_t>,  sizeof(int16_t));
+      case DATA_TYPE_NAME::UINT:      [[fallthrough]];
+      case DATA_TYPE_NAME::ULONG:     return SetCopy(&CopyValue<uint32_t>, sizeof(uint32_t));
+      case DATA_TYPE_NAME::INT:       [[fallthrough]];
+      case DATA_TYPE_NAME::LONG:      return SetCopy(&CopyValue<int32_t>,  sizeof(int32_t));
+      case DATA_TYPE_NAME::ULONGLONG: return SetCopy(&CopyValue<uint64_t>, sizeof(uint64_t));
+      case DATA_TYPE_NAME::LONGLONG:  return SetCopy(&CopyValue<int64_t>,  sizeof(int64_t));
+      case DATA_TYPE_NAME::FLOAT:     return SetCopy(&CopyValue<float>,    sizeof(float));
+      case DATA_TYPE_NAME::DOUBLE:    return SetCopy(&CopyValue<double>,   sizeof(double));
+      default:                        return false;
+      }
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+BinaryEncodePlan::Encode(const IntermediateMessage& stMessage_, unsigned char** ppucBuffer_, uint32_t& uiBufferBytesRemaining_, bool bFlatten_) const
+{
+   if (vMySteps.empty())
+   {
+      return false;
+   }
+
+   unsigned char* pucBuffer = *ppucBuffer_;
+   uint32_t uiBufferBytesRemaining = uiBufferBytesRemaining_;
+   if (!EncodeSteps(vMySteps, stMessage_, pucBuffer, uiBufferBytesRemaining, bFlatten_))
+   {
+      return false;
+   }
+   *ppucBuffer_ = pucBuffer;
+   uiBufferBytesRemaining_ = uiBufferBytesRemaining;
+   return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+BinaryEncodePlan::EncodeSteps(const std::vector<Step>& vSteps_, const std::vector<FieldContainer>& vFields_, unsigned char*& pucBuffer_, uint32_t& uiBufferBytesRemaining_, bool bFlatten_)
+{
+   // A message that was cut short has fewer fields than its definition.
+   if (vFields_.size() > vSteps_.size())
+   {
+      return false;
+   }
+
+   const auto Pad = [&pucBuffer_, &uiBufferBytesRemaining_](uint32_t uiBytes_) {
+      if (uiBufferBytesRemaining_ < uiBytes_)
+      {
+         return false;
+      }
+      memset(pucBuffer_, 0, uiBytes_);
+      pucBuffer_ += uiBytes_;
+      uiBufferBytesRemaining_ -= uiBytes_;
+      return true;
+   };
+
+   for (size_t i = 0; i < vFields_.size(); i++)
+   {
+      const Step& stStep = vSteps_[i];
+      const FieldContainer& clField = vFields_[i];
+      if (clField.field_def != stStep.pclField)
+      {
+         return false;
+      }
+
+      // Realign to type byte boundary if needed
+      const auto uiMisalignment = static_cast<uint32_t>(reinterpret_cast<uint64_t>(pucBuffer_) % stStep.uiAlignment);
+      if (uiMisalignment != 0 && !Pad(stStep.uiAlignment - uiMisalignment))
+      {
+         return false;
+      }
+
+      // Any field that holds an array, other than a FIELD_ARRAY, is an array
+      // of simple elements.
+      const auto* pvElements = std::get_if<std::vector<FieldContainer>>(&clField.field_value);
+      if (pvElements != nullptr && stStep.eType != STEP_TYPE::FIELD_ARRAY)
+      {
+         if (!EncodeArray(stStep, *pvElements, pucBuffer_, uiBufferBytesRemaining_, bFlatten_))
+         {
+            return false;
+         }
+         continue;
+      }
+
+      switch (stStep.eType)
+      {
+      case STEP_TYPE::SIMPLE: [[fallthrough]];
+      case STEP_TYPE::FIXED_ARRAY: [[fallthrough]];
+      case STEP_TYPE::VARIABLE_ARRAY:
+         if (uiBufferBytesRemaining_ < stStep.uiSize || !stStep.pfCopy(clField.field_value, pucBuffer_))
+         {
+            return false;
+         }
+         pucBuffer_ += stStep.uiSize;
+         uiBufferBytesRemaining_ -= stStep.uiSize;
+         break;
+
+      case STEP_TYPE::STRING: [[fallthrough]];
+      case STEP_TYPE::RESPONSE_STRING:
+      {
+         const auto* pstrValue = std::get_if<std::string>(&clField.field_value);
+         if (pstrValue == nullptr)
+         {
+            return false;
+         }
+
+         // Only up to the first null is written.
+         const auto uiLength = static_cast<uint32_t>(strlen(pstrValue->c_str()));
+         if (uiBufferBytesRemaining_ < uiLength)
+         {
+            return false;
+         }
+         memcpy(pucBuffer_, pstrValue->c_str(), uiLength);
+         pucBuffer_ += uiLength;
+         uiBufferBytesRemaining_ -= uiLength;
+
+         if (stStep.eType == STEP_TYPE::RESPONSE_STRING)
+         {
+            break;
+         }
+         // A string is always followed by at least one null.
+         if (bFlatten_ ? (uiLength < stStep.uiFlattenedSize && !Pad(stStep.uiFlattenedSize - uiLength))
+                       : !Pad(4 - static_cast<uint32_t>(reinterpret_cast<uint64_t>(pucBuffer_) % 4)))
+         {
+            return false;
+         }
+         break;
+      }
+
+      case STEP_TYPE::FIELD_ARRAY:
+      {
+         if (pvElements == nullptr || uiBufferBytesRemaining_ < sizeof(uint32_t))
+         {
+            return false;
+         }
+
+         const auto uiCount = static_cast<uint32_t>(pvElements->size());
+         memcpy(pucBuffer_, &uiCount, sizeof(uiCount));
+         pucBuffer_ += sizeof(uiCount);
+         uiBufferBytesRemaining_ -= sizeof(uiCount);
+
+         const unsigned char* pucArrayStart = pucBuffer_;
+         for (const FieldContainer& clElement : *pvElements)
+         {
+            const auto* pvElementFields = std::get_if<std::vector<FieldContainer>>(&clElement.field_value);
+            if (pvElementFields == nullptr || !EncodeSteps(stStep.vFieldArraySteps, *pvElementFields, pucBuffer_, uiBufferBytesRemaining_, bFlatten_))
+            {
+               return false;
+            }
+         }
+
+         const auto uiArrayBytes = static_cast<uint32_t>(pucBuffer_ - pucArrayStart);
+         if (bFlatten_ && uiArrayBytes < stStep.uiFlattenedSize && !Pad(stStep.uiFlattenedSize - uiArrayBytes))
+         {
+            return false;
+         }
+         break;
+      }
+      }
+   }
+   return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+BinaryEncodePlan::EncodeArray(const Step& stStep_, const std::vector<FieldContainer>& vElements_, unsigned char*& pucBuffer_, uint32_t& uiBufferBytesRemaining_, bool bFlatten_)
+{
+   // Only arrays have a length to flatten to.
+   if (stStep_.pfCopy == nullptr || (stStep_.eType != STEP_TYPE::FIXED_ARRAY && stStep_.eType != STEP_TYPE::VARIABLE_ARRAY && stStep_.eType != STEP_TYPE::STRING))
+   {
+      return false;
+   }
+
+   const auto uiCount = static_cast<uint32_t>(vElements_.size());
+   if (stStep_.eType == STEP_TYPE::VARIABLE_ARRAY)
+   {
+      if (uiBufferBytesRemaining_ < sizeof(uiCount))
+      {
+         return false;
+      }
+      memcpy(pucBuffer_, &uiCount, sizeof(uiCount));
+      pucBuffer_ += sizeof(uiCount);
+      uiBufferBytesRemaining_ -= sizeof(uiCount);
+   }
+
+   // Reserve the space for the whole array, then copy the elements.
+   const uint64_t ullArrayBytes = static_cast<uint64_t>(uiCount) * stStep_.uiSize;
+   if (uiBufferBytesRemaining_ < ullArrayBytes)
+   {
+      return false;
+   }
+   unsigned char* pucElement = pucBuffer_;
+   for (const FieldContainer& clElement : vElements_)
+   {
+      if (clElement.field_def != stStep_.pclField || !stStep_.pfCopy(clElement.field_value, pucElement))
+      {
+         return false;
+      }
+      pucElement += stStep_.uiSize;
+   }
+   pucBuffer_ = pucElement;
+   uiBufferBytesRemaining_ -= static_cast<uint32_t>(ullArrayBytes);
+
+   if (bFlatten_ && ullArrayBytes < stStep_.uiFlattenedSize)
+   {
+      const uint32_t uiPadding = stStep_.uiFlattenedSize - static_cast<uint32_t>(ullArrayBytes);
+      if (uiBufferBytesRemaining_ < uiPadding)
+      {
+         return false;
+      }
+      memset(pucBuffer_, 0, uiPadding);
+      pucBuffer_ += uiPadding;
+      uiBufferBytesRemaining_ -= uiPadding;
+   }
+   return true;
+}
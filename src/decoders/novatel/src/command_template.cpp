@@ -0,0 +1,162 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file command_template.cpp
+//! \brief Precompiled OEM commands with positional parameter slots.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "decoders/novatel/api/command_template.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+CommandTemplate::GetSlot(uint32_t uiSlot_, FieldContainer** ppclSlot_)
+{
+   if (uiSlot_ >= stMyParameters.size())
+   {
+      return STATUS::MALFORMED_INPUT;
+   }
+
+   *ppclSlot_ = &stMyParameters[uiSlot_];
+   return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+CommandTemplate::SetParameter(uint32_t uiSlot_, const char* pcValue_)
+{
+   if (!pcValue_)
+   {
+      return STATUS::NULL_PROVIDED;
+   }
+
+   FieldContainer* pclSlot = nullptr;
+   const STATUS eStatus = GetSlot(uiSlot_, &pclSlot);
+   if (eStatus != STATUS::SUCCESS)
+   {
+      return eStatus;
+   }
+
+   if (pclSlot->field_def->type == FIELD_TYPE::ENUM && std::holds_alternative<int32_t>(pclSlot->field_value))
+   {
+      const auto* pclEnumField = dynamic_cast<const EnumField*>(pclSlot->field_def);
+      if (pclEnumField && pclEnumField->enumDef)
+      {
+         for (const auto& stEnumerator : pclEnumField->enumDef->enumerators)
+         {
+            if (strcmp(stEnumerator.name.c_str(), pcValue_) == 0)
+            {
+               pclSlot->field_value = static_cast<int32_t>(stEnumerator.value);
+               return STATUS::SUCCESS;
+            }
+         }
+      }
+      return STATUS::MALFORMED_INPUT;
+   }
+
+   if (pclSlot->field_def->type == FIELD_TYPE::STRING && std::holds_alternative<std::string>(pclSlot->field_value))
+   {
+      // Commander::Compile() reserved room for the longest string the field allows, so assigning
+      // anything that fits will not reallocate.
+      auto& strSlotValue = std::get<std::string>(pclSlot->field_value);
+      const size_t ullLength = strlen(pcValue_);
+      const auto* pclArrayField = dynamic_cast<const ArrayField*>(pclSlot->field_def);
+      if (pclArrayField && ullLength > static_cast<size_t>(pclArrayField->arrayLength) * pclArrayField->dataType.length)
+      {
+         return STATUS::BUFFER_FULL;
+      }
+      strSlotValue.assign(pcValue_, ullLength);
+      return STATUS::SUCCESS;
+   }
+
+   return STATUS::MALFORMED_INPUT;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+CommandTemplate::Encode(char* pcEncodeBuffer_, uint32_t& uiEncodeBufferSize_, ENCODEFORMAT eEncodeFormat_)
+{
+   if (!pcEncodeBuffer_)
+   {
+      return STATUS::NULL_PROVIDED;
+   }
+
+   if (!IsCompiled())
+   {
+      return STATUS::NO_DEFINITION;
+   }
+
+   const unsigned char* pucHeader;
+   uint32_t uiHeaderLength;
+   switch (eEncodeFormat_)
+   {
+      case ENCODEFORMAT::ASCII:
+         pucHeader = aucMyAsciiHeader;
+         uiHeaderLength = uiMyAsciiHeaderLength;
+         break;
+      case ENCODEFORMAT::BINARY:
+         pucHeader = aucMyBinaryHeader;
+         uiHeaderLength = uiMyBinaryHeaderLength;
+         break;
+      default:
+         return STATUS::UNSUPPORTED;
+   }
+
+   if (uiEncodeBufferSize_ < uiHeaderLength)
+   {
+      return STATUS::BUFFER_FULL;
+   }
+
+   // The header never changes, so copy it in place of encoding it.
+   auto* pucEncodeBuffer = reinterpret_cast<unsigned char*>(pcEncodeBuffer_);
+   memcpy(pucEncodeBuffer, pucHeader, uiHeaderLength);
+
+   MessageDataStruct stMessageData;
+   stMessageData.pucMessageHeader = pucEncodeBuffer;
+   stMessageData.uiMessageHeaderLength = uiHeaderLength;
+
+   unsigned char* pucBody = pucEncodeBuffer + uiHeaderLength;
+   const STATUS eStatus = pclMyEncoder->EncodeBody(&pucBody, uiEncodeBufferSize_ - uiHeaderLength, stMyParameters, stMessageData, stMyMetaData, eEncodeFormat_);
+   if (eStatus != STATUS::SUCCESS)
+   {
+      return eStatus;
+   }
+
+   const uint32_t uiMessageLength = uiHeaderLength + stMessageData.uiMessageBodyLength;
+
+   // Null-terminate the command, if possible.  Otherwise the command will be the size of the buffer.
+   if (uiMessageLength < uiEncodeBufferSize_)
+   {
+      pucEncodeBuffer[uiMessageLength] = '\0';
+   }
+   uiEncodeBufferSize_ = uiMessageLength;
+
+   return STATUS::SUCCESS;
+}
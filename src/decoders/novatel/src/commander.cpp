@@ -43,12 +43,12 @@ Commander::Commander(JsonReader* pclJsonDb_) :
 {
    pclMyLogger = Logger().RegisterLogger("novatel_commander");
 
-   pclMyLogger->debug("Commander initializing...");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "Commander initializing...");
    if (pclJsonDb_ != nullptr)
    {
       LoadJsonDb(pclJsonDb_);
    }
-   pclMyLogger->debug("Commander initialized");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "Commander initialized");
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -130,20 +130,10 @@ Commander::CreateResponseMsgDefns()
 
 // -------------------------------------------------------------------------------------------------------
 STATUS
-Commander::Encode(const char* pcAbbrevAsciiCommand_, const uint32_t uiAbbrevAsciiCommandLength_, char* pcEncodeBuffer_, uint32_t& uiEncodeBufferSize_, const ENCODEFORMAT eEncodeFormat_)
+Commander::DecodeCommand(const char* pcAbbrevAsciiCommand_, const uint32_t uiAbbrevAsciiCommandLength_, IntermediateHeader& stIntermediateHeader_, IntermediateMessage& stIntermediateMessage_, MetaDataStruct& stMetaData_)
 {
    constexpr uint32_t thisPort = 0xC0;
 
-   if (!pcAbbrevAsciiCommand_ || !pcEncodeBuffer_)
-   {
-      return STATUS::NULL_PROVIDED;
-   }
-
-   if (eEncodeFormat_ != ENCODEFORMAT::ASCII && eEncodeFormat_ != ENCODEFORMAT::BINARY)
-   {
-      return STATUS::UNSUPPORTED;
-   }
-
    const std::string strAbbrevAsciiCommand = std::string(pcAbbrevAsciiCommand_, uiAbbrevAsciiCommandLength_);
    const size_t ullPos = strAbbrevAsciiCommand.find_first_of(' ');
    const std::string strCmdName = strAbbrevAsciiCommand.substr(0, ullPos);
@@ -164,27 +154,50 @@ Commander::Encode(const char* pcAbbrevAsciiCommand_, const uint32_t uiAbbrevAsci
       return STATUS::NO_DEFINITION;
    }
 
+   // Prime the metadata with information we already know
+   stMetaData_.eFormat = HEADERFORMAT::ABB_ASCII;
+   stMetaData_.usMessageID = static_cast<uint16_t>(pclMessageDef->logID);
+   stMetaData_.uiMessageCRC = static_cast<uint32_t>(pclMessageDef->fields.begin()->first);
+
+   const STATUS eStatus = clMyMessageDecoder.Decode(reinterpret_cast<unsigned char*>(pcCmdParams), stIntermediateMessage_, stMetaData_);
+   if(eStatus != STATUS::SUCCESS)
+   {
+      return eStatus;
+   }
+
+   // Prime the intermediate header with information we already know
+   stIntermediateHeader_.uiPortAddress = thisPort;
+   stIntermediateHeader_.usMessageID = stMetaData_.usMessageID;
+   stIntermediateHeader_.uiMessageDefinitionCRC = stMetaData_.uiMessageCRC;
+
+   return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Commander::Encode(const char* pcAbbrevAsciiCommand_, const uint32_t uiAbbrevAsciiCommandLength_, char* pcEncodeBuffer_, uint32_t& uiEncodeBufferSize_, const ENCODEFORMAT eEncodeFormat_)
+{
+   if (!pcAbbrevAsciiCommand_ || !pcEncodeBuffer_)
+   {
+      return STATUS::NULL_PROVIDED;
+   }
+
+   if (eEncodeFormat_ != ENCODEFORMAT::ASCII && eEncodeFormat_ != ENCODEFORMAT::BINARY)
+   {
+      return STATUS::UNSUPPORTED;
+   }
+
    MessageDataStruct stMessageData;
    MetaDataStruct stMetaData;
    IntermediateHeader stIntermediateHeader;
    IntermediateMessage stIntermediateMessage;
 
-   // Prime the metadata with information we already know
-   stMetaData.eFormat = HEADERFORMAT::ABB_ASCII;
-   stMetaData.usMessageID = static_cast<uint16_t>(pclMessageDef->logID);
-   stMetaData.uiMessageCRC = static_cast<uint32_t>(pclMessageDef->fields.begin()->first);
-
-   STATUS eStatus = clMyMessageDecoder.Decode(reinterpret_cast<unsigned char*>(pcCmdParams), stIntermediateMessage, stMetaData);
+   STATUS eStatus = DecodeCommand(pcAbbrevAsciiCommand_, uiAbbrevAsciiCommandLength_, stIntermediateHeader, stIntermediateMessage, stMetaData);
    if(eStatus != STATUS::SUCCESS)
    {
       return eStatus;
    }
 
-   // Prime the intermediate header with information we already know
-   stIntermediateHeader.uiPortAddress = thisPort;
-   stIntermediateHeader.usMessageID = stMetaData.usMessageID;
-   stIntermediateHeader.uiMessageDefinitionCRC = stMetaData.uiMessageCRC;
-
    eStatus = clMyEncoder.Encode(
       reinterpret_cast<unsigned char**>(&pcEncodeBuffer_), uiEncodeBufferSize_,
       stIntermediateHeader, stIntermediateMessage,
@@ -205,3 +218,60 @@ Commander::Encode(const char* pcAbbrevAsciiCommand_, const uint32_t uiAbbrevAsci
 
    return STATUS::SUCCESS;
 }
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Commander::Compile(const char* pcAbbrevAsciiCommand_, const uint32_t uiAbbrevAsciiCommandLength_, CommandTemplate& clCommandTemplate_)
+{
+   if (!pcAbbrevAsciiCommand_)
+   {
+      return STATUS::NULL_PROVIDED;
+   }
+
+   MessageDataStruct stMessageData;
+   MetaDataStruct stMetaData;
+   IntermediateHeader stIntermediateHeader;
+   IntermediateMessage stIntermediateMessage;
+
+   STATUS eStatus = DecodeCommand(pcAbbrevAsciiCommand_, uiAbbrevAsciiCommandLength_, stIntermediateHeader, stIntermediateMessage, stMetaData);
+   if(eStatus != STATUS::SUCCESS)
+   {
+      return eStatus;
+   }
+
+   // Encode both headers now so the template only has to copy them.
+   unsigned char* pucHeader = clCommandTemplate_.aucMyAsciiHeader;
+   eStatus = clMyEncoder.EncodeHeader(&pucHeader, CommandTemplate::uiMAX_HEADER_LENGTH, stIntermediateHeader, stMessageData, stMetaData, ENCODEFORMAT::ASCII);
+   if(eStatus != STATUS::SUCCESS)
+   {
+      return eStatus;
+   }
+   clCommandTemplate_.uiMyAsciiHeaderLength = stMessageData.uiMessageHeaderLength;
+
+   pucHeader = clCommandTemplate_.aucMyBinaryHeader;
+   eStatus = clMyEncoder.EncodeHeader(&pucHeader, CommandTemplate::uiMAX_HEADER_LENGTH, stIntermediateHeader, stMessageData, stMetaData, ENCODEFORMAT::BINARY);
+   if(eStatus != STATUS::SUCCESS)
+   {
+      return eStatus;
+   }
+   clCommandTemplate_.uiMyBinaryHeaderLength = stMessageData.uiMessageHeaderLength;
+
+   // Give string slots room for the longest value the field allows so refilling them never reallocates.
+   for (FieldContainer& clField : stIntermediateMessage)
+   {
+      if (clField.field_def->type == FIELD_TYPE::STRING && std::holds_alternative<std::string>(clField.field_value))
+      {
+         const auto* pclArrayField = dynamic_cast<const ArrayField*>(clField.field_def);
+         if (pclArrayField)
+         {
+            std::get<std::string>(clField.field_value).reserve(pclArrayField->arrayLength * pclArrayField->dataType.length);
+         }
+      }
+   }
+
+   clCommandTemplate_.stMyParameters = std::move(stIntermediateMessage);
+   clCommandTemplate_.stMyMetaData = stMetaData;
+   clCommandTemplate_.pclMyEncoder = &clMyEncoder;
+
+   return STATUS::SUCCESS;
+}
@@ -0,0 +1,258 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file deduplicator.cpp
+//! \brief Drop logs that have already been seen, such as the same log
+//! received over two ports.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <algorithm>
+#include <cstring>
+
+#include "deduplicator.hpp"
+#include "decoders/common/api/crc32.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+namespace {
+constexpr double dMILLISECONDS_PER_WEEK = 604800000.0;
+
+// The splitmix64 finalizer, so that every bit of the fingerprint depends on
+// every field and the low bits can index the table directly.
+uint64_t Mix(uint64_t ullValue_)
+{
+   ullValue_ ^= ullValue_ >> 30;
+   ullValue_ *= 0xBF58476D1CE4E5B9ULL;
+   ullValue_ ^= ullValue_ >> 27;
+   ullValue_ *= 0x94D049BB133111EBULL;
+   ullValue_ ^= ullValue_ >> 31;
+   return ullValue_;
+}
+
+uint32_t TableSize(uint32_t uiCapacity_)
+{
+   // Keep the table at most half full so that probe sequences stay short.
+   uint32_t uiSize = 2;
+   while (uiSize < 2 * uiCapacity_)
+   {
+      uiSize <<= 1;
+   }
+   return uiSize;
+}
+} // namespace
+
+// -------------------------------------------------------------------------------------------------------
+Deduplicator::Deduplicator(double dWindowMilliseconds_, uint32_t uiCapacity_) :
+   dMyWindowMilliseconds(std::max(dWindowMilliseconds_, 0.0)),
+   uiMyCapacity(std::max(uiCapacity_, 1U)),
+   vMyTable(TableSize(uiMyCapacity), 0),
+   vMyHistory(uiMyCapacity)
+{
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+Deduplicator::SetMatchAcrossPorts(bool bMatchAcrossPorts_)
+{
+   bMyMatchAcrossPorts = bMatchAcrossPorts_;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+Deduplicator::GetMatchAcrossPorts() const
+{
+   return bMyMatchAcrossPorts;
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint64_t
+Deduplicator::GetUniqueCount() const
+{
+   return ullMyUniqueCount;
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint64_t
+Deduplicator::GetDuplicateCount() const
+{
+   return ullMyDuplicateCount;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+Deduplicator::Clear()
+{
+   std::fill(vMyTable.begin(), vMyTable.end(), 0);
+   uiMyHistoryHead = 0;
+   uiMyHistorySize = 0;
+   dMyLatestTime = 0.0;
+   ullMyUniqueCount = 0;
+   ullMyDuplicateCount = 0;
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint64_t
+Deduplicator::Fingerprint(const IntermediateHeader& stHeader_, const MetaDataStruct& stMetaData_, const unsigned char* pucFrame_) const
+{
+   uint32_t uiContentKey = stMetaData_.uiFrameCRC;
+   if (bMyMatchAcrossPorts || uiContentKey == 0)
+   {
+      // Hash the body without the header or the frame CRC, both of which
+      // change with the port.
+      uint32_t uiTrailerLength = 0;
+      if (stMetaData_.eFormat == HEADERFORMAT::BINARY || stMetaData_.eFormat == HEADERFORMAT::SHORT_BINARY)
+      {
+         uiTrailerLength = OEM4_BINARY_CRC_LENGTH;
+      }
+      else if (stMetaData_.eFormat == HEADERFORMAT::ASCII || stMetaData_.eFormat == HEADERFORMAT::SHORT_ASCII)
+      {
+         uiTrailerLength = OEM4_ASCII_CRC_LENGTH + 3; // '*' and CRLF
+      }
+      const uint32_t uiBodyLength = stMetaData_.uiLength > stMetaData_.uiHeaderLength + uiTrailerLength
+                                       ? stMetaData_.uiLength - stMetaData_.uiHeaderLength - uiTrailerLength
+                                       : 0;
+      uiContentKey = CalculateBlockCRC32(uiBodyLength, 0, pucFrame_ + stMetaData_.uiHeaderLength);
+   }
+
+   uint64_t ullMilliseconds = 0;
+   memcpy(&ullMilliseconds, &stMetaData_.dMilliseconds, sizeof(ullMilliseconds));
+
+   uint64_t ullFingerprint = Mix(static_cast<uint64_t>(stMetaData_.usMessageID)
+                               | static_cast<uint64_t>(stMetaData_.eMeasurementSource) << 16
+                               | static_cast<uint64_t>(stHeader_.usSequence) << 32
+                               | static_cast<uint64_t>(stMetaData_.usWeek) << 48);
+   ullFingerprint = Mix(ullFingerprint ^ ullMilliseconds);
+   ullFingerprint = Mix(ullFingerprint ^ uiContentKey);
+   return ullFingerprint != 0 ? ullFingerprint : 1;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+Deduplicator::Insert(uint64_t ullFingerprint_)
+{
+   const size_t ullMask = vMyTable.size() - 1;
+   for (size_t i = ullFingerprint_ & ullMask;; i = (i + 1) & ullMask)
+   {
+      if (vMyTable[i] == ullFingerprint_)
+      {
+         return false;
+      }
+      if (vMyTable[i] == 0)
+      {
+         vMyTable[i] = ullFingerprint_;
+         return true;
+      }
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+Deduplicator::Erase(uint64_t ullFingerprint_)
+{
+   const size_t ullMask = vMyTable.size() - 1;
+   size_t ullHole = ullFingerprint_ & ullMask;
+   while (vMyTable[ullHole] != ullFingerprint_)
+   {
+      if (vMyTable[ullHole] == 0)
+      {
+         return;
+      }
+      ullHole = (ullHole + 1) & ullMask;
+   }
+
+   // Shift later entries of the probe sequence back into the hole, so that
+   // lookups never need tombstones.
+   for (size_t i = (ullHole + 1) & ullMask; vMyTable[i] != 0; i = (i + 1) & ullMask)
+   {
+      const size_t ullHome = vMyTable[i] & ullMask;
+      const bool bHomeAfterHole = ullHole <= i ? (ullHome > ullHole && ullHome <= i) : (ullHome > ullHole || ullHome <= i);
+      if (!bHomeAfterHole)
+      {
+         vMyTable[ullHole] = vMyTable[i];
+         ullHole = i;
+      }
+   }
+   vMyTable[ullHole] = 0;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+Deduplicator::ExpireOldest()
+{
+   Erase(vMyHistory[uiMyHistoryHead].ullFingerprint);
+   uiMyHistoryHead = (uiMyHistoryHead + 1) % uiMyCapacity;
+   uiMyHistorySize--;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+Deduplicator::IsDuplicate(const IntermediateHeader& stHeader_, const MetaDataStruct& stMetaData_, const unsigned char* pucFrame_)
+{
+   // Logs without a GPS time are remembered as of the latest time seen.
+   if (stMetaData_.usWeek != 0)
+   {
+      const double dTime = stMetaData_.usWeek * dMILLISECONDS_PER_WEEK + stMetaData_.dMilliseconds;
+      if (dTime < dMyLatestTime - dMyWindowMilliseconds)
+      {
+         // Time went back by more than the window, as when a new recording
+         // starts, so nothing remembered from before can be repeated now.
+         while (uiMyHistorySize > 0)
+         {
+            ExpireOldest();
+         }
+         dMyLatestTime = dTime;
+      }
+      else
+      {
+         dMyLatestTime = std::max(dMyLatestTime, dTime);
+      }
+   }
+   while (uiMyHistorySize > 0 && vMyHistory[uiMyHistoryHead].dTime < dMyLatestTime - dMyWindowMilliseconds)
+   {
+      ExpireOldest();
+   }
+
+   // The table has room for one more than the capacity, so the oldest log
+   // only needs to be forgotten once this one is known to be new.
+   const uint64_t ullFingerprint = Fingerprint(stHeader_, stMetaData_, pucFrame_);
+   if (!Insert(ullFingerprint))
+   {
+      ullMyDuplicateCount++;
+      return true;
+   }
+   if (uiMyHistorySize == uiMyCapacity)
+   {
+      ExpireOldest();
+   }
+
+   vMyHistory[(uiMyHistoryHead + uiMyHistorySize) % uiMyCapacity] = { ullFingerprint, dMyLatestTime };
+   uiMyHistorySize++;
+   ullMyUniqueCount++;
+   return false;
+}
@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file encode_sink.cpp
+//! \brief Destinations for encoded messages that are not limited to a
+//! fixed size buffer.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <algorithm>
+#include <cstring>
+
+#include "encode_sink.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+EncodeSink::Append(MessageDataStruct& stMessageData_)
+{
+   uint32_t uiReserved = 0;
+   unsigned char* pucBuffer = Reserve(stMessageData_.uiMessageLength, uiReserved);
+   if (pucBuffer == nullptr)
+   {
+      return STATUS::BUFFER_FULL;
+   }
+
+   const unsigned char* pucMessage = stMessageData_.pucMessage;
+   memcpy(pucBuffer, pucMessage, stMessageData_.uiMessageLength);
+   stMessageData_.pucMessage = pucBuffer;
+   if (stMessageData_.pucMessageHeader != nullptr)
+   {
+      stMessageData_.pucMessageHeader = pucBuffer + (stMessageData_.pucMessageHeader - pucMessage);
+   }
+   if (stMessageData_.pucMessageBody != nullptr)
+   {
+      stMessageData_.pucMessageBody = pucBuffer + (stMessageData_.pucMessageBody - pucMessage);
+   }
+   Commit(stMessageData_.uiMessageLength);
+   return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+GrowableEncodeSink::GrowableEncodeSink(uint32_t uiMaxSize_) : uiMyMaxSize(uiMaxSize_)
+{
+}
+
+// -------------------------------------------------------------------------------------------------------
+unsigned char*
+GrowableEncodeSink::Reserve(uint32_t uiSize_, uint32_t& uiReserved_)
+{
+   uiMySize = 0;
+   if (uiSize_ > uiMyMaxSize)
+   {
+      return nullptr;
+   }
+
+   if (uiSize_ > uiMyCapacity)
+   {
+      // Grow geometrically so a run of slightly larger messages does not
+      // reallocate every time.
+      const uint32_t uiCapacity = std::max(uiSize_, uiMyCapacity > uiMyMaxSize / 2 ? uiMyMaxSize : uiMyCapacity * 2);
+      pucMyBuffer = std::make_unique<unsigned char[]>(uiCapacity);
+      uiMyCapacity = uiCapacity;
+   }
+
+   uiReserved_ = uiMyCapacity;
+   return pucMyBuffer.get();
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+GrowableEncodeSink::GetMaxSize() const
+{
+   return uiMyMaxSize;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+GrowableEncodeSink::Commit(uint32_t uiSize_)
+{
+   uiMySize = std::min(uiSize_, uiMyCapacity);
+}
+
+// -------------------------------------------------------------------------------------------------------
+const unsigned char*
+GrowableEncodeSink::GetData() const
+{
+   return pucMyBuffer.get();
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+GrowableEncodeSink::GetSize() const
+{
+   return uiMySize;
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+GrowableEncodeSink::GetCapacity() const
+{
+   return uiMyCapacity;
+}
+
+// -------------------------------------------------------------------------------------------------------
+OutputStreamEncodeSink::OutputStreamEncodeSink(OutputStreamInterface* pclStream_, uint32_t uiMaxSize_) : GrowableEncodeSink(uiMaxSize_), pclMyStream(pclStream_)
+{
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+OutputStreamEncodeSink::Commit(uint32_t uiSize_)
+{
+   GrowableEncodeSink::Commit(uiSize_);
+   if (pclMyStream != nullptr && GetSize() > 0)
+   {
+      // WriteData() takes a mutable pointer but does not modify the data.
+      ullMyBytesWritten += pclMyStream->WriteData(reinterpret_cast<char*>(const_cast<unsigned char*>(GetData())), GetSize());
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint64_t
+OutputStreamEncodeSink::GetBytesWritten() const
+{
+   return ullMyBytesWritten;
+}
@@ -64,13 +64,13 @@ Encoder::Encoder(JsonReader* pclJsonDb_) :
 {
    pclMyLogger = Logger().RegisterLogger("novatel_encoder");
 
-   pclMyLogger->debug("Encoder initializing...");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "Encoder initializing...");
 
    if (pclJsonDb_ != nullptr)
    {
       LoadJsonDb(pclJsonDb_);
    }
-   pclMyLogger->debug("Encoder initialized");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "Encoder initialized");
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -81,6 +81,7 @@ Encoder::LoadJsonDb(JsonReader* pclJsonDb_)
 
    InitEnumDefns();
    CreateResponseMsgDefns();
+   CompileBinaryEncodePlans();
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -104,6 +105,13 @@ Encoder::ShutdownLogger()
    Logger::Shutdown();
 }
 
+// -------------------------------------------------------------------------------------------------------
+void
+Encoder::SetSpecializedEncoder(SpecializedBinaryEncoder pfEncoder_)
+{
+   pfMySpecializedEncoder = pfEncoder_;
+}
+
 // -------------------------------------------------------------------------------------------------------
 void
 Encoder::InitEnumDefns()
@@ -149,6 +157,24 @@ Encoder::CreateResponseMsgDefns()
    stMyRespDef.fields[0].push_back(stRespStrField.clone());
 }
 
+// -------------------------------------------------------------------------------------------------------
+void
+Encoder::CompileBinaryEncodePlans()
+{
+   umMyBinaryEncodePlans.clear();
+   for (const MessageDefinition& stMessageDef : pclMyMsgDb->GetMessageDefinitions())
+   {
+      for (const auto& itFields : stMessageDef.fields)
+      {
+         BinaryEncodePlan clPlan;
+         if (!itFields.second.empty() && clPlan.Compile(itFields.second))
+         {
+            umMyBinaryEncodePlans.emplace(itFields.second.front(), std::move(clPlan));
+         }
+      }
+   }
+}
+
 // -------------------------------------------------------------------------------------------------------
 uint32_t
 Encoder::MsgNameToMsgId(std::string sMsgName_) const
@@ -237,7 +263,11 @@ Encoder::GetMsgDefFromCRC(const MessageDefinition* pclMessageDef_, uint32_t &uiM
    MsgFieldsVector* pvMsgFields;
    if (pclMessageDef_->fields.count(uiMsgDefCRC_) == 0)
    {
-      pclMyLogger->info("Log DB is missing the log definition {} - {}.  Defaulting to newest version of the log definition.", pclMessageDef_->name, uiMsgDefCRC_);
+      uint64_t ullSuppressed = 0;
+      if (pclMyLogger->should_log(spdlog::level::info) && clMyLogRateLimiter.ShouldLog(0, static_cast<uint32_t>(STATUS::NO_DEFINITION), pclMessageDef_->logID, ullSuppressed))
+      {
+         pclMyLogger->info("Log DB is missing the log definition {} - {}.  Defaulting to newest version of the log definition.{}", pclMessageDef_->name, uiMsgDefCRC_, LogRateLimiter::Suppressed(ullSuppressed));
+      }
       pvMsgFields = &pclMessageDef_->fields.at(pclMessageDef_->latestMessageCrc);
       uiMsgDefCRC_ = pclMessageDef_->latestMessageCrc;
    }
@@ -1230,6 +1260,7 @@ Encoder::Encode(
    }
 
    pucTempEncodeBuffer += stMessageData_.uiMessageHeaderLength;
+   uiEncodeBufferSize_ -= stMessageData_.uiMessageHeaderLength;
 
    if (eEncodeFormat_ == ENCODEFORMAT::JSON)
    {
@@ -1246,6 +1277,7 @@ Encoder::Encode(
    }
 
    pucTempEncodeBuffer += stMessageData_.uiMessageBodyLength;
+   uiEncodeBufferSize_ -= stMessageData_.uiMessageBodyLength;
 
    if (eEncodeFormat_ == ENCODEFORMAT::JSON)
    {
@@ -1261,6 +1293,46 @@ Encoder::Encode(
    return STATUS::SUCCESS;
 }
 
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Encoder::Encode(
+   EncodeSink& clSink_,
+   IntermediateHeader& stHeader_,
+   IntermediateMessage& stMessage_,
+   MessageDataStruct& stMessageData_,
+   MetaDataStruct& stMetaData_,
+   ENCODEFORMAT eEncodeFormat_)
+{
+   uint32_t uiSize = MESSAGE_SIZE_MAX;
+   while (true)
+   {
+      uint32_t uiReserved = 0;
+      unsigned char* pucEncodeBuffer = clSink_.Reserve(uiSize, uiReserved);
+      if (pucEncodeBuffer == nullptr)
+      {
+         return STATUS::BUFFER_FULL;
+      }
+
+      const STATUS eStatus = Encode(&pucEncodeBuffer, uiReserved, stHeader_, stMessage_, stMessageData_, stMetaData_, eEncodeFormat_);
+      if (eStatus == STATUS::SUCCESS)
+      {
+         clSink_.Commit(stMessageData_.uiMessageLength);
+      }
+      if (eStatus != STATUS::BUFFER_FULL)
+      {
+         return eStatus;
+      }
+
+      // Ask for twice as much, but no more than the sink can hold.
+      const uint32_t uiMaxSize = clSink_.GetMaxSize();
+      if (uiReserved >= uiMaxSize)
+      {
+         return STATUS::BUFFER_FULL;
+      }
+      uiSize = uiReserved > uiMaxSize / 2 ? uiMaxSize : uiReserved * 2;
+   }
+}
+
 // -------------------------------------------------------------------------------------------------------
 STATUS
 Encoder::EncodeHeader(
@@ -1400,10 +1472,28 @@ Encoder::EncodeBody(
       case ENCODEFORMAT::FLATTENED_BINARY:
          [[fallthrough]];
       case ENCODEFORMAT::BINARY:
-         if (!EncodeBinaryBody(stMessage_, &pucTempEncodeBuffer, uiEncodeBufferSize_, eEncodeFormat_ == ENCODEFORMAT::FLATTENED_BINARY))
+      {
+         // Use the code generated for the message's definition, then its
+         // encode plan, and walk the field definitions instead if neither
+         // can encode this message.
+         const bool bFlatten = eEncodeFormat_ == ENCODEFORMAT::FLATTENED_BINARY;
+         const STATUS eSpecialized = pfMySpecializedEncoder && !stMetaData_.bResponse
+            ? pfMySpecializedEncoder(stMetaData_.usMessageID, stMetaData_.uiMessageCRC, stMessage_, &pucTempEncodeBuffer, uiEncodeBufferSize_, bFlatten)
+            : STATUS::UNSUPPORTED;
+         if (eSpecialized != STATUS::SUCCESS && eSpecialized != STATUS::UNSUPPORTED)
          {
-            return STATUS::BUFFER_FULL;
+            return eSpecialized;
+         }
+         if (eSpecialized == STATUS::UNSUPPORTED)
+         {
+            const auto itPlan = stMessage_.empty() ? umMyBinaryEncodePlans.end() : umMyBinaryEncodePlans.find(stMessage_.front().field_def);
+            if ((itPlan == umMyBinaryEncodePlans.end() || !itPlan->second.Encode(stMessage_, &pucTempEncodeBuffer, uiEncodeBufferSize_, bFlatten))
+               && !EncodeBinaryBody(stMessage_, &pucTempEncodeBuffer, uiEncodeBufferSize_, bFlatten))
+            {
+               return STATUS::BUFFER_FULL;
+            }
          }
+      }
 
          // MessageData must have a valid MessageHeader pointer to populate the length field.
          if (!stMessageData_.pucMessageHeader)
@@ -0,0 +1,275 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file file_index.cpp
+//! \brief Sidecar index of the frames in a log file.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "file_index.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+
+#include "decoders/novatel/api/framer.hpp"
+#include "decoders/novatel/api/header_decoder.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+//! Sidecar file header: magic, format version, record size and record count.
+static constexpr char acINDEX_MAGIC[8] = { 'E', 'D', 'I', 'E', 'I', 'D', 'X', '\0' };
+static constexpr uint32_t uiINDEX_VERSION = 1;
+//! Logs without a time sort after every log with one.
+static constexpr uint64_t ullNO_TIME = std::numeric_limits<uint64_t>::max();
+
+// -------------------------------------------------------------------------------------------------------
+static uint64_t GpsTimeKey(uint32_t uiWeek_, double dMilliseconds_)
+{
+   return static_cast<uint64_t>(uiWeek_) * SECS_IN_WEEK * 1000ULL + static_cast<uint64_t>(dMilliseconds_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+static uint64_t GpsTimeKey(const FileIndexEntry& stEntry_)
+{
+   return stEntry_.usWeek == 0 ? ullNO_TIME : GpsTimeKey(stEntry_.usWeek, stEntry_.uiMilliseconds);
+}
+
+// -------------------------------------------------------------------------------------------------------
+std::string
+FileIndex::GetSidecarPath(const std::string& sLogFilePath_)
+{
+   return sLogFilePath_ + szSIDECAR_EXTENSION;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+FileIndex::Build(InputFileStream* pclInputStream_, JsonReader* pclJsonDb_)
+{
+   if (pclInputStream_ == nullptr || pclJsonDb_ == nullptr)
+   {
+      return false;
+   }
+
+   Framer clFramer;
+   HeaderDecoder clHeaderDecoder(pclJsonDb_);
+   IntermediateHeader stHeader;
+   MetaDataStruct stMetaData;
+
+   std::unique_ptr<unsigned char[]> pucFrameBuffer(new unsigned char[MAX_BINARY_MESSAGE_LENGTH]);
+   std::unique_ptr<char[]> pcReadBuffer(new char[MAX_ASCII_MESSAGE_LENGTH]);
+   ReadDataStructure stReadData;
+   stReadData.cData = pcReadBuffer.get();
+   stReadData.uiDataSize = MAX_ASCII_MESSAGE_LENGTH;
+
+   vMyEntries.clear();
+   pclInputStream_->Reset(0, std::ios::beg);
+
+   uint64_t ullBytesWritten = 0;
+   StreamReadStatus stReadStatus;
+   do
+   {
+      stReadStatus = pclInputStream_->ReadData(stReadData);
+      clFramer.Write(reinterpret_cast<unsigned char*>(stReadData.cData), stReadStatus.uiCurrentStreamRead);
+      ullBytesWritten += stReadStatus.uiCurrentStreamRead;
+
+      while (true)
+      {
+         const STATUS eStatus = clFramer.GetFrame(pucFrameBuffer.get(), MAX_BINARY_MESSAGE_LENGTH, stMetaData);
+         if (eStatus == STATUS::INCOMPLETE || eStatus == STATUS::BUFFER_EMPTY)
+         {
+            break;
+         }
+         if (eStatus != STATUS::SUCCESS || clHeaderDecoder.Decode(pucFrameBuffer.get(), stHeader, stMetaData) != STATUS::SUCCESS)
+         {
+            continue;
+         }
+
+         // The frame ends where the bytes still held by the framer begin.
+         FileIndexEntry stEntry;
+         stEntry.ullOffset = ullBytesWritten - clFramer.GetBufferedByteCount() - stMetaData.uiLength;
+         stEntry.uiLength = stMetaData.uiLength;
+         stEntry.uiMilliseconds = static_cast<uint32_t>(stMetaData.dMilliseconds);
+         stEntry.usWeek = stMetaData.usWeek;
+         stEntry.usMessageId = stMetaData.usMessageID;
+         stEntry.ucFormat = static_cast<uint8_t>(stMetaData.eFormat);
+         stEntry.ucMeasurementSource = static_cast<uint8_t>(stMetaData.eMeasurementSource);
+         vMyEntries.push_back(stEntry);
+      }
+   } while (!stReadStatus.bEOS && stReadStatus.uiCurrentStreamRead > 0);
+
+   pclInputStream_->Reset(0, std::ios::beg);
+   BuildTimeBounds();
+   return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+FileIndex::BuildTimeBounds()
+{
+   const size_t ullEntries = vMyEntries.size();
+   vMyRunningMaxTime.resize(ullEntries);
+   vMyRunningMinTime.resize(ullEntries);
+
+   uint64_t ullMax = 0;
+   for (size_t i = 0; i < ullEntries; i++)
+   {
+      const uint64_t ullTime = GpsTimeKey(vMyEntries[i]);
+      if (ullTime != ullNO_TIME)
+      {
+         ullMax = std::max(ullMax, ullTime);
+      }
+      vMyRunningMaxTime[i] = ullMax;
+   }
+
+   uint64_t ullMin = ullNO_TIME;
+   for (size_t i = ullEntries; i-- > 0;)
+   {
+      ullMin = std::min(ullMin, GpsTimeKey(vMyEntries[i]));
+      vMyRunningMinTime[i] = ullMin;
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+FileIndex::Save(const std::string& sPath_) const
+{
+   std::ofstream clFile(sPath_, std::ios::binary | std::ios::trunc);
+   const uint32_t uiRecordSize = sizeof(FileIndexEntry);
+   const uint64_t ullCount = vMyEntries.size();
+
+   clFile.write(acINDEX_MAGIC, sizeof(acINDEX_MAGIC));
+   clFile.write(reinterpret_cast<const char*>(&uiINDEX_VERSION), sizeof(uiINDEX_VERSION));
+   clFile.write(reinterpret_cast<const char*>(&uiRecordSize), sizeof(uiRecordSize));
+   clFile.write(reinterpret_cast<const char*>(&ullCount), sizeof(ullCount));
+   clFile.write(reinterpret_cast<const char*>(vMyEntries.data()), static_cast<std::streamsize>(ullCount * uiRecordSize));
+   return clFile.good();
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+FileIndex::Load(const std::string& sPath_)
+{
+   std::ifstream clFile(sPath_, std::ios::binary);
+   char acMagic[sizeof(acINDEX_MAGIC)] = {};
+   uint32_t uiVersion = 0;
+   uint32_t uiRecordSize = 0;
+   uint64_t ullCount = 0;
+
+   clFile.read(acMagic, sizeof(acMagic));
+   clFile.read(reinterpret_cast<char*>(&uiVersion), sizeof(uiVersion));
+   clFile.read(reinterpret_cast<char*>(&uiRecordSize), sizeof(uiRecordSize));
+   clFile.read(reinterpret_cast<char*>(&ullCount), sizeof(ullCount));
+   if (!clFile.good() || memcmp(acMagic, acINDEX_MAGIC, sizeof(acMagic)) != 0
+       || uiVersion != uiINDEX_VERSION || uiRecordSize != sizeof(FileIndexEntry))
+   {
+      return false;
+   }
+
+   // The count is untrusted, so check it against what is left of the file
+   // before allocating for it.
+   const std::streamoff llHeaderEnd = clFile.tellg();
+   clFile.seekg(0, std::ios::end);
+   const std::streamoff llFileEnd = clFile.tellg();
+   clFile.seekg(llHeaderEnd);
+   if (llHeaderEnd < 0 || llFileEnd < llHeaderEnd
+       || ullCount != static_cast<uint64_t>(llFileEnd - llHeaderEnd) / sizeof(FileIndexEntry)
+       || static_cast<uint64_t>(llFileEnd - llHeaderEnd) % sizeof(FileIndexEntry) != 0)
+   {
+      return false;
+   }
+
+   std::vector<FileIndexEntry> vEntries(ullCount);
+   clFile.read(reinterpret_cast<char*>(vEntries.data()), static_cast<std::streamsize>(ullCount * uiRecordSize));
+   if (!clFile.good())
+   {
+      return false;
+   }
+
+   vMyEntries.swap(vEntries);
+   BuildTimeBounds();
+   return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+const std::vector<FileIndexEntry>&
+FileIndex::GetEntries() const
+{
+   return vMyEntries;
+}
+
+// -------------------------------------------------------------------------------------------------------
+std::vector<FileIndexRange>
+FileIndex::SelectEntries(size_t ullBegin_, size_t ullEnd_, const std::vector<uint32_t>& vMessageIds_) const
+{
+   std::vector<FileIndexRange> vRanges;
+   for (size_t i = ullBegin_; i < ullEnd_; i++)
+   {
+      const FileIndexEntry& stEntry = vMyEntries[i];
+      if (!vMessageIds_.empty() && std::find(vMessageIds_.begin(), vMessageIds_.end(), stEntry.usMessageId) == vMessageIds_.end())
+      {
+         continue;
+      }
+
+      // Keep any unknown bytes between selected logs when no message IDs are
+      // given, so a window is read as one range.
+      if (!vRanges.empty() && (vMessageIds_.empty() || vRanges.back().ullEnd == stEntry.ullOffset))
+      {
+         vRanges.back().ullEnd = stEntry.ullOffset + stEntry.uiLength;
+      }
+      else
+      {
+         vRanges.push_back({ stEntry.ullOffset, stEntry.ullOffset + stEntry.uiLength });
+      }
+   }
+   return vRanges;
+}
+
+// -------------------------------------------------------------------------------------------------------
+std::vector<FileIndexRange>
+FileIndex::Select(uint32_t uiLowerWeek_, double dLowerSec_, uint32_t uiUpperWeek_, double dUpperSec_, const std::vector<uint32_t>& vMessageIds_) const
+{
+   const uint64_t ullLower = GpsTimeKey(uiLowerWeek_, dLowerSec_ * 1000.0);
+   const uint64_t ullUpper = GpsTimeKey(uiUpperWeek_, dUpperSec_ * 1000.0);
+
+   // Every entry before ullBegin is earlier than the window, and every entry
+   // from ullEnd on is later than it.
+   const size_t ullBegin = std::lower_bound(vMyRunningMaxTime.begin(), vMyRunningMaxTime.end(), ullLower) - vMyRunningMaxTime.begin();
+   const size_t ullEnd = std::upper_bound(vMyRunningMinTime.begin(), vMyRunningMinTime.end(), ullUpper) - vMyRunningMinTime.begin();
+
+   return SelectEntries(ullBegin, ullEnd, vMessageIds_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+std::vector<FileIndexRange>
+FileIndex::Select(const std::vector<uint32_t>& vMessageIds_) const
+{
+   return SelectEntries(0, vMyEntries.size(), vMessageIds_);
+}
@@ -0,0 +1,346 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file file_merger.cpp
+//! \brief Merge the logs of several FileParsers into one GPS time ordered
+//! stream.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <algorithm>
+
+#include "file_merger.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+namespace {
+constexpr double dMILLISECONDS_PER_WEEK = 604800000.0;
+
+// Point a MessageDataStruct at a copy of the bytes it covers.
+void CopyMessageData(const MessageDataStruct& stSource_, std::vector<unsigned char>& vData_, MessageDataStruct& stTarget_)
+{
+   const unsigned char* pucBegin = nullptr;
+   const unsigned char* pucEnd = nullptr;
+   for (const auto& [pucData, uiLength] : { std::make_pair(stSource_.pucMessageHeader, stSource_.uiMessageHeaderLength),
+                                            std::make_pair(stSource_.pucMessageBody, stSource_.uiMessageBodyLength),
+                                            std::make_pair(stSource_.pucMessage, stSource_.uiMessageLength) })
+   {
+      if (pucData != nullptr)
+      {
+         pucBegin = pucBegin == nullptr ? pucData : std::min<const unsigned char*>(pucBegin, pucData);
+         pucEnd = pucEnd == nullptr ? pucData + uiLength : std::max<const unsigned char*>(pucEnd, pucData + uiLength);
+      }
+   }
+
+   vData_.assign(pucBegin, pucEnd);
+   auto Rebase = [&](unsigned char* pucData_) { return pucData_ != nullptr ? vData_.data() + (pucData_ - pucBegin) : nullptr; };
+   stTarget_ = stSource_;
+   stTarget_.pucMessageHeader = Rebase(stSource_.pucMessageHeader);
+   stTarget_.pucMessageBody = Rebase(stSource_.pucMessageBody);
+   stTarget_.pucMessage = Rebase(stSource_.pucMessage);
+}
+} // namespace
+
+// -------------------------------------------------------------------------------------------------------
+FileMerger::FileMerger(double dWindowMilliseconds_, uint32_t uiLookAhead_) :
+   dMyWindowMilliseconds(std::max(dWindowMilliseconds_, 0.0)),
+   uiMyLookAhead(std::max(uiLookAhead_, 1U))
+{
+   pclMyLogger = Logger().RegisterLogger("novatel_file_merger");
+}
+
+// -------------------------------------------------------------------------------------------------------
+FileMerger::~FileMerger()
+{
+   bMyStop = true;
+   for (auto& pclSource : vpclMySources)
+   {
+      {
+         std::lock_guard<std::mutex> clLock(pclSource->clMutex);
+      }
+      pclSource->clCondition.notify_all();
+   }
+
+   for (auto& pclSource : vpclMySources)
+   {
+      if (pclSource->clThread.joinable())
+      {
+         pclSource->clThread.join();
+      }
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+std::shared_ptr<spdlog::logger>
+FileMerger::GetLogger()
+{
+   return pclMyLogger;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+FileMerger::SetLoggerLevel(spdlog::level::level_enum eLevel_)
+{
+   pclMyLogger->set_level(eLevel_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+FileMerger::AddSource(FileParser* pclFileParser_)
+{
+   if (pclFileParser_ == nullptr || bMyStarted)
+   {
+      return false;
+   }
+
+   auto pclSource = std::make_unique<Source>();
+   pclSource->pclFileParser = pclFileParser_;
+   pclSource->pstEntries = std::make_unique<Entry[]>(uiMyLookAhead);
+   pclSource->vFree.reserve(uiMyLookAhead);
+   for (uint32_t i = 0; i < uiMyLookAhead; i++)
+   {
+      pclSource->vFree.push_back(uiMyLookAhead - 1 - i);
+   }
+   vpclMySources.emplace_back(std::move(pclSource));
+   return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+FileMerger::GetSourceCount() const
+{
+   return static_cast<uint32_t>(vpclMySources.size());
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+FileMerger::IsLater(const HeapItem& stLhs_, const HeapItem& stRhs_)
+{
+   // The heap is ordered so that the earliest log is at the front.
+   if (stLhs_.dTime != stRhs_.dTime)
+   {
+      return stLhs_.dTime > stRhs_.dTime;
+   }
+   if (stLhs_.uiSource != stRhs_.uiSource)
+   {
+      return stLhs_.uiSource > stRhs_.uiSource;
+   }
+   return stLhs_.ullSequence > stRhs_.ullSequence;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+FileMerger::Start()
+{
+   bMyStarted = true;
+   vMyHeap.reserve(static_cast<size_t>(uiMyLookAhead) * vpclMySources.size());
+   for (auto& pclSource : vpclMySources)
+   {
+      pclSource->clThread = std::thread(&FileMerger::RunSource, this, std::ref(*pclSource));
+   }
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "FileMerger started with {} sources", vpclMySources.size());
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+FileMerger::RunSource(Source& clSource_)
+{
+   MessageDataStruct stMessageData;
+   MetaDataStruct stMetaData;
+   uint64_t ullSequence = 0;
+   double dTime = 0.0;
+
+   while (!bMyStop)
+   {
+      const STATUS eStatus = clSource_.pclFileParser->Read(stMessageData, stMetaData);
+      if (eStatus == STATUS::STREAM_EMPTY)
+      {
+         break;
+      }
+      // Other errors carry no log, and have been logged by the FileParser.
+      if (eStatus != STATUS::SUCCESS && eStatus != STATUS::UNKNOWN)
+      {
+         continue;
+      }
+
+      uint32_t uiEntry = 0;
+      {
+         std::unique_lock<std::mutex> clLock(clSource_.clMutex);
+         clSource_.clCondition.wait(clLock, [this, &clSource_] { return bMyStop || !clSource_.vFree.empty(); });
+         if (bMyStop)
+         {
+            return;
+         }
+         uiEntry = clSource_.vFree.back();
+         clSource_.vFree.pop_back();
+      }
+
+      if (eStatus == STATUS::SUCCESS && stMetaData.usWeek != 0)
+      {
+         dTime = stMetaData.usWeek * dMILLISECONDS_PER_WEEK + stMetaData.dMilliseconds;
+      }
+
+      Entry& stEntry = clSource_.pstEntries[uiEntry];
+      stEntry.eStatus = eStatus;
+      stEntry.stMetaData = stMetaData;
+      CopyMessageData(stMessageData, stEntry.vData, stEntry.stMessageData);
+      stEntry.dTime = dTime;
+      stEntry.ullSequence = ullSequence++;
+
+      {
+         std::lock_guard<std::mutex> clLock(clSource_.clMutex);
+         clSource_.dqReady.push_back(uiEntry);
+      }
+      clSource_.clCondition.notify_all();
+   }
+
+   {
+      std::lock_guard<std::mutex> clLock(clSource_.clMutex);
+      clSource_.bFinished = true;
+   }
+   clSource_.clCondition.notify_all();
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+FileMerger::IsBlocking(const Source& clSource_) const
+{
+   // A source holds back the earliest log until it has read past its time by
+   // more than the window, unless it has nothing left to read or no room to
+   // read more.
+   if (clSource_.bDrained || clSource_.uiInHeap == uiMyLookAhead)
+   {
+      return false;
+   }
+   return vMyHeap.empty() || !clSource_.bHasLatestTime || clSource_.dLatestTime <= vMyHeap.front().dTime + dMyWindowMilliseconds;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+FileMerger::Pull(uint32_t uiSource_)
+{
+   Source& clSource = *vpclMySources[uiSource_];
+   std::unique_lock<std::mutex> clLock(clSource.clMutex);
+   clSource.clCondition.wait(clLock, [&clSource] { return clSource.bFinished || !clSource.dqReady.empty(); });
+
+   if (clSource.dqReady.empty())
+   {
+      clSource.bDrained = true;
+      return;
+   }
+
+   // Take a single log, so which logs are in the heap depends only on what
+   // has been returned and not on how far the source's thread has read.
+   const uint32_t uiEntry = clSource.dqReady.front();
+   clSource.dqReady.pop_front();
+   clLock.unlock();
+
+   const Entry& stEntry = clSource.pstEntries[uiEntry];
+   vMyHeap.push_back({ stEntry.dTime, uiSource_, stEntry.ullSequence, uiEntry });
+   std::push_heap(vMyHeap.begin(), vMyHeap.end(), IsLater);
+   clSource.dLatestTime = clSource.bHasLatestTime ? std::max(clSource.dLatestTime, stEntry.dTime) : stEntry.dTime;
+   clSource.bHasLatestTime = true;
+   clSource.uiInHeap++;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+FileMerger::ReleaseEntry()
+{
+   if (!bMyHoldingEntry)
+   {
+      return;
+   }
+
+   Source& clSource = *vpclMySources[stMyHeldItem.uiSource];
+   {
+      std::lock_guard<std::mutex> clLock(clSource.clMutex);
+      clSource.vFree.push_back(stMyHeldItem.uiEntry);
+   }
+   clSource.clCondition.notify_all();
+   bMyHoldingEntry = false;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+FileMerger::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, uint32_t& uiSource_)
+{
+   ReleaseEntry();
+   if (!bMyStarted)
+   {
+      Start();
+   }
+
+   // Read from whichever source is holding back the earliest log until none are.
+   bool bPulled = true;
+   while (bPulled)
+   {
+      bPulled = false;
+      for (uint32_t i = 0; i < vpclMySources.size(); i++)
+      {
+         if (IsBlocking(*vpclMySources[i]))
+         {
+            Pull(i);
+            bPulled = true;
+            break;
+         }
+      }
+   }
+
+   if (vMyHeap.empty())
+   {
+      return STATUS::STREAM_EMPTY;
+   }
+
+   std::pop_heap(vMyHeap.begin(), vMyHeap.end(), IsLater);
+   stMyHeldItem = vMyHeap.back();
+   vMyHeap.pop_back();
+   bMyHoldingEntry = true;
+
+   Source& clSource = *vpclMySources[stMyHeldItem.uiSource];
+   clSource.uiInHeap--;
+   if (stMyHeldItem.dTime < dMyLastTime)
+   {
+      SPDLOG_LOGGER_DEBUG(pclMyLogger, "Source {} returned a log {} ms out of order", stMyHeldItem.uiSource, dMyLastTime - stMyHeldItem.dTime);
+   }
+   dMyLastTime = std::max(dMyLastTime, stMyHeldItem.dTime);
+
+   const Entry& stEntry = clSource.pstEntries[stMyHeldItem.uiEntry];
+   stMessageData_ = stEntry.stMessageData;
+   stMetaData_ = stEntry.stMetaData;
+   uiSource_ = stMyHeldItem.uiSource;
+   return stEntry.eStatus;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+FileMerger::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_)
+{
+   uint32_t uiSource = 0;
+   return Read(stMessageData_, stMetaData_, uiSource);
+}
@@ -32,6 +32,8 @@
 //-----------------------------------------------------------------------
 #include "decoders/novatel/api/fileparser.hpp"
 
+#include <limits>
+
 using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
@@ -45,7 +47,7 @@ FileParser::FileParser(const std::string sDbPath_) :
    stMyReadData.cData = reinterpret_cast<char*>(pcMyStreamReadBuffer);
    stMyReadData.uiDataSize = Parser::uiPARSER_INTERNAL_BUFFER_SIZE;
    pclMyInputStream = nullptr;
-   pclMyLogger->debug("FileParser initialized");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "FileParser initialized");
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -58,7 +60,7 @@ FileParser::FileParser(const std::u32string sDbPath_) :
    stMyReadData.cData = reinterpret_cast<char*>(pcMyStreamReadBuffer);
    stMyReadData.uiDataSize = Parser::uiPARSER_INTERNAL_BUFFER_SIZE;
    pclMyInputStream = nullptr;
-   pclMyLogger->debug("FileParser initialized");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "FileParser initialized");
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -71,7 +73,7 @@ FileParser::FileParser(JsonReader* pclJsonDb_):
    stMyReadData.cData = reinterpret_cast<char*>(pcMyStreamReadBuffer);
    stMyReadData.uiDataSize = Parser::uiPARSER_INTERNAL_BUFFER_SIZE;
    pclMyInputStream = nullptr;
-   pclMyLogger->debug("FileParser initialized");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "FileParser initialized");
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -93,7 +95,7 @@ FileParser::LoadJsonDb(JsonReader* pclJsonDb_)
    }
    else
    {
-      pclMyLogger->debug("JSON DB is a NULL pointer.");
+      SPDLOG_LOGGER_DEBUG(pclMyLogger, "JSON DB is a NULL pointer.");
    }
 }
 
@@ -181,6 +183,20 @@ FileParser::GetEncodeFormat()
    return clMyParser.GetEncodeFormat();
 }
 
+// -------------------------------------------------------------------------------------------------------
+void
+FileParser::SetEncodeFormats(const std::vector<ENCODEFORMAT>& vFormats_)
+{
+   clMyParser.SetEncodeFormats(vFormats_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+const std::vector<ENCODEFORMAT>&
+FileParser::GetEncodeFormats() const
+{
+   return clMyParser.GetEncodeFormats();
+}
+
 // -------------------------------------------------------------------------------------------------------
 Filter* FileParser::GetFilter()
 {
@@ -193,6 +209,48 @@ void FileParser::SetFilter(Filter* pclFilter_)
    return clMyParser.SetFilter(pclFilter_);
 }
 
+// -------------------------------------------------------------------------------------------------------
+Deduplicator* FileParser::GetDeduplicator()
+{
+   return clMyParser.GetDeduplicator();
+}
+
+// -------------------------------------------------------------------------------------------------------
+void FileParser::SetDeduplicator(Deduplicator* pclDeduplicator_)
+{
+   clMyParser.SetDeduplicator(pclDeduplicator_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+EncodeSink* FileParser::GetEncodeSink()
+{
+   return clMyParser.GetEncodeSink();
+}
+
+// -------------------------------------------------------------------------------------------------------
+void FileParser::SetEncodeSink(EncodeSink* pclEncodeSink_)
+{
+   clMyParser.SetEncodeSink(pclEncodeSink_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+void FileParser::EnableStatistics(bool bEnable_)
+{
+   clMyParser.EnableStatistics(bEnable_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+ParserStatistics FileParser::GetStatistics() const
+{
+   return clMyParser.GetStatistics();
+}
+
+// -------------------------------------------------------------------------------------------------------
+void FileParser::ResetStatistics()
+{
+   clMyParser.ResetStatistics();
+}
+
 // -------------------------------------------------------------------------------------------------------
 uint32_t
 FileParser::GetPercentRead()
@@ -232,29 +290,161 @@ FileParser::SetStream(InputFileStream* pclInputStream_)
    stMyReadData.uiDataSize = uiReadSizeSave;
 
    pclMyInputStream = pclInputStream_;
+   vMyReadRanges.clear();
 
    Reset();
 
    return true;
 }
 
+// -------------------------------------------------------------------------------------------------------
+bool FileParser::SetReadRanges(const std::vector<FileIndexRange>& vRanges_)
+{
+   if (pclMyInputStream == nullptr)
+   {
+      return false;
+   }
+
+   vMyReadRanges = vRanges_;
+   return Reset();
+}
+
+// -------------------------------------------------------------------------------------------------------
+void FileParser::SeekToReadRange()
+{
+   // Each range starts on a frame, so whatever is left of the last one is of no use.
+   Flush();
+   ullMyStreamPosition = ullMyReadRange < vMyReadRanges.size() ? vMyReadRanges[ullMyReadRange].ullBegin : 0;
+   pclMyInputStream->Reset(static_cast<std::streamoff>(ullMyStreamPosition), std::ios::beg);
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool FileParser::FindTimedFrame(uint64_t ullPosition_, uint64_t ullTarget_, unsigned char* pucFrameBuffer_, uint64_t& ullFrameOffset_, uint64_t& ullFrameTime_)
+{
+   MetaDataStruct stMetaData;
+   IntermediateHeader stHeader;
+
+   // Drop whatever the last probe left behind.
+   clMySeekFramer.Flush(nullptr, std::numeric_limits<uint32_t>::max());
+   pclMyInputStream->Reset(static_cast<std::streamoff>(ullPosition_), std::ios::beg);
+   uint64_t ullBytesWritten = ullPosition_;
+
+   while (true)
+   {
+      stMyReadData.uiDataSize = MAX_ASCII_MESSAGE_LENGTH;
+      const StreamReadStatus stReadStatus = pclMyInputStream->ReadData(stMyReadData);
+      if (stReadStatus.uiCurrentStreamRead == 0)
+      {
+         return false;
+      }
+      clMySeekFramer.Write(reinterpret_cast<unsigned char*>(stMyReadData.cData), stReadStatus.uiCurrentStreamRead);
+      ullBytesWritten += stReadStatus.uiCurrentStreamRead;
+
+      STATUS eStatus = STATUS::UNKNOWN;
+      while ((eStatus = clMySeekFramer.GetFrame(pucFrameBuffer_, Parser::uiPARSER_INTERNAL_BUFFER_SIZE, stMetaData)) != STATUS::INCOMPLETE && eStatus != STATUS::BUFFER_EMPTY)
+      {
+         if (eStatus != STATUS::SUCCESS || clMySeekHeaderDecoder.Decode(pucFrameBuffer_, stHeader, stMetaData) != STATUS::SUCCESS || stMetaData.usWeek == 0)
+         {
+            continue;
+         }
+
+         const uint64_t ullTime = static_cast<uint64_t>(stMetaData.usWeek) * SECS_IN_WEEK * 1000ULL + static_cast<uint64_t>(stMetaData.dMilliseconds);
+         if (ullTime >= ullTarget_)
+         {
+            // The frame ends where the bytes still held by the framer begin.
+            ullFrameOffset_ = ullBytesWritten - clMySeekFramer.GetBufferedByteCount() - stMetaData.uiLength;
+            ullFrameTime_ = ullTime;
+            return true;
+         }
+      }
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool FileParser::SeekToTime(uint32_t uiWeek_, double dSec_)
+{
+   if (pclMyInputStream == nullptr)
+   {
+      return false;
+   }
+
+   clMySeekHeaderDecoder.LoadJsonDb(clMyParser.GetJsonDb());
+   std::unique_ptr<unsigned char[]> pucFrameBuffer(new unsigned char[Parser::uiPARSER_INTERNAL_BUFFER_SIZE]);
+   const uint64_t ullTarget = static_cast<uint64_t>(uiWeek_) * SECS_IN_WEEK * 1000ULL + static_cast<uint64_t>(dSec_ * 1000.0);
+
+   // The first log at or after the target starts in [ullLow, ullHigh]. Every probe
+   // of a stream that can't seek directly would decompress from the start, so
+   // scan it once instead.
+   uint64_t ullLow = 0;
+   uint64_t ullHigh = pclMyInputStream->IsRandomAccess() ? pclMyInputStream->pInFileStream->GetFileLength() : 0;
+   uint64_t ullFrameOffset = 0;
+   uint64_t ullFrameTime = 0;
+   uint32_t uiProbes = 0;
+   while (ullHigh - ullLow > uiSEEK_SCAN_BYTES)
+   {
+      const uint64_t ullMiddle = ullLow + (ullHigh - ullLow) / 2;
+      if (FindTimedFrame(ullMiddle, 0, pucFrameBuffer.get(), ullFrameOffset, ullFrameTime) && ullFrameTime < ullTarget)
+      {
+         ullLow = std::min(ullFrameOffset + 1, ullHigh);
+      }
+      else
+      {
+         ullHigh = ullMiddle;
+      }
+      uiProbes++;
+   }
+
+   if (!FindTimedFrame(ullLow, ullTarget, pucFrameBuffer.get(), ullFrameOffset, ullFrameTime))
+   {
+      pclMyInputStream->Reset(static_cast<std::streamoff>(ullMyStreamPosition), std::ios::beg);
+      return false;
+   }
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "Seeked to offset {} after {} probes", ullFrameOffset, uiProbes);
+
+   vMyReadRanges.clear();
+   Flush();
+   ullMyStreamPosition = ullFrameOffset;
+   pclMyInputStream->Reset(static_cast<std::streamoff>(ullMyStreamPosition), std::ios::beg);
+   return true;
+}
+
 // -------------------------------------------------------------------------------------------------------
 bool FileParser::ReadStream()
 {
    stMyReadData.uiDataSize = MAX_ASCII_MESSAGE_LENGTH;
+
+   if (!vMyReadRanges.empty())
+   {
+      while (ullMyReadRange < vMyReadRanges.size() && ullMyStreamPosition >= vMyReadRanges[ullMyReadRange].ullEnd)
+      {
+         ullMyReadRange++;
+         if (ullMyReadRange < vMyReadRanges.size())
+         {
+            SeekToReadRange();
+         }
+      }
+      if (ullMyReadRange >= vMyReadRanges.size())
+      {
+         return false;
+      }
+      stMyReadData.uiDataSize = static_cast<uint32_t>(std::min<uint64_t>(stMyReadData.uiDataSize, vMyReadRanges[ullMyReadRange].ullEnd - ullMyStreamPosition));
+   }
+
    stMyStreamReadStatus = pclMyInputStream->ReadData(stMyReadData);
+   ullMyStreamPosition += stMyStreamReadStatus.uiCurrentStreamRead;
    return stMyStreamReadStatus.uiCurrentStreamRead > 0
       && clMyParser.Write(reinterpret_cast<unsigned char*>(stMyReadData.cData), stMyStreamReadStatus.uiCurrentStreamRead) == stMyStreamReadStatus.uiCurrentStreamRead;
 }
 
 // -------------------------------------------------------------------------------------------------------
-[[nodiscard]] STATUS
-FileParser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_)
+template <typename MessageData>
+STATUS
+FileParser::ReadMessage(MessageData& tMessageData_, MetaDataStruct& stMetaData_)
 {
    STATUS eStatus = STATUS::UNKNOWN;
    while (true)
    {
-      eStatus = clMyParser.Read(stMessageData_, stMetaData_);
+      eStatus = clMyParser.Read(tMessageData_, stMetaData_);
 
       if (eStatus == STATUS::SUCCESS || eStatus == STATUS::UNKNOWN)
       {
@@ -264,12 +454,16 @@ FileParser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_)
       {
          if (!ReadStream())
          {
-            return clMyParser.Read(stMessageData_, stMetaData_, true) == STATUS::SUCCESS ? STATUS::SUCCESS : STATUS::STREAM_EMPTY;
+            return clMyParser.Read(tMessageData_, stMetaData_, true) == STATUS::SUCCESS ? STATUS::SUCCESS : STATUS::STREAM_EMPTY;
          }
       }
       else
       {
-         pclMyLogger->info("Encountered an error: {}\n", static_cast<int32_t>(eStatus));
+         uint64_t ullSuppressed = 0;
+         if (pclMyLogger->should_log(spdlog::level::info) && clMyLogRateLimiter.ShouldLog(0, static_cast<uint32_t>(eStatus), stMetaData_.usMessageID, ullSuppressed))
+         {
+            pclMyLogger->info("Encountered an error: {}{}", static_cast<int32_t>(eStatus), LogRateLimiter::Suppressed(ullSuppressed));
+         }
          break;
       }
    }
@@ -277,13 +471,28 @@ FileParser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_)
    return eStatus;
 }
 
+// -------------------------------------------------------------------------------------------------------
+[[nodiscard]] STATUS
+FileParser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_)
+{
+   return ReadMessage(stMessageData_, stMetaData_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+[[nodiscard]] STATUS
+FileParser::Read(std::vector<MessageDataStruct>& vMessageData_, MetaDataStruct& stMetaData_)
+{
+   return ReadMessage(vMessageData_, stMetaData_);
+}
+
 // -------------------------------------------------------------------------------------------------------
 bool FileParser::Reset()
 {
    Flush();
    if (pclMyInputStream != nullptr)
    {
-      pclMyInputStream->Reset(0, std::ios::beg);
+      ullMyReadRange = 0;
+      SeekToReadRange();
    }
    return true;
 }
@@ -33,9 +33,84 @@
 //-----------------------------------------------------------------------
 #include "decoders/novatel/api/filter.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
+namespace {
+
+//! Allowance for the millisecond resolution of message times when comparing
+//! them with a decimation period.
+constexpr double dDECIMATION_TOLERANCE_MS = 0.5;
+
+// -------------------------------------------------------------------------------------------------------
+template <typename T>
+double ReadFieldValue(const unsigned char* pucField_)
+{
+   T tValue;
+   memcpy(&tValue, pucField_, sizeof(T));
+   return static_cast<double>(tValue);
+}
+
+// -------------------------------------------------------------------------------------------------------
+//! The size a field's data type must have to be read by a field value filter.
+uint16_t FieldValueSize(DATA_TYPE_NAME eDataType_)
+{
+   switch (eDataType_)
+   {
+   case DATA_TYPE_NAME::HEXBYTE:
+   case DATA_TYPE_NAME::CHAR:
+   case DATA_TYPE_NAME::UCHAR:
+      return 1;
+   case DATA_TYPE_NAME::SHORT:
+   case DATA_TYPE_NAME::USHORT:
+      return 2;
+   case DATA_TYPE_NAME::INT:
+   case DATA_TYPE_NAME::UINT:
+   case DATA_TYPE_NAME::LONG:
+   case DATA_TYPE_NAME::ULONG:
+   case DATA_TYPE_NAME::FLOAT:
+      return 4;
+   case DATA_TYPE_NAME::LONGLONG:
+   case DATA_TYPE_NAME::ULONGLONG:
+   case DATA_TYPE_NAME::DOUBLE:
+      return 8;
+   default:
+      return 0;
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t AlignFieldOffset(uint32_t uiAddress_, uint32_t uiOffset_, uint16_t usDataTypeLength_)
+{
+   const uint32_t uiAlignment = usDataTypeLength_ >= 4 ? 4 : (usDataTypeLength_ == 0 ? 1 : usDataTypeLength_);
+   const uint32_t uiMisalignment = (uiAddress_ + uiOffset_) % uiAlignment;
+   return uiMisalignment == 0 ? uiOffset_ : uiOffset_ + uiAlignment - uiMisalignment;
+}
+
+// -------------------------------------------------------------------------------------------------------
+//! The number of bytes a field with a fixed size takes, or 0 if its size
+//! depends on the data.
+uint32_t FixedFieldSize(const BaseField* pclField_)
+{
+   switch (pclField_->type)
+   {
+   case FIELD_TYPE::SIMPLE:
+      return pclField_->dataType.length;
+   case FIELD_TYPE::ENUM:
+      return sizeof(int32_t);
+   case FIELD_TYPE::FIXED_LENGTH_ARRAY:
+      return static_cast<const ArrayField*>(pclField_)->arrayLength * pclField_->dataType.length;
+   default:
+      return 0;
+   }
+}
+
+}
+
 // -------------------------------------------------------------------------------------------------------
 Filter::Filter()
 {
@@ -43,7 +118,7 @@ Filter::Filter()
 
    ClearFilters();
 
-   pclMyLogger->debug("Filter initialized");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "Filter initialized");
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -112,6 +187,26 @@ Filter::SetIncludeDecimation(double dPeriodSec_)
    PushUnique(&Filter::FilterDecimation);
 }
 
+// -------------------------------------------------------------------------------------------------------
+void
+Filter::SetIncludeDecimation(uint32_t uiMessageId_, double dPeriodSec_)
+{
+   if (uiMessageId_ > std::numeric_limits<uint16_t>::max())
+   {
+      SPDLOG_LOGGER_WARN(pclMyLogger, "Message ID {} is out of range and cannot be decimated", uiMessageId_);
+      return;
+   }
+
+   if (uiMessageId_ >= vMyMessageDecimation.size())
+   {
+      vMyMessageDecimation.resize(uiMessageId_ + 1);
+   }
+
+   MessageDecimation& stDecimation = vMyMessageDecimation[uiMessageId_];
+   stDecimation.dPeriodMilliseconds = dPeriodSec_ > 0.0 ? dPeriodSec_ * SEC_TO_MSEC : 0.0;
+   stDecimation.adLastKeptMilliseconds.fill(-1.0);
+}
+
 // -------------------------------------------------------------------------------------------------------
 void
 Filter::InvertDecimationFilter(bool bInvert_)
@@ -220,8 +315,11 @@ Filter::ClearFilters()
    bMyDecimate = false;
    bMyInvertDecimation = false;
 
+   vMyMessageDecimation.clear();
+
    bMyIncludeNMEA_ = false;
    vMyFilterFunctions.clear();
+   umMyFieldValueFilters.clear();
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -310,7 +408,36 @@ Filter::FilterDecimation(const MetaDataStruct& stMetaData_)
 
 // -------------------------------------------------------------------------------------------------------
 bool
-Filter::DoFiltering(MetaDataStruct& stMetaData_)
+Filter::FilterMessageDecimation(const MetaDataStruct& stMetaData_)
+{
+   if (stMetaData_.usMessageID >= vMyMessageDecimation.size() || stMetaData_.eMeasurementSource >= MEASUREMENT_SOURCE::MAX)
+   {
+      return true;
+   }
+
+   MessageDecimation& stDecimation = vMyMessageDecimation[stMetaData_.usMessageID];
+   if (stDecimation.dPeriodMilliseconds <= 0.0)
+   {
+      return true;
+   }
+
+   double& dLastKept = stDecimation.adLastKeptMilliseconds[static_cast<size_t>(stMetaData_.eMeasurementSource)];
+   const double dMilliseconds = static_cast<double>(stMetaData_.usWeek) * SECS_IN_WEEK * SEC_TO_MSEC + stMetaData_.dMilliseconds;
+
+   // A message from before the last kept one means the time was reset, such
+   // as by reading a new file, so decimation starts again.
+   if (dLastKept >= 0.0 && dMilliseconds >= dLastKept && dMilliseconds - dLastKept + dDECIMATION_TOLERANCE_MS < stDecimation.dPeriodMilliseconds)
+   {
+      return false;
+   }
+
+   dLastKept = dMilliseconds;
+   return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+Filter::FilterMetaData(const MetaDataStruct& stMetaData_)
 {
    if (stMetaData_.eFormat == HEADERFORMAT::UNKNOWN)
    {
@@ -331,3 +458,268 @@ Filter::DoFiltering(MetaDataStruct& stMetaData_)
 
    return true;
 }
+
+// -------------------------------------------------------------------------------------------------------
+bool
+Filter::DoFiltering(MetaDataStruct& stMetaData_)
+{
+   return FilterMetaData(stMetaData_) && FilterMessageDecimation(stMetaData_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+Filter::DoFiltering(MetaDataStruct& stMetaData_, const unsigned char* pucMessageBody_)
+{
+   return FilterMetaData(stMetaData_) && FilterFieldValues(stMetaData_, pucMessageBody_) && FilterMessageDecimation(stMetaData_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+Filter::LoadJsonDb(JsonReader* pclJsonDb_)
+{
+   pclMyMsgDb = pclJsonDb_;
+   umMyFieldValueFilters.clear();
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Filter::IncludeFieldValue(const std::string& strMsgName_, const std::string& strFieldPath_, FIELD_COMPARISON eComparison_, double dValue_)
+{
+   return AddFieldValueFilter(strMsgName_, strFieldPath_, eComparison_, dValue_, nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Filter::IncludeFieldValue(const std::string& strMsgName_, const std::string& strFieldPath_, FIELD_COMPARISON eComparison_, const std::string& strEnumerator_)
+{
+   return AddFieldValueFilter(strMsgName_, strFieldPath_, eComparison_, 0.0, &strEnumerator_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Filter::AddFieldValueFilter(const std::string& strMsgName_, const std::string& strFieldPath_, FIELD_COMPARISON eComparison_, double dValue_, const std::string* pstrEnumerator_)
+{
+   if (!pclMyMsgDb)
+   {
+      return STATUS::NO_DATABASE;
+   }
+
+   const MessageDefinition* pclMsgDef = pclMyMsgDb->GetMsgDef(strMsgName_);
+   if (!pclMsgDef || pclMsgDef->fields.empty())
+   {
+      return STATUS::NO_DEFINITION;
+   }
+
+   // Resolve the field in every version of the message before adding any of them.
+   std::vector<std::pair<uint32_t, FieldValueFilter>> vVersions;
+   for (const auto& itVersion : pclMsgDef->fields)
+   {
+      FieldValueFilter stFilter;
+      const BaseField* pclField = nullptr;
+      const STATUS eStatus = ResolveFieldValueFilter(itVersion.second, strFieldPath_, stFilter, pclField);
+      if (eStatus != STATUS::SUCCESS)
+      {
+         SPDLOG_LOGGER_WARN(pclMyLogger, "Cannot filter on {}.{} (CRC {})", strMsgName_, strFieldPath_, itVersion.first);
+         return eStatus;
+      }
+
+      stFilter.eComparison = eComparison_;
+      stFilter.dValue = dValue_;
+      if (pstrEnumerator_)
+      {
+         const EnumDefinition* pclEnumDef = pclField->type == FIELD_TYPE::ENUM ? static_cast<const EnumField*>(pclField)->enumDef : nullptr;
+         if (!pclEnumDef)
+         {
+            return STATUS::NO_DEFINITION;
+         }
+         const auto itEnumerator = std::find_if(pclEnumDef->enumerators.begin(), pclEnumDef->enumerators.end(),
+                                                [pstrEnumerator_](const EnumDataType& stEnumerator_) { return stEnumerator_.name == *pstrEnumerator_; });
+         if (itEnumerator == pclEnumDef->enumerators.end())
+         {
+            return STATUS::NO_DEFINITION;
+         }
+         stFilter.dValue = static_cast<double>(static_cast<int32_t>(itEnumerator->value));
+      }
+      vVersions.emplace_back(itVersion.first, stFilter);
+   }
+
+   MessageValueFilters& stMessageFilters = umMyFieldValueFilters[pclMsgDef->logID];
+   stMessageFilters.uiLatestCrc = pclMsgDef->latestMessageCrc;
+   for (const auto& itVersion : vVersions)
+   {
+      stMessageFilters.umVersions[itVersion.first].push_back(itVersion.second);
+   }
+   return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Filter::ResolveFieldValueFilter(const std::vector<BaseField*>& vMsgDefFields_, const std::string& strFieldPath_, FieldValueFilter& stFilter_, const BaseField*& pclField_)
+{
+   const size_t ullDot = strFieldPath_.find('.');
+   const std::string strName = strFieldPath_.substr(0, ullDot);
+
+   // The offsets are fixed until the first field whose size depends on the data.
+   for (const BaseField* pclField : vMsgDefFields_)
+   {
+      for (uint32_t uiAddress = 0; uiAddress < stFilter_.auiOffsets.size(); uiAddress++)
+      {
+         stFilter_.auiOffsets[uiAddress] = AlignFieldOffset(uiAddress, stFilter_.auiOffsets[uiAddress], pclField->dataType.length);
+      }
+
+      if (pclField->name == strName)
+      {
+         if (ullDot == std::string::npos)
+         {
+            pclField_ = pclField;
+         }
+         else if (pclField->type == FIELD_TYPE::FIELD_ARRAY)
+         {
+            // The elements must all be the same size, and start 4-byte aligned,
+            // for the field to be at a fixed offset in each of them.
+            const std::string strSubName = strFieldPath_.substr(ullDot + 1);
+            for (const BaseField* pclSubField : static_cast<const FieldArrayField*>(pclField)->fields)
+            {
+               const uint32_t uiSize = FixedFieldSize(pclSubField);
+               if (uiSize == 0)
+               {
+                  return STATUS::UNSUPPORTED;
+               }
+               stFilter_.uiElementSize = AlignFieldOffset(0, stFilter_.uiElementSize, pclSubField->dataType.length);
+               if (pclSubField->name == strSubName)
+               {
+                  pclField_ = pclSubField;
+                  stFilter_.uiElementOffset = stFilter_.uiElementSize;
+               }
+               stFilter_.uiElementSize += uiSize;
+            }
+            if (stFilter_.uiElementSize == 0 || stFilter_.uiElementSize % 4 != 0)
+            {
+               return pclField_ ? STATUS::UNSUPPORTED : STATUS::NO_DEFINITION;
+            }
+         }
+         if (!pclField_)
+         {
+            return STATUS::NO_DEFINITION;
+         }
+
+         stFilter_.eDataType = pclField_->type == FIELD_TYPE::ENUM ? DATA_TYPE_NAME::INT : pclField_->dataType.name;
+         stFilter_.usLength = pclField_->type == FIELD_TYPE::ENUM ? sizeof(int32_t) : pclField_->dataType.length;
+         const bool bNumber = pclField_->type == FIELD_TYPE::ENUM
+                           || (pclField_->type == FIELD_TYPE::SIMPLE
+                            && (stFilter_.eDataType == DATA_TYPE_NAME::BOOL ? stFilter_.usLength > 0 : FieldValueSize(stFilter_.eDataType) == stFilter_.usLength));
+         return bNumber ? STATUS::SUCCESS : STATUS::UNSUPPORTED;
+      }
+
+      const uint32_t uiSize = FixedFieldSize(pclField);
+      if (uiSize == 0)
+      {
+         return STATUS::UNSUPPORTED;
+      }
+      for (uint32_t& uiOffset : stFilter_.auiOffsets)
+      {
+         uiOffset += uiSize;
+      }
+   }
+   return STATUS::NO_DEFINITION;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+Filter::FilterFieldValues(const MetaDataStruct& stMetaData_, const unsigned char* pucMessageBody_) const
+{
+   if (umMyFieldValueFilters.empty() || !pucMessageBody_ || stMetaData_.bResponse
+    || (stMetaData_.eFormat != HEADERFORMAT::BINARY && stMetaData_.eFormat != HEADERFORMAT::SHORT_BINARY))
+   {
+      return true;
+   }
+
+   const auto itMessageFilters = umMyFieldValueFilters.find(stMetaData_.usMessageID);
+   if (itMessageFilters == umMyFieldValueFilters.end())
+   {
+      return true;
+   }
+
+   // Like the MessageDecoder, use the latest version of a message whose CRC is unknown.
+   auto itVersion = itMessageFilters->second.umVersions.find(stMetaData_.uiMessageCRC);
+   if (itVersion == itMessageFilters->second.umVersions.end())
+   {
+      itVersion = itMessageFilters->second.umVersions.find(itMessageFilters->second.uiLatestCrc);
+      if (itVersion == itMessageFilters->second.umVersions.end())
+      {
+         return true;
+      }
+   }
+
+   const auto CompareField = [](const FieldValueFilter& stFilter_, const unsigned char* pucField_) {
+      double dField = 0.0;
+      switch (stFilter_.eDataType)
+      {
+      case DATA_TYPE_NAME::BOOL:      dField = pucField_[0] != 0 ? 1.0 : 0.0; break;
+      case DATA_TYPE_NAME::CHAR:      dField = ReadFieldValue<int8_t>(pucField_); break;
+      case DATA_TYPE_NAME::HEXBYTE:
+      case DATA_TYPE_NAME::UCHAR:     dField = ReadFieldValue<uint8_t>(pucField_); break;
+      case DATA_TYPE_NAME::SHORT:     dField = ReadFieldValue<int16_t>(pucField_); break;
+      case DATA_TYPE_NAME::USHORT:    dField = ReadFieldValue<uint16_t>(pucField_); break;
+      case DATA_TYPE_NAME::INT:
+      case DATA_TYPE_NAME::LONG:      dField = ReadFieldValue<int32_t>(pucField_); break;
+      case DATA_TYPE_NAME::UINT:
+      case DATA_TYPE_NAME::ULONG:     dField = ReadFieldValue<uint32_t>(pucField_); break;
+      case DATA_TYPE_NAME::LONGLONG:  dField = ReadFieldValue<int64_t>(pucField_); break;
+      case DATA_TYPE_NAME::ULONGLONG: dField = ReadFieldValue<uint64_t>(pucField_); break;
+      case DATA_TYPE_NAME::FLOAT:     dField = ReadFieldValue<float>(pucField_); break;
+      case DATA_TYPE_NAME::DOUBLE:    dField = ReadFieldValue<double>(pucField_); break;
+      default: return false;
+      }
+
+      switch (stFilter_.eComparison)
+      {
+      case FIELD_COMPARISON::EQUAL:            return dField == stFilter_.dValue;
+      case FIELD_COMPARISON::NOT_EQUAL:        return dField != stFilter_.dValue;
+      case FIELD_COMPARISON::LESS:             return dField < stFilter_.dValue;
+      case FIELD_COMPARISON::LESS_OR_EQUAL:    return dField <= stFilter_.dValue;
+      case FIELD_COMPARISON::GREATER:          return dField > stFilter_.dValue;
+      case FIELD_COMPARISON::GREATER_OR_EQUAL: return dField >= stFilter_.dValue;
+      default: return false;
+      }
+   };
+
+   const uint32_t uiBodyLength = stMetaData_.uiBinaryMsgLength;
+   const uint32_t uiAddress = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(pucMessageBody_) % 4);
+   for (const FieldValueFilter& stFilter : itVersion->second)
+   {
+      const uint64_t ullOffset = stFilter.auiOffsets[uiAddress];
+      if (stFilter.uiElementSize == 0)
+      {
+         // A message too short to hold the field does not match.
+         if (ullOffset + stFilter.usLength > uiBodyLength || !CompareField(stFilter, pucMessageBody_ + ullOffset))
+         {
+            return false;
+         }
+         continue;
+      }
+
+      if (ullOffset + sizeof(uint32_t) > uiBodyLength)
+      {
+         return false;
+      }
+      uint32_t uiElements = 0;
+      memcpy(&uiElements, pucMessageBody_ + ullOffset, sizeof(uint32_t));
+      const unsigned char* pucElements = pucMessageBody_ + ullOffset + sizeof(uint32_t);
+      if (ullOffset + sizeof(uint32_t) + static_cast<uint64_t>(uiElements) * stFilter.uiElementSize > uiBodyLength)
+      {
+         return false;
+      }
+
+      bool bMatch = false;
+      for (uint32_t i = 0; i < uiElements && !bMatch; i++)
+      {
+         bMatch = CompareField(stFilter, pucElements + static_cast<size_t>(i) * stFilter.uiElementSize + stFilter.uiElementOffset);
+      }
+      if (!bMatch)
+      {
+         return false;
+      }
+   }
+   return true;
+}
@@ -30,6 +30,10 @@
 //-----------------------------------------------------------------------
 // Includes
 //-----------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
 #include "framer.hpp"
 #include "crc32.hpp"
 
@@ -105,6 +109,155 @@ Framer::IsAbbrevAsciiResponse() const
    return false;
 }
 
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+Framer::GetAbbrevAsciiIndentation(uint32_t uiLineStart_, const uint32_t uiLineEnd_) const
+{
+   // Skip the '<' that starts every line.
+   uint32_t uiIndentation = 0;
+   for (uiLineStart_++; uiLineStart_ < uiLineEnd_ && clMyCircularDataBuffer[uiLineStart_] == ' '; uiLineStart_++)
+   {
+      uiIndentation++;
+   }
+   return uiIndentation;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+Framer::IsAbbrevAsciiArrayOpen() const
+{
+   // An array starts with a line ending in its size, and its elements follow
+   // on lines indented deeper than that line.
+   struct OpenArray
+   {
+      uint32_t uiIndentation;
+      uint32_t uiRemaining;
+   };
+   std::vector<OpenArray> vOpenArrays;
+
+   // Skip the header, which is the first line of the buffer.
+   const uint32_t uiLength = clMyCircularDataBuffer.GetLength();
+   uint32_t uiLineStart = 0;
+   while (uiLineStart < uiLength && clMyCircularDataBuffer[uiLineStart] != '\n')
+   {
+      uiLineStart++;
+   }
+   uiLineStart++;
+
+   while (uiLineStart < uiLength)
+   {
+      uint32_t uiLineEnd = uiLineStart;
+      while (uiLineEnd < uiLength && !IsCRLF(uiLineEnd))
+      {
+         uiLineEnd++;
+      }
+      if (uiLineEnd == uiLength)
+      {
+         break;
+      }
+
+      // Arrays indented deeper than this line are over.
+      const uint32_t uiIndentation = GetAbbrevAsciiIndentation(uiLineStart, uiLineEnd);
+      while (!vOpenArrays.empty() && vOpenArrays.back().uiIndentation > uiIndentation)
+      {
+         vOpenArrays.pop_back();
+      }
+
+      const bool bIsElement = !vOpenArrays.empty() && vOpenArrays.back().uiIndentation == uiIndentation;
+      if (bIsElement && vOpenArrays.back().uiRemaining > 0)
+      {
+         vOpenArrays.back().uiRemaining--;
+      }
+
+      // Find the number, if any, before the separator that ends the line.
+      uint32_t uiDigitsStart = uiLineEnd - 1;
+      while (uiDigitsStart > uiLineStart && clMyCircularDataBuffer[uiDigitsStart - 1] >= '0' && clMyCircularDataBuffer[uiDigitsStart - 1] <= '9')
+      {
+         uiDigitsStart--;
+      }
+      const uint32_t uiNextLineStart = uiLineEnd + 2;
+      if (clMyCircularDataBuffer[uiLineEnd - 1] == OEM4_ABBREV_ASCII_SEPARATOR && uiDigitsStart < uiLineEnd - 1
+       && clMyCircularDataBuffer[uiDigitsStart - 1] == OEM4_ABBREV_ASCII_SEPARATOR)
+      {
+         uint32_t uiSize = 0;
+         for (uint32_t i = uiDigitsStart; i < uiLineEnd - 1; i++)
+         {
+            uiSize = uiSize * 10 + static_cast<uint32_t>(clMyCircularDataBuffer[i] - '0');
+         }
+
+         // The number is an array size if the next line is indented deeper.
+         // Nothing follows the last line yet, so it is taken to be one unless
+         // it is an element of an array already open.
+         if (uiNextLineStart < uiLength)
+         {
+            const uint32_t uiNextIndentation = GetAbbrevAsciiIndentation(uiNextLineStart, uiLength);
+            if (uiNextIndentation > uiIndentation)
+            {
+               vOpenArrays.push_back({ uiNextIndentation, uiSize });
+            }
+         }
+         else if (!bIsElement && uiSize > 0)
+         {
+            return true;
+         }
+      }
+      uiLineStart = uiNextLineStart;
+   }
+
+   return std::any_of(vOpenArrays.begin(), vOpenArrays.end(), [](const OpenArray& stArray_) { return stArray_.uiRemaining > 0; });
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+Framer::IsAbbrevAsciiEndOfStream() const
+{
+   const uint32_t uiLength = clMyCircularDataBuffer.GetLength();
+   if (uiLength < 3 || !IsCRLF(uiLength - 2))
+   {
+      return false;
+   }
+
+   // A line that does not end with a separator ends the log, as it would if
+   // the next log had already arrived.
+   const uint32_t uiLineEnd = uiLength - 2;
+   if (clMyCircularDataBuffer[uiLineEnd - 1] != OEM4_ABBREV_ASCII_SEPARATOR)
+   {
+      return true;
+   }
+
+   // An empty line, indented deeper than the array size before it, closes an
+   // empty array and so ends the log.
+   uint32_t uiLineStart = uiLineEnd - 1;
+   while (uiLineStart > 0 && clMyCircularDataBuffer[uiLineStart - 1] != '\n')
+   {
+      uiLineStart--;
+   }
+   if (uiLineStart >= 2 && clMyCircularDataBuffer[uiLineStart] == OEM4_ABBREV_ASCII_SYNC
+    && GetAbbrevAsciiIndentation(uiLineStart, uiLineEnd) + 1 == uiLineEnd - uiLineStart)
+   {
+      const uint32_t uiPreviousLineEnd = uiLineStart - 2;
+      uint32_t uiPreviousLineStart = uiPreviousLineEnd;
+      while (uiPreviousLineStart > 0 && clMyCircularDataBuffer[uiPreviousLineStart - 1] != '\n')
+      {
+         uiPreviousLineStart--;
+      }
+      if (GetAbbrevAsciiIndentation(uiPreviousLineStart, uiPreviousLineEnd) < GetAbbrevAsciiIndentation(uiLineStart, uiLineEnd))
+      {
+         return true;
+      }
+   }
+
+   // Otherwise more lines follow, so the log is only released once no bytes
+   // have been written for a while, and never while an array is missing
+   // elements.  A pause in the middle of a log must not cut it short.
+   if (uiMyAbbrevAsciiIdleMilliseconds == 0 || IsAbbrevAsciiArrayOpen())
+   {
+      return false;
+   }
+   const uint64_t ullNow = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+   return ullNow - ullMyLastWriteNanoseconds >= uiMyAbbrevAsciiIdleMilliseconds * 1000000ULL;
+}
+
 // -------------------------------------------------------------------------------------------------------
 void
 Framer::HandleUnknownBytes(unsigned char* pucBuffer_, const uint32_t uiUnknownBytes_)
@@ -136,6 +289,32 @@ Framer::SetPayloadOnly(bool bMyPayloadOnly_)
    bMyPayloadOnly = bMyPayloadOnly_;
 }
 
+// -------------------------------------------------------------------------------------------------------
+void
+Framer::SetAbbrevAsciiCompletion(bool bEnable_, uint32_t uiIdleMilliseconds_)
+{
+   bMyCompleteAbbrevAscii = bEnable_;
+   uiMyAbbrevAsciiIdleMilliseconds = uiIdleMilliseconds_;
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+Framer::GetAbbrevAsciiIdleMilliseconds() const
+{
+   return bMyCompleteAbbrevAscii ? uiMyAbbrevAsciiIdleMilliseconds : 0;
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+Framer::Write(unsigned char* pucDataBuffer_, uint32_t uiDataBytes_)
+{
+   if (bMyCompleteAbbrevAscii && uiDataBytes_ > 0)
+   {
+      ullMyLastWriteNanoseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+   }
+   return FramerInterface::Write(pucDataBuffer_, uiDataBytes_);
+}
+
 // -------------------------------------------------------------------------------------------------------
 STATUS
 Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSize_, MetaDataStruct& stMetaData_)
@@ -154,6 +333,7 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
    while (eMyFrameState != COMPLETE_MESSAGE)
    {
       stMetaData_.bResponse = false;
+      stMetaData_.uiFrameCRC = 0;
 
       // Read data from circular buffer until we reach the end or we
       // didn't find a complete frame in current data buffer
@@ -402,6 +582,11 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
             if (uiMyCalculatedCRC32 == 0)
             {
                eStatus = STATUS::SUCCESS;
+               // The CRC run over the CRC bytes themselves is 0, so read them back.
+               stMetaData_.uiFrameCRC = static_cast<uint32_t>(clMyCircularDataBuffer[uiMyExpectedMessageLength - 4])
+                                      | static_cast<uint32_t>(clMyCircularDataBuffer[uiMyExpectedMessageLength - 3]) << 8
+                                      | static_cast<uint32_t>(clMyCircularDataBuffer[uiMyExpectedMessageLength - 2]) << 16
+                                      | static_cast<uint32_t>(clMyCircularDataBuffer[uiMyExpectedMessageLength - 1]) << 24;
                if (bMyPayloadOnly)
                {
                   stMetaData_.uiLength = uiMyExpectedPayloadLength;
@@ -538,9 +723,17 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
          // End of buffer (can't look ahead, assume incomplete message)
          if (uiMyByteCount + 3 >= clMyCircularDataBuffer.GetLength())
          {
-            uiMyByteCount--; // If the data lands on the header CRLF then it can be missed unless it's tested again when there is more data
-            stMetaData_.uiLength = clMyCircularDataBuffer.GetLength();
-            return STATUS::INCOMPLETE;
+            if (bMyCompleteAbbrevAscii && IsAbbrevAsciiEndOfStream())
+            {
+               // End the log at the final CRLF without waiting for the next one.
+               uiMyByteCount = clMyCircularDataBuffer.GetLength() - 1;
+            }
+            else
+            {
+               uiMyByteCount--; // If the data lands on the header CRLF then it can be missed unless it's tested again when there is more data
+               stMetaData_.uiLength = clMyCircularDataBuffer.GetLength();
+               return STATUS::INCOMPLETE;
+            }
          }
 
          // Abbrev Array, more data to follow
@@ -623,6 +816,7 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
             if (uiMyCalculatedCRC32 == uiMessageCRC)
             {
                eStatus = STATUS::SUCCESS;
+               stMetaData_.uiFrameCRC = uiMessageCRC;
 
                if (uiFrameBufferSize_ < stMetaData_.uiLength)
                {
@@ -41,13 +41,13 @@ HeaderDecoder::HeaderDecoder(JsonReader* pclJsonDb_)
 {
    pclMyLogger = Logger().RegisterLogger("novatel_header_decoder");
 
-   pclMyLogger->debug("HeaderDecoder initializing...");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "HeaderDecoder initializing...");
 
    if (pclJsonDb_ != nullptr)
    {
       LoadJsonDb(pclJsonDb_);
    }
-   pclMyLogger->debug("HeaderDecoder initialized");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "HeaderDecoder initialized");
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -0,0 +1,373 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file ingest_engine.cpp
+//! \brief Parse OEM logs from many file descriptors on one thread.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "ingest_engine.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+//! The epoll tag of the wakeup eventfd.  Stream IDs start at 1.
+static constexpr uint32_t uiWAKE_TAG = 0;
+//! The most events handled per epoll_wait().
+static constexpr int32_t iMAX_EVENTS = 256;
+
+// -------------------------------------------------------------------------------------------------------
+IngestEngine::IngestEngine(const std::string sDbPath_)
+{
+   clMyJsonReader.LoadFile(sDbPath_);
+   pclMyJsonDb = &clMyJsonReader;
+   Initialize();
+}
+
+// -------------------------------------------------------------------------------------------------------
+IngestEngine::IngestEngine(JsonReader* pclJsonDb_) :
+   pclMyJsonDb(pclJsonDb_)
+{
+   Initialize();
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+IngestEngine::Initialize()
+{
+   pclMyLogger = Logger().RegisterLogger("novatel_ingest_engine");
+   pcMyReadBuffer.reset(new char[uiREAD_SIZE]);
+
+   iMyEpollFd = epoll_create1(EPOLL_CLOEXEC);
+   iMyWakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+   if (iMyEpollFd < 0 || iMyWakeFd < 0)
+   {
+      if (iMyEpollFd >= 0) { close(iMyEpollFd); }
+      if (iMyWakeFd >= 0) { close(iMyWakeFd); }
+      throw std::runtime_error("IngestEngine(): failed to create the epoll instance");
+   }
+
+   epoll_event stEvent{};
+   stEvent.events = EPOLLIN;
+   stEvent.data.u32 = uiWAKE_TAG;
+   if (epoll_ctl(iMyEpollFd, EPOLL_CTL_ADD, iMyWakeFd, &stEvent) < 0)
+   {
+      close(iMyEpollFd);
+      close(iMyWakeFd);
+      throw std::runtime_error("IngestEngine(): failed to watch the wakeup eventfd");
+   }
+
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "IngestEngine initialized");
+}
+
+// -------------------------------------------------------------------------------------------------------
+IngestEngine::~IngestEngine()
+{
+   close(iMyWakeFd);
+   close(iMyEpollFd);
+}
+
+// -------------------------------------------------------------------------------------------------------
+std::shared_ptr<spdlog::logger>
+IngestEngine::GetLogger()
+{
+   return pclMyLogger;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+IngestEngine::SetLoggerLevel(spdlog::level::level_enum eLevel_)
+{
+   pclMyLogger->set_level(eLevel_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+IngestEngine::SetMessageCallback(MessageCallback fnCallback_)
+{
+   fnMyMessageCallback = std::move(fnCallback_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+IngestEngine::SetStreamClosedCallback(StreamClosedCallback fnCallback_)
+{
+   fnMyStreamClosedCallback = std::move(fnCallback_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+IngestEngine::AddStream(InputFdStream* pclInputStream_)
+{
+   if (pclInputStream_ == nullptr)
+   {
+      return uiINVALID_STREAM_ID;
+   }
+
+   const uint32_t uiStreamId = uiMyNextStreamId;
+
+   epoll_event stEvent{};
+   stEvent.events = EPOLLIN;
+   stEvent.data.u32 = uiStreamId;
+   if (epoll_ctl(iMyEpollFd, EPOLL_CTL_ADD, pclInputStream_->GetFileDescriptor(), &stEvent) < 0)
+   {
+      pclMyLogger->warn("Failed to watch file descriptor {} (errno {})", pclInputStream_->GetFileDescriptor(), errno);
+      return uiINVALID_STREAM_ID;
+   }
+
+   uiMyNextStreamId++;
+   mMyStreams.emplace(uiStreamId, Stream{ pclInputStream_, std::make_unique<Parser>(pclMyJsonDb) });
+   return uiStreamId;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+IngestEngine::RemoveStream(uint32_t uiStreamId_)
+{
+   const auto itStream = mMyStreams.find(uiStreamId_);
+   if (itStream == mMyStreams.end())
+   {
+      return false;
+   }
+
+   epoll_ctl(iMyEpollFd, EPOLL_CTL_DEL, itStream->second.pclInputStream->GetFileDescriptor(), nullptr);
+
+   // A callback may be removing the stream whose Parser is delivering it a log,
+   // so keep the Parser alive until Poll() unwinds.
+   if (bMyPolling)
+   {
+      vMyRetiredStreams.emplace_back(std::move(itStream->second));
+   }
+   mMyStreams.erase(itStream);
+   return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+Parser*
+IngestEngine::GetParser(uint32_t uiStreamId_)
+{
+   const auto itStream = mMyStreams.find(uiStreamId_);
+   return itStream == mMyStreams.end() ? nullptr : itStream->second.pclParser.get();
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+IngestEngine::GetStreamCount() const
+{
+   return static_cast<uint32_t>(mMyStreams.size());
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+IngestEngine::DeliverLogs(uint32_t uiStreamId_, Parser& clParser_)
+{
+   uint32_t uiDelivered = 0;
+   MessageDataStruct stMessageData;
+   MetaDataStruct stMetaData;
+
+   while (true)
+   {
+      const STATUS eStatus = clParser_.Read(stMessageData, stMetaData);
+      if (eStatus == STATUS::BUFFER_EMPTY)
+      {
+         break;
+      }
+
+      uiDelivered++;
+      if (fnMyMessageCallback)
+      {
+         fnMyMessageCallback(uiStreamId_, eStatus, stMessageData, stMetaData);
+         if (mMyStreams.find(uiStreamId_) == mMyStreams.end())
+         {
+            // Removed by the callback.
+            break;
+         }
+      }
+   }
+   return uiDelivered;
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+IngestEngine::ReadStream(uint32_t uiStreamId_)
+{
+   const auto itStream = mMyStreams.find(uiStreamId_);
+   if (itStream == mMyStreams.end())
+   {
+      // Removed by a callback earlier in this batch of events.
+      return 0;
+   }
+   Stream& stStream = itStream->second;
+
+   ReadDataStructure stReadData;
+   stReadData.cData = pcMyReadBuffer.get();
+   stReadData.uiDataSize = uiREAD_SIZE;
+   const StreamReadStatus stReadStatus = stStream.pclInputStream->ReadData(stReadData);
+
+   uint32_t uiDelivered = 0;
+   if (stReadStatus.uiCurrentStreamRead > 0)
+   {
+      stStream.pclParser->Write(reinterpret_cast<unsigned char*>(stReadData.cData), stReadStatus.uiCurrentStreamRead);
+      // Taken after the Write() so the Framer sees the stream as idle first.
+      stStream.tpLastWrite = std::chrono::steady_clock::now();
+      stStream.bIdleReadPending = true;
+      uiDelivered = DeliverLogs(uiStreamId_, *stStream.pclParser);
+   }
+
+   if (stReadStatus.bEOS && RemoveStream(uiStreamId_))
+   {
+      SPDLOG_LOGGER_DEBUG(pclMyLogger, "Stream {} ended after {} bytes", uiStreamId_, stReadStatus.ullStreamLength);
+      if (fnMyStreamClosedCallback)
+      {
+         fnMyStreamClosedCallback(uiStreamId_);
+      }
+   }
+   return uiDelivered;
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+IngestEngine::DeliverIdleLogs()
+{
+   // Give each Parser whose stream has been quiet for its idle time a chance
+   // to release logs it was holding for more data.  A busy stream must not
+   // hold up a quiet one, so this does not wait for every stream to be quiet.
+   const auto tpNow = std::chrono::steady_clock::now();
+   std::vector<uint32_t> vStreamIds;
+   for (auto& itStream : mMyStreams)
+   {
+      Stream& stStream = itStream.second;
+      const uint32_t uiIdleMilliseconds = stStream.pclParser->GetAbbrevAsciiIdleMilliseconds();
+      if (stStream.bIdleReadPending && uiIdleMilliseconds > 0 && tpNow - stStream.tpLastWrite >= std::chrono::milliseconds(uiIdleMilliseconds))
+      {
+         stStream.bIdleReadPending = false;
+         vStreamIds.push_back(itStream.first);
+      }
+   }
+
+   // Callbacks may remove streams.
+   uint32_t uiDelivered = 0;
+   for (const uint32_t uiStreamId : vStreamIds)
+   {
+      const auto itStream = mMyStreams.find(uiStreamId);
+      if (itStream != mMyStreams.end())
+      {
+         uiDelivered += DeliverLogs(uiStreamId, *itStream->second.pclParser);
+      }
+   }
+   return uiDelivered;
+}
+
+// -------------------------------------------------------------------------------------------------------
+int32_t
+IngestEngine::GetIdleTimeout() const
+{
+   // Wake up when the first stream written since it was last idle becomes
+   // idle, or never if there is no such stream.
+   const auto tpNow = std::chrono::steady_clock::now();
+   int32_t iTimeoutMs = -1;
+   for (const auto& itStream : mMyStreams)
+   {
+      const Stream& stStream = itStream.second;
+      const uint32_t uiIdleMilliseconds = stStream.pclParser->GetAbbrevAsciiIdleMilliseconds();
+      if (!stStream.bIdleReadPending || uiIdleMilliseconds == 0)
+      {
+         continue;
+      }
+
+      // Round up so that the stream is idle by the time epoll_wait() returns.
+      const int64_t llRemainingMs = std::chrono::duration_cast<std::chrono::milliseconds>(stStream.tpLastWrite + std::chrono::milliseconds(uiIdleMilliseconds) - tpNow).count() + 1;
+      const auto iStreamTimeoutMs = static_cast<int32_t>(std::clamp<int64_t>(llRemainingMs, 0, INT32_MAX));
+      if (iTimeoutMs < 0 || iStreamTimeoutMs < iTimeoutMs)
+      {
+         iTimeoutMs = iStreamTimeoutMs;
+      }
+   }
+   return iTimeoutMs;
+}
+
+// -------------------------------------------------------------------------------------------------------
+int32_t
+IngestEngine::Poll(int32_t iTimeoutMs_)
+{
+   epoll_event astEvents[iMAX_EVENTS];
+   const int32_t iEvents = epoll_wait(iMyEpollFd, astEvents, iMAX_EVENTS, iTimeoutMs_);
+   if (iEvents < 0)
+   {
+      return errno == EINTR ? 0 : -1;
+   }
+
+   int32_t iDelivered = 0;
+   bMyPolling = true;
+   for (int32_t i = 0; i < iEvents; i++)
+   {
+      if (astEvents[i].data.u32 == uiWAKE_TAG)
+      {
+         uint64_t ullCount = 0;
+         static_cast<void>(read(iMyWakeFd, &ullCount, sizeof(ullCount)));
+         continue;
+      }
+      iDelivered += static_cast<int32_t>(ReadStream(astEvents[i].data.u32));
+   }
+
+   iDelivered += static_cast<int32_t>(DeliverIdleLogs());
+   bMyPolling = false;
+   vMyRetiredStreams.clear();
+
+   return iDelivered;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+IngestEngine::Run()
+{
+   while (!bMyStop && !mMyStreams.empty())
+   {
+      if (Poll(GetIdleTimeout()) < 0)
+      {
+         pclMyLogger->error("epoll_wait() failed (errno {})", errno);
+         break;
+      }
+   }
+   bMyStop = false;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+IngestEngine::Stop()
+{
+   bMyStop = true;
+   const uint64_t ullOne = 1;
+   static_cast<void>(write(iMyWakeFd, &ullOne, sizeof(ullOne)));
+}
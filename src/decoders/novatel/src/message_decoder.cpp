@@ -31,6 +31,7 @@
 // Includes
 //-----------------------------------------------------------------------
 #include "decoders/novatel/api/message_decoder.hpp"
+#include <algorithm>
 #include <bitset>
 #include <sstream>
 
@@ -42,12 +43,12 @@ MessageDecoder::MessageDecoder(JsonReader* pclJsonDb_)
 {
    pclMyLogger = Logger().RegisterLogger("novatel_message_decoder");
 
-   pclMyLogger->debug("MessageDecoder initializing...");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "MessageDecoder initializing...");
    if (pclJsonDb_ != nullptr)
    {
       LoadJsonDb(pclJsonDb_);
    }
-   pclMyLogger->debug("MessageDecoder initialized");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "MessageDecoder initialized");
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -55,6 +56,7 @@ void
 MessageDecoder::LoadJsonDb(JsonReader* pclJsonDb_)
 {
    pclMyMsgDb = pclJsonDb_;
+   umMyProjections.clear();
 
    InitEnumDefns();
    CreateResponseMsgDefns();
@@ -215,7 +217,11 @@ MessageDecoder::GetMsgDefFromCRC(const MessageDefinition* pclMessageDef_, uint32
    // If we can't find the correct CRC just default to the latest.
    if (pclMessageDef_->fields.count(uiMsgDefCRC_) == 0)
    {
-      pclMyLogger->info("Log DB is missing the log definition {} - {}.  Defaulting to newest version fo the log definition.", pclMessageDef_->name, uiMsgDefCRC_);
+      uint64_t ullSuppressed = 0;
+      if (pclMyLogger->should_log(spdlog::level::info) && clMyLogRateLimiter.ShouldLog(0, static_cast<uint32_t>(STATUS::NO_DEFINITION), pclMessageDef_->logID, ullSuppressed))
+      {
+         pclMyLogger->info("Log DB is missing the log definition {} - {}.  Defaulting to newest version fo the log definition.{}", pclMessageDef_->name, uiMsgDefCRC_, LogRateLimiter::Suppressed(ullSuppressed));
+      }
       uiMsgDefCRC_ = pclMessageDef_->latestMessageCrc;
    }
    return &pclMessageDef_->fields.at(uiMsgDefCRC_);
@@ -236,94 +242,104 @@ MessageDecoder::DecodeBinary(const std::vector<BaseField*> MsgDefFields_, unsign
          *ppucLogBuf_ += usTypeAlightment - (reinterpret_cast<uint64_t>(*ppucLogBuf_) % usTypeAlightment);
       }
 
-      if (field->type == FIELD_TYPE::SIMPLE)
-      {
-         DecodeBinaryField(field, ppucLogBuf_, vIntermediateFormat_);
-      }
-      else if (field->type == FIELD_TYPE::ENUM)
-      {
-         vIntermediateFormat_.emplace_back(*reinterpret_cast<std::int32_t*>(*ppucLogBuf_), field);
-         *ppucLogBuf_ += sizeof(int32_t);
-      }
-      else if (field->type == FIELD_TYPE::RESPONSE_ID)
-      {
-         vIntermediateFormat_.emplace_back(*reinterpret_cast<std::int32_t*>(*ppucLogBuf_), field);
-         *ppucLogBuf_ += sizeof(int32_t);
-      }
-      else if (field->type == FIELD_TYPE::RESPONSE_STR)
-      {
-         std::string sTemp(reinterpret_cast<char*>(*ppucLogBuf_), uiMessageLength_ - sizeof(int32_t)); // Remove CRC
-         vIntermediateFormat_.emplace_back(sTemp, field);
-         // Binary response string is not null terminated or 4 byte aligned
-         *ppucLogBuf_ += sTemp.size();
-      }
-      else if (field->type == FIELD_TYPE::FIXED_LENGTH_ARRAY)
-      {
-         uint32_t uiArraySize = static_cast<const ArrayField*>(field)->arrayLength;
-         vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
+      eStatus = DecodeBinaryValue(field, ppucLogBuf_, vIntermediateFormat_, uiMessageLength_, pucTempStart);
 
-         auto& pvFC = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
-         pvFC.reserve(uiArraySize);
+      if (*ppucLogBuf_ - pucTempStart  >= static_cast<int32_t>(uiMessageLength_))
+         break;
+   }
 
-         for (uint32_t i = 0; i < uiArraySize; ++i)
-            DecodeBinaryField(field, ppucLogBuf_, pvFC);
-      }
-      else if (field->type == FIELD_TYPE::VARIABLE_LENGTH_ARRAY)
-      {
-         auto uiArraySize = *reinterpret_cast<std::uint32_t*>(*ppucLogBuf_);;
-         *ppucLogBuf_ += sizeof(uint32_t);
+   return eStatus;
+}
 
-         vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
-         auto& pvFC = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
-         pvFC.reserve(uiArraySize);
+// -------------------------------------------------------------------------------------------------------
+STATUS
+MessageDecoder::DecodeBinaryValue(const BaseField* field, unsigned char** ppucLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_, uint32_t uiMessageLength_, const unsigned char* pucTempStart)
+{
+   STATUS eStatus = STATUS::SUCCESS;
+   if (field->type == FIELD_TYPE::SIMPLE)
+   {
+      DecodeBinaryField(field, ppucLogBuf_, vIntermediateFormat_);
+   }
+   else if (field->type == FIELD_TYPE::ENUM)
+   {
+      vIntermediateFormat_.emplace_back(*reinterpret_cast<std::int32_t*>(*ppucLogBuf_), field);
+      *ppucLogBuf_ += sizeof(int32_t);
+   }
+   else if (field->type == FIELD_TYPE::RESPONSE_ID)
+   {
+      vIntermediateFormat_.emplace_back(*reinterpret_cast<std::int32_t*>(*ppucLogBuf_), field);
+      *ppucLogBuf_ += sizeof(int32_t);
+   }
+   else if (field->type == FIELD_TYPE::RESPONSE_STR)
+   {
+      std::string sTemp(reinterpret_cast<char*>(*ppucLogBuf_), uiMessageLength_ - sizeof(int32_t)); // Remove CRC
+      vIntermediateFormat_.emplace_back(sTemp, field);
+      // Binary response string is not null terminated or 4 byte aligned
+      *ppucLogBuf_ += sTemp.size();
+   }
+   else if (field->type == FIELD_TYPE::FIXED_LENGTH_ARRAY)
+   {
+      uint32_t uiArraySize = static_cast<const ArrayField*>(field)->arrayLength;
+      vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
 
-         for (uint32_t i = 0; i < uiArraySize; ++i)
-         {
-            DecodeBinaryField(field, ppucLogBuf_, pvFC);
-         }
-      }
-      else if (field->type == FIELD_TYPE::STRING)
-      {
-         // This version of a string is different. It is hopefully null terminated.
-         std::string sTemp(reinterpret_cast<char*>(*ppucLogBuf_));
-         vIntermediateFormat_.emplace_back(sTemp, field);
-         *ppucLogBuf_ += sTemp.size() + 1; // + 1 to consume the NULL at the end of the string. This is to maintain byte alignment.
+      auto& pvFC = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
+      pvFC.reserve(uiArraySize);
 
-         if (reinterpret_cast<std::uint64_t>(*ppucLogBuf_) % 4 != 0)
-         {
-            *ppucLogBuf_ += 4 - reinterpret_cast<std::uint64_t>(*ppucLogBuf_) % 4;
-         }
+      for (uint32_t i = 0; i < uiArraySize; ++i)
+         DecodeBinaryField(field, ppucLogBuf_, pvFC);
+   }
+   else if (field->type == FIELD_TYPE::VARIABLE_LENGTH_ARRAY)
+   {
+      auto uiArraySize = *reinterpret_cast<std::uint32_t*>(*ppucLogBuf_);;
+      *ppucLogBuf_ += sizeof(uint32_t);
+
+      vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
+      auto& pvFC = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
+      pvFC.reserve(uiArraySize);
+
+      for (uint32_t i = 0; i < uiArraySize; ++i)
+      {
+         DecodeBinaryField(field, ppucLogBuf_, pvFC);
       }
-      else if (field->type == FIELD_TYPE::FIELD_ARRAY)
+   }
+   else if (field->type == FIELD_TYPE::STRING)
+   {
+      // This version of a string is different. It is hopefully null terminated.
+      std::string sTemp(reinterpret_cast<char*>(*ppucLogBuf_));
+      vIntermediateFormat_.emplace_back(sTemp, field);
+      *ppucLogBuf_ += sTemp.size() + 1; // + 1 to consume the NULL at the end of the string. This is to maintain byte alignment.
+
+      if (reinterpret_cast<std::uint64_t>(*ppucLogBuf_) % 4 != 0)
       {
-         auto* puiArraySize = reinterpret_cast<std::uint32_t*>(*ppucLogBuf_);
-         *ppucLogBuf_ += sizeof(int32_t);
+         *ppucLogBuf_ += 4 - reinterpret_cast<std::uint64_t>(*ppucLogBuf_) % 4;
+      }
+   }
+   else if (field->type == FIELD_TYPE::FIELD_ARRAY)
+   {
+      auto* puiArraySize = reinterpret_cast<std::uint32_t*>(*ppucLogBuf_);
+      *ppucLogBuf_ += sizeof(int32_t);
 
-         auto* sub_field_defs = static_cast<FieldArrayField*>(field);
+      auto* sub_field_defs = static_cast<const FieldArrayField*>(field);
 
-         vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
-         auto& pvFieldArrayContainer = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
-         pvFieldArrayContainer.reserve(*puiArraySize);
-
-         for (uint32_t i = 0; i < *puiArraySize; ++i)
-         {
-            pvFieldArrayContainer.emplace_back(std::vector<FieldContainer>(), field);
-            auto& pvFC = std::get<std::vector<FieldContainer>>(pvFieldArrayContainer.back().field_value);
-            pvFC.reserve((static_cast<const FieldArrayField*>(field))->fields.size());
+      vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
+      auto& pvFieldArrayContainer = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
+      pvFieldArrayContainer.reserve(*puiArraySize);
 
-            eStatus = DecodeBinary(sub_field_defs->fields, ppucLogBuf_, pvFC, uiMessageLength_ - static_cast<uint32_t>(*ppucLogBuf_ - pucTempStart));
-         }
-      }
-      else
+      for (uint32_t i = 0; i < *puiArraySize; ++i)
       {
-         std::string sError = "DecodeBinary(): Unknown field type\n";
-         SPDLOG_LOGGER_CRITICAL(pclMyLogger, sError);
-         throw std::runtime_error(sError);
+         pvFieldArrayContainer.emplace_back(std::vector<FieldContainer>(), field);
+         auto& pvFC = std::get<std::vector<FieldContainer>>(pvFieldArrayContainer.back().field_value);
+         pvFC.reserve((static_cast<const FieldArrayField*>(field))->fields.size());
+
+         eStatus = DecodeBinary(sub_field_defs->fields, ppucLogBuf_, pvFC, uiMessageLength_ - static_cast<uint32_t>(*ppucLogBuf_ - pucTempStart));
       }
-      if (*ppucLogBuf_ - pucTempStart  >= static_cast<int32_t>(uiMessageLength_))
-         break;
    }
-
+   else
+   {
+      std::string sError = "DecodeBinary(): Unknown field type\n";
+      SPDLOG_LOGGER_CRITICAL(pclMyLogger, sError);
+      throw std::runtime_error(sError);
+   }
    return eStatus;
 }
 
@@ -369,16 +385,342 @@ MessageDecoder::DecodeBinaryField(const BaseField* MessageDataType_, unsigned ch
    *ppucLogBuf_ += MessageDataType_->dataType.length;
 }
 
+// -------------------------------------------------------------------------------------------------------
+void
+MessageDecoder::SkipBinaryValue(const BaseField* field, unsigned char** ppucLogBuf_, uint32_t uiMessageLength_, const unsigned char* pucTempStart)
+{
+   switch (field->type)
+   {
+   case FIELD_TYPE::SIMPLE:
+      *ppucLogBuf_ += field->dataType.length;
+      break;
+   case FIELD_TYPE::ENUM:
+   case FIELD_TYPE::RESPONSE_ID:
+      *ppucLogBuf_ += sizeof(int32_t);
+      break;
+   case FIELD_TYPE::RESPONSE_STR:
+      *ppucLogBuf_ += uiMessageLength_ - sizeof(int32_t);
+      break;
+   case FIELD_TYPE::FIXED_LENGTH_ARRAY:
+      *ppucLogBuf_ += static_cast<const ArrayField*>(field)->arrayLength * field->dataType.length;
+      break;
+   case FIELD_TYPE::VARIABLE_LENGTH_ARRAY:
+   {
+      const uint32_t uiArraySize = *reinterpret_cast<std::uint32_t*>(*ppucLogBuf_);
+      *ppucLogBuf_ += sizeof(uint32_t) + uiArraySize * field->dataType.length;
+      break;
+   }
+   case FIELD_TYPE::STRING:
+      *ppucLogBuf_ += strlen(reinterpret_cast<char*>(*ppucLogBuf_)) + 1;
+      if (reinterpret_cast<std::uint64_t>(*ppucLogBuf_) % 4 != 0)
+      {
+         *ppucLogBuf_ += 4 - reinterpret_cast<std::uint64_t>(*ppucLogBuf_) % 4;
+      }
+      break;
+   case FIELD_TYPE::FIELD_ARRAY:
+   {
+      const uint32_t uiArraySize = *reinterpret_cast<std::uint32_t*>(*ppucLogBuf_);
+      *ppucLogBuf_ += sizeof(int32_t);
+
+      // Step over each element the same way DecodeBinary() decodes it.
+      for (uint32_t i = 0; i < uiArraySize; ++i)
+      {
+         const unsigned char* pucElementStart = *ppucLogBuf_;
+         const uint32_t uiElementLength = uiMessageLength_ - static_cast<uint32_t>(*ppucLogBuf_ - pucTempStart);
+         for (const auto& sub_field : static_cast<const FieldArrayField*>(field)->fields)
+         {
+            uint8_t usTypeAlightment = sub_field->dataType.length >= 4 ? 4 : sub_field->dataType.length;
+            if (reinterpret_cast<uint64_t>(*ppucLogBuf_) % usTypeAlightment != 0)
+            {
+               *ppucLogBuf_ += usTypeAlightment - (reinterpret_cast<uint64_t>(*ppucLogBuf_) % usTypeAlightment);
+            }
+
+            SkipBinaryValue(sub_field, ppucLogBuf_, uiElementLength, pucElementStart);
+
+            if (*ppucLogBuf_ - pucElementStart >= static_cast<int32_t>(uiElementLength))
+               break;
+         }
+      }
+      break;
+   }
+   default:
+      std::string sError = "SkipBinaryValue(): Unknown field type\n";
+      SPDLOG_LOGGER_CRITICAL(pclMyLogger, sError);
+      throw std::runtime_error(sError);
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+MessageDecoder::CompileProjectedFields(const std::vector<BaseField*>& vMsgDefFields_, const std::vector<std::string>& vFieldPaths_, std::vector<ProjectedField>& vProjectedFields_) const
+{
+   bool bAllFound = true;
+
+   vProjectedFields_.clear();
+   vProjectedFields_.reserve(vMsgDefFields_.size());
+   for (const auto& field : vMsgDefFields_)
+   {
+      vProjectedFields_.push_back(ProjectedField{ field, false, {} });
+   }
+
+   // Split each path at its first '.' and group the rest of the paths by the
+   // FIELD_ARRAY they belong to.
+   std::vector<std::vector<std::string>> vSubFieldPaths(vMsgDefFields_.size());
+   for (const auto& strPath : vFieldPaths_)
+   {
+      const size_t ullDot = strPath.find('.');
+      const std::string strName = strPath.substr(0, ullDot);
+
+      auto itField = std::find_if(vMsgDefFields_.begin(), vMsgDefFields_.end(),
+                                  [&strName](const BaseField* pclField_) { return pclField_->name == strName; });
+      if (itField == vMsgDefFields_.end())
+      {
+         bAllFound = false;
+         continue;
+      }
+
+      const size_t ullIndex = static_cast<size_t>(itField - vMsgDefFields_.begin());
+      if (ullDot == std::string::npos)
+      {
+         vProjectedFields_[ullIndex].bDecode = true;
+      }
+      else if ((*itField)->type == FIELD_TYPE::FIELD_ARRAY)
+      {
+         vSubFieldPaths[ullIndex].push_back(strPath.substr(ullDot + 1));
+      }
+      else
+      {
+         bAllFound = false;
+      }
+   }
+
+   for (size_t i = 0; i < vProjectedFields_.size(); ++i)
+   {
+      ProjectedField& stField = vProjectedFields_[i];
+      if (!stField.bDecode && !vSubFieldPaths[i].empty())
+      {
+         const auto* pclFieldArray = static_cast<const FieldArrayField*>(stField.pclField);
+         bAllFound = CompileProjectedFields(pclFieldArray->fields, vSubFieldPaths[i], stField.vSubFields) && bAllFound;
+
+         // Nothing wanted from the elements if none of the paths were found.
+         if (std::none_of(stField.vSubFields.begin(), stField.vSubFields.end(),
+                          [](const ProjectedField& stSubField_) { return stSubField_.bDecode || !stSubField_.vSubFields.empty(); }))
+         {
+            stField.vSubFields.clear();
+         }
+      }
+   }
+
+   return bAllFound;
+}
+
+// -------------------------------------------------------------------------------------------------------
+//! The size in a binary body of a SIMPLE, ENUM or FIXED_LENGTH_ARRAY field.
+static uint32_t FixedFieldSize(const BaseField* pclField_)
+{
+   return pclField_->type == FIELD_TYPE::ENUM ? sizeof(int32_t)
+        : pclField_->type == FIELD_TYPE::FIXED_LENGTH_ARRAY ? static_cast<const ArrayField*>(pclField_)->arrayLength * pclField_->dataType.length
+        : pclField_->dataType.length;
+}
+
+// -------------------------------------------------------------------------------------------------------
+const MessageDecoder::FieldProjection&
+MessageDecoder::GetProjection(MsgFieldsVector* pvMsgDefFields_, const std::vector<std::string>& vFieldPaths_)
+{
+   auto itProjection = umMyProjections.find(pvMsgDefFields_);
+   if (itProjection != umMyProjections.end())
+   {
+      return itProjection->second;
+   }
+
+   // A field missing from this version of the message is just not decoded.
+   FieldProjection stProjection;
+   static_cast<void>(CompileProjectedFields(*pvMsgDefFields_, vFieldPaths_, stProjection.vFields));
+
+   // Nothing after the last wanted field has to be read.
+   while (!stProjection.vFields.empty() && !stProjection.vFields.back().bDecode && stProjection.vFields.back().vSubFields.empty())
+   {
+      stProjection.vFields.pop_back();
+   }
+
+   // The offsets of the fields are fixed until the first one whose size
+   // depends on the data.
+   uint32_t uiOffset = 0;
+   stProjection.bFixedLayout = true;
+   for (const auto& stField : stProjection.vFields)
+   {
+      const BaseField* field = stField.pclField;
+      if (field->type != FIELD_TYPE::SIMPLE && field->type != FIELD_TYPE::ENUM && field->type != FIELD_TYPE::FIXED_LENGTH_ARRAY)
+      {
+         stProjection.bFixedLayout = false;
+         stProjection.vFixedOffsets.clear();
+         break;
+      }
+
+      const uint32_t uiTypeAlignment = field->dataType.length >= 4 ? 4 : field->dataType.length;
+      if (uiTypeAlignment > 1 && uiOffset % uiTypeAlignment != 0)
+      {
+         uiOffset += uiTypeAlignment - uiOffset % uiTypeAlignment;
+      }
+
+      if (stField.bDecode)
+      {
+         stProjection.vFixedOffsets.emplace_back(uiOffset, field);
+      }
+
+      uiOffset += FixedFieldSize(field);
+   }
+
+   return umMyProjections.emplace(pvMsgDefFields_, std::move(stProjection)).first->second;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+MessageDecoder::DecodeBinaryProjection(const FieldProjection& stProjection_, unsigned char* pucLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_, uint32_t uiMessageLength_)
+{
+   // Fields are aligned to their absolute address, so the offsets only hold
+   // for a 4-byte aligned body.
+   if (stProjection_.bFixedLayout && reinterpret_cast<uint64_t>(pucLogBuf_) % 4 == 0)
+   {
+      STATUS eStatus = STATUS::SUCCESS;
+      for (const auto& stFixedOffset : stProjection_.vFixedOffsets)
+      {
+         // Stop at the first field the message is too short to hold.
+         if (static_cast<uint64_t>(stFixedOffset.first) + FixedFieldSize(stFixedOffset.second) > uiMessageLength_)
+            break;
+
+         unsigned char* pucField = pucLogBuf_ + stFixedOffset.first;
+         eStatus = DecodeBinaryValue(stFixedOffset.second, &pucField, vIntermediateFormat_, uiMessageLength_, pucLogBuf_);
+      }
+      return eStatus;
+   }
+
+   return DecodeBinaryProjectedFields(stProjection_.vFields, &pucLogBuf_, vIntermediateFormat_, uiMessageLength_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+MessageDecoder::DecodeBinaryProjectedFields(const std::vector<ProjectedField>& vFields_, unsigned char** ppucLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_, uint32_t uiMessageLength_)
+{
+   STATUS eStatus = STATUS::SUCCESS;
+   unsigned char* pucTempStart = *ppucLogBuf_;
+   for (const auto& stField : vFields_)
+   {
+      const BaseField* field = stField.pclField;
+
+      // Realign to type byte boundry if needed
+      uint8_t usTypeAlightment = field->dataType.length >= 4 ? 4 : field->dataType.length;
+      if (reinterpret_cast<uint64_t>(*ppucLogBuf_) % usTypeAlightment != 0)
+      {
+         *ppucLogBuf_ += usTypeAlightment - (reinterpret_cast<uint64_t>(*ppucLogBuf_) % usTypeAlightment);
+      }
+
+      if (stField.bDecode)
+      {
+         eStatus = DecodeBinaryValue(field, ppucLogBuf_, vIntermediateFormat_, uiMessageLength_, pucTempStart);
+      }
+      else if (!stField.vSubFields.empty())
+      {
+         const uint32_t uiArraySize = *reinterpret_cast<std::uint32_t*>(*ppucLogBuf_);
+         *ppucLogBuf_ += sizeof(int32_t);
+
+         vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
+         auto& pvFieldArrayContainer = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
+         pvFieldArrayContainer.reserve(uiArraySize);
+
+         for (uint32_t i = 0; i < uiArraySize; ++i)
+         {
+            pvFieldArrayContainer.emplace_back(std::vector<FieldContainer>(), field);
+            auto& pvFC = std::get<std::vector<FieldContainer>>(pvFieldArrayContainer.back().field_value);
+            pvFC.reserve(stField.vSubFields.size());
+
+            eStatus = DecodeBinaryProjectedFields(stField.vSubFields, ppucLogBuf_, pvFC, uiMessageLength_ - static_cast<uint32_t>(*ppucLogBuf_ - pucTempStart));
+         }
+      }
+      else
+      {
+         SkipBinaryValue(field, ppucLogBuf_, uiMessageLength_, pucTempStart);
+      }
+
+      if (*ppucLogBuf_ - pucTempStart  >= static_cast<int32_t>(uiMessageLength_))
+         break;
+   }
+
+   return eStatus;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+MessageDecoder::SetProjection(const std::string& strMsgName_, const std::vector<std::string>& vFieldPaths_)
+{
+   if (!pclMyMsgDb)
+   {
+      return STATUS::NO_DATABASE;
+   }
+
+   const MessageDefinition* pclMsgDef = pclMyMsgDb->GetMsgDef(strMsgName_);
+   if (!pclMsgDef)
+   {
+      return STATUS::NO_DEFINITION;
+   }
+
+   umMyProjections.clear();
+   if (vFieldPaths_.empty())
+   {
+      umMyProjectionPaths.erase(pclMsgDef->logID);
+      return STATUS::SUCCESS;
+   }
+
+   // Check the paths against the newest version of the message.
+   auto itFields = pclMsgDef->fields.find(pclMsgDef->latestMessageCrc);
+   if (itFields == pclMsgDef->fields.end())
+   {
+      itFields = pclMsgDef->fields.begin();
+   }
+   std::vector<ProjectedField> vProjectedFields;
+   if (itFields == pclMsgDef->fields.end() || !CompileProjectedFields(itFields->second, vFieldPaths_, vProjectedFields))
+   {
+      return STATUS::NO_DEFINITION;
+   }
+
+   umMyProjectionPaths[pclMsgDef->logID] = vFieldPaths_;
+   return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+MessageDecoder::ClearProjections()
+{
+   umMyProjectionPaths.clear();
+   umMyProjections.clear();
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+MessageDecoder::SetSpecializedDecoder(SpecializedBinaryDecoder pfDecoder_)
+{
+   pfMySpecializedDecoder = pfDecoder_;
+}
+
 // -------------------------------------------------------------------------------------------------------
 STATUS
 MessageDecoder::DecodeAscii(const std::vector<BaseField*> MsgDefFields_, char** ppucLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_)
+{
+   // Find the delimiters once, as the fields are decoded, instead of scanning for each field.
+   clMyAsciiTokenizer.Reset(*ppucLogBuf_);
+   return DecodeAsciiFields(MsgDefFields_, ppucLogBuf_, vIntermediateFormat_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+MessageDecoder::DecodeAsciiFields(const std::vector<BaseField*>& MsgDefFields_, char** ppucLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_)
 {
    STATUS eStatus = STATUS::SUCCESS;
 
    bool bEarlyEndOfMessage = false;
    for (auto& field : MsgDefFields_)
    {
-      size_t tokenLength = strcspn(*ppucLogBuf_, ",*");
+      size_t tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_, AsciiTokenizer::COMMA | AsciiTokenizer::ASTERISK);
       if (static_cast<int8_t>(*(*ppucLogBuf_+tokenLength)) == '*')
          bEarlyEndOfMessage = true;
 
@@ -396,16 +738,16 @@ MessageDecoder::DecodeAscii(const std::vector<BaseField*> MsgDefFields_, char**
       else if (field->type == FIELD_TYPE::STRING) // Handle string type directly
       {
          // It may be possible that there is a field delimiter character in the string, meaning the previous tokenLength value is invalid.
-         tokenLength = strcspn(*ppucLogBuf_ + 1, "\"*"); // Look for LAST '\"' character, skipping past the first.
+         tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_ + 1, AsciiTokenizer::QUOTE | AsciiTokenizer::ASTERISK); // Look for LAST '\"' character, skipping past the first.
          std::string sTemp(*ppucLogBuf_ + 1, tokenLength); // +1 to traverse opening double-quote.
          vIntermediateFormat_.emplace_back(sTemp, field);
          // Skip past the first '\"', string token and the remaining characters ('\"' and ',').
-         *ppucLogBuf_ += 1 + tokenLength + strcspn(*ppucLogBuf_ + tokenLength, ",*");
+         *ppucLogBuf_ += 1 + tokenLength + clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_ + tokenLength, AsciiTokenizer::COMMA | AsciiTokenizer::ASTERISK);
       }
       else if (field->type == FIELD_TYPE::RESPONSE_ID)
       {
          // Ensure we get the whole response (skip over ' ' delimiters in responses)
-         tokenLength = strcspn(*ppucLogBuf_, "*");
+         tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_, AsciiTokenizer::ASTERISK);
          std::string sResponse(*ppucLogBuf_, tokenLength);
          if (sResponse == "OK")
          {
@@ -425,7 +767,7 @@ MessageDecoder::DecodeAscii(const std::vector<BaseField*> MsgDefFields_, char**
       {
          // Response strings aren't surrounded by double quotes
          // Ensure we get the whole response (skip over ' ' delimiters in responses)
-         tokenLength = strcspn(*ppucLogBuf_, "*");
+         tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_, AsciiTokenizer::ASTERISK);
          std::string sTemp(*ppucLogBuf_, tokenLength);
          vIntermediateFormat_.emplace_back(sTemp, field);
          *ppucLogBuf_ += tokenLength + 1;
@@ -441,7 +783,7 @@ MessageDecoder::DecodeAscii(const std::vector<BaseField*> MsgDefFields_, char**
          {
             uiArraySize = static_cast<uint32_t>(strtoul(*ppucLogBuf_, nullptr, 10));
             *ppucLogBuf_ += tokenLength + 1;
-            tokenLength = strcspn(*ppucLogBuf_, ",*");
+            tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_, AsciiTokenizer::COMMA | AsciiTokenizer::ASTERISK);
          }
 
          vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
@@ -460,7 +802,7 @@ MessageDecoder::DecodeAscii(const std::vector<BaseField*> MsgDefFields_, char**
          if (bPrintAsString)
          {
             // Ensure we grabbed the whole string, it might contain delimiters
-            tokenLength = strcspn(*ppucLogBuf_ + 1, "\"*");
+            tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_ + 1, AsciiTokenizer::QUOTE | AsciiTokenizer::ASTERISK);
             tokenLength+=2; // Add the back in the quotes so we process them
             pcPosition++; // Start of string, skip first double-quote
          }
@@ -522,7 +864,7 @@ MessageDecoder::DecodeAscii(const std::vector<BaseField*> MsgDefFields_, char**
                // Simple type
                else
                {
-                  tokenLength = strcspn(*ppucLogBuf_, ",*");
+                  tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_, AsciiTokenizer::COMMA | AsciiTokenizer::ASTERISK);
                   DecodeAsciiField(field, ppucLogBuf_, tokenLength, pvFC);
                   *ppucLogBuf_ += tokenLength + 1;
                }
@@ -548,7 +890,7 @@ MessageDecoder::DecodeAscii(const std::vector<BaseField*> MsgDefFields_, char**
             auto& pvsubFC = std::get<std::vector<FieldContainer>>(pvFieldArrayContainer.back().field_value);
             pvsubFC.reserve((static_cast<const FieldArrayField*>(field))->fields.size());
 
-            eStatus = DecodeAscii(sub_field_defs->fields, ppucLogBuf_, pvsubFC);
+            eStatus = DecodeAsciiFields(sub_field_defs->fields, ppucLogBuf_, pvsubFC);
          }
       }
       else
@@ -568,6 +910,15 @@ MessageDecoder::DecodeAscii(const std::vector<BaseField*> MsgDefFields_, char**
 // -------------------------------------------------------------------------------------------------------
 STATUS
 MessageDecoder::DecodeAbbrevAscii(const std::vector<BaseField*> MsgDefFields_, char** ppucLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_)
+{
+   // Find the delimiters once, as the fields are decoded, instead of scanning for each field.
+   clMyAsciiTokenizer.Reset(*ppucLogBuf_);
+   return DecodeAbbrevAsciiFields(MsgDefFields_, ppucLogBuf_, vIntermediateFormat_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+MessageDecoder::DecodeAbbrevAsciiFields(const std::vector<BaseField*>& MsgDefFields_, char** ppucLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_)
 {
    STATUS eStatus = STATUS::SUCCESS;
 
@@ -575,9 +926,9 @@ MessageDecoder::DecodeAbbrevAscii(const std::vector<BaseField*> MsgDefFields_, c
    {
       for (auto& field : MsgDefFields_)
       {
-         size_t tokenLength = strcspn(*ppucLogBuf_, " \r\n");
+         size_t tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_, AsciiTokenizer::SPACE | AsciiTokenizer::CR | AsciiTokenizer::LF);
          if (ConsumeAbbrevFormatting(tokenLength, ppucLogBuf_))
-            tokenLength = strcspn(*ppucLogBuf_, " \r\n");
+            tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_, AsciiTokenizer::SPACE | AsciiTokenizer::CR | AsciiTokenizer::LF);
          if (tokenLength == 0) // We encountered the end of the buffer unexpectedly
             return STATUS::MALFORMED_INPUT;
 
@@ -595,16 +946,16 @@ MessageDecoder::DecodeAbbrevAscii(const std::vector<BaseField*> MsgDefFields_, c
          else if (field->type == FIELD_TYPE::STRING) // Handle string type directly
          {
             // It may be possible that there is a field delimiter character in the string, meaning the previous tokenLength value is invalid.
-            tokenLength = strcspn(*ppucLogBuf_ + 1, "\"\r"); // Look for LAST '\"' character, skipping past the first.
+            tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_ + 1, AsciiTokenizer::QUOTE | AsciiTokenizer::CR); // Look for LAST '\"' character, skipping past the first.
             std::string sTemp(*ppucLogBuf_ + 1, tokenLength); // +1 to traverse opening double-quote.
             vIntermediateFormat_.emplace_back(sTemp, field);
             // Skip past the first '\"', string token and the remaining characters ('\"' and ',').
-            *ppucLogBuf_ += 1 + tokenLength + strcspn(*ppucLogBuf_ + tokenLength, " \r");
+            *ppucLogBuf_ += 1 + tokenLength + clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_ + tokenLength, AsciiTokenizer::SPACE | AsciiTokenizer::CR);
          }
          else if (field->type == FIELD_TYPE::RESPONSE_ID)
          {
             // Ensure we get the whole response (skip over ',' and ' ' delimiters in responses)
-            tokenLength = strcspn(*ppucLogBuf_, "\r");
+            tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_, AsciiTokenizer::CR);
             std::string sResponse(*ppucLogBuf_, tokenLength);
             if (sResponse == "OK")
             {
@@ -623,7 +974,7 @@ MessageDecoder::DecodeAbbrevAscii(const std::vector<BaseField*> MsgDefFields_, c
          {
             // Response strings aren't surrounded by double quotes
             // Ensure we get the whole response (skip over ' ' delimiters in responses)
-            tokenLength = strcspn(*ppucLogBuf_, "\r");
+            tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_, AsciiTokenizer::CR);
             std::string sTemp(*ppucLogBuf_, tokenLength);
             vIntermediateFormat_.emplace_back(sTemp, field);
             *ppucLogBuf_ += tokenLength + 1;
@@ -647,7 +998,7 @@ MessageDecoder::DecodeAbbrevAscii(const std::vector<BaseField*> MsgDefFields_, c
                }
 
                *ppucLogBuf_ += tokenLength + 1;
-               tokenLength = strcspn(*ppucLogBuf_, " \r");
+               tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_, AsciiTokenizer::SPACE | AsciiTokenizer::CR);
             }
 
             vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
@@ -666,7 +1017,7 @@ MessageDecoder::DecodeAbbrevAscii(const std::vector<BaseField*> MsgDefFields_, c
             if (bPrintAsString)
             {
                // Ensure we grabbed the whole string, it might contain delimiters
-               tokenLength = strcspn(*ppucLogBuf_ + 1, "\"\r");
+               tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_ + 1, AsciiTokenizer::QUOTE | AsciiTokenizer::CR);
                tokenLength+=2; // Add the back in the quotes so we process them
                pcPosition++; // Start of string, skip first double-quote
             }
@@ -728,7 +1079,7 @@ MessageDecoder::DecodeAbbrevAscii(const std::vector<BaseField*> MsgDefFields_, c
                   // Simple type
                   else
                   {
-                     tokenLength = strcspn(*ppucLogBuf_, " \r");
+                     tokenLength = clMyAsciiTokenizer.FindFirstOf(*ppucLogBuf_, AsciiTokenizer::SPACE | AsciiTokenizer::CR);
                      DecodeAsciiField(field, ppucLogBuf_, tokenLength, pvFC);
                      *ppucLogBuf_ += tokenLength + 1;
                   }
@@ -760,7 +1111,7 @@ MessageDecoder::DecodeAbbrevAscii(const std::vector<BaseField*> MsgDefFields_, c
                auto& pvsubFC = std::get<std::vector<FieldContainer>>(pvFieldArrayContainer.back().field_value);
                pvsubFC.reserve((static_cast<const FieldArrayField*>(field))->fields.size());
 
-               eStatus = DecodeAbbrevAscii(sub_field_defs->fields, ppucLogBuf_, pvsubFC);
+               eStatus = DecodeAbbrevAsciiFields(sub_field_defs->fields, ppucLogBuf_, pvsubFC);
                if (eStatus != STATUS::SUCCESS)
                   break;
             }
@@ -1333,7 +1684,11 @@ MessageDecoder::Decode(unsigned char* pucInData_, IntermediateMessage& stInterme
 
       if (!vMsgDef)
       {
-         pclMyLogger->warn("No log definition for ID {}", stMetaData_.usMessageID);
+         uint64_t ullSuppressed = 0;
+         if (pclMyLogger->should_log(spdlog::level::warn) && clMyLogRateLimiter.ShouldLog(1, static_cast<uint32_t>(STATUS::NO_DEFINITION), stMetaData_.usMessageID, ullSuppressed))
+         {
+            pclMyLogger->warn("No log definition for ID {}{}", stMetaData_.usMessageID, LogRateLimiter::Suppressed(ullSuppressed));
+         }
          return STATUS::NO_DEFINITION;
       }
 
@@ -1345,6 +1700,30 @@ MessageDecoder::Decode(unsigned char* pucInData_, IntermediateMessage& stInterme
    stIntermediateMessage_.clear();
    stIntermediateMessage_.reserve(pvCurrentMsgFields->size());
 
+   // Decode only the wanted fields of a projected binary message.
+   if (!stMetaData_.bResponse && !umMyProjectionPaths.empty()
+    && (stMetaData_.eFormat == HEADERFORMAT::BINARY || stMetaData_.eFormat == HEADERFORMAT::SHORT_BINARY))
+   {
+      const auto itPaths = umMyProjectionPaths.find(stMetaData_.usMessageID);
+      if (itPaths != umMyProjectionPaths.end())
+      {
+         return DecodeBinaryProjection(GetProjection(pvCurrentMsgFields, itPaths->second), pucTempInData, stIntermediateMessage_, stMetaData_.uiBinaryMsgLength);
+      }
+   }
+
+   // Decode a binary message with the code generated for its definition, if there is any.
+   if (pfMySpecializedDecoder && !stMetaData_.bResponse
+    && (stMetaData_.eFormat == HEADERFORMAT::BINARY || stMetaData_.eFormat == HEADERFORMAT::SHORT_BINARY))
+   {
+      const STATUS eStatus = pfMySpecializedDecoder(stMetaData_.usMessageID, stMetaData_.uiMessageCRC, *pvCurrentMsgFields, pucTempInData,
+                                                    stMetaData_.uiBinaryMsgLength, stIntermediateMessage_);
+      if (eStatus != STATUS::UNSUPPORTED)
+      {
+         return eStatus;
+      }
+      stIntermediateMessage_.clear();
+   }
+
    // Decode the detected format.
   return stMetaData_.eFormat == HEADERFORMAT::ASCII || stMetaData_.eFormat == HEADERFORMAT::SHORT_ASCII
        ? DecodeAscii(*pvCurrentMsgFields, reinterpret_cast<char**>(&pucTempInData), stIntermediateMessage_)
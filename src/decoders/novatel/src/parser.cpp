@@ -32,6 +32,8 @@
 //-----------------------------------------------------------------------
 #include "parser.hpp"
 
+#include <cstring>
+
 using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
@@ -43,6 +45,7 @@ Parser::Parser(const std::string sDbPath_) :
    pclMyLogger = Logger().RegisterLogger("novatel_parser");
 
    clMyJsonReader.LoadFile(sDbPath_);
+   pclMyJsonDb = &clMyJsonReader;
 
    clMyHeaderDecoder.LoadJsonDb(&clMyJsonReader);
    clMyMessageDecoder.LoadJsonDb(&clMyJsonReader);
@@ -61,7 +64,7 @@ Parser::Parser(const std::string sDbPath_) :
    clMyRxConfigFilter.IncludeMessageId(usRXConfigMsgID,  HEADERFORMAT::ALL, MEASUREMENT_SOURCE::PRIMARY);
    clMyRxConfigFilter.IncludeMessageId(usRXConfigMsgID,  HEADERFORMAT::ALL, MEASUREMENT_SOURCE::SECONDARY);
 
-   pclMyLogger->debug("Parser initialized");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "Parser initialized");
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -72,6 +75,7 @@ Parser::Parser(const std::u32string sDbPath_) :
    pclMyLogger = Logger().RegisterLogger("novatel_parser");
 
    clMyJsonReader.LoadFile(sDbPath_);
+   pclMyJsonDb = &clMyJsonReader;
 
    clMyHeaderDecoder    .LoadJsonDb(&clMyJsonReader);
    clMyMessageDecoder   .LoadJsonDb(&clMyJsonReader);
@@ -90,7 +94,7 @@ Parser::Parser(const std::u32string sDbPath_) :
    clMyRxConfigFilter.IncludeMessageId(usRXConfigMsgID,   HEADERFORMAT::ALL, MEASUREMENT_SOURCE::PRIMARY);
    clMyRxConfigFilter.IncludeMessageId(usRXConfigMsgID,   HEADERFORMAT::ALL, MEASUREMENT_SOURCE::SECONDARY);
 
-   pclMyLogger->debug("Parser initialized");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "Parser initialized");
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -103,9 +107,8 @@ Parser::Parser(JsonReader* pclJsonDb_) :
    if (pclJsonDb_ != nullptr)
    {
       LoadJsonDb(pclJsonDb_);
-      clMyJsonReader = *pclJsonDb_;
    }
-   pclMyLogger->debug("Parser initialized");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "Parser initialized");
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -145,14 +148,21 @@ Parser::LoadJsonDb(JsonReader* pclJsonDb_)
       clMyRxConfigFilter.IncludeMessageId(usRXConfigMsgID,   HEADERFORMAT::ALL, MEASUREMENT_SOURCE::PRIMARY);
       clMyRxConfigFilter.IncludeMessageId(usRXConfigMsgID,   HEADERFORMAT::ALL, MEASUREMENT_SOURCE::SECONDARY);
 
-      clMyJsonReader = *pclJsonDb_;
+      pclMyJsonDb = pclJsonDb_;
    }
    else
    {
-      pclMyLogger->debug("JSON DB is a nullptr.");
+      SPDLOG_LOGGER_DEBUG(pclMyLogger, "JSON DB is a nullptr.");
    }
 }
 
+// -------------------------------------------------------------------------------------------------------
+JsonReader*
+Parser::GetJsonDb()
+{
+   return pclMyJsonDb;
+}
+
 // -------------------------------------------------------------------------------------------------------
 std::shared_ptr<spdlog::logger>
 Parser::GetLogger()
@@ -218,6 +228,34 @@ Parser::GetFilter()
    return pclMyUserFilter;
 }
 
+// -------------------------------------------------------------------------------------------------------
+void
+Parser::SetDeduplicator(Deduplicator* pclDeduplicator_)
+{
+   pclMyDeduplicator = pclDeduplicator_;
+}
+
+// -------------------------------------------------------------------------------------------------------
+Deduplicator*
+Parser::GetDeduplicator()
+{
+   return pclMyDeduplicator;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+Parser::SetEncodeSink(EncodeSink* pclEncodeSink_)
+{
+   pclMyEncodeSink = pclEncodeSink_;
+}
+
+// -------------------------------------------------------------------------------------------------------
+EncodeSink*
+Parser::GetEncodeSink()
+{
+   return pclMyEncodeSink;
+}
+
 // -------------------------------------------------------------------------------------------------------
 void
 Parser::SetDecompressRangeCmp(bool bDecompressRangeCmp_)
@@ -260,6 +298,34 @@ Parser::GetEncodeFormat()
    return eMyEncodeFormat;
 }
 
+// -------------------------------------------------------------------------------------------------------
+void
+Parser::SetEncodeFormats(const std::vector<ENCODEFORMAT>& vFormats_)
+{
+   vMyEncodeFormats = vFormats_;
+
+   const size_t ullFanOutBuffers = vMyEncodeFormats.empty() ? 0 : vMyEncodeFormats.size() - 1;
+   while (vMyFanOutEncodeBuffers.size() < ullFanOutBuffers)
+   {
+      vMyFanOutEncodeBuffers.emplace_back(new unsigned char[uiPARSER_INTERNAL_BUFFER_SIZE]);
+   }
+   vMyFanOutEncodeBuffers.resize(ullFanOutBuffers);
+}
+
+// -------------------------------------------------------------------------------------------------------
+const std::vector<ENCODEFORMAT>&
+Parser::GetEncodeFormats() const
+{
+   return vMyEncodeFormats;
+}
+
+// -------------------------------------------------------------------------------------------------------
+unsigned char*
+Parser::GetEncodeBuffer(size_t ullFormat_)
+{
+   return ullFormat_ == 0 ? pcMyEncodeBuffer : vMyFanOutEncodeBuffers[ullFormat_ - 1].get();
+}
+
 // -------------------------------------------------------------------------------------------------------
 unsigned char*
 Parser::GetInternalBuffer()
@@ -267,15 +333,65 @@ Parser::GetInternalBuffer()
    return pucMyFrameBufferPointer;
 }
 
+// -------------------------------------------------------------------------------------------------------
+void
+Parser::SetAbbrevAsciiCompletion(bool bEnable_, uint32_t uiIdleMilliseconds_)
+{
+   clMyFramer.SetAbbrevAsciiCompletion(bEnable_, uiIdleMilliseconds_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+Parser::GetAbbrevAsciiIdleMilliseconds() const
+{
+   return clMyFramer.GetAbbrevAsciiIdleMilliseconds();
+}
+
 // -------------------------------------------------------------------------------------------------------
 uint32_t Parser::Write(unsigned char* pcData_, uint32_t uiDataSize_)
 {
    return clMyFramer.Write(pcData_, uiDataSize_);
 }
 
+// -------------------------------------------------------------------------------------------------------
+void
+Parser::LogStageStatus(const PARSER_STAGE eStage_, const STATUS eStatus_, const uint32_t uiMessageId_)
+{
+   static constexpr const char* apcStageNames[] = { "Framer", "HeaderDecoder", "Filter", "Deduplicator", "RangeDecompressor", "RxConfigHandler", "MessageDecoder", "Encoder" };
+
+   // Check the level first so a silenced logger costs nothing, then collapse repeats of the same failure.
+   uint64_t ullSuppressed = 0;
+   if (pclMyLogger->should_log(spdlog::level::info) &&
+       clMyLogRateLimiter.ShouldLog(static_cast<uint32_t>(eStage_), static_cast<uint32_t>(eStatus_), uiMessageId_, ullSuppressed))
+   {
+      pclMyLogger->info("{} returned status {} for message ID {}{}", apcStageNames[static_cast<uint32_t>(eStage_)], static_cast<int32_t>(eStatus_), uiMessageId_, LogRateLimiter::Suppressed(ullSuppressed));
+   }
+}
+
 // -------------------------------------------------------------------------------------------------------
 STATUS
 Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, bool bDecodeIncompleteAbbv)
+{
+   return ReadFormats(&stMessageData_, &eMyEncodeFormat, 1, stMetaData_, bDecodeIncompleteAbbv);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Parser::Read(std::vector<MessageDataStruct>& vMessageData_, MetaDataStruct& stMetaData_, bool bDecodeIncompleteAbbv)
+{
+   if (vMyEncodeFormats.empty())
+   {
+      vMessageData_.resize(1);
+      return Read(vMessageData_.front(), stMetaData_, bDecodeIncompleteAbbv);
+   }
+
+   vMessageData_.resize(vMyEncodeFormats.size());
+   return ReadFormats(vMessageData_.data(), vMyEncodeFormats.data(), vMyEncodeFormats.size(), stMetaData_, bDecodeIncompleteAbbv);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Parser::ReadFormats(MessageDataStruct* astMessageData_, const ENCODEFORMAT* aeFormats_, size_t ullFormatCount_, MetaDataStruct& stMetaData_, bool bDecodeIncompleteAbbv_)
 {
    STATUS eStatus = STATUS::UNKNOWN;
 
@@ -285,8 +401,9 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
    while (true)
    {
       pucMyFrameBufferPointer = pcMyFrameBuffer; //!< Reset the buffer.
-      pucMyEncodeBufferPointer = pcMyEncodeBuffer; //!< Reset the buffer.
+      uint64_t ullStageStart = clMyStatistics.StageStart();
       eStatus = clMyFramer.GetFrame(pucMyFrameBufferPointer, uiPARSER_INTERNAL_BUFFER_SIZE, stMetaData_);
+      clMyStatistics.StageEnd(PARSER_STAGE::FRAMER, ullStageStart);
 
       // Datasets ending with a Abbv ASCII message will always return a incomplete framing status
       // as there is no delimiter marking the end of the log.
@@ -294,7 +411,7 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
       // HEADERFORMAT::ABB_ASCII or HEADERFORMAT::SHORT_ABB_ASCII then flush the framer and attempt to
       // decode that data.
 
-      if (bDecodeIncompleteAbbv
+      if (bDecodeIncompleteAbbv_
          && eStatus == STATUS::INCOMPLETE
          && (stMetaData_.eFormat == HEADERFORMAT::ABB_ASCII || stMetaData_.eFormat == HEADERFORMAT::SHORT_ABB_ASCII))
       {
@@ -308,14 +425,23 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
 
       if (eStatus == STATUS::UNKNOWN)
       {
-         stMessageData_.uiMessageHeaderLength = 0;
-         stMessageData_.uiMessageBodyLength = 0;
+         clMyStatistics.CountUnknownBytes(stMetaData_.uiLength);
+         for (size_t ullFormat = 0; ullFormat < ullFormatCount_; ullFormat++)
+         {
+            MessageDataStruct& stMessageData = astMessageData_[ullFormat];
+            stMessageData.uiMessageHeaderLength = 0;
+            stMessageData.uiMessageBodyLength = 0;
+
+            if (bMyReturnUnknownBytes)
+            {
+               stMessageData.pucMessageHeader = pucMyFrameBufferPointer;
+               stMessageData.uiMessageHeaderLength = stMetaData_.uiLength;
+               stMessageData.pucMessageBody = nullptr;
+            }
+         }
 
          if (bMyReturnUnknownBytes)
          {
-            stMessageData_.pucMessageHeader = pucMyFrameBufferPointer;
-            stMessageData_.uiMessageHeaderLength = stMetaData_.uiLength;
-            stMessageData_.pucMessageBody = nullptr;
             break;
          }
       }
@@ -323,34 +449,62 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
       {
          if ((!bMyIgnoreAbbreviatedASCIIResponse) && (stMetaData_.bResponse) && (stMetaData_.eFormat == HEADERFORMAT::ABB_ASCII))
          {
-            stMessageData_.uiMessageHeaderLength = 0;
-            stMessageData_.pucMessageHeader = nullptr;
-            stMessageData_.uiMessageBodyLength = 0;
-            stMessageData_.pucMessageBody = nullptr;
-            stMessageData_.pucMessage = pucMyFrameBufferPointer;
-            stMessageData_.uiMessageLength = stMetaData_.uiLength;
+            for (size_t ullFormat = 0; ullFormat < ullFormatCount_; ullFormat++)
+            {
+               MessageDataStruct& stMessageData = astMessageData_[ullFormat];
+               stMessageData.uiMessageHeaderLength = 0;
+               stMessageData.pucMessageHeader = nullptr;
+               stMessageData.uiMessageBodyLength = 0;
+               stMessageData.pucMessageBody = nullptr;
+               stMessageData.pucMessage = pucMyFrameBufferPointer;
+               stMessageData.uiMessageLength = stMetaData_.uiLength;
+            }
+            clMyStatistics.CountHeaderFormat(stMetaData_.eFormat);
+            clMyStatistics.CountReadStatus(eStatus);
             return eStatus;
          }
 
+         ullStageStart = clMyStatistics.StageStart();
          eStatus = clMyHeaderDecoder.Decode(pucMyFrameBufferPointer, stHeader, stMetaData_);
+         clMyStatistics.StageEnd(PARSER_STAGE::HEADER_DECODER, ullStageStart);
          if (eStatus == STATUS::SUCCESS)
          {
-            if ((pclMyUserFilter != nullptr) && (!pclMyUserFilter->DoFiltering(stMetaData_)))
+            clMyStatistics.CountHeaderFormat(stMetaData_.eFormat);
+            clMyStatistics.CountMessageId(stMetaData_.usMessageID);
+            if (pclMyUserFilter != nullptr)
             {
-               continue;
+               ullStageStart = clMyStatistics.StageStart();
+               const bool bKeep = pclMyUserFilter->DoFiltering(stMetaData_, pucMyFrameBufferPointer + stMetaData_.uiHeaderLength);
+               clMyStatistics.StageEnd(PARSER_STAGE::FILTER, ullStageStart);
+               if (!bKeep)
+               {
+                  continue;
+               }
+            }
+            if (pclMyDeduplicator != nullptr)
+            {
+               ullStageStart = clMyStatistics.StageStart();
+               const bool bDuplicate = pclMyDeduplicator->IsDuplicate(stHeader, stMetaData_, pucMyFrameBufferPointer);
+               clMyStatistics.StageEnd(PARSER_STAGE::DEDUPLICATOR, ullStageStart);
+               if (bDuplicate)
+               {
+                  continue;
+               }
             }
 
             // Should we decompress this?
             if (clMyRangeCmpFilter.DoFiltering(stMetaData_) && bMyDecompressRangeCmp)
             {
+               ullStageStart = clMyStatistics.StageStart();
                eStatus = clMyRangeDecompressor.Decompress(pucMyFrameBufferPointer, uiPARSER_INTERNAL_BUFFER_SIZE, stMetaData_);
+               clMyStatistics.StageEnd(PARSER_STAGE::RANGE_DECOMPRESSOR, ullStageStart);
                if (eStatus == STATUS::SUCCESS)
                {
                   stHeader.usMessageID = stMetaData_.usMessageID;
                }
                else
                {
-                  pclMyLogger->info("RangeDecompressor returned status {}\n", static_cast<int32_t>(eStatus));
+                  LogStageStatus(PARSER_STAGE::RANGE_DECOMPRESSOR, eStatus, stMetaData_.usMessageID);
                   break;
                }
                // Continue if we succeeded.
@@ -358,23 +512,41 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
 
             if (clMyRxConfigFilter.DoFiltering(stMetaData_))
             {
-               // Use some dummy stuff for the embedded message.  The parser won't handle that now.
-               MessageDataStruct stEmbeddedMessageData;
-               MetaDataStruct stEmbeddedMetaData;
-               clMyRxConfigHandler.Write(pucMyFrameBufferPointer, stMetaData_.uiLength);
-               eStatus = clMyRxConfigHandler.Convert(stMessageData_, stMetaData_, stEmbeddedMessageData, stEmbeddedMetaData, eMyEncodeFormat);
+               ullStageStart = clMyStatistics.StageStart();
+               eStatus = ConvertRxConfig(astMessageData_, aeFormats_, ullFormatCount_, stMetaData_);
+               if (eStatus == STATUS::SUCCESS && pclMyEncodeSink != nullptr)
+               {
+                  eStatus = pclMyEncodeSink->Append(astMessageData_[0]);
+               }
+               clMyStatistics.StageEnd(PARSER_STAGE::RXCONFIG_HANDLER, ullStageStart);
                if (eStatus != STATUS::SUCCESS)
                {
-                  pclMyLogger->info("RxConfigHandler returned status {}\n", static_cast<int32_t>(eStatus));
+                  LogStageStatus(PARSER_STAGE::RXCONFIG_HANDLER, eStatus, stMetaData_.usMessageID);
                }
                break;
             }
 
             pucMyFrameBufferPointer += stMetaData_.uiHeaderLength;
+            ullStageStart = clMyStatistics.StageStart();
             eStatus = clMyMessageDecoder.Decode(pucMyFrameBufferPointer, stMessage, stMetaData_);
+            clMyStatistics.StageEnd(PARSER_STAGE::MESSAGE_DECODER, ullStageStart);
             if (eStatus == STATUS::SUCCESS)
             {
-               eStatus = clMyEncoder.Encode(&pucMyEncodeBufferPointer, uiPARSER_INTERNAL_BUFFER_SIZE, stHeader, stMessage, stMessageData_, stMetaData_, eMyEncodeFormat);
+               ullStageStart = clMyStatistics.StageStart();
+               // Every format is encoded from the one decoded message.
+               for (size_t ullFormat = 0; ullFormat < ullFormatCount_ && eStatus == STATUS::SUCCESS; ullFormat++)
+               {
+                  if (ullFormat == 0 && pclMyEncodeSink != nullptr)
+                  {
+                     eStatus = clMyEncoder.Encode(*pclMyEncodeSink, stHeader, stMessage, astMessageData_[ullFormat], stMetaData_, aeFormats_[ullFormat]);
+                  }
+                  else
+                  {
+                     unsigned char* pucEncodeBuffer = GetEncodeBuffer(ullFormat);
+                     eStatus = clMyEncoder.Encode(&pucEncodeBuffer, uiPARSER_INTERNAL_BUFFER_SIZE, stHeader, stMessage, astMessageData_[ullFormat], stMetaData_, aeFormats_[ullFormat]);
+                  }
+               }
+               clMyStatistics.StageEnd(PARSER_STAGE::ENCODER, ullStageStart);
                if (eStatus == STATUS::SUCCESS)
                {
                   eStatus = STATUS::SUCCESS;
@@ -382,17 +554,17 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
                }
                else
                {
-                  pclMyLogger->info("Encoder returned status {}\n", static_cast<int32_t>(eStatus));
+                  LogStageStatus(PARSER_STAGE::ENCODER, eStatus, stMetaData_.usMessageID);
                }
             }
             else
             {
-               pclMyLogger->info("MessageDecoder returned status {}\n", static_cast<int32_t>(eStatus));
+               LogStageStatus(PARSER_STAGE::MESSAGE_DECODER, eStatus, stMetaData_.usMessageID);
             }
          }
          else
          {
-            pclMyLogger->info("HeaderDecoder returned status {}\n", static_cast<int32_t>(eStatus));
+            LogStageStatus(PARSER_STAGE::HEADER_DECODER, eStatus, stMetaData_.usMessageID);
          }
       }
       else if (eStatus == STATUS::INCOMPLETE || eStatus == STATUS::BUFFER_EMPTY)
@@ -402,13 +574,75 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
       }
       else
       {
-         pclMyLogger->info("Framer returned status {}\n", static_cast<int32_t>(eStatus));
+         LogStageStatus(PARSER_STAGE::FRAMER, eStatus, 0);
       }
    }
 
+   clMyStatistics.CountReadStatus(eStatus);
    return eStatus;
 }
 
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Parser::ConvertRxConfig(MessageDataStruct* astMessageData_, const ENCODEFORMAT* aeFormats_, size_t ullFormatCount_, MetaDataStruct& stMetaData_)
+{
+   // Use some dummy stuff for the embedded message.  The parser won't handle that now.
+   MessageDataStruct stEmbeddedMessageData;
+   MetaDataStruct stEmbeddedMetaData;
+
+   // The log is already framed, so hand it over directly rather than re-framing it in the handler.
+   if (ullFormatCount_ == 1)
+   {
+      return clMyRxConfigHandler.Convert(pucMyFrameBufferPointer, astMessageData_[0], stMetaData_, stEmbeddedMessageData, stEmbeddedMetaData, aeFormats_[0]);
+   }
+
+   // The handler edits the frame it converts and encodes into a buffer of its
+   // own, so convert a copy of the frame for each format and move the result
+   // into that format's buffer.
+   const uint32_t uiFrameLength = stMetaData_.uiLength;
+   for (size_t ullFormat = 0; ullFormat < ullFormatCount_; ullFormat++)
+   {
+      unsigned char* pucEncodeBuffer = GetEncodeBuffer(ullFormat);
+      MessageDataStruct& stMessageData = astMessageData_[ullFormat];
+      memcpy(pucEncodeBuffer, pucMyFrameBufferPointer, uiFrameLength);
+
+      const STATUS eStatus = clMyRxConfigHandler.Convert(pucEncodeBuffer, stMessageData, stMetaData_, stEmbeddedMessageData, stEmbeddedMetaData, aeFormats_[ullFormat]);
+      if (eStatus != STATUS::SUCCESS)
+      {
+         return eStatus;
+      }
+
+      const unsigned char* pucConverted = stMessageData.pucMessage;
+      memcpy(pucEncodeBuffer, pucConverted, stMessageData.uiMessageLength);
+      stMessageData.pucMessage = pucEncodeBuffer;
+      stMessageData.pucMessageHeader = pucEncodeBuffer + (stMessageData.pucMessageHeader - pucConverted);
+      stMessageData.pucMessageBody = pucEncodeBuffer + (stMessageData.pucMessageBody - pucConverted);
+   }
+
+   return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+Parser::EnableStatistics(bool bEnable_)
+{
+   clMyStatistics.SetEnabled(bEnable_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+ParserStatistics
+Parser::GetStatistics() const
+{
+   return clMyStatistics.GetSnapshot();
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+Parser::ResetStatistics()
+{
+   clMyStatistics.Reset();
+}
+
 // -------------------------------------------------------------------------------------------------------
 uint32_t
 Parser::Flush(unsigned char* pucBuffer_, uint32_t uiBufferSize_)
@@ -0,0 +1,629 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file pipelined_parser.cpp
+//! \brief Parse bytes for OEM logs, decoding and encoding on worker threads.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <cstring>
+
+#include "pipelined_parser.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+// -------------------------------------------------------------------------------------------------------
+PipelinedParser::Worker::Worker(JsonReader* pclJsonDb_, uint32_t uiQueueDepth_) :
+   clMessageDecoder(pclJsonDb_),
+   clEncoder(pclJsonDb_),
+   clRangeDecompressor(pclJsonDb_),
+   clRxConfigHandler(pclJsonDb_),
+   clQueue(uiQueueDepth_)
+{
+}
+
+// -------------------------------------------------------------------------------------------------------
+static uint32_t RoundUpToPowerOfTwo(uint32_t uiValue_)
+{
+   uint32_t uiPower = 1;
+   while (uiPower < uiValue_)
+   {
+      uiPower <<= 1;
+   }
+   return uiPower;
+}
+
+// -------------------------------------------------------------------------------------------------------
+PipelinedParser::PipelinedParser(const std::string sDbPath_, uint32_t uiWorkerCount_, uint32_t uiQueueDepth_) :
+   uiMyQueueDepth(RoundUpToPowerOfTwo(uiQueueDepth_)),
+   pstMySlots(new Slot[uiMyQueueDepth])
+{
+   clMyJsonReader.LoadFile(sDbPath_);
+   pclMyJsonDb = &clMyJsonReader;
+   Start(uiWorkerCount_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+PipelinedParser::PipelinedParser(JsonReader* pclJsonDb_, uint32_t uiWorkerCount_, uint32_t uiQueueDepth_) :
+   pclMyJsonDb(pclJsonDb_),
+   uiMyQueueDepth(RoundUpToPowerOfTwo(uiQueueDepth_)),
+   pstMySlots(new Slot[uiMyQueueDepth])
+{
+   Start(uiWorkerCount_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::Start(uint32_t uiWorkerCount_)
+{
+   pclMyLogger = Logger().RegisterLogger("novatel_pipelined_parser");
+
+   clMyHeaderDecoder.LoadJsonDb(pclMyJsonDb);
+
+   clMyRangeCmpFilter.IncludeMessageId(RANGECMP_MSG_ID,  HEADERFORMAT::ALL, MEASUREMENT_SOURCE::PRIMARY);
+   clMyRangeCmpFilter.IncludeMessageId(RANGECMP_MSG_ID,  HEADERFORMAT::ALL, MEASUREMENT_SOURCE::SECONDARY);
+   clMyRangeCmpFilter.IncludeMessageId(RANGECMP2_MSG_ID, HEADERFORMAT::ALL, MEASUREMENT_SOURCE::PRIMARY);
+   clMyRangeCmpFilter.IncludeMessageId(RANGECMP2_MSG_ID, HEADERFORMAT::ALL, MEASUREMENT_SOURCE::SECONDARY);
+   clMyRangeCmpFilter.IncludeMessageId(RANGECMP3_MSG_ID, HEADERFORMAT::ALL, MEASUREMENT_SOURCE::PRIMARY);
+   clMyRangeCmpFilter.IncludeMessageId(RANGECMP3_MSG_ID, HEADERFORMAT::ALL, MEASUREMENT_SOURCE::SECONDARY);
+   clMyRangeCmpFilter.IncludeMessageId(RANGECMP4_MSG_ID, HEADERFORMAT::ALL, MEASUREMENT_SOURCE::PRIMARY);
+   clMyRangeCmpFilter.IncludeMessageId(RANGECMP4_MSG_ID, HEADERFORMAT::ALL, MEASUREMENT_SOURCE::SECONDARY);
+   clMyRxConfigFilter.IncludeMessageId(usRXConfigMsgID,  HEADERFORMAT::ALL, MEASUREMENT_SOURCE::PRIMARY);
+   clMyRxConfigFilter.IncludeMessageId(usRXConfigMsgID,  HEADERFORMAT::ALL, MEASUREMENT_SOURCE::SECONDARY);
+
+   if (uiWorkerCount_ == 0)
+   {
+      // Leave a core each for the framing thread and the reader.
+      const uint32_t uiCores = std::thread::hardware_concurrency();
+      uiWorkerCount_ = uiCores > 3 ? uiCores - 2 : 1;
+   }
+
+   for (uint32_t i = 0; i < uiWorkerCount_; i++)
+   {
+      vpclMyWorkers.emplace_back(std::make_unique<Worker>(pclMyJsonDb, uiMyQueueDepth));
+   }
+   for (auto& pclWorker : vpclMyWorkers)
+   {
+      pclWorker->clThread = std::thread(&PipelinedParser::RunWorker, this, std::ref(*pclWorker));
+   }
+   clMyFramingThread = std::thread(&PipelinedParser::RunFramer, this);
+
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "PipelinedParser initialized with {} workers", uiWorkerCount_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+PipelinedParser::~PipelinedParser()
+{
+   {
+      std::lock_guard<std::mutex> clLock(clMyInputMutex);
+      bMyStop = true;
+   }
+   clMyInputCondition.notify_all();
+
+   for (auto& pclWorker : vpclMyWorkers)
+   {
+      {
+         std::lock_guard<std::mutex> clLock(pclWorker->clMutex);
+      }
+      pclWorker->clCondition.notify_one();
+   }
+
+   clMyFramingThread.join();
+   for (auto& pclWorker : vpclMyWorkers)
+   {
+      pclWorker->clThread.join();
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+std::shared_ptr<spdlog::logger>
+PipelinedParser::GetLogger()
+{
+   return pclMyLogger;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::SetLoggerLevel(spdlog::level::level_enum eLevel_)
+{
+   pclMyLogger->set_level(eLevel_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+PipelinedParser::GetWorkerCount() const
+{
+   return static_cast<uint32_t>(vpclMyWorkers.size());
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::SetIgnoreAbbreviatedAsciiResponses(bool bIgnoreAbbreivatedAsciiResponses_)
+{
+   bMyIgnoreAbbreviatedASCIIResponse = bIgnoreAbbreivatedAsciiResponses_;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+PipelinedParser::GetIgnoreAbbreviatedAsciiResponses()
+{
+   return bMyIgnoreAbbreviatedASCIIResponse;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::SetDecompressRangeCmp(bool bDecompressRangeCmp_)
+{
+   bMyDecompressRangeCmp = bDecompressRangeCmp_;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+PipelinedParser::GetDecompressRangeCmp()
+{
+   return bMyDecompressRangeCmp;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::SetReturnUnknownBytes(bool bReturnUnknownBytes_)
+{
+   bMyReturnUnknownBytes = bReturnUnknownBytes_;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+PipelinedParser::GetReturnUnknownBytes()
+{
+   return bMyReturnUnknownBytes;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::SetEncodeFormat(ENCODEFORMAT eFormat_)
+{
+   eMyEncodeFormat = eFormat_;
+}
+
+// -------------------------------------------------------------------------------------------------------
+ENCODEFORMAT
+PipelinedParser::GetEncodeFormat()
+{
+   return eMyEncodeFormat;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::SetFilter(Filter* pclFilter_)
+{
+   pclMyUserFilter = pclFilter_;
+}
+
+// -------------------------------------------------------------------------------------------------------
+Filter*
+PipelinedParser::GetFilter()
+{
+   return pclMyUserFilter;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::LogStageStatus(LogRateLimiter& clLogRateLimiter_, const PARSER_STAGE eStage_, const STATUS eStatus_, const uint32_t uiMessageId_)
+{
+   static constexpr const char* apcStageNames[] = { "Framer", "HeaderDecoder", "Filter", "Deduplicator", "RangeDecompressor", "RxConfigHandler", "MessageDecoder", "Encoder" };
+
+   uint64_t ullSuppressed = 0;
+   if (pclMyLogger->should_log(spdlog::level::info) &&
+       clLogRateLimiter_.ShouldLog(static_cast<uint32_t>(eStage_), static_cast<uint32_t>(eStatus_), uiMessageId_, ullSuppressed))
+   {
+      pclMyLogger->info("{} returned status {} for message ID {}{}", apcStageNames[static_cast<uint32_t>(eStage_)], static_cast<int32_t>(eStatus_), uiMessageId_, LogRateLimiter::Suppressed(ullSuppressed));
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::NotifyReader()
+{
+   // Take the lock so the notification cannot fall between the reader
+   // checking its predicate and going to sleep.
+   {
+      std::lock_guard<std::mutex> clLock(clMyReaderMutex);
+   }
+   clMyReaderCondition.notify_one();
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+PipelinedParser::Write(unsigned char* pucData_, uint32_t uiDataSize_)
+{
+   {
+      std::lock_guard<std::mutex> clLock(clMyInputMutex);
+      vMyPendingInput.insert(vMyPendingInput.end(), pucData_, pucData_ + uiDataSize_);
+      bMyFramerIdle.store(false, std::memory_order_release);
+   }
+   clMyInputCondition.notify_all();
+   return uiDataSize_;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::RunFramer()
+{
+   std::vector<unsigned char> vInput;
+   std::unique_lock<std::mutex> clLock(clMyInputMutex);
+
+   while (!bMyStop)
+   {
+      if (bMyPauseRequested)
+      {
+         bMyPaused = true;
+         clMyInputCondition.notify_all();
+         clMyInputCondition.wait(clLock, [this] { return !bMyPauseRequested || bMyStop; });
+         bMyPaused = false;
+         continue;
+      }
+
+      if (vMyPendingInput.empty())
+      {
+         // Everything written so far has been framed.
+         bMyFramerIdle.store(true, std::memory_order_release);
+         NotifyReader();
+         clMyInputCondition.wait(clLock, [this] { return bMyStop || bMyPauseRequested || !vMyPendingInput.empty(); });
+         continue;
+      }
+
+      vInput.swap(vMyPendingInput);
+      clLock.unlock();
+      clMyFramer.Write(vInput.data(), static_cast<uint32_t>(vInput.size()));
+      vInput.clear();
+      clLock.lock();
+
+      FrameLogs(clLock);
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::FrameLogs(std::unique_lock<std::mutex>& clLock_)
+{
+   while (true)
+   {
+      const uint64_t ullSequence = ullMyFramedSequence.load(std::memory_order_relaxed);
+      Slot& stSlot = GetSlot(ullSequence);
+
+      clMyInputCondition.wait(clLock_, [this, &stSlot] {
+         return bMyStop || bMyPauseRequested || stSlot.eState.load(std::memory_order_acquire) == SLOT_STATE::FREE; });
+      if (bMyStop || bMyPauseRequested)
+      {
+         return;
+      }
+
+      clLock_.unlock();
+      const bool bFramed = FrameLog(stSlot, ullSequence);
+      clLock_.lock();
+
+      if (!bFramed)
+      {
+         return;
+      }
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool
+PipelinedParser::FrameLog(Slot& stSlot_, uint64_t ullSequence_)
+{
+   unsigned char* pucFrameBuffer = stSlot_.pucFrameBuffer.get();
+   MetaDataStruct& stMetaData = stSlot_.stMetaData;
+   stSlot_.stMessageData = MessageDataStruct();
+   stSlot_.bDropped = false;
+
+   STATUS eStatus = clMyFramer.GetFrame(pucFrameBuffer, Parser::uiPARSER_INTERNAL_BUFFER_SIZE, stMyFramerMetaData);
+
+   if (eStatus == STATUS::INCOMPLETE || eStatus == STATUS::BUFFER_EMPTY)
+   {
+      return false;
+   }
+   stMetaData = stMyFramerMetaData;
+
+   if (eStatus == STATUS::UNKNOWN)
+   {
+      if (bMyReturnUnknownBytes)
+      {
+         stSlot_.stMessageData.pucMessageHeader = pucFrameBuffer;
+         stSlot_.stMessageData.uiMessageHeaderLength = stMetaData.uiLength;
+         stSlot_.eStatus = STATUS::UNKNOWN;
+         stSlot_.eState.store(SLOT_STATE::DONE, std::memory_order_release);
+         ullMyFramedSequence.store(ullSequence_ + 1, std::memory_order_release);
+         NotifyReader();
+      }
+      return true;
+   }
+
+   if (eStatus != STATUS::SUCCESS)
+   {
+      LogStageStatus(clMyLogRateLimiter, PARSER_STAGE::FRAMER, eStatus, 0);
+      return true;
+   }
+
+   if (!bMyIgnoreAbbreviatedASCIIResponse && stMetaData.bResponse && stMetaData.eFormat == HEADERFORMAT::ABB_ASCII)
+   {
+      stSlot_.stMessageData.pucMessage = pucFrameBuffer;
+      stSlot_.stMessageData.uiMessageLength = stMetaData.uiLength;
+      stSlot_.eStatus = STATUS::SUCCESS;
+      stSlot_.eState.store(SLOT_STATE::DONE, std::memory_order_release);
+      ullMyFramedSequence.store(ullSequence_ + 1, std::memory_order_release);
+      NotifyReader();
+      return true;
+   }
+
+   eStatus = clMyHeaderDecoder.Decode(pucFrameBuffer, stSlot_.stHeader, stMetaData);
+   if (eStatus != STATUS::SUCCESS)
+   {
+      LogStageStatus(clMyLogRateLimiter, PARSER_STAGE::HEADER_DECODER, eStatus, stMetaData.usMessageID);
+      return true;
+   }
+
+   Filter* pclUserFilter = pclMyUserFilter;
+   if (pclUserFilter != nullptr && !pclUserFilter->DoFiltering(stMetaData, pucFrameBuffer + stMetaData.uiHeaderLength))
+   {
+      return true;
+   }
+
+   if (clMyRangeCmpFilter.DoFiltering(stMetaData) && bMyDecompressRangeCmp)
+   {
+      stSlot_.eAction = SLOT_ACTION::DECOMPRESS;
+   }
+   else if (clMyRxConfigFilter.DoFiltering(stMetaData))
+   {
+      stSlot_.eAction = SLOT_ACTION::RXCONFIG;
+   }
+   else
+   {
+      stSlot_.eAction = SLOT_ACTION::DECODE;
+   }
+   stSlot_.eEncodeFormat = eMyEncodeFormat;
+
+   Dispatch(stSlot_, ullSequence_);
+   return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::Dispatch(Slot& stSlot_, uint64_t ullSequence_)
+{
+   // RANGECMP logs carry lock time history between logs of the same
+   // measurement source, so each source is pinned to one worker.  Everything
+   // else goes to the worker with the shortest queue.
+   Worker* pclWorker = nullptr;
+   if (stSlot_.eAction == SLOT_ACTION::DECOMPRESS)
+   {
+      pclWorker = vpclMyWorkers[static_cast<uint32_t>(stSlot_.stMetaData.eMeasurementSource) % vpclMyWorkers.size()].get();
+   }
+   else
+   {
+      pclWorker = vpclMyWorkers.front().get();
+      for (auto& pclCandidate : vpclMyWorkers)
+      {
+         if (pclCandidate->clQueue.Size() < pclWorker->clQueue.Size())
+         {
+            pclWorker = pclCandidate.get();
+         }
+      }
+   }
+
+   stSlot_.eState.store(SLOT_STATE::DECODING, std::memory_order_relaxed);
+   uiMyInFlight.fetch_add(1, std::memory_order_relaxed);
+   // Each worker queue holds as many entries as there are slots, so this
+   // cannot fail.
+   static_cast<void>(pclWorker->clQueue.TryPush(static_cast<uint32_t>(ullSequence_ & (uiMyQueueDepth - 1))));
+   ullMyFramedSequence.store(ullSequence_ + 1, std::memory_order_release);
+
+   {
+      std::lock_guard<std::mutex> clLock(pclWorker->clMutex);
+   }
+   pclWorker->clCondition.notify_one();
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::RunWorker(Worker& clWorker_)
+{
+   uint32_t uiSlot = 0;
+   while (true)
+   {
+      if (!clWorker_.clQueue.TryPop(uiSlot))
+      {
+         std::unique_lock<std::mutex> clLock(clWorker_.clMutex);
+         clWorker_.clCondition.wait(clLock, [this, &clWorker_] { return bMyStop || !clWorker_.clQueue.IsEmpty(); });
+         if (bMyStop)
+         {
+            return;
+         }
+         continue;
+      }
+
+      Slot& stSlot = pstMySlots[uiSlot];
+      ProcessSlot(clWorker_, stSlot);
+      stSlot.eState.store(SLOT_STATE::DONE, std::memory_order_release);
+      uiMyInFlight.fetch_sub(1, std::memory_order_acq_rel);
+      NotifyReader();
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::ProcessSlot(Worker& clWorker_, Slot& stSlot_)
+{
+   unsigned char* pucFrameBuffer = stSlot_.pucFrameBuffer.get();
+   MetaDataStruct& stMetaData = stSlot_.stMetaData;
+   STATUS eStatus = STATUS::UNKNOWN;
+
+   if (stSlot_.eAction == SLOT_ACTION::DECOMPRESS)
+   {
+      eStatus = clWorker_.clRangeDecompressor.Decompress(pucFrameBuffer, Parser::uiPARSER_INTERNAL_BUFFER_SIZE, stMetaData);
+      if (eStatus != STATUS::SUCCESS)
+      {
+         // Parser returns decompression failures to the caller.
+         LogStageStatus(clWorker_.clLogRateLimiter, PARSER_STAGE::RANGE_DECOMPRESSOR, eStatus, stMetaData.usMessageID);
+         stSlot_.eStatus = eStatus;
+         return;
+      }
+      stSlot_.stHeader.usMessageID = stMetaData.usMessageID;
+   }
+   else if (stSlot_.eAction == SLOT_ACTION::RXCONFIG)
+   {
+      MessageDataStruct stEmbeddedMessageData;
+      MetaDataStruct stEmbeddedMetaData;
+      MessageDataStruct& stMessageData = stSlot_.stMessageData;
+      eStatus = clWorker_.clRxConfigHandler.Convert(pucFrameBuffer, stMessageData, stMetaData, stEmbeddedMessageData, stEmbeddedMetaData, stSlot_.eEncodeFormat);
+      if (eStatus == STATUS::SUCCESS)
+      {
+         // The handler reuses its own buffer for the next RXCONFIG, so move
+         // the result into the slot.
+         unsigned char* pucSource = stMessageData.pucMessage;
+         unsigned char* pucTarget = stSlot_.pucEncodeBuffer.get();
+         memcpy(pucTarget, pucSource, stMessageData.uiMessageLength);
+         stMessageData.pucMessage = pucTarget;
+         stMessageData.pucMessageHeader = pucTarget + (stMessageData.pucMessageHeader - pucSource);
+         stMessageData.pucMessageBody = pucTarget + (stMessageData.pucMessageBody - pucSource);
+      }
+      else
+      {
+         LogStageStatus(clWorker_.clLogRateLimiter, PARSER_STAGE::RXCONFIG_HANDLER, eStatus, stMetaData.usMessageID);
+      }
+      stSlot_.eStatus = eStatus;
+      return;
+   }
+
+   clWorker_.stMessage.clear();
+   eStatus = clWorker_.clMessageDecoder.Decode(pucFrameBuffer + stMetaData.uiHeaderLength, clWorker_.stMessage, stMetaData);
+   if (eStatus != STATUS::SUCCESS)
+   {
+      LogStageStatus(clWorker_.clLogRateLimiter, PARSER_STAGE::MESSAGE_DECODER, eStatus, stMetaData.usMessageID);
+      stSlot_.bDropped = true;
+      return;
+   }
+
+   unsigned char* pucEncodeBuffer = stSlot_.pucEncodeBuffer.get();
+   eStatus = clWorker_.clEncoder.Encode(&pucEncodeBuffer, Parser::uiPARSER_INTERNAL_BUFFER_SIZE, stSlot_.stHeader, clWorker_.stMessage, stSlot_.stMessageData, stMetaData, stSlot_.eEncodeFormat);
+   if (eStatus != STATUS::SUCCESS)
+   {
+      LogStageStatus(clWorker_.clLogRateLimiter, PARSER_STAGE::ENCODER, eStatus, stMetaData.usMessageID);
+      stSlot_.bDropped = true;
+      return;
+   }
+   stSlot_.eStatus = STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void
+PipelinedParser::ReleaseSlot()
+{
+   if (!bMyHoldingSlot)
+   {
+      return;
+   }
+
+   GetSlot(ullMyReadSequence).eState.store(SLOT_STATE::FREE, std::memory_order_release);
+   ullMyReadSequence++;
+   bMyHoldingSlot = false;
+
+   {
+      std::lock_guard<std::mutex> clLock(clMyInputMutex);
+   }
+   clMyInputCondition.notify_all();
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+PipelinedParser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_)
+{
+   ReleaseSlot();
+
+   while (true)
+   {
+      Slot& stSlot = GetSlot(ullMyReadSequence);
+      {
+         std::unique_lock<std::mutex> clLock(clMyReaderMutex);
+         clMyReaderCondition.wait(clLock, [this, &stSlot] {
+            return stSlot.eState.load(std::memory_order_acquire) == SLOT_STATE::DONE
+                || (bMyFramerIdle.load(std::memory_order_acquire) && ullMyFramedSequence.load(std::memory_order_acquire) == ullMyReadSequence); });
+      }
+
+      if (stSlot.eState.load(std::memory_order_acquire) != SLOT_STATE::DONE)
+      {
+         return STATUS::BUFFER_EMPTY;
+      }
+
+      bMyHoldingSlot = true;
+      if (stSlot.bDropped)
+      {
+         ReleaseSlot();
+         continue;
+      }
+
+      stMessageData_ = stSlot.stMessageData;
+      stMetaData_ = stSlot.stMetaData;
+      return stSlot.eStatus;
+   }
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t
+PipelinedParser::Flush(unsigned char* pucBuffer_, uint32_t uiBufferSize_)
+{
+   // Stop the framing thread between logs, then wait for the workers to
+   // finish what they were given so their decompressors can be reset.
+   std::unique_lock<std::mutex> clInputLock(clMyInputMutex);
+   bMyPauseRequested = true;
+   clMyInputCondition.notify_all();
+   clMyInputCondition.wait(clInputLock, [this] { return bMyPaused; });
+
+   {
+      std::unique_lock<std::mutex> clReaderLock(clMyReaderMutex);
+      clMyReaderCondition.wait(clReaderLock, [this] { return uiMyInFlight.load(std::memory_order_acquire) == 0; });
+   }
+
+   if (!vMyPendingInput.empty())
+   {
+      clMyFramer.Write(vMyPendingInput.data(), static_cast<uint32_t>(vMyPendingInput.size()));
+      vMyPendingInput.clear();
+   }
+   const uint32_t uiFlushed = clMyFramer.Flush(pucBuffer_, uiBufferSize_);
+
+   for (auto& pclWorker : vpclMyWorkers)
+   {
+      pclWorker->clRangeDecompressor.Reset();
+   }
+
+   bMyPauseRequested = false;
+   clInputLock.unlock();
+   clMyInputCondition.notify_all();
+   return uiFlushed;
+}
@@ -49,7 +49,7 @@ constexpr float afTheRangeCmp2ADRStdDevValues[] =
 //! https://docs.novatel.com/OEM7/Content/Logs/RANGECMP2.htm?Highlight=RANGECMP2#L1_E1_B1_Scaling
 //-----------------------------------------------------------------------
 
-static std::map<SYSTEM, std::map<RangeCmp2::SIGNAL_TYPE, const double>> mmTheRangeCmp2SignalScalingMapping =
+static const std::map<SYSTEM, std::map<RangeCmp2::SIGNAL_TYPE, const double>> mmTheRangeCmp2SignalScalingMapping =
 {
    {
       SYSTEM::GPS,
@@ -147,7 +147,7 @@ constexpr SYSTEM aeTheRangeCmp4SatelliteSystems[RC4_HEADER_BLOCK_SYSTEM_COUNT]
 //! satellite and signal blocks defined in the RANGECMP4 documentation:
 //! https://docs.novatel.com/OEM7/Content/Logs/RANGECMP4.htm?Highlight=RANGECMP#Signal
 //-----------------------------------------------------------------------
-static std::map<SYSTEM, std::vector<RangeCmp4::SIGNAL_TYPE>> mvTheRangeCmp4SystemSignalMasks =
+static const std::map<SYSTEM, std::vector<RangeCmp4::SIGNAL_TYPE>> mvTheRangeCmp4SystemSignalMasks =
 {
    {
       SYSTEM::GPS,
@@ -266,6 +266,30 @@ constexpr float afTheRangeCmp4LockTimeValues[] =
    2048.0f,  4096.0f,  8192.0f,  16384.0f, 32768.0f, 65536.0f, 131072.0f, 262144.0f
 };
 
+//-----------------------------------------------------------------------
+//! The lookup tables above are shared by every RangeDecompressor, so they
+//! are only ever searched, never default-inserted into.  This keeps
+//! decompressors on different threads from racing on them.
+//-----------------------------------------------------------------------
+static double GetRangeCmp2SignalScaling(SYSTEM eSystem_, RangeCmp2::SIGNAL_TYPE eSignalType_)
+{
+   const auto itSystem = mmTheRangeCmp2SignalScalingMapping.find(eSystem_);
+   if (itSystem == mmTheRangeCmp2SignalScalingMapping.end())
+   {
+      return 0.0;
+   }
+   const auto itSignal = itSystem->second.find(eSignalType_);
+   return itSignal != itSystem->second.end() ? itSignal->second : 0.0;
+}
+
+//-----------------------------------------------------------------------
+static const std::vector<RangeCmp4::SIGNAL_TYPE>& GetRangeCmp4SystemSignals(SYSTEM eSystem_)
+{
+   static const std::vector<RangeCmp4::SIGNAL_TYPE> vNoSignals;
+   const auto itSystem = mvTheRangeCmp4SystemSignalMasks.find(eSystem_);
+   return itSystem != mvTheRangeCmp4SystemSignalMasks.end() ? itSystem->second : vNoSignals;
+}
+
 //------------------------------------------------------------------------------
 RangeDecompressor::RangeDecompressor(JsonReader* pclJsonDB_) :
    clMyHeaderDecoder(pclJsonDB_),
@@ -273,7 +297,7 @@ RangeDecompressor::RangeDecompressor(JsonReader* pclJsonDB_) :
    clMyEncoder(pclJsonDB_)
 {
    pclMyLogger = Logger().RegisterLogger("range_decompressor");
-   pclMyLogger->debug("RangeDecompressor initializing...");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "RangeDecompressor initializing...");
 
    if (pclJsonDB_ != nullptr)
    {
@@ -289,7 +313,7 @@ RangeDecompressor::RangeDecompressor(JsonReader* pclJsonDB_) :
    clMyRangeCmpFilter.IncludeMessageId(RANGECMP4_MSG_ID, HEADERFORMAT::ALL, MEASUREMENT_SOURCE::PRIMARY);
    clMyRangeCmpFilter.IncludeMessageId(RANGECMP4_MSG_ID, HEADERFORMAT::ALL, MEASUREMENT_SOURCE::SECONDARY);
 
-   pclMyLogger->debug("RangeDecompressor initialized");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "RangeDecompressor initialized");
 }
 
 //------------------------------------------------------------------------------
@@ -847,7 +871,7 @@ RangeDecompressor::RangeCmp2ToRange(const RangeCmp2Struct& stRangeCmp2Message_,
          stRangeData.fPSRStdDev = afTheRangeCmp2PSRStdDevValues[ucPSRBitfield];
          stRangeData.dADR = MAGIC_NEGATE * (static_cast<double>(iPSRBase) + static_cast<double>(fPhaseRangeDiff/RC2_SIG_PHASERANGE_DIFF_SCALE_FACTOR)) / (GetSignalWavelength(stChannelTrackingStatus, (stRangeData.sGLONASSFrequency-GLONASS_FREQUENCY_NUMBER_OFFSET)));
          stRangeData.fADRStdDev = afTheRangeCmp2ADRStdDevValues[ucADRBitfield];
-         stRangeData.fDopplerFrequency = static_cast<float>(iDopplerBase + fScaledDopplerDiff) / static_cast<float>(mmTheRangeCmp2SignalScalingMapping[eSatelliteSystem][eSignalType]);
+         stRangeData.fDopplerFrequency = static_cast<float>(iDopplerBase + fScaledDopplerDiff) / static_cast<float>(GetRangeCmp2SignalScaling(eSatelliteSystem, eSignalType));
          stRangeData.fCNo = RC2_SIG_CNO_SCALE_OFFSET + static_cast<float>(stRangeCmp2SigBlock.ulCombinedField2 & RC2_SIG_CNO_MASK);
          stRangeData.fLockTime = DetermineRangeCmp2ObservationLocktime(stMetaData_, uiLocktimeBits, stChannelTrackingStatus.eSatelliteSystem, stChannelTrackingStatus.eSignalType, usPRN);
          stRangeData.uiChannelTrackingStatus = stChannelTrackingStatus.GetAsWord();
@@ -917,7 +941,7 @@ RangeDecompressor::RangeCmp4ToRange(uint8_t* pucCompressedData_, RangeStruct& st
          usSignals = static_cast<uint16_t>(GetBitfieldFromBuffer(&pucTempDataPointer, RC4_SIGNALS_BITS));
 
          // Collect the signals tracked in this satellite system.
-         for (RangeCmp4::SIGNAL_TYPE eCurrentSignalType : mvTheRangeCmp4SystemSignalMasks[eCurrentSatelliteSystem])
+         for (RangeCmp4::SIGNAL_TYPE eCurrentSignalType : GetRangeCmp4SystemSignals(eCurrentSatelliteSystem))
          {
             if (usSignals & (1UL << static_cast<uint16_t>(eCurrentSignalType)))
             {
@@ -47,14 +47,14 @@ RxConfigHandler::RxConfigHandler(JsonReader* pclJsonDB_) :
 {
    pclMyLogger = Logger().RegisterLogger("rxconfig_handler");
 
-   pclMyLogger->debug("RxConfigHandler initializing...");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "RxConfigHandler initializing...");
 
    if (pclJsonDB_ != NULL)
    {
       LoadJsonDb(pclJsonDB_);
    }
 
-   pclMyLogger->debug("RxConfigHandler initialized");
+   SPDLOG_LOGGER_DEBUG(pclMyLogger, "RxConfigHandler initialized");
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -236,6 +236,13 @@ RxConfigHandler::CreateRXConfigMsgDefn()
    stMyRXConfigMsgDef.fields[0];
    stMyRXConfigMsgDef.fields[0].push_back(stEmbeddedHeader.clone());
    stMyRXConfigMsgDef.fields[0].push_back(stEmbeddedBody.clone());
+
+   // Scratch message reused by Convert().  FieldContainer cannot be copied, so reserve up front.
+   const MsgFieldsVector& vRxConfigMessageFields = stMyRXConfigMsgDef.fields.at(0);
+   stMyRxConfigMessage.clear();
+   stMyRxConfigMessage.reserve(vRxConfigMessageFields.size());
+   stMyRxConfigMessage.emplace_back(IntermediateHeader(), vRxConfigMessageFields[0]);
+   stMyRxConfigMessage.emplace_back(IntermediateMessage(), vRxConfigMessageFields[1]);
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -252,16 +259,10 @@ RxConfigHandler::Convert(
    MessageDataStruct& stEmbeddedMessageData_, MetaDataStruct& stEmbeddedMetaData_,
    ENCODEFORMAT eEncodeFormat_)
 {
-   STATUS eStatus = STATUS::SUCCESS;
-   IntermediateHeader stRxConfigHeader;
-   IntermediateHeader stEmbeddedHeader;
-   IntermediateMessage stRxConfigMessage;
-   IntermediateMessage stEmbeddedMessage;
    pucMyFrameBufferPointer = pcMyFrameBuffer;
-   unsigned char* pucTempMessagePointer = pucMyFrameBufferPointer;
 
    // Get an RXCONFIG log.
-   eStatus = clMyFramer.GetFrame(pucMyFrameBufferPointer, uiINTERNAL_BUFFER_SIZE, stRxConfigMetaData_);
+   const STATUS eStatus = clMyFramer.GetFrame(pucMyFrameBufferPointer, uiINTERNAL_BUFFER_SIZE, stRxConfigMetaData_);
    if (eStatus == STATUS::BUFFER_EMPTY || eStatus == STATUS::INCOMPLETE)
    {
       return STATUS::BUFFER_EMPTY;
@@ -271,8 +272,33 @@ RxConfigHandler::Convert(
       return eStatus;
    }
 
+   return Convert(pucMyFrameBufferPointer, stRxConfigMessageData_, stRxConfigMetaData_, stEmbeddedMessageData_, stEmbeddedMetaData_, eEncodeFormat_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+RxConfigHandler::Convert(
+   unsigned char* pucFrame_,
+   MessageDataStruct& stRxConfigMessageData_, MetaDataStruct& stRxConfigMetaData_,
+   MessageDataStruct& stEmbeddedMessageData_, MetaDataStruct& stEmbeddedMetaData_,
+   ENCODEFORMAT eEncodeFormat_)
+{
+   if (pucFrame_ == nullptr)
+   {
+      return STATUS::NULL_PROVIDED;
+   }
+
+   if (!pclMyMsgDB)
+   {
+      return STATUS::NO_DATABASE;
+   }
+
+   STATUS eStatus = STATUS::SUCCESS;
+   IntermediateHeader stRxConfigHeader;
+   unsigned char* pucTempMessagePointer = pucFrame_;
+
    // Decode the RXCONFIG log.
-   eStatus = clMyHeaderDecoder.Decode(pucMyFrameBufferPointer, stRxConfigHeader, stRxConfigMetaData_);
+   eStatus = clMyHeaderDecoder.Decode(pucFrame_, stRxConfigHeader, stRxConfigMetaData_);
    if(eStatus != STATUS::SUCCESS)
    {
       return eStatus;
@@ -285,12 +311,11 @@ RxConfigHandler::Convert(
       return STATUS::UNKNOWN;
    }
 
-   // Decode the RXCONFIG message body, which is a regular OEM header and body.
-   novatel::edie::oem::MsgFieldsVector vRxConfigMessageFields = stMyRXConfigMsgDef.fields.at(0);
-   stRxConfigMessage.reserve(vRxConfigMessageFields.size());
-   for(auto& field : vRxConfigMessageFields)
+   // Decode the RXCONFIG message body, which is a regular OEM header and body.  The scratch
+   // message already holds one container per field definition, so decode straight into them.
+   for(FieldContainer& field : stMyRxConfigMessage)
    {
-      if(field->type == FIELD_TYPE::RXCONFIG_HEADER)
+      if(field.field_def->type == FIELD_TYPE::RXCONFIG_HEADER)
       {
          if(stRxConfigMetaData_.eFormat == HEADERFORMAT::ABB_ASCII)
          {
@@ -302,7 +327,7 @@ RxConfigHandler::Convert(
             *pucTempMessagePointer = OEM4_ABBREV_ASCII_SYNC;
          }
 
-         eStatus = clMyHeaderDecoder.Decode(pucTempMessagePointer, stEmbeddedHeader, stEmbeddedMetaData_);
+         eStatus = clMyHeaderDecoder.Decode(pucTempMessagePointer, std::get<IntermediateHeader>(field.field_value), stEmbeddedMetaData_);
          if(eStatus == STATUS::NO_DEFINITION)
          {
             return STATUS::NO_DEFINITION_EMBEDDED;
@@ -311,15 +336,11 @@ RxConfigHandler::Convert(
          {
             return eStatus;
          }
-
-         stRxConfigMessage.emplace_back(stEmbeddedHeader, field);
       }
-      else if(field->type == FIELD_TYPE::RXCONFIG_BODY)
+      else if(field.field_def->type == FIELD_TYPE::RXCONFIG_BODY)
       {
-         // Put an IntermediateMessage struct into the RXCONFIG IntermediateMessage, then
-         // pass it to the message decoder as a destination for the embedded message.
-         stRxConfigMessage.emplace_back(IntermediateMessage(), field);
-         eStatus = clMyMessageDecoder.Decode((pucTempMessagePointer + stEmbeddedMetaData_.uiHeaderLength), std::get<IntermediateMessage>(stRxConfigMessage.back().field_value), stEmbeddedMetaData_);
+         // The message decoder clears the embedded message before decoding into it.
+         eStatus = clMyMessageDecoder.Decode((pucTempMessagePointer + stEmbeddedMetaData_.uiHeaderLength), std::get<IntermediateMessage>(field.field_value), stEmbeddedMetaData_);
          if(eStatus == STATUS::NO_DEFINITION)
          {
             return STATUS::NO_DEFINITION_EMBEDDED;
@@ -373,7 +394,7 @@ RxConfigHandler::Convert(
 
    // This is just dummy args that we must pass to the encoder.  They will not be used.
    uint32_t uiCRC = 0;
-   for (FieldContainer& field : stRxConfigMessage)
+   for (FieldContainer& field : stMyRxConfigMessage)
    {
       if (field.field_def->type == FIELD_TYPE::RXCONFIG_HEADER)
       {
@@ -42,13 +42,35 @@
 #include "decoders/novatel/api/framer.hpp"
 #include "decoders/novatel/api/header_decoder.hpp"
 #include "decoders/novatel/api/message_decoder.hpp"
+#include "decoders/novatel/api/file_index.hpp"
+#include "decoders/novatel/api/deduplicator.hpp"
+#include "decoders/novatel/api/encode_sink.hpp"
+#include "decoders/novatel/api/file_merger.hpp"
 #include "decoders/novatel/api/fileparser.hpp"
+#include "decoders/novatel/api/pipelined_parser.hpp"
+#ifdef HAVE_ZLIB
+#include "hw_interface/stream_interface/api/inputcompressedfilestream.hpp"
+#include <zlib.h>
+#endif
+#ifndef WIN32
+#include "decoders/novatel/api/ingest_engine.hpp"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+#include "decoders/common/api/crc32.hpp"
 #include "decoders/common/api/jsonreader.hpp"
 #include "resources/novatel_message_definitions.hpp"
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <iostream>
+#include <map>
+#include <numeric>
+#include <set>
+#include <thread>
 #include <fstream>
 #include <filesystem>
 #include <locale>
@@ -1348,6 +1370,81 @@ TEST_F(FramerTest, ABBREV_ASCII_EMPTY_ARRAY)
    ASSERT_TRUE(CompareMetaData(&stTestMetaData, &stExpectedMetaData));
 }
 
+TEST_F(FramerTest, ABBREV_ASCII_COMPLETION)
+{
+   // Nothing follows these logs, so they are held until the next one starts.
+   unsigned char aucLog[] = "<BESTPOS COM1 0 72.0 FINESTEERING 2215 148248.000 02000020 cdba 32768\r\n"\
+      "<     SOL_COMPUTED SINGLE 51.15043711386 -114.03067767000 1097.2099 -17.0000 WGS84 0.9038 0.8534 1.7480 \"\" 0.000 0.000 35 30 30 30 00 06 39 33\r\n";
+   unsigned char aucEmptyArray[] = "<RANGE COM1 0 95.5 UNKNOWN 0 170.000 025c0020 5103 16807\r\n<     0 \r\n<         \r\n";
+   unsigned char aucArray[] = "<SAVEDSURVEYPOSITIONS COM1 0 55.5 FINESTEERING 2211 324085.143 02000000 ddf2 32768\r\n"\
+      "<     2 \r\n"\
+      "<          \"MN01\" 51.11600000000 -114.03800000000 1065.0000 \r\n";
+   unsigned char aucLastElement[] = "<          \"MN02\" 51.11700000000 -114.03900000000 1066.0000 \r\n";
+   MetaDataStruct stMetaData;
+
+   Framer clFramer;
+   clFramer.Write(aucLog, sizeof(aucLog) - 1);
+   ASSERT_EQ(STATUS::INCOMPLETE, clFramer.GetFrame(pucMyTestFrameBuffer, MAX_ASCII_MESSAGE_LENGTH, stMetaData));
+
+   // The last line does not end with a separator, so the log is over.
+   clFramer.SetAbbrevAsciiCompletion(true, 0);
+   ASSERT_EQ(STATUS::SUCCESS, clFramer.GetFrame(pucMyTestFrameBuffer, MAX_ASCII_MESSAGE_LENGTH, stMetaData));
+   ASSERT_EQ(stMetaData.eFormat, HEADERFORMAT::ABB_ASCII);
+   ASSERT_EQ(stMetaData.uiLength, sizeof(aucLog) - 1);
+   ASSERT_EQ(0, memcmp(pucMyTestFrameBuffer, aucLog, sizeof(aucLog) - 1));
+
+   // An empty line indented under the array size closes an empty array.
+   clFramer.Write(aucEmptyArray, sizeof(aucEmptyArray) - 1);
+   ASSERT_EQ(STATUS::SUCCESS, clFramer.GetFrame(pucMyTestFrameBuffer, MAX_ASCII_MESSAGE_LENGTH, stMetaData));
+   ASSERT_EQ(stMetaData.uiLength, sizeof(aucEmptyArray) - 1);
+
+   // The array is missing an element, so the log is held however long the
+   // stream is idle.
+   clFramer.Write(aucArray, sizeof(aucArray) - 1);
+   ASSERT_EQ(STATUS::INCOMPLETE, clFramer.GetFrame(pucMyTestFrameBuffer, MAX_ASCII_MESSAGE_LENGTH, stMetaData));
+   clFramer.SetAbbrevAsciiCompletion(true, 100);
+   std::this_thread::sleep_for(std::chrono::milliseconds(150));
+   ASSERT_EQ(STATUS::INCOMPLETE, clFramer.GetFrame(pucMyTestFrameBuffer, MAX_ASCII_MESSAGE_LENGTH, stMetaData));
+
+   // Once it has all its elements, fields could still follow the array, so
+   // wait until the stream is idle.
+   clFramer.Write(aucLastElement, sizeof(aucLastElement) - 1);
+   ASSERT_EQ(STATUS::INCOMPLETE, clFramer.GetFrame(pucMyTestFrameBuffer, MAX_ASCII_MESSAGE_LENGTH, stMetaData));
+   std::this_thread::sleep_for(std::chrono::milliseconds(150));
+   ASSERT_EQ(STATUS::SUCCESS, clFramer.GetFrame(pucMyTestFrameBuffer, MAX_ASCII_MESSAGE_LENGTH, stMetaData));
+   ASSERT_EQ(stMetaData.uiLength, sizeof(aucArray) - 1 + sizeof(aucLastElement) - 1);
+   ASSERT_EQ(clFramer.GetBufferedByteCount(), 0U);
+}
+
+TEST_F(FramerTest, ABBREV_ASCII_COMPLETION_PAUSE)
+{
+   // A RANGE log that stops for longer than the idle time after its size and
+   // again after its first observation, as a serial port might.
+   unsigned char aucHeader[] = "<RANGE COM1 0 80.0 FINESTEERING 2167 244214.000 02000020 5103 16809\r\n"\
+      "<     3 \r\n";
+   unsigned char aucFirst[] = "<          3 0 23167422.080 0.055 -121746738.562 0.009 -2178.730 41.9 4932.330 1810bc04 \r\n";
+   unsigned char aucRest[] = "<          22 0 21134718.264 0.033 -111061537.390 0.008 1218.532 46.4 9823.100 18109c04 \r\n"\
+      "<          25 0 22454530.553 0.050 -117999405.829 0.009 -3109.120 42.9 6022.660 08109c04\r\n";
+   MetaDataStruct stMetaData;
+
+   Framer clFramer;
+   clFramer.SetAbbrevAsciiCompletion(true);
+   clFramer.Write(aucHeader, sizeof(aucHeader) - 1);
+   std::this_thread::sleep_for(std::chrono::milliseconds(2 * Framer::uiDEFAULT_ABBREV_ASCII_IDLE_MILLISECONDS));
+   ASSERT_EQ(STATUS::INCOMPLETE, clFramer.GetFrame(pucMyTestFrameBuffer, MAX_ASCII_MESSAGE_LENGTH, stMetaData));
+
+   clFramer.Write(aucFirst, sizeof(aucFirst) - 1);
+   std::this_thread::sleep_for(std::chrono::milliseconds(2 * Framer::uiDEFAULT_ABBREV_ASCII_IDLE_MILLISECONDS));
+   ASSERT_EQ(STATUS::INCOMPLETE, clFramer.GetFrame(pucMyTestFrameBuffer, MAX_ASCII_MESSAGE_LENGTH, stMetaData));
+
+   // The whole log is released together once its last line arrives.
+   clFramer.Write(aucRest, sizeof(aucRest) - 1);
+   ASSERT_EQ(STATUS::SUCCESS, clFramer.GetFrame(pucMyTestFrameBuffer, MAX_ASCII_MESSAGE_LENGTH, stMetaData));
+   ASSERT_EQ(stMetaData.eFormat, HEADERFORMAT::ABB_ASCII);
+   ASSERT_EQ(stMetaData.uiLength, sizeof(aucHeader) - 1 + sizeof(aucFirst) - 1 + sizeof(aucRest) - 1);
+   ASSERT_EQ(clFramer.GetBufferedByteCount(), 0U);
+}
+
 // -------------------------------------------------------------------------------------------------------
 // JSON Framer Unit Tests
 // -------------------------------------------------------------------------------------------------------
@@ -3504,6 +3601,218 @@ TEST_F(DecodeEncodeTest, CONVERSION_TO_FLAT_BIN_TRACKSTAT_ASC_AND_BIN)
    ASSERT_TRACKSTAT_EQ(stMessageData1.pucMessageBody, stMessageData2.pucMessageBody);
 }
 
+// -------------------------------------------------------------------------------------------------------
+// Binary Encode Plan Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class FieldWalkEncoder : public Encoder
+{
+public:
+   FieldWalkEncoder(JsonReader* pclJsonDb_) : Encoder(pclJsonDb_) {}
+
+   bool TestEncodeBinaryBody(const IntermediateMessage& stIntermediateMessage_, unsigned char** ppcOutBuf_, uint32_t uiBytes, bool bFlatten_)
+   {
+      return Encoder::EncodeBinaryBody(stIntermediateMessage_, ppcOutBuf_, uiBytes, bFlatten_);
+   }
+};
+
+TEST_F(DecodeEncodeTest, BINARY_ENCODE_PLAN_MATCHES_FIELD_WALK)
+{
+   const char* aszLogs[] = {
+      "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1",
+      "#BESTSATSA,COM1,0,50.0,FINESTEERING,2167,244820.000,02000000,be05,16248;43,GPS,2,GOOD,00000003,GPS,20,GOOD,00000003,GPS,29,GOOD,00000003,GPS,13,GOOD,00000003,GPS,15,GOOD,00000003,GPS,16,GOOD,00000003,GPS,18,GOOD,00000007,GPS,25,GOOD,00000007,GPS,5,GOOD,00000003,GPS,26,GOOD,00000007,GPS,23,GOOD,00000007,QZSS,194,SUPPLEMENTARY,00000007,SBAS,131,NOTUSED,00000000,SBAS,133,NOTUSED,00000000,SBAS,138,NOTUSED,00000000,GLONASS,8+6,GOOD,00000003,GLONASS,9-2,GOOD,00000003,GLONASS,1+1,GOOD,00000003,GLONASS,24+2,GOOD,00000003,GLONASS,2-4,GOOD,00000003,GLONASS,17+4,GOOD,00000003,GLONASS,16-1,GOOD,00000003,GLONASS,18-3,GOOD,00000003,GLONASS,15,GOOD,00000003,GALILEO,26,GOOD,0000000f,GALILEO,12,GOOD,0000000f,GALILEO,19,ELEVATIONERROR,00000000,GALILEO,31,GOOD,0000000f,GALILEO,25,ELEVATIONERROR,00000000,GALILEO,33,GOOD,0000000f,GALILEO,8,ELEVATIONERROR,00000000,GALILEO,7,GOOD,0000000f,GALILEO,24,GOOD,0000000f,BEIDOU,35,LOCKEDOUT,00000000,BEIDOU,29,SUPPLEMENTARY,00000001,BEIDOU,25,ELEVATIONERROR,00000000,BEIDOU,20,SUPPLEMENTARY,00000001,BEIDOU,22,SUPPLEMENTARY,00000001,BEIDOU,44,LOCKEDOUT,00000000,BEIDOU,57,NOEPHEMERIS,00000000,BEIDOU,12,ELEVATIONERROR,00000000,BEIDOU,24,SUPPLEMENTARY,00000001,BEIDOU,19,SUPPLEMENTARY,00000001*7abea593\r\n",
+      "#RAWGPSSUBFRAMEA,COM1,0,54.0,SATTIME,2167,254754.000,02000000,0457,16248;4,32,5,8b01dc52ee35516daa63199cfd4c00a10cb7227993c059e0b9c4d63e0054,4*80b22f2e\r\n",
+      "#RANGEA,COM1,0,6.5,COARSESTEERING,2180,407587.500,024c0020,5103,32768;3,8,0,22086479.072,0.079,-116065230.826912,0.008,827.920,48.3,20.465,0800bca4,32,0,22250341.055,0.070,-116926330.596180,0.007,3298.934,49.5,19.924,0800bce4,15,0,23310073.938,0.111,-122495264.853699,0.012,-3571.021,45.5,19.861,0800bda4*d32c11da\r\n",
+      "#RANGEA,COM1,0,5.5,UNKNOWN,0,25.000,024c00a0,5103,32768;0*943a8919\r\n",
+      "#VERSIONA,COM1,0,55.5,FINESTEERING,2167,254938.857,02000000,3681,16248;8,GPSCARD,\"FFNBYNTMNP1\",\"BMHR15470120X\",\"OEM719N-0.00C\",\"OM7CR0707RN0000\",\"OM7BR0000RBG000\",\"2020/Apr/09\",\"13:40:45\",OEM7FPGA,\"\",\"\",\"\",\"OMV070001RN0000\",\"\",\"\",\"\",DEFAULT_CONFIG,\"\",\"\",\"\",\"EZDCD0707RN0001\",\"\",\"2020/Apr/09\",\"13:41:07\",APPLICATION,\"\",\"\",\"\",\"EZAPR0707RN0000\",\"\",\"2020/Apr/09\",\"13:41:00\",PACKAGE,\"\",\"\",\"\",\"EZPKR0103RN0000\",\"\",\"2020/Apr/09\",\"13:41:14\",ENCLOSURE,\"\",\"NMJC14520001W\",\"0.0.0.H\",\"\",\"\",\"\",\"\",IMUCARD,\"Epson G320N 125\",\"E0000114\",\"G320PDGN\",\"2302\",\"\",\"\",\"\",RADIO,\"M3-R4\",\"1843000570\",\"SPL0020d12\",\"V07.34.2.5.1.11\",\"\",\"\",\"\"*4b995016\r\n",
+      "#GLOEPHEMERISA,COM1,11,67.0,SATTIME,2168,160218.000,02000820,8d29,32768;51,0,1,80,2168,161118000,10782,573,0,0,95,0,-2.3917966796875000e+07,4.8163881835937500e+06,7.4258510742187500e+06,-1.0062713623046875e+03,1.8321990966796875e+02,-3.3695755004882813e+03,1.86264514923095700e-06,-9.31322574615478510e-07,-0.00000000000000000,-6.69313594698905940e-05,5.587935448e-09,0.00000000000000000,84600,3,2,0,13*ad20fc5f\r\n"
+   };
+
+   FieldWalkEncoder clFieldWalkEncoder(pclMyJsonDb);
+   for (const char* szLog : aszLogs)
+   {
+      for (ENCODEFORMAT eFormat : { ENCODEFORMAT::BINARY, ENCODEFORMAT::FLATTENED_BINARY })
+      {
+         IntermediateHeader stHeader;
+         IntermediateMessage stMessage;
+         MetaDataStruct stMetaData;
+         MessageDataStruct stMessageData;
+
+         stMetaData.uiLength = static_cast<uint32_t>(strlen(szLog)); // This would have been set by the framer.
+         auto* pucLog = reinterpret_cast<unsigned char*>(const_cast<char*>(szLog));
+         ASSERT_EQ(STATUS::SUCCESS, pclMyHeaderDecoder->Decode(pucLog, stHeader, stMetaData)) << szLog;
+         ASSERT_EQ(STATUS::SUCCESS, pclMyMessageDecoder->Decode(pucLog + stMetaData.uiHeaderLength, stMessage, stMetaData)) << szLog;
+
+         // Encoder::Encode() uses the plan compiled for the message.
+         alignas(8) unsigned char acPlanBuffer[MAX_BINARY_MESSAGE_LENGTH];
+         unsigned char* pucPlanBuffer = acPlanBuffer;
+         ASSERT_EQ(STATUS::SUCCESS, pclMyEncoder->Encode(&pucPlanBuffer, sizeof(acPlanBuffer), stHeader, stMessage, stMessageData, stMetaData, eFormat)) << szLog;
+
+         // Walk the field definitions at the same offset, as padding depends on alignment.
+         const auto uiBodyOffset = static_cast<uint32_t>(stMessageData.pucMessageBody - acPlanBuffer);
+         alignas(8) unsigned char acFieldWalkBuffer[MAX_BINARY_MESSAGE_LENGTH];
+         unsigned char* pucFieldWalkBuffer = acFieldWalkBuffer + uiBodyOffset;
+         ASSERT_TRUE(clFieldWalkEncoder.TestEncodeBinaryBody(stMessage, &pucFieldWalkBuffer, sizeof(acFieldWalkBuffer) - uiBodyOffset, eFormat == ENCODEFORMAT::FLATTENED_BINARY)) << szLog;
+
+         const uint32_t uiBodyLength = stMessageData.uiMessageBodyLength - OEM4_BINARY_CRC_LENGTH;
+         ASSERT_EQ(uiBodyLength, static_cast<uint32_t>(pucFieldWalkBuffer - (acFieldWalkBuffer + uiBodyOffset))) << szLog;
+         ASSERT_EQ(0, memcmp(stMessageData.pucMessageBody, acFieldWalkBuffer + uiBodyOffset, uiBodyLength)) << szLog;
+      }
+   }
+}
+
+// Check a field decoded with a projection against the same field decoded in full.
+static void ExpectSameFieldValue(const FieldContainer& clField_, const FieldContainer& clFullField_)
+{
+   ASSERT_EQ(clField_.field_def, clFullField_.field_def);
+   ASSERT_EQ(clField_.field_value.index(), clFullField_.field_value.index()) << clField_.field_def->name;
+   std::visit([&](const auto& value) {
+      using T = std::decay_t<decltype(value)>;
+      const auto& full_value = std::get<T>(clFullField_.field_value);
+      if constexpr (std::is_same_v<T, std::vector<FieldContainer>>)
+      {
+         ASSERT_EQ(value.size(), full_value.size()) << clField_.field_def->name;
+         for (size_t i = 0; i < value.size(); ++i)
+            ExpectSameFieldValue(value[i], full_value[i]);
+      }
+      else if constexpr (std::is_same_v<T, IntermediateHeader>)
+      {
+         ADD_FAILURE() << clField_.field_def->name << " holds a header";
+      }
+      else
+      {
+         EXPECT_EQ(value, full_value) << clField_.field_def->name;
+      }
+   }, clField_.field_value);
+}
+
+static void ExpectProjectedFields(const std::vector<FieldContainer>& vFields_, const std::vector<FieldContainer>& vFullFields_)
+{
+   for (const auto& clField : vFields_)
+   {
+      auto itFullField = std::find_if(vFullFields_.begin(), vFullFields_.end(), [&clField](const FieldContainer& clFullField_) { return clFullField_.field_def == clField.field_def; });
+      ASSERT_NE(vFullFields_.end(), itFullField) << clField.field_def->name;
+
+      if (clField.field_def->type != FIELD_TYPE::FIELD_ARRAY)
+      {
+         ExpectSameFieldValue(clField, *itFullField);
+         continue;
+      }
+
+      // The elements of a projected FIELD_ARRAY only hold the wanted fields.
+      const auto& vElements = std::get<std::vector<FieldContainer>>(clField.field_value);
+      const auto& vFullElements = std::get<std::vector<FieldContainer>>(itFullField->field_value);
+      ASSERT_EQ(vFullElements.size(), vElements.size()) << clField.field_def->name;
+      for (size_t i = 0; i < vElements.size(); ++i)
+      {
+         ExpectProjectedFields(std::get<std::vector<FieldContainer>>(vElements[i].field_value), std::get<std::vector<FieldContainer>>(vFullElements[i].field_value));
+      }
+   }
+}
+
+TEST_F(DecodeEncodeTest, BINARY_PROJECTION_MATCHES_FULL_DECODE)
+{
+   const char* aszLogs[] = {
+      "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1",
+      "#BESTSATSA,COM1,0,50.0,FINESTEERING,2167,244820.000,02000000,be05,16248;4,GPS,2,GOOD,00000003,GLONASS,8+6,GOOD,00000003,GALILEO,19,ELEVATIONERROR,00000000,BEIDOU,29,SUPPLEMENTARY,00000001*7abea593\r\n",
+      "#RANGEA,COM1,0,6.5,COARSESTEERING,2180,407587.500,024c0020,5103,32768;3,8,0,22086479.072,0.079,-116065230.826912,0.008,827.920,48.3,20.465,0800bca4,32,0,22250341.055,0.070,-116926330.596180,0.007,3298.934,49.5,19.924,0800bce4,15,0,23310073.938,0.111,-122495264.853699,0.012,-3571.021,45.5,19.861,0800bda4*d32c11da\r\n",
+      "#VERSIONA,COM1,0,55.5,FINESTEERING,2167,254938.857,02000000,3681,16248;2,GPSCARD,\"FFNBYNTMNP1\",\"BMHR15470120X\",\"OEM719N-0.00C\",\"OM7CR0707RN0000\",\"OM7BR0000RBG000\",\"2020/Apr/09\",\"13:40:45\",OEM7FPGA,\"\",\"\",\"\",\"OMV070001RN0000\",\"\",\"\",\"\"*4b995016\r\n"
+   };
+
+   ASSERT_EQ(STATUS::NO_DEFINITION, pclMyMessageDecoder->SetProjection("NOTALOG", { "latitude" }));
+
+   for (const char* szLog : aszLogs)
+   {
+      IntermediateHeader stHeader;
+      IntermediateMessage stMessage;
+      MetaDataStruct stMetaData;
+      MessageDataStruct stMessageData;
+
+      stMetaData.uiLength = static_cast<uint32_t>(strlen(szLog)); // This would have been set by the framer.
+      auto* pucLog = reinterpret_cast<unsigned char*>(const_cast<char*>(szLog));
+      ASSERT_EQ(STATUS::SUCCESS, pclMyHeaderDecoder->Decode(pucLog, stHeader, stMetaData)) << szLog;
+      ASSERT_EQ(STATUS::SUCCESS, pclMyMessageDecoder->Decode(pucLog + stMetaData.uiHeaderLength, stMessage, stMetaData)) << szLog;
+
+      alignas(8) unsigned char acBinaryLog[MAX_BINARY_MESSAGE_LENGTH];
+      unsigned char* pucBinaryLog = acBinaryLog;
+      ASSERT_EQ(STATUS::SUCCESS, pclMyEncoder->Encode(&pucBinaryLog, sizeof(acBinaryLog), stHeader, stMessage, stMessageData, stMetaData, ENCODEFORMAT::BINARY)) << szLog;
+
+      // Want every other field, and every other field of each FIELD_ARRAY element.
+      const MessageDefinition* pclMsgDef = pclMyJsonDb->GetMsgDef(static_cast<int32_t>(stMetaData.usMessageID));
+      ASSERT_NE(nullptr, pclMsgDef) << szLog;
+      std::vector<std::string> vPaths;
+      const auto& vMsgDefFields = pclMsgDef->fields.at(pclMsgDef->latestMessageCrc);
+      for (size_t i = 0; i < vMsgDefFields.size(); ++i)
+      {
+         if (vMsgDefFields[i]->type == FIELD_TYPE::FIELD_ARRAY)
+         {
+            const auto& vSubFields = static_cast<const FieldArrayField*>(vMsgDefFields[i])->fields;
+            for (size_t j = 1; j < vSubFields.size(); j += 2)
+               vPaths.push_back(vMsgDefFields[i]->name + "." + vSubFields[j]->name);
+         }
+         else if (i % 2 == 1)
+         {
+            vPaths.push_back(vMsgDefFields[i]->name);
+         }
+      }
+      ASSERT_FALSE(vPaths.empty()) << szLog;
+
+      IntermediateHeader stBinaryHeader;
+      IntermediateMessage stFullMessage;
+      IntermediateMessage stProjectedMessage;
+      MetaDataStruct stBinaryMetaData;
+      ASSERT_EQ(STATUS::SUCCESS, pclMyHeaderDecoder->Decode(acBinaryLog, stBinaryHeader, stBinaryMetaData)) << szLog;
+      ASSERT_EQ(HEADERFORMAT::BINARY, stBinaryMetaData.eFormat) << szLog;
+
+      MessageDecoder clProjectedDecoder(pclMyJsonDb);
+      ASSERT_EQ(STATUS::NO_DEFINITION, clProjectedDecoder.SetProjection(pclMsgDef->name, { "not_a_field" })) << szLog;
+      ASSERT_EQ(STATUS::SUCCESS, clProjectedDecoder.SetProjection(pclMsgDef->name, vPaths)) << szLog;
+
+      // Decode twice, as the projection is compiled by the first decode.
+      for (int32_t iPass = 0; iPass < 2; ++iPass)
+      {
+         MetaDataStruct stFullMetaData = stBinaryMetaData;
+         MetaDataStruct stProjectedMetaData = stBinaryMetaData;
+         ASSERT_EQ(STATUS::SUCCESS, pclMyMessageDecoder->Decode(acBinaryLog + stBinaryMetaData.uiHeaderLength, stFullMessage, stFullMetaData)) << szLog;
+         ASSERT_EQ(STATUS::SUCCESS, clProjectedDecoder.Decode(acBinaryLog + stBinaryMetaData.uiHeaderLength, stProjectedMessage, stProjectedMetaData)) << szLog;
+
+         std::set<std::string> sTopLevelNames;
+         for (const auto& strPath : vPaths)
+            sTopLevelNames.insert(strPath.substr(0, strPath.find('.')));
+         ASSERT_EQ(sTopLevelNames.size(), stProjectedMessage.size()) << szLog;
+         ExpectProjectedFields(stProjectedMessage, stFullMessage);
+      }
+
+      // Removing the projection decodes the whole message again.
+      ASSERT_EQ(STATUS::SUCCESS, clProjectedDecoder.SetProjection(pclMsgDef->name, {})) << szLog;
+      ASSERT_EQ(STATUS::SUCCESS, clProjectedDecoder.Decode(acBinaryLog + stBinaryMetaData.uiHeaderLength, stProjectedMessage, stBinaryMetaData)) << szLog;
+      ASSERT_EQ(stFullMessage.size(), stProjectedMessage.size()) << szLog;
+   }
+}
+
+TEST_F(DecodeEncodeTest, BINARY_PROJECTION_SHORT_MESSAGE)
+{
+   alignas(8) unsigned char aucLog[] = { 0xAA, 0x44, 0x12, 0x1C, 0x2A, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x00, 0xA4, 0xB4, 0xAC, 0x07, 0xD8, 0x16, 0x6D, 0x08, 0x08, 0x40, 0x00, 0x02, 0xF6, 0xB1, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xD7, 0x03, 0xB0, 0x4C, 0xE5, 0x8E, 0x49, 0x40, 0x52, 0xC4, 0x26, 0xD1, 0x72, 0x82, 0x5C, 0xC0, 0x29, 0xCB, 0x10, 0xC7, 0x7A, 0xA2, 0x90, 0x40, 0x33, 0x33, 0x87, 0xC1, 0x3D, 0x00, 0x00, 0x00, 0xFA, 0x7E, 0xBA, 0x3F, 0x3F, 0x57, 0x83, 0x3F, 0xA9, 0xA4, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x16, 0x00, 0x06, 0x39, 0x33, 0x23, 0xC4, 0x89, 0x7A };
+
+   IntermediateHeader stHeader;
+   MetaDataStruct stMetaData;
+   ASSERT_EQ(STATUS::SUCCESS, pclMyHeaderDecoder->Decode(aucLog, stHeader, stMetaData));
+
+   MessageDecoder clProjectedDecoder(pclMyJsonDb);
+   ASSERT_EQ(STATUS::SUCCESS, clProjectedDecoder.SetProjection("BESTPOS", { "latitude", "longitude" }));
+
+   // The body is 4-byte aligned, so the fixed offsets are used.  Longitude
+   // starts inside a body cut short at 20 bytes, but does not fit in it.
+   IntermediateMessage stMessage;
+   stMetaData.uiBinaryMsgLength = 20;
+   ASSERT_EQ(STATUS::SUCCESS, clProjectedDecoder.Decode(aucLog + stMetaData.uiHeaderLength, stMessage, stMetaData));
+   ASSERT_EQ(stMessage.size(), 1U);
+   ASSERT_EQ(stMessage.front().field_def->name, "latitude");
+
+   stMetaData.uiBinaryMsgLength = 24;
+   ASSERT_EQ(STATUS::SUCCESS, clProjectedDecoder.Decode(aucLog + stMetaData.uiHeaderLength, stMessage, stMetaData));
+   ASSERT_EQ(stMessage.size(), 2U);
+}
+
 // -------------------------------------------------------------------------------------------------------
 // Command Encoding Unit Tests
 // -------------------------------------------------------------------------------------------------------
@@ -3637,6 +3946,119 @@ TEST_F(CommandEncodeTest, COMMAND_ENCODE_BINARY_UALCONTROL)
    ASSERT_EQ(0, memcmp(acEncodeBuffer, aucExpectedCommand, sizeof(aucExpectedCommand)));
 }
 
+// -------------------------------------------------------------------------------------------------------
+// Command Template Unit Tests
+// -------------------------------------------------------------------------------------------------------
+TEST_F(CommandEncodeTest, COMMAND_TEMPLATE_ASCII_INSTHRESHOLDS)
+{
+   char aucCommandToCompile[] = "INSTHRESHOLDS LOW 0.0 0.0 0.0";
+   char aucCommandToEncode[] = "INSTHRESHOLDS LOW 1.5 0.25 3.0";
+   char acExpectedBuffer[MAX_ASCII_MESSAGE_LENGTH];
+   char acEncodeBuffer[MAX_ASCII_MESSAGE_LENGTH];
+   uint32_t uiEncodeBufferSize = sizeof(acEncodeBuffer);
+
+   CommandTemplate clTemplate;
+   ASSERT_FALSE(clTemplate.IsCompiled());
+   ASSERT_EQ(STATUS::NO_DEFINITION, clTemplate.Encode(acEncodeBuffer, uiEncodeBufferSize, ENCODEFORMAT::ASCII));
+
+   ASSERT_EQ(STATUS::SUCCESS, pclMyCommander->Compile(aucCommandToCompile, sizeof(aucCommandToCompile), clTemplate));
+   ASSERT_TRUE(clTemplate.IsCompiled());
+   ASSERT_EQ(4U, clTemplate.GetParameterCount());
+
+   // An unchanged template matches the command it was compiled from.
+   ASSERT_EQ(STATUS::SUCCESS, TestCommandConversion(aucCommandToCompile, sizeof(aucCommandToCompile), acExpectedBuffer, sizeof(acExpectedBuffer), ENCODEFORMAT::ASCII));
+   ASSERT_EQ(STATUS::SUCCESS, clTemplate.Encode(acEncodeBuffer, uiEncodeBufferSize, ENCODEFORMAT::ASCII));
+   ASSERT_EQ(strlen(acExpectedBuffer), uiEncodeBufferSize);
+   ASSERT_EQ(0, memcmp(acEncodeBuffer, acExpectedBuffer, uiEncodeBufferSize + 1));
+
+   ASSERT_EQ(STATUS::SUCCESS, clTemplate.SetParameter(0, "LOW"));
+   ASSERT_EQ(STATUS::SUCCESS, clTemplate.SetParameter(1, 1.5));
+   ASSERT_EQ(STATUS::SUCCESS, clTemplate.SetParameter(2, 0.25));
+   ASSERT_EQ(STATUS::SUCCESS, clTemplate.SetParameter(3, 3));
+   ASSERT_EQ(STATUS::MALFORMED_INPUT, clTemplate.SetParameter(0, "NOT_AN_ENUMERATOR"));
+   ASSERT_EQ(STATUS::MALFORMED_INPUT, clTemplate.SetParameter(1, "LOW"));
+   ASSERT_EQ(STATUS::MALFORMED_INPUT, clTemplate.SetParameter(4, 1.0));
+
+   ASSERT_EQ(STATUS::SUCCESS, TestCommandConversion(aucCommandToEncode, sizeof(aucCommandToEncode), acExpectedBuffer, sizeof(acExpectedBuffer), ENCODEFORMAT::ASCII));
+   uiEncodeBufferSize = sizeof(acEncodeBuffer);
+   ASSERT_EQ(STATUS::SUCCESS, clTemplate.Encode(acEncodeBuffer, uiEncodeBufferSize, ENCODEFORMAT::ASCII));
+   ASSERT_EQ(0, memcmp(acEncodeBuffer, acExpectedBuffer, uiEncodeBufferSize + 1));
+
+   uiEncodeBufferSize = 10;
+   ASSERT_EQ(STATUS::BUFFER_FULL, clTemplate.Encode(acEncodeBuffer, uiEncodeBufferSize, ENCODEFORMAT::ASCII));
+   ASSERT_EQ(STATUS::UNSUPPORTED, clTemplate.Encode(acEncodeBuffer, uiEncodeBufferSize, ENCODEFORMAT::JSON));
+}
+
+TEST_F(CommandEncodeTest, COMMAND_TEMPLATE_BINARY_CONFIGCODE)
+{
+   char aucCommandToCompile[] = "CONFIGCODE ERASE_TABLE \"WJ4HDW\" \"GM5Z99\" \"T2M7DP\" \"KG2T8T\" \"KF7GKR\" \"TABLECLEAR\"";
+   char aucCommandToEncode[] = "CONFIGCODE ERASE_TABLE \"WJ4HDW\" \"GM5Z99\" \"T2M7DP\" \"KG2T8T\" \"KF7GKR\" \"CLEAR\"";
+   char acExpectedBuffer[MAX_ASCII_MESSAGE_LENGTH];
+   char acEncodeBuffer[MAX_ASCII_MESSAGE_LENGTH];
+   uint32_t uiExpectedBufferSize = sizeof(acExpectedBuffer);
+   uint32_t uiEncodeBufferSize = sizeof(acEncodeBuffer);
+
+   CommandTemplate clTemplate;
+   ASSERT_EQ(STATUS::SUCCESS, pclMyCommander->Compile(aucCommandToCompile, sizeof(aucCommandToCompile), clTemplate));
+
+   ASSERT_EQ(STATUS::SUCCESS, pclMyCommander->Encode(aucCommandToCompile, sizeof(aucCommandToCompile), acExpectedBuffer, uiExpectedBufferSize, ENCODEFORMAT::BINARY));
+   ASSERT_EQ(STATUS::SUCCESS, clTemplate.Encode(acEncodeBuffer, uiEncodeBufferSize, ENCODEFORMAT::BINARY));
+   ASSERT_EQ(uiExpectedBufferSize, uiEncodeBufferSize);
+   ASSERT_EQ(0, memcmp(acEncodeBuffer, acExpectedBuffer, uiEncodeBufferSize));
+
+   const uint32_t uiLastSlot = clTemplate.GetParameterCount() - 1;
+   ASSERT_EQ(STATUS::SUCCESS, clTemplate.SetParameter(uiLastSlot, "CLEAR"));
+   ASSERT_EQ(STATUS::BUFFER_FULL, clTemplate.SetParameter(uiLastSlot, "THIS_STRING_IS_FAR_TOO_LONG_FOR_A_CONFIGCODE_FIELD"));
+
+   // The limit is the field's maximum length, whatever the string's capacity.
+   const auto* pclStringField = dynamic_cast<const ArrayField*>(clTemplate.GetParameterDefinition(uiLastSlot));
+   ASSERT_NE(pclStringField, nullptr);
+   const size_t ullMaxLength = static_cast<size_t>(pclStringField->arrayLength) * pclStringField->dataType.length;
+   ASSERT_EQ(STATUS::SUCCESS, clTemplate.SetParameter(uiLastSlot, std::string(ullMaxLength, 'A').c_str()));
+   ASSERT_EQ(STATUS::BUFFER_FULL, clTemplate.SetParameter(uiLastSlot, std::string(ullMaxLength + 1, 'A').c_str()));
+   ASSERT_EQ(STATUS::SUCCESS, clTemplate.SetParameter(uiLastSlot, "CLEAR"));
+
+   uiExpectedBufferSize = sizeof(acExpectedBuffer);
+   uiEncodeBufferSize = sizeof(acEncodeBuffer);
+   ASSERT_EQ(STATUS::SUCCESS, pclMyCommander->Encode(aucCommandToEncode, sizeof(aucCommandToEncode), acExpectedBuffer, uiExpectedBufferSize, ENCODEFORMAT::BINARY));
+   ASSERT_EQ(STATUS::SUCCESS, clTemplate.Encode(acEncodeBuffer, uiEncodeBufferSize, ENCODEFORMAT::BINARY));
+   ASSERT_EQ(uiExpectedBufferSize, uiEncodeBufferSize);
+   ASSERT_EQ(0, memcmp(acEncodeBuffer, acExpectedBuffer, uiEncodeBufferSize));
+}
+
+TEST_F(CommandEncodeTest, BENCHMARK_COMMAND_TEMPLATE_BINARY_UALCONTROL)
+{
+   constexpr uint32_t uiMaxCount = 100000;
+   char aucCommandToEncode[] = "UALCONTROL ENABLE 2.0 1.0";
+   char acEncodeBuffer[MAX_ASCII_MESSAGE_LENGTH];
+   uint32_t uiEncodeBufferSize = 0;
+   bool bFailedOnce = false;
+
+   CommandTemplate clTemplate;
+   ASSERT_EQ(STATUS::SUCCESS, pclMyCommander->Compile(aucCommandToEncode, sizeof(aucCommandToEncode), clTemplate));
+
+   auto start = std::chrono::system_clock::now();
+   for (uint32_t uiCount = 0; uiCount < uiMaxCount && !bFailedOnce; uiCount++)
+   {
+      uiEncodeBufferSize = sizeof(acEncodeBuffer);
+      bFailedOnce = STATUS::SUCCESS != pclMyCommander->Encode(aucCommandToEncode, sizeof(aucCommandToEncode), acEncodeBuffer, uiEncodeBufferSize, ENCODEFORMAT::BINARY);
+   }
+   std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+   printf("Commander::Encode TIME ELAPSED: %lf seconds.\nCommands/sec: %lf\n", elapsed_seconds.count(), uiMaxCount / elapsed_seconds.count());
+   ASSERT_FALSE(bFailedOnce);
+
+   start = std::chrono::system_clock::now();
+   for (uint32_t uiCount = 0; uiCount < uiMaxCount && !bFailedOnce; uiCount++)
+   {
+      uiEncodeBufferSize = sizeof(acEncodeBuffer);
+      bFailedOnce = STATUS::SUCCESS != clTemplate.SetParameter(1, static_cast<double>(uiCount)) ||
+                    STATUS::SUCCESS != clTemplate.Encode(acEncodeBuffer, uiEncodeBufferSize, ENCODEFORMAT::BINARY);
+   }
+   elapsed_seconds = std::chrono::system_clock::now() - start;
+   printf("CommandTemplate::Encode TIME ELAPSED: %lf seconds.\nCommands/sec: %lf\n", elapsed_seconds.count(), uiMaxCount / elapsed_seconds.count());
+   ASSERT_FALSE(bFailedOnce);
+}
+
 
 // -------------------------------------------------------------------------------------------------------
 // Decode/Encode Benchmark Unit Tests
@@ -4021,6 +4443,7 @@ protected:
          pclMyJsonDb->LoadFile(*TEST_DB_PATH);
          pclMyHeaderDecoder = new HeaderDecoder(pclMyJsonDb);
          pclMyFilter = new Filter();
+         pclMyFilter->LoadJsonDb(pclMyJsonDb);
       }
       catch (JsonReaderFailure& e)
       {
@@ -4086,7 +4509,7 @@ public:
          return false;
       }
 
-      return pclMyFilter->DoFiltering(stMetaData);
+      return pclMyFilter->DoFiltering(stMetaData, pucMessage_ + stMetaData.uiHeaderLength);
    }
 };
 JsonReader* FilterTest::pclMyJsonDb = nullptr;
@@ -4361,6 +4784,54 @@ TEST_F(FilterTest, DECIMATION)
    ASSERT_TRUE(TestFilter(const_cast<unsigned char*>(reinterpret_cast<const unsigned char*>(bestpos_log_20Hz5))));
 }
 
+TEST_F(FilterTest, MESSAGE_DECIMATION)
+{
+   const auto BestPos = [](const std::string& strName_, const std::string& strSeconds_) {
+      return "#" + strName_ + ",COM1,0,8.5,FINESTEERING,2180," + strSeconds_ + ",02000020,cdba,32768;SOL_COMPUTED,SINGLE,51.15043043561,-114.03067194872,1097.5245,-17.0000,WGS84,0.9659,0.6980,1.7027,\"\",0.000,0.000,36,32,32,32,00,06,39,33*3bed5c1b\r\n";
+   };
+   const auto Test = [this](const std::string& strLog_) {
+      return TestFilter(reinterpret_cast<unsigned char*>(const_cast<char*>(strLog_.c_str())));
+   };
+   const char* bestutm_log = "#BESTUTMA,COM1,0,8.5,FINESTEERING,2180,324435.000,02000020,eb16,32768;SOL_COMPUTED,SINGLE,11,U,5666936.4417,707279.3875,1063.8401,-16.2712,WGS84,1.0850,0.9284,2.3338,\"\",0.000,0.000,22,22,22,0,00,02,11,11*a6d06321\r\n";
+
+   pclMyFilter->SetIncludeDecimation(42, 0.1);
+
+   // BESTPOS at 20 Hz is kept at 10 Hz, though the times are not multiples
+   // of the period.
+   ASSERT_TRUE(Test(BestPos("BESTPOSA", "324435.050")));
+   ASSERT_FALSE(Test(BestPos("BESTPOSA", "324435.100")));
+   ASSERT_TRUE(Test(BestPos("BESTPOSA", "324435.150")));
+   ASSERT_FALSE(Test(BestPos("BESTPOSA", "324435.200")));
+   ASSERT_TRUE(Test(BestPos("BESTPOSA", "324435.250")));
+
+   // Each antenna source is decimated on its own, and other messages are not
+   // decimated.
+   ASSERT_TRUE(Test(BestPos("BESTPOSA_1", "324435.300")));
+   ASSERT_FALSE(Test(BestPos("BESTPOSA_1", "324435.350")));
+   ASSERT_TRUE(Test(bestutm_log));
+   ASSERT_TRUE(Test(bestutm_log));
+
+   // BESTUTM has its own period.
+   pclMyFilter->SetIncludeDecimation(726, 1.0);
+   ASSERT_TRUE(Test(bestutm_log));
+   ASSERT_FALSE(Test(bestutm_log));
+   ASSERT_TRUE(Test(BestPos("BESTPOSA", "324435.350")));
+
+   // A time before the last kept message starts decimation again.
+   ASSERT_TRUE(Test(BestPos("BESTPOSA", "324435.000")));
+   ASSERT_FALSE(Test(BestPos("BESTPOSA", "324435.050")));
+
+   // A message rejected by another filter is not counted as kept.
+   pclMyFilter->IncludeTimeStatus(TIME_STATUS::COARSESTEERING);
+   ASSERT_FALSE(Test(BestPos("BESTPOSA", "324436.000")));
+   pclMyFilter->InvertTimeStatusFilter(true);
+   ASSERT_TRUE(Test(BestPos("BESTPOSA", "324436.000")));
+
+   // A period of zero stops decimating the message.
+   pclMyFilter->SetIncludeDecimation(42, 0.0);
+   ASSERT_TRUE(Test(BestPos("BESTPOSA", "324436.000")));
+}
+
 TEST_F(FilterTest, MIX_1)
 {
    const char* bestposa_log_1 = "#BESTPOSA,COM1,0,8.0,FINESTEERING,2180,313698.000,024000a0,cdba,32768;SOL_COMPUTED,SINGLE,51.15045046450,-114.03068725072,1097.2706,-17.0000,WGS84,1.3811,1.1629,3.1178,\"\",0.000,0.000,24,22,22,0,00,02,11,11*c64c3d4a\r\n";
@@ -4593,6 +5064,99 @@ TEST_F(FilterTest, MIX_2_INVERTED)
    ASSERT_FALSE(TestFilter(const_cast<unsigned char*>(reinterpret_cast<const unsigned char*>(filtered_log_5))));
 }
 
+TEST_F(FilterTest, FIELD_VALUE_ENUM)
+{
+   unsigned char aucLog[] = { 0xAA, 0x44, 0x12, 0x1C, 0x2A, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x00, 0xA4, 0xB4, 0xAC, 0x07, 0xD8, 0x16, 0x6D, 0x08, 0x08, 0x40, 0x00, 0x02, 0xF6, 0xB1, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xD7, 0x03, 0xB0, 0x4C, 0xE5, 0x8E, 0x49, 0x40, 0x52, 0xC4, 0x26, 0xD1, 0x72, 0x82, 0x5C, 0xC0, 0x29, 0xCB, 0x10, 0xC7, 0x7A, 0xA2, 0x90, 0x40, 0x33, 0x33, 0x87, 0xC1, 0x3D, 0x00, 0x00, 0x00, 0xFA, 0x7E, 0xBA, 0x3F, 0x3F, 0x57, 0x83, 0x3F, 0xA9, 0xA4, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x16, 0x00, 0x06, 0x39, 0x33, 0x23, 0xC4, 0x89, 0x7A };
+   const char* log = "#BESTPOSA,COM1,0,8.0,FINESTEERING,2180,313698.000,024000a0,cdba,32768;SOL_COMPUTED,NARROW_INT,51.15045046450,-114.03068725072,1097.2706,-17.0000,WGS84,1.3811,1.1629,3.1178,\"\",0.000,0.000,24,22,22,0,00,02,11,11*c64c3d4a\r\n";
+
+   ASSERT_EQ(pclMyFilter->IncludeFieldValue("BESTPOS", "position_type", FIELD_COMPARISON::EQUAL, "SINGLE"), STATUS::SUCCESS);
+   ASSERT_TRUE(TestFilter(aucLog));
+
+   pclMyFilter->ClearFilters();
+   ASSERT_EQ(pclMyFilter->IncludeFieldValue("BESTPOS", "position_type", FIELD_COMPARISON::EQUAL, "NARROW_INT"), STATUS::SUCCESS);
+   ASSERT_FALSE(TestFilter(aucLog));
+   // Field value predicates only inspect binary bodies, ASCII logs are left to the decoded stage.
+   ASSERT_TRUE(TestFilter(const_cast<unsigned char*>(reinterpret_cast<const unsigned char*>(log))));
+
+   pclMyFilter->ClearFilters();
+   ASSERT_EQ(pclMyFilter->IncludeFieldValue("BESTPOS", "position_type", FIELD_COMPARISON::NOT_EQUAL, "NARROW_INT"), STATUS::SUCCESS);
+   ASSERT_TRUE(TestFilter(aucLog));
+}
+
+TEST_F(FilterTest, FIELD_VALUE_NUMBER)
+{
+   unsigned char aucLog[] = { 0xAA, 0x44, 0x12, 0x1C, 0x2A, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x00, 0xA4, 0xB4, 0xAC, 0x07, 0xD8, 0x16, 0x6D, 0x08, 0x08, 0x40, 0x00, 0x02, 0xF6, 0xB1, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xD7, 0x03, 0xB0, 0x4C, 0xE5, 0x8E, 0x49, 0x40, 0x52, 0xC4, 0x26, 0xD1, 0x72, 0x82, 0x5C, 0xC0, 0x29, 0xCB, 0x10, 0xC7, 0x7A, 0xA2, 0x90, 0x40, 0x33, 0x33, 0x87, 0xC1, 0x3D, 0x00, 0x00, 0x00, 0xFA, 0x7E, 0xBA, 0x3F, 0x3F, 0x57, 0x83, 0x3F, 0xA9, 0xA4, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x16, 0x00, 0x06, 0x39, 0x33, 0x23, 0xC4, 0x89, 0x7A };
+
+   ASSERT_EQ(pclMyFilter->IncludeFieldValue("BESTPOS", "num_svs", FIELD_COMPARISON::GREATER, 20), STATUS::SUCCESS);
+   ASSERT_EQ(pclMyFilter->IncludeFieldValue("BESTPOS", "latitude", FIELD_COMPARISON::GREATER_OR_EQUAL, 51.0), STATUS::SUCCESS);
+   ASSERT_TRUE(TestFilter(aucLog));
+
+   ASSERT_EQ(pclMyFilter->IncludeFieldValue("BESTPOS", "latitude", FIELD_COMPARISON::LESS, 0.0), STATUS::SUCCESS);
+   ASSERT_FALSE(TestFilter(aucLog));
+
+   pclMyFilter->ClearFilters();
+   ASSERT_EQ(pclMyFilter->IncludeFieldValue("BESTPOS", "num_svs", FIELD_COMPARISON::LESS_OR_EQUAL, 21), STATUS::SUCCESS);
+   ASSERT_FALSE(TestFilter(aucLog));
+}
+
+TEST_F(FilterTest, FIELD_VALUE_ARRAY)
+{
+   // A RANGE log with just the fields of each observation that matter here.
+   JsonReader clJsonDb;
+   clJsonDb.ParseJson(R"({"enums": [], "logs": [{"_id": "RANGE", "messageID": 43, "name": "RANGE", "description": null, "latestMsgDefCrc": "4660", "fields": {"4660": [
+      {"name": "obs", "description": null, "type": "FIELD_ARRAY", "arrayLength": 325, "conversionString": null, "dataType": {"name": "UNKNOWN", "length": 0, "description": null}, "fields": [
+         {"name": "prn", "description": null, "type": "SIMPLE", "conversionString": "%hu", "dataType": {"name": "USHORT", "length": 2, "description": null}},
+         {"name": "glofreq", "description": null, "type": "SIMPLE", "conversionString": "%hu", "dataType": {"name": "USHORT", "length": 2, "description": null}},
+         {"name": "psr", "description": null, "type": "SIMPLE", "conversionString": "%.3lf", "dataType": {"name": "DOUBLE", "length": 8, "description": null}},
+         {"name": "cno", "description": null, "type": "SIMPLE", "conversionString": "%.1f", "dataType": {"name": "FLOAT", "length": 4, "description": null}},
+         {"name": "ch_tr_status", "description": null, "type": "SIMPLE", "conversionString": "%08lx", "dataType": {"name": "ULONG", "length": 4, "description": null}}]}]}}]})");
+
+   Filter clFilter;
+   clFilter.LoadJsonDb(&clJsonDb);
+   ASSERT_EQ(clFilter.IncludeFieldValue("RANGE", "obs.cno", FIELD_COMPARISON::GREATER, 35), STATUS::SUCCESS);
+
+   // Observations are 20 bytes, after the ULONG count of them.
+   const auto RangeBody = [](const std::vector<float>& vCNo_) {
+      std::vector<unsigned char> vBody(sizeof(uint32_t) + vCNo_.size() * 20, 0);
+      const auto uiCount = static_cast<uint32_t>(vCNo_.size());
+      memcpy(vBody.data(), &uiCount, sizeof(uiCount));
+      for (size_t i = 0; i < vCNo_.size(); i++)
+      {
+         memcpy(vBody.data() + sizeof(uint32_t) + i * 20 + 12, &vCNo_[i], sizeof(float));
+      }
+      return vBody;
+   };
+   const auto TestRange = [&clFilter](std::vector<unsigned char>& vBody_) {
+      MetaDataStruct stMetaData;
+      stMetaData.eFormat = HEADERFORMAT::BINARY;
+      stMetaData.usMessageID = 43;
+      stMetaData.uiMessageCRC = 4660;
+      stMetaData.uiBinaryMsgLength = static_cast<uint32_t>(vBody_.size());
+      return clFilter.DoFiltering(stMetaData, vBody_.data());
+   };
+
+   // Only the third observation is above 35 dB-Hz.
+   std::vector<unsigned char> vOneMatch = RangeBody({ 30.0F, 32.5F, 41.0F, 28.0F });
+   ASSERT_TRUE(TestRange(vOneMatch));
+
+   std::vector<unsigned char> vNoMatch = RangeBody({ 30.0F, 32.5F, 35.0F, 28.0F });
+   ASSERT_FALSE(TestRange(vNoMatch));
+
+   std::vector<unsigned char> vNoObservations = RangeBody({});
+   ASSERT_FALSE(TestRange(vNoObservations));
+}
+
+TEST_F(FilterTest, FIELD_VALUE_ERRORS)
+{
+   Filter clFilter;
+   ASSERT_EQ(clFilter.IncludeFieldValue("BESTPOS", "num_svs", FIELD_COMPARISON::EQUAL, 1), STATUS::NO_DATABASE);
+
+   ASSERT_EQ(pclMyFilter->IncludeFieldValue("NOTAMESSAGE", "num_svs", FIELD_COMPARISON::EQUAL, 1), STATUS::NO_DEFINITION);
+   ASSERT_EQ(pclMyFilter->IncludeFieldValue("BESTPOS", "not_a_field", FIELD_COMPARISON::EQUAL, 1), STATUS::NO_DEFINITION);
+   ASSERT_EQ(pclMyFilter->IncludeFieldValue("BESTPOS", "position_type", FIELD_COMPARISON::EQUAL, "NOT_AN_ENUMERATOR"), STATUS::NO_DEFINITION);
+   ASSERT_EQ(pclMyFilter->IncludeFieldValue("BESTPOS", "base_id", FIELD_COMPARISON::EQUAL, 1), STATUS::UNSUPPORTED);
+}
+
 // -------------------------------------------------------------------------------------------------------
 // FileParser Unit Tests
 // -------------------------------------------------------------------------------------------------------
@@ -4745,6 +5309,237 @@ TEST_F(FileParserTest, PARSE_FILE_WITH_FILTER)
    ASSERT_EQ(numSuccess, 2);
 }
 
+TEST_F(FileParserTest, STATISTICS)
+{
+   FileParser clFileParser(*TEST_DB_PATH);
+   clFileParser.SetEncodeFormat(ENCODEFORMAT::ASCII);
+
+   std::filesystem::path test_gps_file = std::filesystem::path(*TEST_RESOURCE_PATH) / "BESTUTMBIN.GPS";
+   InputFileStream clInputFileStream = InputFileStream(test_gps_file.string().c_str());
+   ASSERT_TRUE(clFileParser.SetStream(&clInputFileStream));
+
+   MetaDataStruct stMetaData;
+   MessageDataStruct stMessageData;
+
+   // Nothing is collected until statistics are enabled.
+   ASSERT_EQ(clFileParser.GetStatistics().GetStage(PARSER_STAGE::FRAMER).ullCalls, 0ULL);
+   clFileParser.EnableStatistics(true);
+
+   uint64_t ullSuccesses = 0;
+   std::map<uint16_t, uint64_t> mExpectedMessageIds;
+   STATUS eStatus = STATUS::UNKNOWN;
+   while (eStatus != STATUS::STREAM_EMPTY)
+   {
+      eStatus = clFileParser.Read(stMessageData, stMetaData);
+      if (eStatus == STATUS::SUCCESS)
+      {
+         ullSuccesses++;
+         mExpectedMessageIds[stMetaData.usMessageID]++;
+      }
+   }
+   ASSERT_GT(ullSuccesses, 0ULL);
+
+   const ParserStatistics stStatistics = clFileParser.GetStatistics();
+   ASSERT_EQ(stStatistics.GetReadStatus(STATUS::SUCCESS), ullSuccesses);
+   for (const auto& [usMessageId, ullCount] : mExpectedMessageIds)
+   {
+      ASSERT_GE(stStatistics.mMessageIds.at(usMessageId), ullCount);
+   }
+   ASSERT_GE(std::accumulate(stStatistics.aullHeaderFormat.begin(), stStatistics.aullHeaderFormat.end(), 0ULL), ullSuccesses);
+   ASSERT_GT(stStatistics.ullUnknownBytes, 0ULL);
+   ASSERT_GT(stStatistics.GetStage(PARSER_STAGE::FRAMER).ullCalls, ullSuccesses);
+   ASSERT_GE(stStatistics.GetStage(PARSER_STAGE::HEADER_DECODER).ullCalls, ullSuccesses);
+   ASSERT_EQ(stStatistics.GetStage(PARSER_STAGE::FILTER).ullCalls, 0ULL);
+   ASSERT_GE(stStatistics.GetStage(PARSER_STAGE::MESSAGE_DECODER).ullCalls, ullSuccesses);
+   ASSERT_GE(stStatistics.GetStage(PARSER_STAGE::ENCODER).ullCalls, ullSuccesses);
+   ASSERT_GT(stStatistics.GetStage(PARSER_STAGE::ENCODER).ullNanoseconds, 0ULL);
+
+   clFileParser.ResetStatistics();
+   ASSERT_EQ(clFileParser.GetStatistics().GetReadStatus(STATUS::SUCCESS), 0ULL);
+   ASSERT_TRUE(clFileParser.GetStatistics().mMessageIds.empty());
+}
+
+TEST_F(FileParserTest, ENCODE_FORMATS)
+{
+   const std::vector<ENCODEFORMAT> vFormats = { ENCODEFORMAT::ASCII, ENCODEFORMAT::JSON, ENCODEFORMAT::FLATTENED_BINARY, ENCODEFORMAT::BINARY };
+
+   // RXCONFIG logs are converted rather than encoded, so add one to the file.
+   const std::string sLogFile = (std::filesystem::temp_directory_path() / "edie_encode_formats_test.GPS").string();
+   {
+      std::ofstream clFile(sLogFile, std::ios::binary);
+      clFile << "#RXCONFIGA,COM1,0,54.0,FINESTEERING,2172,155744.316,02010000,f702,16248;#INTERFACEMODEA,COM1,0,54.0,FINESTEERING,2172,155744.316,02010000,f702,16248;COM1,NOVATEL,NOVATEL,ON*ca0f5c51*71be1427\r\n";
+      clFile << std::ifstream(std::filesystem::path(*TEST_RESOURCE_PATH) / "BESTUTMBIN.GPS", std::ios::binary).rdbuf();
+   }
+
+   MetaDataStruct stMetaData;
+   MessageDataStruct stMessageData;
+   STATUS eStatus = STATUS::UNKNOWN;
+
+   // Encode each format with a FileParser of its own.
+   std::vector<std::vector<std::string>> vExpected(vFormats.size());
+   for (size_t i = 0; i < vFormats.size(); i++)
+   {
+      FileParser clFileParser(*TEST_DB_PATH);
+      clFileParser.SetEncodeFormat(vFormats[i]);
+      InputFileStream clInputFileStream(sLogFile.c_str());
+      ASSERT_TRUE(clFileParser.SetStream(&clInputFileStream));
+      for (eStatus = STATUS::UNKNOWN; eStatus != STATUS::STREAM_EMPTY;)
+      {
+         eStatus = clFileParser.Read(stMessageData, stMetaData);
+         if (eStatus == STATUS::SUCCESS)
+         {
+            vExpected[i].emplace_back(reinterpret_cast<char*>(stMessageData.pucMessage), stMessageData.uiMessageLength);
+         }
+      }
+   }
+   ASSERT_GE(vExpected.front().size(), 2U);
+
+   FileParser clFileParser(*TEST_DB_PATH);
+   clFileParser.SetEncodeFormats(vFormats);
+   ASSERT_EQ(clFileParser.GetEncodeFormats(), vFormats);
+   InputFileStream clInputFileStream(sLogFile.c_str());
+   ASSERT_TRUE(clFileParser.SetStream(&clInputFileStream));
+
+   std::vector<MessageDataStruct> vMessageData;
+   size_t ullLog = 0;
+   for (eStatus = STATUS::UNKNOWN; eStatus != STATUS::STREAM_EMPTY;)
+   {
+      eStatus = clFileParser.Read(vMessageData, stMetaData);
+      if (eStatus == STATUS::SUCCESS)
+      {
+         ASSERT_EQ(vMessageData.size(), vFormats.size());
+         for (size_t i = 0; i < vFormats.size(); i++)
+         {
+            ASSERT_LT(ullLog, vExpected[i].size());
+            ASSERT_EQ(std::string(reinterpret_cast<char*>(vMessageData[i].pucMessage), vMessageData[i].uiMessageLength), vExpected[i][ullLog]);
+            ASSERT_GE(vMessageData[i].pucMessageBody, vMessageData[i].pucMessage);
+            ASSERT_LE(vMessageData[i].pucMessageBody + vMessageData[i].uiMessageBodyLength, vMessageData[i].pucMessage + vMessageData[i].uiMessageLength);
+         }
+         ullLog++;
+      }
+   }
+   ASSERT_EQ(ullLog, vExpected.front().size());
+
+   // Without encode formats, the one set by SetEncodeFormat() is used.
+   clFileParser.SetEncodeFormats({});
+   clFileParser.SetEncodeFormat(ENCODEFORMAT::JSON);
+   ASSERT_TRUE(clFileParser.Reset());
+   ASSERT_EQ(clFileParser.Read(vMessageData, stMetaData), STATUS::SUCCESS);
+   ASSERT_EQ(vMessageData.size(), 1U);
+   ASSERT_EQ(std::string(reinterpret_cast<char*>(vMessageData[0].pucMessage), vMessageData[0].uiMessageLength), vExpected[1][0]);
+
+   std::filesystem::remove(sLogFile);
+}
+
+TEST_F(FileParserTest, ENCODE_SINK)
+{
+   class StringOutputStream : public OutputStreamInterface
+   {
+   public:
+      std::string sData;
+
+      uint32_t WriteData(char* pcData_, uint32_t uiDataLength_) override
+      {
+         sData.append(pcData_, uiDataLength_);
+         return uiDataLength_;
+      }
+   };
+
+   const std::filesystem::path clLogFile = std::filesystem::path(*TEST_RESOURCE_PATH) / "BESTUTMBIN.GPS";
+   MetaDataStruct stMetaData;
+   MessageDataStruct stMessageData;
+   STATUS eStatus = STATUS::UNKNOWN;
+
+   // Encode into the internal buffer first.
+   std::string sExpected;
+   {
+      FileParser clFileParser(*TEST_DB_PATH);
+      clFileParser.SetEncodeFormat(ENCODEFORMAT::JSON);
+      InputFileStream clInputFileStream(clLogFile.string().c_str());
+      ASSERT_TRUE(clFileParser.SetStream(&clInputFileStream));
+      for (eStatus = STATUS::UNKNOWN; eStatus != STATUS::STREAM_EMPTY;)
+      {
+         eStatus = clFileParser.Read(stMessageData, stMetaData);
+         if (eStatus == STATUS::SUCCESS)
+         {
+            sExpected.append(reinterpret_cast<char*>(stMessageData.pucMessage), stMessageData.uiMessageLength);
+         }
+      }
+   }
+   ASSERT_FALSE(sExpected.empty());
+
+   // Every message read is written to the stream as it is encoded.
+   StringOutputStream clOutputStream;
+   OutputStreamEncodeSink clSink(&clOutputStream);
+   FileParser clFileParser(*TEST_DB_PATH);
+   clFileParser.SetEncodeFormat(ENCODEFORMAT::JSON);
+   clFileParser.SetEncodeSink(&clSink);
+   ASSERT_EQ(clFileParser.GetEncodeSink(), &clSink);
+   InputFileStream clInputFileStream(clLogFile.string().c_str());
+   ASSERT_TRUE(clFileParser.SetStream(&clInputFileStream));
+   for (eStatus = STATUS::UNKNOWN; eStatus != STATUS::STREAM_EMPTY;)
+   {
+      eStatus = clFileParser.Read(stMessageData, stMetaData);
+      if (eStatus == STATUS::SUCCESS)
+      {
+         ASSERT_EQ(stMessageData.pucMessage, clSink.GetData());
+         ASSERT_EQ(stMessageData.uiMessageLength, clSink.GetSize());
+      }
+   }
+   ASSERT_EQ(clOutputStream.sData, sExpected);
+   ASSERT_EQ(clSink.GetBytesWritten(), sExpected.size());
+
+   // A sink that cannot hold a message fails to encode it.
+   GrowableEncodeSink clSmallSink(MESSAGE_SIZE_MAX / 2);
+   clFileParser.SetEncodeSink(&clSmallSink);
+   ASSERT_TRUE(clFileParser.Reset());
+   for (eStatus = STATUS::UNKNOWN; eStatus != STATUS::STREAM_EMPTY;)
+   {
+      eStatus = clFileParser.Read(stMessageData, stMetaData);
+      ASSERT_NE(eStatus, STATUS::SUCCESS);
+   }
+   ASSERT_EQ(clSmallSink.GetCapacity(), 0U);
+}
+
+TEST_F(FileParserTest, ENCODE_SINK_MAX_SIZE)
+{
+   // A log of 20000 ULONGs, which is about 80 KB as BINARY.  The Encoder also
+   // needs a Responses enum.
+   JsonReader clJsonDb;
+   clJsonDb.ParseJson(R"({"enums": [{"_id": "0", "name": "Responses", "enumerators": []}], "logs": [{"_id": "BIGLOG", "messageID": 9000, "name": "BIGLOG", "description": null, "latestMsgDefCrc": "4660", "fields": {"4660": [
+      {"name": "values", "description": null, "type": "VARIABLE_LENGTH_ARRAY", "arrayLength": 20000, "conversionString": "%lu", "dataType": {"name": "ULONG", "length": 4, "description": null}}]}}]})");
+   const BaseField* pclValuesField = clJsonDb.GetMsgDef(9000)->fields.at(4660)[0];
+
+   IntermediateMessage stMessage;
+   auto& vValues = std::get<std::vector<FieldContainer>>(stMessage.emplace_back(std::vector<FieldContainer>(), pclValuesField).field_value);
+   vValues.reserve(20000);
+   for (uint32_t i = 0; i < 20000; i++)
+   {
+      vValues.emplace_back(i, pclValuesField);
+   }
+   IntermediateHeader stHeader;
+   stHeader.usMessageID = 9000;
+   stHeader.uiMessageDefinitionCRC = 4660;
+   MetaDataStruct stMetaData;
+   stMetaData.usMessageID = 9000;
+   stMetaData.uiMessageCRC = 4660;
+   MessageDataStruct stMessageData;
+   Encoder clEncoder(&clJsonDb);
+
+   // The log fits in three times MESSAGE_SIZE_MAX but not in twice it, so the
+   // sink must be grown to exactly its maximum rather than doubled past it.
+   GrowableEncodeSink clSink(3 * MESSAGE_SIZE_MAX);
+   ASSERT_EQ(clEncoder.Encode(clSink, stHeader, stMessage, stMessageData, stMetaData, ENCODEFORMAT::BINARY), STATUS::SUCCESS);
+   ASSERT_EQ(clSink.GetCapacity(), 3U * MESSAGE_SIZE_MAX);
+   ASSERT_EQ(stMessageData.uiMessageLength, OEM4_BINARY_HEADER_LENGTH + sizeof(uint32_t) + 20000 * sizeof(uint32_t) + OEM4_BINARY_CRC_LENGTH);
+   ASSERT_EQ(clSink.GetSize(), stMessageData.uiMessageLength);
+
+   // A sink one byte short of the log fails once it has reached its maximum.
+   GrowableEncodeSink clShortSink(stMessageData.uiMessageLength - 1);
+   ASSERT_EQ(clEncoder.Encode(clShortSink, stHeader, stMessage, stMessageData, stMetaData, ENCODEFORMAT::BINARY), STATUS::BUFFER_FULL);
+   ASSERT_EQ(clShortSink.GetCapacity(), clShortSink.GetMaxSize());
+}
+
 TEST_F(FileParserTest, RESET)
 {
    pclFp = new FileParser();
@@ -4752,6 +5547,864 @@ TEST_F(FileParserTest, RESET)
    ASSERT_TRUE(pclFp->Reset());
 }
 
+// -------------------------------------------------------------------------------------------------------
+// FileIndex Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class FileIndexTest : public ::testing::Test
+{
+protected:
+   static constexpr uint32_t uiWEEK = 2163;
+   static constexpr uint32_t uiSECONDS = 3600;
+   static inline std::string sLogFile;
+   static inline JsonReader clJsonDb;
+
+   static std::string AsciiLog(const std::string& sHeader_, uint32_t uiSecond_, const std::string& sBody_)
+   {
+      char acTime[32];
+      snprintf(acTime, sizeof(acTime), "%u,%u.000", uiWEEK, uiSecond_);
+      const std::string sLog = sHeader_ + ",COM1,0,83.5,FINESTEERING," + acTime + ",02400000,b1f6,16248;" + sBody_;
+      char acCrc[16];
+      snprintf(acCrc, sizeof(acCrc), "*%08x\r\n", CalculateBlockCRC32(static_cast<uint32_t>(sLog.size()), 0, reinterpret_cast<const unsigned char*>(sLog.data())));
+      return "#" + sLog + acCrc;
+   }
+
+   // An hour of BESTPOS logs at 1 Hz, with a BESTUTM log and some garbage
+   // every ten seconds.
+   static void SetUpTestSuite()
+   {
+      clJsonDb.LoadFile(*TEST_DB_PATH);
+      sLogFile = (std::filesystem::temp_directory_path() / "edie_file_index_test.ASC").string();
+      std::ofstream clFile(sLogFile, std::ios::binary);
+      for (uint32_t i = 0; i < uiSECONDS; i++)
+      {
+         clFile << AsciiLog("BESTPOSA", i, "SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01");
+         if (i % 10 == 0)
+         {
+            clFile << AsciiLog("BESTUTMA", i, "SOL_COMPUTED,WAAS,11,U,5670746.0187,707662.0088,1098.7489,-17.0000,WGS84,0.8816,0.6843,1.9549,\"131\",4.000,0.000,30,9,9,9,0,06,00,03");
+            clFile << "garbage\r\n";
+         }
+      }
+   }
+
+   static void TearDownTestSuite()
+   {
+      std::filesystem::remove(sLogFile);
+      std::filesystem::remove(FileIndex::GetSidecarPath(sLogFile));
+   }
+
+   static std::vector<MetaDataStruct> ReadAll(FileParser& clFileParser_)
+   {
+      std::vector<MetaDataStruct> vLogs;
+      MessageDataStruct stMessageData;
+      MetaDataStruct stMetaData;
+      STATUS eStatus = STATUS::UNKNOWN;
+      while ((eStatus = clFileParser_.Read(stMessageData, stMetaData)) != STATUS::STREAM_EMPTY)
+      {
+         if (eStatus == STATUS::SUCCESS)
+         {
+            vLogs.push_back(stMetaData);
+         }
+      }
+      return vLogs;
+   }
+};
+
+TEST_F(FileIndexTest, BUILD_SAVE_LOAD)
+{
+   InputFileStream clInputFileStream(sLogFile.c_str());
+   FileIndex clIndex;
+   ASSERT_TRUE(clIndex.Build(&clInputFileStream, &clJsonDb));
+   ASSERT_EQ(clIndex.GetEntries().size(), uiSECONDS + uiSECONDS / 10);
+
+   // Every entry points at the sync byte of a frame.
+   std::ifstream clFile(sLogFile, std::ios::binary);
+   const std::string sContents((std::istreambuf_iterator<char>(clFile)), std::istreambuf_iterator<char>());
+   for (const FileIndexEntry& stEntry : clIndex.GetEntries())
+   {
+      ASSERT_EQ(sContents[stEntry.ullOffset], '#');
+      ASSERT_EQ(sContents.substr(stEntry.ullOffset + stEntry.uiLength - 2, 2), "\r\n");
+      ASSERT_EQ(stEntry.usWeek, uiWEEK);
+   }
+
+   const std::string sSidecar = FileIndex::GetSidecarPath(sLogFile);
+   ASSERT_TRUE(clIndex.Save(sSidecar));
+   FileIndex clLoaded;
+   ASSERT_TRUE(clLoaded.Load(sSidecar));
+   ASSERT_EQ(clLoaded.GetEntries().size(), clIndex.GetEntries().size());
+   ASSERT_EQ(0, memcmp(clLoaded.GetEntries().data(), clIndex.GetEntries().data(), clIndex.GetEntries().size() * sizeof(FileIndexEntry)));
+
+   ASSERT_FALSE(clLoaded.Load(sLogFile));
+
+   // An index whose entry count does not match its size is rejected.
+   std::ifstream clSidecar(sSidecar, std::ios::binary);
+   std::string sIndex((std::istreambuf_iterator<char>(clSidecar)), std::istreambuf_iterator<char>());
+   clSidecar.close();
+   const std::string sCorrupt = sSidecar + ".corrupt";
+   const auto WriteIndex = [&sCorrupt](const std::string& sContents_) { std::ofstream(sCorrupt, std::ios::binary) << sContents_; };
+   WriteIndex(sIndex.substr(0, sIndex.size() - 1));
+   ASSERT_FALSE(clLoaded.Load(sCorrupt));
+   const uint64_t ullHugeCount = 1ULL << 60;
+   memcpy(&sIndex[16], &ullHugeCount, sizeof(ullHugeCount));
+   WriteIndex(sIndex);
+   ASSERT_FALSE(clLoaded.Load(sCorrupt));
+   ASSERT_EQ(clLoaded.GetEntries().size(), clIndex.GetEntries().size());
+   std::filesystem::remove(sCorrupt);
+}
+
+TEST_F(FileIndexTest, SEEK_TIME_WINDOW)
+{
+   InputFileStream clInputFileStream(sLogFile.c_str());
+   FileIndex clIndex;
+   ASSERT_TRUE(clIndex.Build(&clInputFileStream, &clJsonDb));
+
+   FileParser clFileParser(&clJsonDb);
+   ASSERT_TRUE(clFileParser.SetStream(&clInputFileStream));
+   const std::vector<FileIndexRange> vRanges = clIndex.Select(uiWEEK, 1800.0, uiWEEK, 1859.0);
+   ASSERT_EQ(vRanges.size(), 1U);
+   ASSERT_TRUE(clFileParser.SetReadRanges(vRanges));
+
+   const std::vector<MetaDataStruct> vLogs = ReadAll(clFileParser);
+   ASSERT_EQ(vLogs.size(), 66U);
+   ASSERT_EQ(vLogs.front().dMilliseconds, 1800000.0);
+   ASSERT_EQ(vLogs.back().dMilliseconds, 1859000.0);
+
+   // Reset() returns to the start of the window.
+   ASSERT_TRUE(clFileParser.Reset());
+   ASSERT_EQ(ReadAll(clFileParser).size(), 66U);
+
+   // An empty set of ranges reads the whole file again.
+   ASSERT_TRUE(clFileParser.SetReadRanges({}));
+   ASSERT_EQ(ReadAll(clFileParser).size(), clIndex.GetEntries().size());
+
+   ASSERT_TRUE(clIndex.Select(uiWEEK + 1, 0.0, uiWEEK + 1, 60.0).empty());
+}
+
+TEST_F(FileIndexTest, SELECT_MESSAGE_IDS)
+{
+   InputFileStream clInputFileStream(sLogFile.c_str());
+   FileIndex clIndex;
+   ASSERT_TRUE(clIndex.Build(&clInputFileStream, &clJsonDb));
+
+   const uint32_t uiBestUtmId = clJsonDb.GetMsgDef("BESTUTM")->logID;
+   FileParser clFileParser(&clJsonDb);
+   ASSERT_TRUE(clFileParser.SetStream(&clInputFileStream));
+   ASSERT_TRUE(clFileParser.SetReadRanges(clIndex.Select({ uiBestUtmId })));
+
+   const std::vector<MetaDataStruct> vLogs = ReadAll(clFileParser);
+   ASSERT_EQ(vLogs.size(), uiSECONDS / 10);
+   for (const MetaDataStruct& stMetaData : vLogs)
+   {
+      ASSERT_EQ(stMetaData.usMessageID, uiBestUtmId);
+   }
+
+   // Message IDs and a time window together.
+   ASSERT_TRUE(clFileParser.SetReadRanges(clIndex.Select(uiWEEK, 100.0, uiWEEK, 199.0, { uiBestUtmId })));
+   ASSERT_EQ(ReadAll(clFileParser).size(), 10U);
+}
+
+TEST_F(FileIndexTest, SEEK_TO_TIME)
+{
+   InputFileStream clInputFileStream(sLogFile.c_str());
+   FileParser clFileParser(&clJsonDb);
+   ASSERT_TRUE(clFileParser.SetStream(&clInputFileStream));
+
+   MessageDataStruct stMessageData;
+   MetaDataStruct stMetaData;
+   for (const uint32_t uiSecond : { 0U, 1U, 1234U, 2000U, 3599U })
+   {
+      ASSERT_TRUE(clFileParser.SeekToTime(uiWEEK, uiSecond));
+      ASSERT_EQ(clFileParser.Read(stMessageData, stMetaData), STATUS::SUCCESS);
+      ASSERT_EQ(stMetaData.usWeek, uiWEEK);
+      ASSERT_EQ(stMetaData.dMilliseconds, uiSecond * 1000.0);
+   }
+
+   // Between two logs, the later one is found.
+   ASSERT_TRUE(clFileParser.SeekToTime(uiWEEK, 99.5));
+   ASSERT_EQ(clFileParser.Read(stMessageData, stMetaData), STATUS::SUCCESS);
+   ASSERT_EQ(stMetaData.dMilliseconds, 100000.0);
+
+   // Before the file starts.
+   ASSERT_TRUE(clFileParser.SeekToTime(uiWEEK - 1, 0.0));
+   ASSERT_EQ(clFileParser.Read(stMessageData, stMetaData), STATUS::SUCCESS);
+   ASSERT_EQ(stMetaData.dMilliseconds, 0.0);
+
+   // After the file ends, the FileParser carries on from where it was.
+   ASSERT_FALSE(clFileParser.SeekToTime(uiWEEK, uiSECONDS + 1.0));
+   ASSERT_EQ(clFileParser.Read(stMessageData, stMetaData), STATUS::SUCCESS);
+   ASSERT_EQ(stMetaData.dMilliseconds, 0.0);
+   ASSERT_EQ(stMetaData.usMessageID, clJsonDb.GetMsgDef("BESTUTM")->logID);
+}
+
+#ifdef HAVE_ZLIB
+TEST_F(FileIndexTest, COMPRESSED_STREAM)
+{
+   const std::string sCompressedFile = sLogFile + ".gz";
+   {
+      std::ifstream clFile(sLogFile, std::ios::binary);
+      const std::string sContents((std::istreambuf_iterator<char>(clFile)), std::istreambuf_iterator<char>());
+      gzFile pstFile = gzopen(sCompressedFile.c_str(), "wb");
+      ASSERT_NE(pstFile, nullptr);
+      ASSERT_EQ(gzwrite(pstFile, sContents.data(), static_cast<unsigned>(sContents.size())), static_cast<int>(sContents.size()));
+      ASSERT_EQ(gzclose(pstFile), Z_OK);
+   }
+
+   {
+      InputCompressedFileStream clInputFileStream(sCompressedFile.c_str(), 64 * 1024);
+      FileIndex clIndex;
+      ASSERT_TRUE(clIndex.Build(&clInputFileStream, &clJsonDb));
+      ASSERT_EQ(clIndex.GetEntries().size(), uiSECONDS + uiSECONDS / 10);
+
+      FileParser clFileParser(&clJsonDb);
+      ASSERT_TRUE(clFileParser.SetStream(&clInputFileStream));
+      ASSERT_EQ(ReadAll(clFileParser).size(), clIndex.GetEntries().size());
+      ASSERT_EQ(clFileParser.GetPercentRead(), 100U);
+
+      // Ranges and seeks are in decompressed offsets.
+      ASSERT_TRUE(clFileParser.SetReadRanges(clIndex.Select(uiWEEK, 1800.0, uiWEEK, 1859.0)));
+      ASSERT_EQ(ReadAll(clFileParser).size(), 66U);
+
+      MessageDataStruct stMessageData;
+      MetaDataStruct stMetaData;
+      ASSERT_TRUE(clFileParser.SeekToTime(uiWEEK, 1234.0));
+      ASSERT_EQ(clFileParser.Read(stMessageData, stMetaData), STATUS::SUCCESS);
+      ASSERT_EQ(stMetaData.dMilliseconds, 1234000.0);
+   }
+   std::filesystem::remove(sCompressedFile);
+}
+#endif
+
+// -------------------------------------------------------------------------------------------------------
+// FileMerger Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class FileMergerTest : public ::testing::Test
+{
+protected:
+   static constexpr uint32_t uiWEEK = 2163;
+   static constexpr uint32_t uiLOGS = 600;
+   static inline std::vector<std::string> vLogFiles;
+   static inline JsonReader clJsonDb;
+
+   static std::string AsciiLog(uint32_t uiMilliseconds_)
+   {
+      char acTime[32];
+      snprintf(acTime, sizeof(acTime), "%u,%u.%03u", uiWEEK, uiMilliseconds_ / 1000, uiMilliseconds_ % 1000);
+      const std::string sLog = std::string("BESTPOSA,COM1,0,83.5,FINESTEERING,") + acTime + ",02400000,b1f6,16248;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01";
+      char acCrc[16];
+      snprintf(acCrc, sizeof(acCrc), "*%08x\r\n", CalculateBlockCRC32(static_cast<uint32_t>(sLog.size()), 0, reinterpret_cast<const unsigned char*>(sLog.data())));
+      return "#" + sLog + acCrc;
+   }
+
+   // Three recordings of the same session: logs at 1 Hz, logs at 2 Hz offset
+   // by 250 ms, and logs at 1 Hz where every tenth log is written after the
+   // two that follow it.
+   static void SetUpTestSuite()
+   {
+      clJsonDb.LoadFile(*TEST_DB_PATH);
+      for (uint32_t uiFile = 0; uiFile < 3; uiFile++)
+      {
+         vLogFiles.push_back((std::filesystem::temp_directory_path() / ("edie_file_merger_test_" + std::to_string(uiFile) + ".ASC")).string());
+         std::ofstream clFile(vLogFiles.back(), std::ios::binary);
+         for (uint32_t i = 0; i < uiLOGS; i++)
+         {
+            if (uiFile == 0)
+            {
+               clFile << AsciiLog(i * 1000);
+            }
+            else if (uiFile == 1)
+            {
+               clFile << AsciiLog(i * 500 + 250);
+            }
+            else if (i % 10 == 0)
+            {
+               clFile << AsciiLog((i + 1) * 1000) << AsciiLog((i + 2) * 1000) << AsciiLog(i * 1000);
+               i += 2;
+            }
+            else
+            {
+               clFile << AsciiLog(i * 1000);
+            }
+         }
+      }
+   }
+
+   static void TearDownTestSuite()
+   {
+      for (const std::string& sLogFile : vLogFiles)
+      {
+         std::filesystem::remove(sLogFile);
+      }
+   }
+
+   struct MergedLog
+   {
+      double dMilliseconds;
+      uint32_t uiSource;
+   };
+
+   static std::vector<MergedLog> ReadAll(const std::vector<uint32_t>& vFiles_, double dWindowMilliseconds_, uint32_t uiLookAhead_)
+   {
+      std::vector<std::unique_ptr<InputFileStream>> vpclStreams;
+      std::vector<std::unique_ptr<FileParser>> vpclFileParsers;
+      FileMerger clFileMerger(dWindowMilliseconds_, uiLookAhead_);
+      for (const uint32_t uiFile : vFiles_)
+      {
+         vpclStreams.emplace_back(std::make_unique<InputFileStream>(vLogFiles[uiFile].c_str()));
+         vpclFileParsers.emplace_back(std::make_unique<FileParser>(&clJsonDb));
+         EXPECT_TRUE(vpclFileParsers.back()->SetStream(vpclStreams.back().get()));
+         EXPECT_TRUE(clFileMerger.AddSource(vpclFileParsers.back().get()));
+      }
+
+      std::vector<MergedLog> vLogs;
+      MessageDataStruct stMessageData;
+      MetaDataStruct stMetaData;
+      uint32_t uiSource = 0;
+      STATUS eStatus = STATUS::UNKNOWN;
+      while ((eStatus = clFileMerger.Read(stMessageData, stMetaData, uiSource)) != STATUS::STREAM_EMPTY)
+      {
+         EXPECT_EQ(eStatus, STATUS::SUCCESS);
+         EXPECT_EQ(stMetaData.usWeek, uiWEEK);
+         EXPECT_EQ(stMessageData.pucMessage[0], '#');
+         EXPECT_EQ(stMessageData.uiMessageLength, stMetaData.uiLength);
+         vLogs.push_back({ stMetaData.dMilliseconds, uiSource });
+      }
+      return vLogs;
+   }
+
+   static bool IsOrdered(const std::vector<MergedLog>& vLogs_)
+   {
+      return std::is_sorted(vLogs_.begin(), vLogs_.end(), [](const MergedLog& stLhs_, const MergedLog& stRhs_) {
+         return stLhs_.dMilliseconds < stRhs_.dMilliseconds || (stLhs_.dMilliseconds == stRhs_.dMilliseconds && stLhs_.uiSource < stRhs_.uiSource); });
+   }
+};
+
+TEST_F(FileMergerTest, ADD_SOURCE)
+{
+   InputFileStream clInputFileStream(vLogFiles[0].c_str());
+   FileParser clFileParser(&clJsonDb);
+   ASSERT_TRUE(clFileParser.SetStream(&clInputFileStream));
+
+   FileMerger clFileMerger;
+   ASSERT_FALSE(clFileMerger.AddSource(nullptr));
+   ASSERT_TRUE(clFileMerger.AddSource(&clFileParser));
+   ASSERT_EQ(clFileMerger.GetSourceCount(), 1U);
+
+   MessageDataStruct stMessageData;
+   MetaDataStruct stMetaData;
+   ASSERT_EQ(clFileMerger.Read(stMessageData, stMetaData), STATUS::SUCCESS);
+   ASSERT_FALSE(clFileMerger.AddSource(&clFileParser));
+}
+
+TEST_F(FileMergerTest, TIME_ORDER)
+{
+   const std::vector<MergedLog> vLogs = ReadAll({ 0, 1 }, 0.0, FileMerger::uiDEFAULT_LOOK_AHEAD);
+   ASSERT_EQ(vLogs.size(), 2 * uiLOGS);
+   ASSERT_TRUE(IsOrdered(vLogs));
+   ASSERT_EQ(std::count_if(vLogs.begin(), vLogs.end(), [](const MergedLog& stLog_) { return stLog_.uiSource == 1; }), uiLOGS);
+
+   // Logs with the same time are returned in the order the sources were added.
+   const std::vector<MergedLog> vSameTime = ReadAll({ 0, 0 }, 0.0, FileMerger::uiDEFAULT_LOOK_AHEAD);
+   ASSERT_EQ(vSameTime.size(), 2 * uiLOGS);
+   ASSERT_TRUE(IsOrdered(vSameTime));
+}
+
+TEST_F(FileMergerTest, REORDER_WINDOW)
+{
+   // Without a window, the late logs are returned as soon as they are read.
+   ASSERT_FALSE(IsOrdered(ReadAll({ 0, 2 }, 0.0, FileMerger::uiDEFAULT_LOOK_AHEAD)));
+
+   const std::vector<MergedLog> vLogs = ReadAll({ 0, 2 }, 2000.0, FileMerger::uiDEFAULT_LOOK_AHEAD);
+   ASSERT_EQ(vLogs.size(), 2 * uiLOGS);
+   ASSERT_TRUE(IsOrdered(vLogs));
+}
+
+TEST_F(FileMergerTest, LOOK_AHEAD)
+{
+   // A look-ahead of one log per source is enough for sources in order.
+   const std::vector<MergedLog> vLogs = ReadAll({ 0, 1 }, 0.0, 1);
+   ASSERT_EQ(vLogs.size(), 2 * uiLOGS);
+   ASSERT_TRUE(IsOrdered(vLogs));
+
+   // A window wider than the look-ahead can cover still returns every log.
+   ASSERT_EQ(ReadAll({ 0, 1, 2 }, 60000.0, 4).size(), 3 * uiLOGS);
+}
+
+// -------------------------------------------------------------------------------------------------------
+// Deduplicator Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class DeduplicatorTest : public ::testing::Test
+{
+protected:
+   static inline JsonReader clJsonDb;
+
+   static void SetUpTestSuite()
+   {
+      clJsonDb.LoadFile(*TEST_DB_PATH);
+   }
+
+   static std::string AsciiLog(const std::string& sPort_, uint32_t uiMilliseconds_, const std::string& sLatitude_ = "51.15043874397")
+   {
+      char acTime[32];
+      snprintf(acTime, sizeof(acTime), "2163,%u.%03u", uiMilliseconds_ / 1000, uiMilliseconds_ % 1000);
+      const std::string sLog = "BESTPOSA," + sPort_ + ",0,83.5,FINESTEERING," + acTime + ",02400000,b1f6,16248;SOL_COMPUTED,SINGLE," + sLatitude_ + ",-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01";
+      char acCrc[16];
+      snprintf(acCrc, sizeof(acCrc), "*%08x\r\n", CalculateBlockCRC32(static_cast<uint32_t>(sLog.size()), 0, reinterpret_cast<const unsigned char*>(sLog.data())));
+      return "#" + sLog + acCrc;
+   }
+
+   static uint32_t CountLogs(Deduplicator& clDeduplicator_, const std::string& sLogs_)
+   {
+      Parser clParser(&clJsonDb);
+      clParser.SetDeduplicator(&clDeduplicator_);
+      clParser.Write(reinterpret_cast<unsigned char*>(const_cast<char*>(sLogs_.data())), static_cast<uint32_t>(sLogs_.size()));
+      MessageDataStruct stMessageData;
+      MetaDataStruct stMetaData;
+      uint32_t uiLogs = 0;
+      while (clParser.Read(stMessageData, stMetaData) != STATUS::BUFFER_EMPTY)
+      {
+         uiLogs++;
+      }
+      return uiLogs;
+   }
+};
+
+TEST_F(DeduplicatorTest, FRAME_CRC)
+{
+   unsigned char aucLog[] = { 0xAA, 0x44, 0x12, 0x1C, 0x2A, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x00, 0xA4, 0xB4, 0xAC, 0x07, 0xD8, 0x16, 0x6D, 0x08, 0x08, 0x40, 0x00, 0x02, 0xF6, 0xB1, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xD7, 0x03, 0xB0, 0x4C, 0xE5, 0x8E, 0x49, 0x40, 0x52, 0xC4, 0x26, 0xD1, 0x72, 0x82, 0x5C, 0xC0, 0x29, 0xCB, 0x10, 0xC7, 0x7A, 0xA2, 0x90, 0x40, 0x33, 0x33, 0x87, 0xC1, 0x3D, 0x00, 0x00, 0x00, 0xFA, 0x7E, 0xBA, 0x3F, 0x3F, 0x57, 0x83, 0x3F, 0xA9, 0xA4, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x16, 0x00, 0x06, 0x39, 0x33, 0x23, 0xC4, 0x89, 0x7A };
+   const std::string sLog = AsciiLog("COM1", 1000);
+
+   Framer clFramer;
+   unsigned char aucFrame[MESSAGE_SIZE_MAX];
+   MetaDataStruct stMetaData;
+   clFramer.Write(aucLog, sizeof(aucLog));
+   ASSERT_EQ(clFramer.GetFrame(aucFrame, sizeof(aucFrame), stMetaData), STATUS::SUCCESS);
+   ASSERT_EQ(stMetaData.uiFrameCRC, 0x7A89C423U);
+
+   clFramer.Write(reinterpret_cast<unsigned char*>(const_cast<char*>(sLog.data())), static_cast<uint32_t>(sLog.size()));
+   ASSERT_EQ(clFramer.GetFrame(aucFrame, sizeof(aucFrame), stMetaData), STATUS::SUCCESS);
+   ASSERT_EQ(stMetaData.uiFrameCRC, static_cast<uint32_t>(std::stoul(sLog.substr(sLog.size() - 10, 8), nullptr, 16)));
+}
+
+TEST_F(DeduplicatorTest, DROP_DUPLICATES)
+{
+   Deduplicator clDeduplicator;
+   const std::string sLogs = AsciiLog("COM1", 1000) + AsciiLog("COM1", 1000) + AsciiLog("COM1", 1000, "51.15043874398") + AsciiLog("COM1", 2000) + AsciiLog("COM1", 1000);
+   ASSERT_EQ(CountLogs(clDeduplicator, sLogs), 3U);
+   ASSERT_EQ(clDeduplicator.GetUniqueCount(), 3U);
+   ASSERT_EQ(clDeduplicator.GetDuplicateCount(), 2U);
+
+   // The Deduplicator remembers logs across Parsers until it is cleared.
+   ASSERT_EQ(CountLogs(clDeduplicator, AsciiLog("COM1", 2000)), 0U);
+   clDeduplicator.Clear();
+   ASSERT_EQ(clDeduplicator.GetDuplicateCount(), 0U);
+   ASSERT_EQ(CountLogs(clDeduplicator, AsciiLog("COM1", 2000)), 1U);
+}
+
+TEST_F(DeduplicatorTest, STATISTICS)
+{
+   Deduplicator clDeduplicator;
+   Parser clParser(&clJsonDb);
+   clParser.SetDeduplicator(&clDeduplicator);
+   clParser.EnableStatistics(true);
+   std::string sLogs = AsciiLog("COM1", 1000) + AsciiLog("COM1", 1000) + AsciiLog("COM1", 2000);
+   clParser.Write(reinterpret_cast<unsigned char*>(sLogs.data()), static_cast<uint32_t>(sLogs.size()));
+   MessageDataStruct stMessageData;
+   MetaDataStruct stMetaData;
+   while (clParser.Read(stMessageData, stMetaData) != STATUS::BUFFER_EMPTY) {}
+
+   // The Deduplicator is timed as its own stage, not as the Filter.
+   const ParserStatistics stStatistics = clParser.GetStatistics();
+   ASSERT_EQ(stStatistics.GetStage(PARSER_STAGE::DEDUPLICATOR).ullCalls, 3ULL);
+   ASSERT_EQ(stStatistics.GetStage(PARSER_STAGE::FILTER).ullCalls, 0ULL);
+   ASSERT_EQ(stStatistics.GetStage(PARSER_STAGE::MESSAGE_DECODER).ullCalls, 2ULL);
+}
+
+TEST_F(DeduplicatorTest, MATCH_ACROSS_PORTS)
+{
+   const std::string sLogs = AsciiLog("COM1", 1000) + AsciiLog("USB1", 1000) + AsciiLog("USB1", 1000, "51.15043874398");
+
+   Deduplicator clDeduplicator;
+   ASSERT_FALSE(clDeduplicator.GetMatchAcrossPorts());
+   ASSERT_EQ(CountLogs(clDeduplicator, sLogs), 3U);
+
+   clDeduplicator.Clear();
+   clDeduplicator.SetMatchAcrossPorts(true);
+   ASSERT_EQ(CountLogs(clDeduplicator, sLogs), 2U);
+   ASSERT_EQ(clDeduplicator.GetDuplicateCount(), 1U);
+}
+
+TEST_F(DeduplicatorTest, WINDOW_AND_CAPACITY)
+{
+   // A log is forgotten once the latest time is more than the window past it.
+   Deduplicator clWindowed(1000.0);
+   ASSERT_EQ(CountLogs(clWindowed, AsciiLog("COM1", 1000) + AsciiLog("COM1", 2000) + AsciiLog("COM1", 1000)), 2U);
+   ASSERT_EQ(CountLogs(clWindowed, AsciiLog("COM1", 2001) + AsciiLog("COM1", 1000)), 2U);
+
+   // After time goes back by more than the window, the window follows the
+   // new times instead of the latest time seen before.
+   Deduplicator clRestarted(1000.0);
+   ASSERT_EQ(CountLogs(clRestarted, AsciiLog("COM1", 100000) + AsciiLog("COM1", 1000) + AsciiLog("COM1", 1500) + AsciiLog("COM1", 1000)), 3U);
+   ASSERT_EQ(clRestarted.GetDuplicateCount(), 1U);
+
+   // Beyond the capacity, the oldest logs are forgotten first.
+   Deduplicator clSmall(60000.0, 2);
+   ASSERT_EQ(CountLogs(clSmall, AsciiLog("COM1", 1000) + AsciiLog("COM1", 2000) + AsciiLog("COM1", 3000)), 3U);
+   ASSERT_EQ(CountLogs(clSmall, AsciiLog("COM1", 3000) + AsciiLog("COM1", 2000)), 0U);
+   ASSERT_EQ(CountLogs(clSmall, AsciiLog("COM1", 1000)), 1U);
+
+   // Many distinct logs keep the table consistent as entries are removed.
+   std::string sLogs;
+   for (uint32_t i = 0; i < 500; i++)
+   {
+      sLogs += AsciiLog("COM1", 1000 + i * 10);
+   }
+   Deduplicator clChurn(60000.0, 16);
+   ASSERT_EQ(CountLogs(clChurn, sLogs), 500U);
+   ASSERT_EQ(CountLogs(clChurn, sLogs.substr(sLogs.size() - 16 * AsciiLog("COM1", 5990).size())), 0U);
+}
+
+// -------------------------------------------------------------------------------------------------------
+// PipelinedParser Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class PipelinedParserTest : public ::testing::Test
+{
+protected:
+   static std::vector<unsigned char> ReadTestFile(const char* pcFileName_)
+   {
+      std::filesystem::path test_file = std::filesystem::path(*TEST_RESOURCE_PATH) / pcFileName_;
+      std::ifstream clFile(test_file, std::ios::binary);
+      return std::vector<unsigned char>(std::istreambuf_iterator<char>(clFile), std::istreambuf_iterator<char>());
+   }
+
+   // Parse the stream in chunks and collect every status and returned log.
+   template <typename ParserType>
+   static std::vector<std::pair<STATUS, std::string>> ParseAll(ParserType& clParser_, std::vector<unsigned char>& vStream_, uint32_t uiChunkSize_)
+   {
+      std::vector<std::pair<STATUS, std::string>> vResults;
+      MessageDataStruct stMessageData;
+      MetaDataStruct stMetaData;
+
+      for (size_t ullOffset = 0; ullOffset < vStream_.size(); ullOffset += uiChunkSize_)
+      {
+         const uint32_t uiSize = static_cast<uint32_t>(std::min<size_t>(uiChunkSize_, vStream_.size() - ullOffset));
+         clParser_.Write(&vStream_[ullOffset], uiSize);
+
+         STATUS eStatus = clParser_.Read(stMessageData, stMetaData);
+         while (eStatus != STATUS::BUFFER_EMPTY)
+         {
+            // The message data is only set for a log or unknown bytes, a log that failed to decode only has its status.
+            if (eStatus == STATUS::SUCCESS || eStatus == STATUS::UNKNOWN)
+            {
+               const unsigned char* pucLog = eStatus == STATUS::UNKNOWN ? stMessageData.pucMessageHeader : stMessageData.pucMessage;
+               const uint32_t uiLength = eStatus == STATUS::UNKNOWN ? stMessageData.uiMessageHeaderLength : stMessageData.uiMessageLength;
+               vResults.emplace_back(eStatus, std::string(reinterpret_cast<const char*>(pucLog), uiLength));
+            }
+            else
+            {
+               vResults.emplace_back(eStatus, std::string());
+            }
+            eStatus = clParser_.Read(stMessageData, stMetaData);
+         }
+      }
+      return vResults;
+   }
+};
+
+TEST_F(PipelinedParserTest, OPTIONS)
+{
+   PipelinedParser clParser(*TEST_DB_PATH, 2);
+   ASSERT_EQ(clParser.GetWorkerCount(), 2U);
+   clParser.SetDecompressRangeCmp(false);
+   ASSERT_FALSE(clParser.GetDecompressRangeCmp());
+   clParser.SetReturnUnknownBytes(false);
+   ASSERT_FALSE(clParser.GetReturnUnknownBytes());
+   clParser.SetEncodeFormat(ENCODEFORMAT::JSON);
+   ASSERT_EQ(clParser.GetEncodeFormat(), ENCODEFORMAT::JSON);
+}
+
+TEST_F(PipelinedParserTest, MATCHES_PARSER)
+{
+   JsonReader clJsonDb;
+   clJsonDb.LoadFile(*TEST_DB_PATH);
+
+   const std::vector<unsigned char> vRecorded = ReadTestFile("BESTUTMBIN.GPS");
+   // RANGECMP, RANGECMP2 and a RANGECMP4 reference log with a differential
+   // log that depends on it.
+   const std::vector<unsigned char> vRangeCmp = ReadTestFile("RANGECMP.ASC");
+   ASSERT_FALSE(vRangeCmp.empty());
+   const std::string sAscii = "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,16248;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n";
+
+   std::vector<unsigned char> vStream;
+   for (uint32_t i = 0; i < 200; i++)
+   {
+      vStream.insert(vStream.end(), sAscii.begin(), sAscii.end());
+      vStream.insert(vStream.end(), vRecorded.begin(), vRecorded.end());
+      vStream.insert(vStream.end(), vRangeCmp.begin(), vRangeCmp.end());
+      vStream.push_back(static_cast<unsigned char>(i));
+   }
+
+   Parser clParser(&clJsonDb);
+   clParser.SetEncodeFormat(ENCODEFORMAT::JSON);
+   PipelinedParser clPipelinedParser(&clJsonDb, 4, 8);
+   clPipelinedParser.SetEncodeFormat(ENCODEFORMAT::JSON);
+
+   const auto vExpected = ParseAll(clParser, vStream, 4096);
+   const auto vActual = ParseAll(clPipelinedParser, vStream, 4096);
+
+   ASSERT_GE(std::count_if(vExpected.begin(), vExpected.end(), [](const auto& stResult_) { return stResult_.first == STATUS::SUCCESS; }), 200);
+   ASSERT_EQ(vActual.size(), vExpected.size());
+   for (size_t i = 0; i < vExpected.size(); i++)
+   {
+      ASSERT_EQ(vActual[i].first, vExpected[i].first) << "log " << i;
+      ASSERT_EQ(vActual[i].second, vExpected[i].second) << "log " << i;
+   }
+}
+
+TEST_F(PipelinedParserTest, FLUSH)
+{
+   PipelinedParser clParser(*TEST_DB_PATH, 2);
+   unsigned char aucPartial[] = "#BESTPOSA,COM1,0,83.5,FINESTEERING";
+   clParser.Write(aucPartial, sizeof(aucPartial) - 1);
+
+   MessageDataStruct stMessageData;
+   MetaDataStruct stMetaData;
+   ASSERT_EQ(clParser.Read(stMessageData, stMetaData), STATUS::BUFFER_EMPTY);
+
+   unsigned char aucFlushed[64];
+   ASSERT_EQ(clParser.Flush(aucFlushed, sizeof(aucFlushed)), sizeof(aucPartial) - 1);
+   ASSERT_EQ(0, memcmp(aucFlushed, aucPartial, sizeof(aucPartial) - 1));
+   ASSERT_EQ(clParser.Flush(), 0U);
+}
+
+#ifndef WIN32
+// -------------------------------------------------------------------------------------------------------
+// IngestEngine Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class IngestEngineTest : public ::testing::Test
+{
+protected:
+   static std::vector<unsigned char> ReadTestFile()
+   {
+      std::filesystem::path test_file = std::filesystem::path(*TEST_RESOURCE_PATH) / "BESTUTMBIN.GPS";
+      std::ifstream clFile(test_file, std::ios::binary);
+      return std::vector<unsigned char>(std::istreambuf_iterator<char>(clFile), std::istreambuf_iterator<char>());
+   }
+
+   static uint32_t CountLogs(JsonReader* pclJsonDb_, std::vector<unsigned char>& vData_)
+   {
+      Parser clParser(pclJsonDb_);
+      clParser.Write(vData_.data(), static_cast<uint32_t>(vData_.size()));
+      MessageDataStruct stMessageData;
+      MetaDataStruct stMetaData;
+      uint32_t uiLogs = 0;
+      while (clParser.Read(stMessageData, stMetaData) != STATUS::BUFFER_EMPTY)
+      {
+         uiLogs++;
+      }
+      return uiLogs;
+   }
+};
+
+TEST_F(IngestEngineTest, MANY_PIPES)
+{
+   JsonReader clJsonDb;
+   clJsonDb.LoadFile(*TEST_DB_PATH);
+   std::vector<unsigned char> vData = ReadTestFile();
+   const uint32_t uiExpectedLogs = CountLogs(&clJsonDb, vData);
+   ASSERT_GT(uiExpectedLogs, 0U);
+
+   constexpr uint32_t uiStreams = 200;
+   IngestEngine clEngine(&clJsonDb);
+   std::vector<std::unique_ptr<InputFdStream>> vStreams;
+   std::vector<int> vWriteFds;
+   std::map<uint32_t, uint32_t> mLogs;
+   std::set<uint32_t> sClosed;
+
+   clEngine.SetMessageCallback([&mLogs](uint32_t uiStreamId_, STATUS, MessageDataStruct&, MetaDataStruct&) { mLogs[uiStreamId_]++; });
+   clEngine.SetStreamClosedCallback([&sClosed](uint32_t uiStreamId_) { sClosed.insert(uiStreamId_); });
+
+   for (uint32_t i = 0; i < uiStreams; i++)
+   {
+      int aiFds[2];
+      ASSERT_EQ(pipe(aiFds), 0);
+      vStreams.emplace_back(std::make_unique<InputFdStream>(aiFds[0], true));
+      vWriteFds.push_back(aiFds[1]);
+      ASSERT_NE(clEngine.AddStream(vStreams.back().get()), IngestEngine::uiINVALID_STREAM_ID);
+   }
+   ASSERT_EQ(clEngine.GetStreamCount(), uiStreams);
+
+   // Write each stream in two pieces, so frames are split across reads.
+   const size_t ullHalf = vData.size() / 2;
+   for (int iFd : vWriteFds)
+   {
+      ASSERT_EQ(write(iFd, vData.data(), ullHalf), static_cast<ssize_t>(ullHalf));
+   }
+   while (clEngine.Poll(0) > 0) {}
+   for (int iFd : vWriteFds)
+   {
+      ASSERT_EQ(write(iFd, vData.data() + ullHalf, vData.size() - ullHalf), static_cast<ssize_t>(vData.size() - ullHalf));
+      close(iFd);
+   }
+
+   clEngine.Run();
+   ASSERT_EQ(clEngine.GetStreamCount(), 0U);
+   ASSERT_EQ(sClosed.size(), uiStreams);
+   ASSERT_EQ(mLogs.size(), uiStreams);
+   for (const auto& [uiStreamId, uiLogs] : mLogs)
+   {
+      ASSERT_EQ(uiLogs, uiExpectedLogs) << "stream " << uiStreamId;
+   }
+}
+
+TEST_F(IngestEngineTest, LOOPBACK_SOCKETS)
+{
+   JsonReader clJsonDb;
+   clJsonDb.LoadFile(*TEST_DB_PATH);
+   std::vector<unsigned char> vData = ReadTestFile();
+   const uint32_t uiExpectedLogs = CountLogs(&clJsonDb, vData);
+
+   sockaddr_in stAddress{};
+   stAddress.sin_family = AF_INET;
+   stAddress.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+   socklen_t uiAddressLength = sizeof(stAddress);
+
+   // TCP
+   const int iListener = socket(AF_INET, SOCK_STREAM, 0);
+   ASSERT_EQ(bind(iListener, reinterpret_cast<sockaddr*>(&stAddress), sizeof(stAddress)), 0);
+   ASSERT_EQ(listen(iListener, 1), 0);
+   ASSERT_EQ(getsockname(iListener, reinterpret_cast<sockaddr*>(&stAddress), &uiAddressLength), 0);
+   const int iTcpClient = socket(AF_INET, SOCK_STREAM, 0);
+   ASSERT_EQ(connect(iTcpClient, reinterpret_cast<sockaddr*>(&stAddress), sizeof(stAddress)), 0);
+   InputFdStream clTcpStream(accept(iListener, nullptr, nullptr), true);
+   close(iListener);
+
+   // UDP, one datagram per write.
+   stAddress.sin_port = 0;
+   const int iUdpServer = socket(AF_INET, SOCK_DGRAM, 0);
+   ASSERT_EQ(bind(iUdpServer, reinterpret_cast<sockaddr*>(&stAddress), sizeof(stAddress)), 0);
+   uiAddressLength = sizeof(stAddress);
+   ASSERT_EQ(getsockname(iUdpServer, reinterpret_cast<sockaddr*>(&stAddress), &uiAddressLength), 0);
+   const int iUdpClient = socket(AF_INET, SOCK_DGRAM, 0);
+   ASSERT_EQ(connect(iUdpClient, reinterpret_cast<sockaddr*>(&stAddress), sizeof(stAddress)), 0);
+   InputFdStream clUdpStream(iUdpServer, true);
+
+   IngestEngine clEngine(&clJsonDb);
+   const uint32_t uiTcpId = clEngine.AddStream(&clTcpStream);
+   const uint32_t uiUdpId = clEngine.AddStream(&clUdpStream);
+   std::map<uint32_t, uint32_t> mLogs;
+   clEngine.SetMessageCallback([&mLogs](uint32_t uiStreamId_, STATUS, MessageDataStruct&, MetaDataStruct&) { mLogs[uiStreamId_]++; });
+
+   // The streams share the engine's DB rather than copying it.
+   ASSERT_EQ(clEngine.GetParser(uiTcpId)->GetJsonDb(), &clJsonDb);
+   ASSERT_EQ(clEngine.GetParser(uiUdpId)->GetJsonDb(), &clJsonDb);
+
+   // An empty datagram does not end the UDP stream.
+   ASSERT_EQ(send(iUdpClient, vData.data(), 0, 0), 0);
+   for (uint32_t i = 0; i < 10; i++)
+   {
+      ASSERT_GE(clEngine.Poll(10), 0);
+   }
+   ASSERT_EQ(clEngine.GetStreamCount(), 2U);
+
+   ASSERT_EQ(send(iTcpClient, vData.data(), vData.size(), 0), static_cast<ssize_t>(vData.size()));
+   ASSERT_EQ(send(iUdpClient, vData.data(), vData.size(), 0), static_cast<ssize_t>(vData.size()));
+
+   for (uint32_t i = 0; i < 100 && (mLogs[uiTcpId] < uiExpectedLogs || mLogs[uiUdpId] < uiExpectedLogs); i++)
+   {
+      ASSERT_GE(clEngine.Poll(10), 0);
+   }
+   ASSERT_EQ(mLogs[uiTcpId], uiExpectedLogs);
+   ASSERT_EQ(mLogs[uiUdpId], uiExpectedLogs);
+
+   close(iTcpClient);
+   close(iUdpClient);
+}
+
+TEST_F(IngestEngineTest, STOP)
+{
+   int aiFds[2];
+   ASSERT_EQ(pipe(aiFds), 0);
+   InputFdStream clStream(aiFds[0], true);
+
+   IngestEngine clEngine(*TEST_DB_PATH);
+   const uint32_t uiStreamId = clEngine.AddStream(&clStream);
+   ASSERT_NE(uiStreamId, IngestEngine::uiINVALID_STREAM_ID);
+   ASSERT_NE(clEngine.GetParser(uiStreamId), nullptr);
+
+   std::thread clStopper([&clEngine] { std::this_thread::sleep_for(std::chrono::milliseconds(50)); clEngine.Stop(); });
+   clEngine.Run();
+   clStopper.join();
+
+   ASSERT_TRUE(clEngine.RemoveStream(uiStreamId));
+   ASSERT_FALSE(clEngine.RemoveStream(uiStreamId));
+   ASSERT_EQ(clEngine.GetParser(uiStreamId), nullptr);
+   close(aiFds[1]);
+}
+
+TEST_F(IngestEngineTest, ABBREV_ASCII_IDLE)
+{
+   // Only the idle time shows that this log is over, as its last line ends
+   // with a separator.
+   unsigned char aucLog[] = "<BESTPOS COM1 0 80.0 FINESTEERING 2217 164041.000 02000000 cdba 32768\r\n"\
+      "<     SOL_COMPUTED SINGLE 51.15043628556 -114.03068602900 1099.2120 -17.0000 WGS84 1.4033 1.0278 3.0744 \"\" 0.000 0.000 18 17 17 17 00 06 00 3b \r\n";
+   int aiQuietFds[2];
+   int aiBusyFds[2];
+   ASSERT_EQ(pipe(aiQuietFds), 0);
+   ASSERT_EQ(pipe(aiBusyFds), 0);
+   InputFdStream clQuietStream(aiQuietFds[0], true);
+   InputFdStream clBusyStream(aiBusyFds[0], true);
+
+   IngestEngine clEngine(*TEST_DB_PATH);
+   const uint32_t uiQuietId = clEngine.AddStream(&clQuietStream);
+   const uint32_t uiBusyId = clEngine.AddStream(&clBusyStream);
+   ASSERT_NE(uiQuietId, IngestEngine::uiINVALID_STREAM_ID);
+   ASSERT_NE(uiBusyId, IngestEngine::uiINVALID_STREAM_ID);
+   clEngine.GetParser(uiQuietId)->SetAbbrevAsciiCompletion(true);
+   clEngine.GetParser(uiBusyId)->SetAbbrevAsciiCompletion(true);
+
+   STATUS eLogStatus = STATUS::UNKNOWN;
+   MetaDataStruct stLogMetaData;
+   clEngine.SetMessageCallback([&](uint32_t uiStreamId_, STATUS eStatus_, MessageDataStruct&, MetaDataStruct& stMetaData_) {
+      if (uiStreamId_ == uiQuietId)
+      {
+         eLogStatus = eStatus_;
+         stLogMetaData = stMetaData_;
+         clEngine.Stop();
+      }
+   });
+
+   // The other stream never stops long enough for epoll_wait() to time out,
+   // and the pipe with the log is never closed.
+   ASSERT_EQ(write(aiQuietFds[1], aucLog, sizeof(aucLog) - 1), static_cast<ssize_t>(sizeof(aucLog) - 1));
+   std::atomic<bool> bDone{ false };
+   std::thread clWriter([&bDone, iFd = aiBusyFds[1]] {
+      const unsigned char ucByte = 0;
+      while (!bDone)
+      {
+         static_cast<void>(write(iFd, &ucByte, 1));
+         std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      }
+   });
+   std::thread clTimeout([&clEngine, &bDone] {
+      for (uint32_t i = 0; i < 200 && !bDone; i++)
+      {
+         std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+      clEngine.Stop();
+   });
+
+   clEngine.Run();
+   bDone = true;
+   clWriter.join();
+   clTimeout.join();
+
+   ASSERT_EQ(eLogStatus, STATUS::SUCCESS);
+   ASSERT_EQ(stLogMetaData.eFormat, HEADERFORMAT::ABB_ASCII);
+   ASSERT_EQ(stLogMetaData.uiLength, sizeof(aucLog) - 1);
+   close(aiQuietFds[1]);
+   close(aiBusyFds[1]);
+}
+#endif
+
 // -------------------------------------------------------------------------------------------------------
 // Novatel Types Unit Tests
 // -------------------------------------------------------------------------------------------------------
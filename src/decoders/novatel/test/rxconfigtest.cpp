@@ -241,6 +241,40 @@ TEST_F(RxConfigTest, RXCONFIG_ROUNDTRIP_BINARY)
 }
 
 
+TEST_F(RxConfigTest, RXCONFIG_CONVERT_FRAMED_BINARY)
+{
+   // RXCONFIG
+   unsigned char aucLog[] = { 0xAA, 0x44, 0x12, 0x1C, 0x80, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x00, 0x65, 0xB4, 0x7C, 0x08, 0x3C, 0x78, 0x48, 0x09, 0x00, 0x00, 0x01, 0x02, 0x02, 0xF7, 0x78, 0x3F, 0xAA, 0x44, 0x12, 0x1C, 0x03, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x65, 0xB4, 0x7C, 0x08, 0x3C, 0x78, 0x48, 0x09, 0x00, 0x00, 0x01, 0x02, 0x02, 0xF7, 0x78, 0x3F, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x67, 0x74, 0xB2, 0xEC, 0x0E, 0xD1, 0xFB, 0x06 };
+   MessageDataStruct stExpectedRxConfigMessageData;
+   stExpectedRxConfigMessageData.pucMessage = &aucLog[0];
+   stExpectedRxConfigMessageData.uiMessageLength = 80;
+   stExpectedRxConfigMessageData.pucMessageHeader = &aucLog[0];
+   stExpectedRxConfigMessageData.uiMessageHeaderLength = OEM4_BINARY_HEADER_LENGTH;
+   stExpectedRxConfigMessageData.pucMessageBody = &aucLog[OEM4_BINARY_HEADER_LENGTH];
+   stExpectedRxConfigMessageData.uiMessageBodyLength = 52;
+
+   MessageDataStruct stExpectedEmbeddedMessageData;
+   stExpectedEmbeddedMessageData.pucMessage = &aucLog[OEM4_BINARY_HEADER_LENGTH];
+   stExpectedEmbeddedMessageData.uiMessageLength = 48;
+   stExpectedEmbeddedMessageData.pucMessageHeader = &aucLog[OEM4_BINARY_HEADER_LENGTH];
+   stExpectedEmbeddedMessageData.uiMessageHeaderLength = OEM4_BINARY_HEADER_LENGTH;
+   stExpectedEmbeddedMessageData.pucMessageBody = &aucLog[OEM4_BINARY_HEADER_LENGTH*2];
+   stExpectedEmbeddedMessageData.uiMessageBodyLength = 20;
+
+   // Convert the same frame repeatedly to exercise the handler's reused scratch message.
+   for (uint32_t i = 0; i < 2; i++)
+   {
+      MetaDataStruct stTestRxConfigMetaData;
+      MetaDataStruct stTestEmbeddedMetaData;
+      MessageDataStruct stTestRxConfigMessageData;
+      MessageDataStruct stTestEmbeddedMessageData;
+
+      ASSERT_EQ(pclMyRxConfigHandler->Convert(aucLog, stTestRxConfigMessageData, stTestRxConfigMetaData, stTestEmbeddedMessageData, stTestEmbeddedMetaData, ENCODEFORMAT::BINARY), STATUS::SUCCESS);
+      ASSERT_TRUE(CompareMessageData(&stTestRxConfigMessageData, &stExpectedRxConfigMessageData));
+      ASSERT_TRUE(CompareMessageData(&stTestEmbeddedMessageData, &stExpectedEmbeddedMessageData));
+   }
+}
+
 // -------------------------------------------------------------------------------------------------------
 // Conversion to JSON unit tests.
 // -------------------------------------------------------------------------------------------------------
@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/*! \file asyncfilewriter.hpp
+ *  \brief Writes data to output files on a background thread.
+ *
+ */
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef ASYNCFILEWRITER_HPP
+#define ASYNCFILEWRITER_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "filestream.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/*! \class AsyncFileWriter
+ *  \brief Writes data to any number of FileStreams on a writer thread.
+ *
+ *  Write() copies the data into a shared queue and returns.  Each time the
+ *  writer thread wakes up it takes everything that is queued, groups it by
+ *  file and writes each file's data with a single writev() call, so the
+ *  caller does not wait for the disk.  The caller only waits if more than the
+ *  configured number of bytes are queued.  The writer thread opens its own
+ *  descriptor for each file, in append mode.
+ */
+class AsyncFileWriter
+{
+   friend class MultiOutputFileStreamTest;
+
+public:
+   /*! Default number of bytes that can be queued before Write() waits */
+   static constexpr uint64_t ullDEFAULT_MAX_QUEUED_BYTES = 16 * 1024 * 1024;
+
+   /*! A Constructor
+    *  \brief  Starts the writer thread.
+    *
+    *  \param [in] ullMaxQueuedBytes_ Bytes that can be queued before Write() waits.
+    */
+   AsyncFileWriter(uint64_t ullMaxQueuedBytes_ = ullDEFAULT_MAX_QUEUED_BYTES);
+
+   /*! A destructor
+    *  \brief Writes out everything that is queued, closes the descriptor of
+    *  every file that has not been closed, and waits for the writer thread.
+    *  Those files are not deleted.  Files are only synced by Flush().
+    */
+   ~AsyncFileWriter();
+
+   /*! \fn uint32_t Write(FileStream*, const char*, uint32_t)
+    *  \brief Queue data to be appended to a file.
+    *
+    *  \param [in] pclFile_ The FileStream to write to.  Its own stream is not
+    *  used, so it should be closed once the file has been created.
+    *  \param [in] pcData_ The data to write.
+    *  \param [in] uiLength_ The number of bytes in pcData_.
+    *  \return uiLength_
+    *
+    *  \remark If writing to any file has failed, then exception
+    *  "asynchronous write failed" will be thrown.
+    */
+   uint32_t Write(FileStream* pclFile_, const char* pcData_, uint32_t uiLength_);
+
+   /*! \fn void Close(FileStream*)
+    *  \brief Write out a file's queued data, then close and delete it on the
+    *  writer thread.
+    *
+    *  \param [in] pclFile_ The FileStream, which the AsyncFileWriter now owns.
+    */
+   void Close(FileStream* pclFile_);
+
+   /*! \fn void Suspend(FileStream*)
+    *  \brief Write out a file's queued data and close its descriptor.  It is
+    *  reopened in append mode at the next Write().
+    *
+    *  \param [in] pclFile_ The FileStream, which is still owned by the caller.
+    */
+   void Suspend(FileStream* pclFile_);
+
+   /*! \fn void Flush()
+    *  \brief Wait until all of the data written so far is on disk.  The open
+    *  files are synced, and so are the files suspended or closed since the
+    *  last Flush(), so the data survives a crash once this returns.
+    *
+    *  \remark If writing to any file has failed, then exception
+    *  "asynchronous write failed" will be thrown.
+    */
+   void Flush();
+
+private:
+   AsyncFileWriter(const AsyncFileWriter& clTemp) = delete;
+   const AsyncFileWriter& operator= (const AsyncFileWriter& clTemp) = delete;
+
+   /*! \enum ENTRY_TYPE
+    *  \brief What the writer thread does with a queued entry.
+    */
+   enum class ENTRY_TYPE
+   {
+      WRITE,   //!< Append the entry's data to the file.
+      SUSPEND, //!< Close the file's descriptor until its next write.
+      CLOSE,   //!< Close the file's descriptor and delete the file.
+      SYNC     //!< Sync every open file once the batch is written.
+   };
+
+   /*! \struct Entry
+    *  \brief A write, or a request for the writer thread, in queue order.
+    */
+   struct Entry
+   {
+      FileStream* pclFile;
+      size_t ullOffset;
+      uint32_t uiLength;
+      ENTRY_TYPE eType;
+   };
+
+   /*! \struct Batch
+    *  \brief Queued entries, with the data of every write stored back to back.
+    */
+   struct Batch
+   {
+      std::vector<char> vData;
+      std::vector<Entry> vEntries;
+   };
+
+   /*! \fn void Queue(FileStream*, const char*, uint32_t, ENTRY_TYPE)
+    *  \brief Add an entry to the queue, waiting if too much is queued.
+    */
+   void Queue(FileStream* pclFile_, const char* pcData_, uint32_t uiLength_, ENTRY_TYPE eType_);
+
+   /*! \fn void WriteLoop()
+    *  \brief Body of the writer thread.
+    */
+   void WriteLoop();
+
+   /*! \fn void WriteBatch(Batch&, bool&)
+    *  \brief Write a batch, grouped by file, and carry out its requests.
+    *  Once bFailed_ is set, data is dropped but files are still closed.
+    */
+   void WriteBatch(Batch& stBatch_, bool& bFailed_);
+
+   /*! \fn void WriteFile(FileStream*, const Batch&, size_t, size_t)
+    *  \brief Write the data of the grouped entries [ullBegin_, ullEnd_),
+    *  which all belong to one file, with as few system calls as possible.
+    */
+   void WriteFile(FileStream* pclFile_, const Batch& stBatch_, size_t ullBegin_, size_t ullEnd_);
+
+   /*! \fn bool CloseDescriptor(FileStream*, bool)
+    *  \brief Close the writer thread's descriptor for a file, if it is open,
+    *  syncing it first if bSync_ is set.  Otherwise the file is synced by
+    *  name at the next SYNC.
+    *  \return false if the sync failed.
+    */
+   bool CloseDescriptor(FileStream* pclFile_, bool bSync_);
+
+   /*! \fn bool SyncClosedFiles()
+    *  \brief Sync the files closed without a sync since the last SYNC.  A
+    *  file that no longer exists is skipped.
+    *  \return false if any sync failed.
+    */
+   bool SyncClosedFiles();
+
+   uint64_t ullMyMaxQueuedBytes;
+
+   std::mutex clMyMutex;
+   std::condition_variable clMyEntryQueued;
+   std::condition_variable clMyBatchDone;
+   Batch stMyQueue;
+   uint64_t ullMyQueuedBytes{ 0 };
+   uint64_t ullMySyncsQueued{ 0 };
+   uint64_t ullMySyncsDone{ 0 };
+   bool bMyStop{ false };
+   bool bMyFailed{ false };
+
+   //! State only touched by the writer thread.
+   Batch stMyBatch;
+   //! Indices into stMyBatch.vEntries, grouped by file.
+   std::vector<size_t> vMyGroupedEntries;
+   std::unordered_map<FileStream*, int32_t> umMyDescriptors;
+   //! Names of the files written and closed since the last SYNC.
+   std::unordered_set<std::string> usMyUnsyncedFiles;
+   std::thread clMyThread;
+};
+
+#endif
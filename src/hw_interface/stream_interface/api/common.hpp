@@ -52,6 +52,18 @@ typedef enum
    SPLIT_NONE    /*!< Do not split */
 } FileSplitMethodEnum;
 
+/*! An Enum.
+ *
+ * Compression of a file read by InputCompressedFileStream or written by
+ * MultiOutputFileStream.
+ */
+enum class COMPRESSION
+{
+   NONE, /*!< Uncompressed */
+   GZIP, /*!< gzip, through zlib */
+   ZSTD  /*!< zstd, if built with HAVE_ZSTD */
+};
+
 /*! A Structure
  *
  * Hold/copy decoded log and size of it.
@@ -0,0 +1,196 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/*! \file compressedfilewriter.hpp
+ *  \brief Compresses data into output files on a background thread.
+ *
+ */
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef COMPRESSEDFILEWRITER_HPP
+#define COMPRESSEDFILEWRITER_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "common.hpp"
+#include "filestream.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*! \class CompressedFileWriter
+ *  \brief Writes gzip or zstd compressed streams to any number of FileStreams.
+ *
+ *  Write() only copies the data into a per-file buffer.  Full buffers are
+ *  queued to a worker thread that owns the compressors and writes the
+ *  compressed bytes.  The worker reopens suspended files in append mode.
+ *  The caller only waits if more than the configured number of bytes are
+ *  queued.  Each file is a complete compressed stream once Close() has been
+ *  processed.
+ */
+class CompressedFileWriter
+{
+public:
+   /*! Default number of bytes buffered per file before they are queued */
+   static constexpr uint32_t uiDEFAULT_BUFFER_SIZE = 256 * 1024;
+   /*! Default number of bytes that can be queued before Write() waits */
+   static constexpr uint64_t ullDEFAULT_MAX_QUEUED_BYTES = 64 * 1024 * 1024;
+
+   /*! A Constructor
+    *  \brief  Starts the compression thread.
+    *
+    *  \param [in] eCompression_ The compression to apply.
+    *  \param [in] iLevel_ The compression level, or -1 for the format's default.
+    *  \param [in] uiBufferSize_ Bytes buffered per file before they are queued.
+    *  \param [in] ullMaxQueuedBytes_ Bytes that can be queued before Write() waits.
+    *
+    *  \remark If eCompression_ is not built in, then exception "compression
+    *  not supported" will be thrown.
+    */
+   CompressedFileWriter(COMPRESSION eCompression_, int32_t iLevel_ = -1, uint32_t uiBufferSize_ = uiDEFAULT_BUFFER_SIZE,
+                        uint64_t ullMaxQueuedBytes_ = ullDEFAULT_MAX_QUEUED_BYTES);
+
+   /*! A destructor
+    *  \brief Finishes the compressed stream of every file that has not been
+    *  closed, and waits for the compression thread.  Those files are not deleted.
+    */
+   ~CompressedFileWriter();
+
+   /*! \fn uint32_t Write(FileStream*, const char*, uint32_t)
+    *  \brief Append data to the compressed stream of a file.
+    *
+    *  \param [in] pclFile_ An open output FileStream.
+    *  \param [in] pcData_ The data to compress.
+    *  \param [in] uiLength_ The number of bytes in pcData_.
+    *  \return uiLength_
+    *
+    *  \remark If writing to any file has failed, then exception
+    *  "compressed write failed" will be thrown.
+    */
+   uint32_t Write(FileStream* pclFile_, const char* pcData_, uint32_t uiLength_);
+
+   /*! \fn void Close(FileStream*)
+    *  \brief Finish the compressed stream of a file, then close and delete it
+    *  on the compression thread.
+    *
+    *  \param [in] pclFile_ The FileStream, which the CompressedFileWriter now owns.
+    */
+   void Close(FileStream* pclFile_);
+
+   /*! \fn void Suspend(FileStream*)
+    *  \brief Write out a file's buffered data and close its descriptor.  The
+    *  compressed stream carries on, in append mode, at the next Write().
+    *
+    *  \param [in] pclFile_ The FileStream, which is still owned by the caller.
+    */
+   void Suspend(FileStream* pclFile_);
+
+   /*! \fn void Flush()
+    *  \brief Flush every file's compressed stream, so that all of the data
+    *  written so far can be decompressed, and wait until it is on disk.
+    */
+   void Flush();
+
+   /*! \fn const char* GetExtension(COMPRESSION)
+    *  \brief Returns the file extension for a compression, including the '.'.
+    */
+   static const char* GetExtension(COMPRESSION eCompression_);
+
+private:
+   CompressedFileWriter(const CompressedFileWriter& clTemp) = delete;
+   const CompressedFileWriter& operator= (const CompressedFileWriter& clTemp) = delete;
+
+   /*! \enum JOB_TYPE
+    *  \brief What the compression thread does with a queued buffer.
+    */
+   enum class JOB_TYPE
+   {
+      WRITE,   //!< Compress the data.
+      FLUSH,   //!< Compress the data and flush the compressed stream.
+      FINISH,  //!< Compress the data and finish the compressed stream.
+      SUSPEND, //!< Compress the data, then close the file until its next write.
+      CLOSE    //!< Finish the compressed stream, then close and delete the file.
+   };
+
+   /*! \struct Job
+    *  \brief A buffer queued for the compression thread.
+    */
+   struct Job
+   {
+      FileStream* pclFile;
+      std::vector<char> vData;
+      JOB_TYPE eType;
+   };
+
+   /*! Compressor state for one file, only used on the compression thread. */
+   struct Encoder;
+
+   /*! \fn void Submit(FileStream*, JOB_TYPE)
+    *  \brief Queue a file's buffered data, waiting if too much is queued.
+    */
+   void Submit(FileStream* pclFile_, JOB_TYPE eType_);
+
+   /*! \fn void CompressLoop()
+    *  \brief Body of the compression thread.
+    */
+   void CompressLoop();
+
+   /*! \fn void Process(Job&)
+    *  \brief Compress a job's data and write it to its file.
+    */
+   void Process(Job& stJob_);
+
+   COMPRESSION eMyCompression;
+   int32_t iMyLevel;
+   uint32_t uiMyBufferSize;
+   uint64_t ullMyMaxQueuedBytes;
+
+   //! Data not yet queued, only touched by the writing thread.
+   std::map<FileStream*, std::vector<char>> mMyBuffers;
+
+   std::mutex clMyMutex;
+   std::condition_variable clMyJobQueued;
+   std::condition_variable clMyJobDone;
+   std::deque<Job> dMyJobs;
+   std::vector<std::vector<char>> vMyFreeBuffers;
+   uint64_t ullMyQueuedBytes{ 0 };
+   bool bMyBusy{ false };
+   bool bMyStop{ false };
+   bool bMyFailed{ false };
+
+   //! Compressors, only touched by the compression thread.
+   std::map<FileStream*, std::unique_ptr<Encoder>> mMyEncoders;
+   std::vector<char> vMyOutput;
+   std::thread clMyThread;
+};
+
+#endif
@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/*! \file inputcompressedfilestream.hpp
+ *  \brief It is a Derived class from InputFileStream. Input to the decoder is
+ *  a gzip or zstd compressed file, decompressed on the fly.
+ *
+ */
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef INPUTCOMPRESSEDFILESTREAM_HPP
+#define INPUTCOMPRESSEDFILESTREAM_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "inputfilestream.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*! \class InputCompressedFileStream
+ *   \brief A Derived class will be used by decoder, if the decoded input is a
+ *   compressed file.
+ *
+ *  The compression is detected from the first bytes of the file: gzip
+ *  (including concatenated members), zstd when built with HAVE_ZSTD, or none,
+ *  in which case the bytes are passed through.  A worker thread decompresses
+ *  into a ring of read-ahead blocks while the caller parses the previous ones.
+ *
+ *  Offsets given to Reset() and reported by GetCurrentFilePosition() are in
+ *  decompressed bytes.  Moving forward skips decompressed bytes, while moving
+ *  backward restarts decompression from the start of the file.  The read
+ *  percentage is based on the compressed bytes consumed.
+*/
+class InputCompressedFileStream : public InputFileStream
+{
+public:
+   /*! Default number of decompressed bytes held by each read-ahead block */
+   static constexpr uint32_t uiDEFAULT_BLOCK_SIZE = 1024 * 1024;
+   /*! Default number of read-ahead blocks */
+   static constexpr uint32_t uiDEFAULT_BLOCK_COUNT = 4;
+
+   /*! A Constructor
+    *  \brief  Opens the file and starts decompressing it.
+    *
+    *  \param [in] pcFileName_ file name as Character pointer.
+    *  \param [in] uiBlockSize_ Decompressed bytes held by each read-ahead block.
+    *  \param [in] uiBlockCount_ Number of read-ahead blocks.
+    *
+    *  \remark If the file is zstd compressed and zstd support is not built in,
+    *  then exception "zstd support is not built in" will be thrown.
+    */
+   InputCompressedFileStream(const char* pcFileName_, uint32_t uiBlockSize_ = uiDEFAULT_BLOCK_SIZE, uint32_t uiBlockCount_ = uiDEFAULT_BLOCK_COUNT);
+
+   /*! A Constructor
+    *  \brief  Opens the file with wide character filename string and starts
+    *  decompressing it.
+    *
+    *  \param [in] s32FileName_ Wide character file name.
+    *  \param [in] uiBlockSize_ Decompressed bytes held by each read-ahead block.
+    *  \param [in] uiBlockCount_ Number of read-ahead blocks.
+    */
+   InputCompressedFileStream(const std::u32string s32FileName_, uint32_t uiBlockSize_ = uiDEFAULT_BLOCK_SIZE, uint32_t uiBlockCount_ = uiDEFAULT_BLOCK_COUNT);
+
+   /*! A destructor, stops the decompression thread */
+   virtual ~InputCompressedFileStream();
+
+   /*! \fn StreamReadStatus ReadData(ReadDataStructure&)
+    *  \brief Copy up to pReadDataStructure.uiDataSize decompressed bytes,
+    *  waiting for the decompression thread if it has fallen behind.
+    *
+    *  \param [in] pReadDataStructure ReadDataStructure to hold the bytes read.
+    *  \return StreamReadStatus read data statistics.
+    *
+    *  \remark If the compressed data is corrupt, then exception "decompression
+    *  failed" will be thrown.  A truncated file ends the stream quietly.
+    */
+   StreamReadStatus ReadData(ReadDataStructure& pReadDataStructure);
+
+   /*! \fn StreamReadStatus ReadLine
+    *  \brief Read one decompressed line, without the line terminator.
+    *
+    *  \param [in] szLine String to hold the line.
+    *  \return Returns Read statistics structure (StreamReadStatus)
+    */
+   StreamReadStatus ReadLine(std::string& szLine);
+
+   /*! \fn void Reset(std::streamoff = 0, std::ios_base::seekdir = std::ios::beg)
+    *  \brief Set the decompressed position from which next read will be done.
+    *
+    *  \param [in] offset the decompressed position to read from.
+    *  \param [in] dir std::ios::beg or std::ios::cur.
+    *
+    *  \remark The decompressed length is not known up front, so seeking from
+    *  std::ios::end throws "seek from end not supported".
+    */
+   void Reset(std::streamoff offset = 0, std::ios_base::seekdir dir = std::ios::beg);
+
+   /*! \fn uint64_t GetCurrentFilePosition()
+    *  \brief Returns the decompressed position from which next read will be done.
+    */
+   uint64_t GetCurrentFilePosition();
+
+   /*! \fn bool IsRandomAccess()
+    *  \brief Moving backward means decompressing from the start again.
+    *
+    *  \return false.
+    */
+   bool IsRandomAccess() const;
+
+   /*! \fn COMPRESSION GetCompression()
+    *  \brief Returns the compression format detected for the file.
+    */
+   COMPRESSION GetCompression() const;
+
+   /*! \fn COMPRESSION DetectCompression(const unsigned char*, uint32_t)
+    *  \brief Identify the compression format from the first bytes of a file.
+    *
+    *  \param [in] pucData_ The first bytes of the file.
+    *  \param [in] uiLength_ The number of bytes in pucData_.
+    *  \return The compression format, or COMPRESSION::NONE if unrecognised.
+    */
+   static COMPRESSION DetectCompression(const unsigned char* pucData_, uint32_t uiLength_);
+
+private:
+   InputCompressedFileStream(const InputCompressedFileStream& clTemp) = delete;
+   const InputCompressedFileStream& operator= (const InputCompressedFileStream& clTemp) = delete;
+
+   /*! \struct DecompressedBlock
+    *  \brief One read-ahead block and the compressed bytes it came from.
+    */
+   struct DecompressedBlock
+   {
+      std::vector<char> vData;
+      uint32_t uiSize{ 0 };
+      uint64_t ullCompressedBegin{ 0 };
+      uint64_t ullCompressedEnd{ 0 };
+      bool bLast{ false };   //!< No blocks follow this one.
+      bool bFailed{ false }; //!< The compressed data is corrupt.
+   };
+
+   /*! Decoder state for the detected compression format. */
+   struct Decoder;
+
+   /*! \fn void Initialize(uint32_t, uint32_t)
+    *  \brief Detect the compression format and start the decompression thread.
+    */
+   void Initialize(uint32_t uiBlockSize_, uint32_t uiBlockCount_);
+
+   /*! \fn void StartDecompression()
+    *  \brief Rewind the compressed file and start the decompression thread.
+    */
+   void StartDecompression();
+
+   /*! \fn void StopDecompression()
+    *  \brief Stop the decompression thread and discard its blocks.
+    */
+   void StopDecompression();
+
+   /*! \fn void DecompressLoop()
+    *  \brief Body of the decompression thread.
+    */
+   void DecompressLoop();
+
+   /*! \fn DecompressedBlock* AcquireBlock()
+    *  \brief Wait for the block the next read comes from.
+    *
+    *  \return The block, or nullptr at the end of the stream.
+    */
+   DecompressedBlock* AcquireBlock();
+
+   /*! \fn void ReleaseBlock()
+    *  \brief Hand the fully read block back to the decompression thread.
+    */
+   void ReleaseBlock();
+
+   /*! \fn uint32_t Consume(char*, uint32_t)
+    *  \brief Copy, or skip if pcData_ is nullptr, up to uiSize_ decompressed bytes.
+    *
+    *  \return The number of bytes consumed.
+    */
+   uint32_t Consume(char* pcData_, uint32_t uiSize_);
+
+   /*! \fn StreamReadStatus GetReadStatus(uint32_t)
+    *  \brief Fill in the read statistics for a read of uiRead_ bytes.
+    */
+   StreamReadStatus GetReadStatus(uint32_t uiRead_);
+
+   COMPRESSION eMyCompression{ COMPRESSION::NONE };
+   uint64_t ullMyCompressedLength{ 0 };
+
+   std::unique_ptr<Decoder> pclMyDecoder;
+   std::thread clMyThread;
+   std::mutex clMyMutex;
+   std::condition_variable clMyBlockFilled;
+   std::condition_variable clMyBlockFreed;
+   std::atomic<bool> bMyStop{ false };
+
+   //! Ring of read-ahead blocks.  The decompression thread fills
+   //! vMyBlocks[uiMyTail], the reader consumes vMyBlocks[uiMyHead].
+   std::vector<DecompressedBlock> vMyBlocks;
+   uint32_t uiMyHead{ 0 };
+   uint32_t uiMyTail{ 0 };
+   uint32_t uiMyFilledBlocks{ 0 };
+
+   //! Reader side state, only touched by the reading thread.
+   bool bMyHoldingBlock{ false };
+   uint32_t uiMyBlockOffset{ 0 };
+   uint64_t ullMyPosition{ 0 };
+   uint64_t ullMyCompressedPosition{ 0 };
+};
+
+#endif
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/*! \file inputfdstream.hpp
+ *  \brief It is a Derived class from main InputStream. Input to the decoder is
+ *  a file descriptor, such as a serial port, pipe or socket.
+ *
+ */
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef INPUTFDSTREAM_HPP
+#define INPUTFDSTREAM_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "inputstreaminterface.hpp"
+
+/*! \class InputFdStream
+ *   \brief A Derived class will be used by decoder, if the decoded input is a
+ *   POSIX file descriptor.
+ *
+ *  Derived from base class InputStreamInterface.  The descriptor is switched
+ *  to non-blocking mode so the stream can be driven by poll/epoll: ReadData()
+ *  returns whatever is available, or nothing if no bytes are waiting.
+*/
+class InputFdStream : public InputStreamInterface
+{
+public:
+   /*! A Constructor
+    *  \brief  Wraps an open file descriptor.
+    *
+    *  \param [in] iFd_ An open, readable file descriptor.
+    *  \param [in] bOwnsFd_ Close the descriptor when this object is destroyed.
+    *
+    *  \remark If iFd_ is invalid, then an nExcept "File descriptor not valid" will be thrown.
+    */
+   InputFdStream(int32_t iFd_, bool bOwnsFd_ = false);
+
+   /*! A destructor, closes the descriptor if it is owned */
+   virtual ~InputFdStream();
+
+   /*! \fn StreamReadStatus ReadData(ReadDataStructure&)
+    *  \brief Read the bytes that are available on the descriptor, up to
+    *  pReadDataStructure.uiDataSize, without blocking.
+    *
+    *  \param [in] pReadDataStructure ReadDataStructure to hold the bytes read.
+    *  \return StreamReadStatus read data statistics.  bEOS is set once the
+    *  peer has closed the stream or the descriptor has failed.  A datagram
+    *  socket does not end on an empty datagram.
+    */
+   StreamReadStatus ReadData(ReadDataStructure& pReadDataStructure);
+
+   /*! \fn bool IsStreamAvailable()
+    *  \brief Checks whether the end of the stream has been reached.
+    *
+    *  \return false once ReadData() has reported the end of the stream.
+    */
+   bool IsStreamAvailable(void);
+
+   /*! \fn int32_t GetFileDescriptor()
+    *  \brief Returns the wrapped file descriptor.
+    */
+   int32_t GetFileDescriptor() const;
+
+   /*! \fn uint64_t  GetCurrentFileOffset(void)
+    *  \brief Returns the number of bytes read so far.
+    */
+   uint64_t  GetCurrentFileOffset(void) const;
+
+private:
+   InputFdStream(const InputFdStream& clTemp) = delete;
+   const InputFdStream& operator= (const InputFdStream& clTemp) = delete;
+
+   /*! \var iMyFd
+    *
+    *  The wrapped file descriptor.
+    */
+   int32_t iMyFd;
+
+   /*! \var bMyOwnsFd
+    *
+    *  Close iMyFd on destruction.
+    */
+   bool bMyOwnsFd;
+
+   /*! \var bMyDatagram
+    *
+    *  iMyFd is a datagram socket, where a read of 0 bytes is an empty
+    *  datagram rather than the end of the stream.
+    */
+   bool bMyDatagram{ false };
+
+   /*! \var bMyEOS
+    *
+    *  The end of the stream has been reached.
+    */
+   bool bMyEOS{ false };
+
+   /*! \var ullMyBytesRead
+    *
+    *  Number of bytes read so far.
+    */
+   uint64_t ullMyBytesRead{ 0 };
+};
+
+#endif
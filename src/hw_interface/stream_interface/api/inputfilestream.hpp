@@ -127,6 +127,13 @@ public:
     */
    uint64_t  GetCurrentFileOffset(void) const;
 
+   /*! \fn bool IsRandomAccess()
+    *  \brief Can Reset() move to any offset without reading the bytes before it?
+    *
+    *  \return true for a plain file.
+    */
+   virtual bool IsRandomAccess() const;
+
 private:
 	/*! Private Copy Constructor
 	 *
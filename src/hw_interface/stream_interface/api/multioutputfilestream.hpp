@@ -38,12 +38,17 @@
 // Includes
 //-----------------------------------------------------------------------
 #include "outputstreaminterface.hpp"
+#include "asyncfilewriter.hpp"
+#include "compressedfilewriter.hpp"
 #include "filestream.hpp"
 #include "decoders/common/api/common.hpp"
 #include "decoders/common/api/nexcept.h"
 #include "decoders/novatel/api/common.hpp"
+#include <list>
 #include <string>
 #include <map>
+#include <memory>
+#include <unordered_map>
 
 /*! \def MIN_TIME_SPLIT_SEC
  *  \brief Minimum split time in seconds.
@@ -160,6 +165,31 @@ public:
       uint16_t usWeek_,
       double dMilliseconds_);
 
+   /*! \fn uint32_t WriteData(char* pcData_, uint32_t uiDataLength_, uint32_t uiMessageId_, const std::string& strMsgName_, uint32_t uiSize_, novatel::edie::TIME_STATUS eStatus_, uint16_t usWeek_, double dMilliseconds_)
+    *  \brief As the WriteData above, but when splitting by log the output file
+    *  is looked up by message ID.  The file name is only built the first time
+    *  an ID is seen.
+    *  \param [in] char* pcData_
+    *  \param [in] uint32_t uiDataLength_
+    *  \param [in] uint32_t uiMessageId_ The log's message ID.  Logs with the
+    *  same ID must have the same strMsgName_.
+    *  \param [in] std::string strMsgName_
+    *  \param [in] uint32_t uiSize_
+    *  \param [in] novatel::edie::TIME_STATUS eStatus_
+    *  \param [in] uint16_t usWeek_
+    *  \param [in] double dMilliseconds_
+    *  \return Number of bytes written to output file.
+    */
+   uint32_t WriteData(
+      char* pcData_,
+      uint32_t uiDataLength_,
+      uint32_t uiMessageId_,
+      const std::string& strMsgName_,
+      uint32_t uiSize_,
+      novatel::edie::TIME_STATUS eStatus_,
+      uint16_t usWeek_,
+      double dMilliseconds_);
+
    /*! \fn uint32_t WriteData(CHAR *pcFrameBuf_, uint32_t uiLength)
     *  \brief Write Buffer to outputfile.
     *  \param [in] *pcFrameBuf_ pointer to buffer to be written to output file
@@ -240,6 +270,47 @@ public:
     */
    void SelectTimeFile(novatel::edie::TIME_STATUS eStatus_, uint16_t usWeek_, double dMilliseconds_);
 
+   /*! \fn void ConfigureCompression(COMPRESSION eCompression_, int32_t iLevel_)
+    *  \brief Compress the output files on a background thread.
+    *  \param [in] eCompression_ The compression, or COMPRESSION::NONE for raw output.
+    *  \param [in] iLevel_ The compression level, or -1 for the format's default.
+    *  \remark Files already open are closed.  Files opened afterwards get ".gz"
+    *  or ".zst" appended to their names.  Each one is finished as a complete
+    *  compressed stream when the output is split to a new file or this object is
+    *  destroyed.  Split sizes count the bytes before compression.
+    *  If eCompression_ is not built in, exception "compression not supported"
+    *  will be thrown.
+    */
+   void ConfigureCompression(COMPRESSION eCompression_, int32_t iLevel_ = -1);
+
+   /*! \fn void ConfigureAsyncWrite(bool bEnable_, uint64_t ullMaxQueuedBytes_)
+    *  \brief Write the output files on a background thread, so that WriteData
+    *  does not wait for the disk.
+    *  \param [in] bEnable_ true to write in the background, false to write
+    *  each message before WriteData returns.
+    *  \param [in] ullMaxQueuedBytes_ Bytes that can be queued before WriteData waits.
+    *  \remark Files already open are closed.  Compressed output is always
+    *  written by the compression thread, so this only applies without compression.
+    *  \sa AsyncFileWriter
+    */
+   void ConfigureAsyncWrite(bool bEnable_, uint64_t ullMaxQueuedBytes_ = AsyncFileWriter::ullDEFAULT_MAX_QUEUED_BYTES);
+
+   /*! \fn void Flush()
+    *  \brief Wait until everything written so far has reached the output files.
+    *  With ConfigureAsyncWrite the files are also synced to disk.
+    */
+   void Flush();
+
+   /*! \fn void ConfigureMaxOpenFiles(uint32_t uiMaxOpenFiles_)
+    *  \brief Limit the number of output files held open at once.
+    *  \param [in] uiMaxOpenFiles_ The maximum number of open files, or 0 for no limit.
+    *  \remark When a file has to be opened beyond the limit, the least recently
+    *  written one is closed.  It is reopened in append mode the next time it
+    *  is written to.  Compressed files keep their compressor state while closed.
+    *  Setting the limit back to 0 reopens every closed file.
+    */
+   void ConfigureMaxOpenFiles(uint32_t uiMaxOpenFiles_);
+
    /*! \fn std::map<std::string, FileStream*> GetFileMap()
     *  \brief Gets the output file map
     *  \return Map with filename and FileStream Struct as key-value pair
@@ -258,8 +329,8 @@ public:
     *  \brief Sets the extension name of the output file
     *  \param [in] strExt std::string - Output file name
     */
-   void SetExtensionName(std::string strExt) { stMyExtentionName = strExt; }
-   void SetExtensionName(std::u32string strExt) { s32MyExtentionName = strExt; }
+   void SetExtensionName(std::string strExt) { stMyExtentionName = strExt; umMyLogFiles.clear(); }
+   void SetExtensionName(std::u32string strExt) { s32MyExtentionName = strExt; umMyLogFiles.clear(); }
 
    /*! Frind class to test private methods. */
    friend class MultiOutputFileStreamTest;
@@ -278,6 +349,46 @@ private:
 	 */
    const MultiOutputFileStream& operator= (const MultiOutputFileStream& clTemp);
 
+   /*! \fn void CloseFileStream(FileStream* pclFileStream_)
+    *  \brief Close and delete an output file, finishing its compressed
+    *  stream first if compression is configured.
+    */
+   void CloseFileStream(FileStream* pclFileStream_);
+
+   /*! \fn void KeepFileStreamOpen(FileStream* pclFileStream_)
+    *  \brief Mark an output file as the most recently used one, reopening it
+    *  if it was closed to stay within uiMyMaxOpenFiles.  The least recently
+    *  used files are closed to make room.
+    */
+   void KeepFileStreamOpen(FileStream* pclFileStream_);
+
+   /*! \fn void EvictLeastRecent()
+    *  \brief Close the least recently used open output file, or suspend it
+    *  if a background writer owns it.
+    */
+   void EvictLeastRecent();
+
+   /*! Maximum number of open output files, 0 for no limit */
+   uint32_t uiMyMaxOpenFiles{ 0 };
+
+   /*! Open output files, most recently used first, if uiMyMaxOpenFiles is set */
+   std::list<FileStream*> lMyOpenFiles;
+
+   /*! Position of each open output file in lMyOpenFiles */
+   std::unordered_map<FileStream*, std::list<FileStream*>::iterator> umMyOpenFiles;
+
+   /*! Output file of each message ID, when splitting by log */
+   std::unordered_map<uint32_t, FileStream*> umMyLogFiles;
+
+   /*! Compression applied to files opened from now on */
+   COMPRESSION eMyCompression{ COMPRESSION::NONE };
+
+   /*! Compresses and writes the output files, if compression is configured */
+   std::unique_ptr<CompressedFileWriter> pMyCompressedFileWriter;
+
+   /*! Writes the uncompressed output files, if asynchronous writes are configured */
+   std::unique_ptr<AsyncFileWriter> pMyAsyncFileWriter;
+
    /*! FileStream class object pointer
     * \sa FileStream
     */
@@ -39,8 +39,11 @@
 // Includes
 //-----------------------------------------------------------------------
 #include "outputstreaminterface.hpp"
+#include "asyncfilewriter.hpp"
 #include "filestream.hpp"
 
+#include <memory>
+
 /*! \class OutputFileStream
  *  \brief A Derived class from parent interface class OutputStreamInterface.
  *
@@ -86,7 +89,26 @@ public:
     */
    uint32_t WriteData(char* cData, uint32_t uiSize);
 
+   /*! \fn void ConfigureAsyncWrite(bool bEnable_, uint64_t ullMaxQueuedBytes_)
+    *  \brief Write the output file on a background thread, so that WriteData
+    *  does not wait for the disk.
+    *  \param [in] bEnable_ true to write in the background, false to write
+    *  each message before WriteData returns.
+    *  \param [in] ullMaxQueuedBytes_ Bytes that can be queued before WriteData waits.
+    *  \sa AsyncFileWriter
+    */
+   void ConfigureAsyncWrite(bool bEnable_, uint64_t ullMaxQueuedBytes_ = AsyncFileWriter::ullDEFAULT_MAX_QUEUED_BYTES);
+
+   /*! \fn void Flush()
+    *  \brief Wait until everything written so far has reached the output file.
+    *  With ConfigureAsyncWrite the file is also synced to disk.
+    */
+   void Flush();
+
 private:
+   /*! Writes the output file, if asynchronous writes are configured */
+   std::unique_ptr<AsyncFileWriter> pMyAsyncFileWriter;
+
 	/*! Private Copy Constructor
 	 *
 	 *  A copy constructor is a member function which initializes an object using another object of the same class.
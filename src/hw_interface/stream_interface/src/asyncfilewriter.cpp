@@ -0,0 +1,369 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include "asyncfilewriter.hpp"
+#include "decoders/common/api/nexcept.h"
+
+#include <algorithm>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+// code
+// ---------------------------------------------------------
+AsyncFileWriter::AsyncFileWriter(uint64_t ullMaxQueuedBytes_)
+   : ullMyMaxQueuedBytes(ullMaxQueuedBytes_)
+{
+   clMyThread = std::thread(&AsyncFileWriter::WriteLoop, this);
+}
+
+// ---------------------------------------------------------
+AsyncFileWriter::~AsyncFileWriter()
+{
+   {
+      std::lock_guard<std::mutex> clLock(clMyMutex);
+      bMyStop = true;
+   }
+   clMyEntryQueued.notify_one();
+   clMyThread.join();
+
+   while (!umMyDescriptors.empty())
+   {
+      CloseDescriptor(umMyDescriptors.begin()->first, false);
+   }
+}
+
+// ---------------------------------------------------------
+uint32_t AsyncFileWriter::Write(FileStream* pclFile_, const char* pcData_, uint32_t uiLength_)
+{
+   Queue(pclFile_, pcData_, uiLength_, ENTRY_TYPE::WRITE);
+   return uiLength_;
+}
+
+// ---------------------------------------------------------
+void AsyncFileWriter::Close(FileStream* pclFile_)
+{
+   Queue(pclFile_, nullptr, 0, ENTRY_TYPE::CLOSE);
+}
+
+// ---------------------------------------------------------
+void AsyncFileWriter::Suspend(FileStream* pclFile_)
+{
+   Queue(pclFile_, nullptr, 0, ENTRY_TYPE::SUSPEND);
+}
+
+// ---------------------------------------------------------
+void AsyncFileWriter::Flush()
+{
+   Queue(nullptr, nullptr, 0, ENTRY_TYPE::SYNC);
+
+   std::unique_lock<std::mutex> clLock(clMyMutex);
+   const uint64_t ullSync = ullMySyncsQueued;
+   clMyBatchDone.wait(clLock, [this, ullSync] { return ullMySyncsDone >= ullSync; });
+   if (bMyFailed)
+   {
+      throw nExcept("asynchronous write failed");
+   }
+}
+
+// ---------------------------------------------------------
+void AsyncFileWriter::Queue(FileStream* pclFile_, const char* pcData_, uint32_t uiLength_, ENTRY_TYPE eType_)
+{
+   bool bWasEmpty = false;
+   {
+      std::unique_lock<std::mutex> clLock(clMyMutex);
+      // Closing a file must always reach the writer thread, which owns it.  A
+      // write bigger than the limit is let through once nothing else is queued.
+      clMyBatchDone.wait(clLock, [this, uiLength_, eType_] {
+         return eType_ != ENTRY_TYPE::WRITE || bMyFailed || ullMyQueuedBytes == 0 || ullMyQueuedBytes + uiLength_ <= ullMyMaxQueuedBytes;
+      });
+      if (bMyFailed && eType_ == ENTRY_TYPE::WRITE)
+      {
+         throw nExcept("asynchronous write failed");
+      }
+
+      bWasEmpty = stMyQueue.vEntries.empty();
+      stMyQueue.vEntries.push_back(Entry{ pclFile_, stMyQueue.vData.size(), uiLength_, eType_ });
+      stMyQueue.vData.insert(stMyQueue.vData.end(), pcData_, pcData_ + uiLength_);
+      ullMyQueuedBytes += uiLength_;
+      if (eType_ == ENTRY_TYPE::SYNC)
+      {
+         ullMySyncsQueued++;
+      }
+   }
+   // The writer thread takes everything that is queued each time it wakes,
+   // so it only needs waking when the queue was empty.
+   if (bWasEmpty)
+   {
+      clMyEntryQueued.notify_one();
+   }
+}
+
+// ---------------------------------------------------------
+void AsyncFileWriter::WriteLoop()
+{
+   while (true)
+   {
+      bool bFailed = false;
+      {
+         std::unique_lock<std::mutex> clLock(clMyMutex);
+         clMyEntryQueued.wait(clLock, [this] { return bMyStop || !stMyQueue.vEntries.empty(); });
+         if (stMyQueue.vEntries.empty())
+         {
+            return;
+         }
+         std::swap(stMyQueue, stMyBatch);
+         bFailed = bMyFailed;
+      }
+
+      const uint64_t ullSyncs = std::count_if(stMyBatch.vEntries.begin(), stMyBatch.vEntries.end(),
+                                              [](const Entry& stEntry_) { return stEntry_.eType == ENTRY_TYPE::SYNC; });
+      WriteBatch(stMyBatch, bFailed);
+
+      {
+         std::lock_guard<std::mutex> clLock(clMyMutex);
+         ullMyQueuedBytes -= stMyBatch.vData.size();
+         ullMySyncsDone += ullSyncs;
+         bMyFailed = bMyFailed || bFailed;
+      }
+      stMyBatch.vData.clear();
+      stMyBatch.vEntries.clear();
+      clMyBatchDone.notify_all();
+   }
+}
+
+// ---------------------------------------------------------
+void AsyncFileWriter::WriteBatch(Batch& stBatch_, bool& bFailed_)
+{
+   const std::vector<Entry>& vEntries = stBatch_.vEntries;
+
+   // Group the entries by file, in the order each file first appears, keeping
+   // each file's entries in the order they were queued.
+   bool bSync = false;
+   std::unordered_map<FileStream*, size_t> umFirstEntry;
+   vMyGroupedEntries.clear();
+   for (size_t i = 0; i < vEntries.size(); i++)
+   {
+      if (vEntries[i].eType == ENTRY_TYPE::SYNC)
+      {
+         bSync = true;
+         continue;
+      }
+      umFirstEntry.emplace(vEntries[i].pclFile, i);
+      vMyGroupedEntries.push_back(i);
+   }
+   std::stable_sort(vMyGroupedEntries.begin(), vMyGroupedEntries.end(), [&](size_t ullLhs_, size_t ullRhs_) {
+      return umFirstEntry[vEntries[ullLhs_].pclFile] < umFirstEntry[vEntries[ullRhs_].pclFile];
+   });
+
+   for (size_t i = 0; i < vMyGroupedEntries.size();)
+   {
+      const Entry& stEntry = vEntries[vMyGroupedEntries[i]];
+      if (stEntry.eType != ENTRY_TYPE::WRITE)
+      {
+         // Once a write has failed the remaining data is dropped, but files
+         // are still closed.
+         if (!CloseDescriptor(stEntry.pclFile, bSync && !bFailed_))
+         {
+            bFailed_ = true;
+         }
+         if (stEntry.eType == ENTRY_TYPE::CLOSE)
+         {
+            delete stEntry.pclFile;
+         }
+         i++;
+         continue;
+      }
+
+      size_t ullEnd = i + 1;
+      while (ullEnd < vMyGroupedEntries.size() && vEntries[vMyGroupedEntries[ullEnd]].pclFile == stEntry.pclFile &&
+             vEntries[vMyGroupedEntries[ullEnd]].eType == ENTRY_TYPE::WRITE)
+      {
+         ullEnd++;
+      }
+      try
+      {
+         if (!bFailed_)
+         {
+            WriteFile(stEntry.pclFile, stBatch_, i, ullEnd);
+         }
+      }
+      catch (...)
+      {
+         bFailed_ = true;
+      }
+      i = ullEnd;
+   }
+
+   if (bSync && !bFailed_)
+   {
+      if (!SyncClosedFiles())
+      {
+         bFailed_ = true;
+      }
+      for (const auto& itDescriptor : umMyDescriptors)
+      {
+#ifdef _WIN32
+         itDescriptor.first->FlushFile();
+#else
+         if (fsync(itDescriptor.second) != 0)
+         {
+            bFailed_ = true;
+         }
+#endif
+      }
+   }
+}
+
+// ---------------------------------------------------------
+void AsyncFileWriter::WriteFile(FileStream* pclFile_, const Batch& stBatch_, size_t ullBegin_, size_t ullEnd_)
+{
+#ifdef _WIN32
+   if (!pclFile_->GetMyFileStream()->is_open())
+   {
+      pclFile_->OpenFile(FileStream::FILEMODES::APPEND);
+   }
+   umMyDescriptors.emplace(pclFile_, -1);
+   for (size_t i = ullBegin_; i < ullEnd_; i++)
+   {
+      const Entry& stEntry = stBatch_.vEntries[vMyGroupedEntries[i]];
+      pclFile_->WriteFile(const_cast<char*>(stBatch_.vData.data() + stEntry.ullOffset), stEntry.uiLength);
+   }
+#else
+   auto itDescriptor = umMyDescriptors.find(pclFile_);
+   if (itDescriptor == umMyDescriptors.end())
+   {
+      const int32_t iFd = open(pclFile_->GetFileName().c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+      if (iFd < 0)
+      {
+         throw nExcept("\"%s\" file open failed", pclFile_->GetFileName().c_str());
+      }
+      itDescriptor = umMyDescriptors.emplace(pclFile_, iFd).first;
+      // Syncing the new descriptor also syncs what was written before.
+      usMyUnsyncedFiles.erase(pclFile_->GetFileName());
+   }
+
+   std::vector<iovec> vIovecs;
+   vIovecs.reserve(ullEnd_ - ullBegin_);
+   for (size_t i = ullBegin_; i < ullEnd_; i++)
+   {
+      const Entry& stEntry = stBatch_.vEntries[vMyGroupedEntries[i]];
+      if (stEntry.uiLength > 0)
+      {
+         vIovecs.push_back(iovec{ const_cast<char*>(stBatch_.vData.data() + stEntry.ullOffset), stEntry.uiLength });
+      }
+   }
+
+   size_t ullFirst = 0;
+   while (ullFirst < vIovecs.size())
+   {
+      const int32_t iCount = static_cast<int32_t>(std::min<size_t>(vIovecs.size() - ullFirst, IOV_MAX));
+      ssize_t llWritten = writev(itDescriptor->second, &vIovecs[ullFirst], iCount);
+      if (llWritten < 0)
+      {
+         if (errno == EINTR)
+         {
+            continue;
+         }
+         throw nExcept("\"%s\" file  write failed", pclFile_->GetFileName().c_str());
+      }
+
+      // Carry on from wherever a short write stopped.
+      while (llWritten > 0)
+      {
+         iovec& stIovec = vIovecs[ullFirst];
+         if (static_cast<size_t>(llWritten) >= stIovec.iov_len)
+         {
+            llWritten -= static_cast<ssize_t>(stIovec.iov_len);
+            ullFirst++;
+         }
+         else
+         {
+            stIovec.iov_base = static_cast<char*>(stIovec.iov_base) + llWritten;
+            stIovec.iov_len -= static_cast<size_t>(llWritten);
+            llWritten = 0;
+         }
+      }
+   }
+#endif
+}
+
+// ---------------------------------------------------------
+bool AsyncFileWriter::CloseDescriptor(FileStream* pclFile_, bool bSync_)
+{
+   const auto itDescriptor = umMyDescriptors.find(pclFile_);
+   if (itDescriptor == umMyDescriptors.end())
+   {
+      return true;
+   }
+   bool bSynced = true;
+#ifdef _WIN32
+   if (bSync_)
+   {
+      pclFile_->FlushFile();
+   }
+   pclFile_->CloseFile();
+#else
+   if (bSync_)
+   {
+      bSynced = fsync(itDescriptor->second) == 0;
+   }
+   else
+   {
+      usMyUnsyncedFiles.insert(pclFile_->GetFileName());
+   }
+   close(itDescriptor->second);
+#endif
+   umMyDescriptors.erase(itDescriptor);
+   return bSynced;
+}
+
+// ---------------------------------------------------------
+bool AsyncFileWriter::SyncClosedFiles()
+{
+   bool bSynced = true;
+#ifndef _WIN32
+   for (const std::string& strFileName : usMyUnsyncedFiles)
+   {
+      // Reopening a file is enough to sync it, as fsync() syncs the file and
+      // not just what was written through the descriptor.
+      const int32_t iFd = open(strFileName.c_str(), O_WRONLY | O_CLOEXEC);
+      if (iFd < 0)
+      {
+         bSynced = bSynced && errno == ENOENT;
+         continue;
+      }
+      bSynced = fsync(iFd) == 0 && bSynced;
+      close(iFd);
+   }
+#endif
+   usMyUnsyncedFiles.clear();
+   return bSynced;
+}
@@ -0,0 +1,376 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include "compressedfilewriter.hpp"
+#include "decoders/common/api/nexcept.h"
+
+#include <algorithm>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+// code
+// Number of free buffers kept for reuse by Write().
+constexpr size_t ullMAX_FREE_BUFFERS = 4;
+
+// ---------------------------------------------------------
+struct CompressedFileWriter::Encoder
+{
+   Encoder(COMPRESSION eCompression_, int32_t iLevel_);
+   ~Encoder();
+
+   // Compress the data and write it to the file, one vOutput_ at a time.
+   void Compress(FileStream* pclFile_, const char* pcData_, size_t ullLength_, JOB_TYPE eType_, std::vector<char>& vOutput_);
+
+   COMPRESSION eCompression;
+#ifdef HAVE_ZLIB
+   z_stream stZlib{};
+#endif
+#ifdef HAVE_ZSTD
+   ZSTD_CStream* pstZstd{ nullptr };
+#endif
+};
+
+// ---------------------------------------------------------
+CompressedFileWriter::Encoder::Encoder(COMPRESSION eCompression_, int32_t iLevel_)
+   : eCompression(eCompression_)
+{
+#ifdef HAVE_ZLIB
+   if (eCompression == COMPRESSION::GZIP)
+   {
+      // 15 window bits, plus 16 to write a gzip header and trailer.
+      if (deflateInit2(&stZlib, iLevel_ < 0 ? Z_DEFAULT_COMPRESSION : iLevel_, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+      {
+         throw nExcept("zlib initialisation failed");
+      }
+   }
+#endif
+#ifdef HAVE_ZSTD
+   if (eCompression == COMPRESSION::ZSTD)
+   {
+      pstZstd = ZSTD_createCStream();
+      if (pstZstd == nullptr || ZSTD_isError(ZSTD_CCtx_setParameter(pstZstd, ZSTD_c_compressionLevel, iLevel_ < 0 ? ZSTD_CLEVEL_DEFAULT : iLevel_)))
+      {
+         ZSTD_freeCStream(pstZstd);
+         throw nExcept("zstd initialisation failed");
+      }
+   }
+#endif
+   static_cast<void>(iLevel_);
+}
+
+// ---------------------------------------------------------
+CompressedFileWriter::Encoder::~Encoder()
+{
+#ifdef HAVE_ZLIB
+   if (eCompression == COMPRESSION::GZIP)
+   {
+      deflateEnd(&stZlib);
+   }
+#endif
+#ifdef HAVE_ZSTD
+   ZSTD_freeCStream(pstZstd);
+#endif
+}
+
+// ---------------------------------------------------------
+void CompressedFileWriter::Encoder::Compress(FileStream* pclFile_, const char* pcData_, size_t ullLength_, JOB_TYPE eType_, std::vector<char>& vOutput_)
+{
+   switch (eCompression)
+   {
+#ifdef HAVE_ZLIB
+   case COMPRESSION::GZIP:
+   {
+      const int32_t iFlush = eType_ == JOB_TYPE::WRITE ? Z_NO_FLUSH : eType_ == JOB_TYPE::FLUSH ? Z_SYNC_FLUSH : Z_FINISH;
+      stZlib.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(pcData_));
+      stZlib.avail_in = static_cast<uInt>(ullLength_);
+      int32_t iResult = Z_OK;
+      do
+      {
+         stZlib.next_out = reinterpret_cast<Bytef*>(vOutput_.data());
+         stZlib.avail_out = static_cast<uInt>(vOutput_.size());
+         iResult = deflate(&stZlib, iFlush);
+         if (iResult == Z_STREAM_ERROR)
+         {
+            throw nExcept("gzip compression failed");
+         }
+         const uint32_t uiProduced = static_cast<uint32_t>(vOutput_.size() - stZlib.avail_out);
+         if (uiProduced > 0)
+         {
+            pclFile_->WriteFile(vOutput_.data(), uiProduced);
+         }
+         // A full output buffer means deflate has more to give.
+      } while (stZlib.avail_out == 0 || (iFlush == Z_FINISH && iResult != Z_STREAM_END));
+      break;
+   }
+#endif
+#ifdef HAVE_ZSTD
+   case COMPRESSION::ZSTD:
+   {
+      const ZSTD_EndDirective eMode = eType_ == JOB_TYPE::WRITE ? ZSTD_e_continue : eType_ == JOB_TYPE::FLUSH ? ZSTD_e_flush : ZSTD_e_end;
+      ZSTD_inBuffer stInput{ pcData_, ullLength_, 0 };
+      size_t ullRemaining = 0;
+      do
+      {
+         ZSTD_outBuffer stOutput{ vOutput_.data(), vOutput_.size(), 0 };
+         ullRemaining = ZSTD_compressStream2(pstZstd, &stOutput, &stInput, eMode);
+         if (ZSTD_isError(ullRemaining))
+         {
+            throw nExcept("zstd compression failed");
+         }
+         if (stOutput.pos > 0)
+         {
+            pclFile_->WriteFile(vOutput_.data(), static_cast<uint32_t>(stOutput.pos));
+         }
+      } while (eMode == ZSTD_e_continue ? stInput.pos < stInput.size : ullRemaining != 0);
+      break;
+   }
+#endif
+   default:
+      if (ullLength_ > 0)
+      {
+         pclFile_->WriteFile(const_cast<char*>(pcData_), static_cast<uint32_t>(ullLength_));
+      }
+      break;
+   }
+}
+
+// ---------------------------------------------------------
+CompressedFileWriter::CompressedFileWriter(COMPRESSION eCompression_, int32_t iLevel_, uint32_t uiBufferSize_, uint64_t ullMaxQueuedBytes_)
+   : eMyCompression(eCompression_), iMyLevel(iLevel_), uiMyBufferSize(std::max(uiBufferSize_, 1U)), ullMyMaxQueuedBytes(ullMaxQueuedBytes_),
+     vMyOutput(uiDEFAULT_BUFFER_SIZE)
+{
+#ifndef HAVE_ZLIB
+   if (eMyCompression == COMPRESSION::GZIP)
+   {
+      throw nExcept("compression not supported");
+   }
+#endif
+#ifndef HAVE_ZSTD
+   if (eMyCompression == COMPRESSION::ZSTD)
+   {
+      throw nExcept("compression not supported");
+   }
+#endif
+   clMyThread = std::thread(&CompressedFileWriter::CompressLoop, this);
+}
+
+// ---------------------------------------------------------
+CompressedFileWriter::~CompressedFileWriter()
+{
+   std::vector<FileStream*> vFiles;
+   for (const auto& itBuffer : mMyBuffers)
+   {
+      vFiles.push_back(itBuffer.first);
+   }
+   for (FileStream* pclFile : vFiles)
+   {
+      Submit(pclFile, JOB_TYPE::FINISH);
+   }
+
+   {
+      std::lock_guard<std::mutex> clLock(clMyMutex);
+      bMyStop = true;
+   }
+   clMyJobQueued.notify_one();
+   clMyThread.join();
+}
+
+// ---------------------------------------------------------
+const char* CompressedFileWriter::GetExtension(COMPRESSION eCompression_)
+{
+   switch (eCompression_)
+   {
+   case COMPRESSION::GZIP: return ".gz";
+   case COMPRESSION::ZSTD: return ".zst";
+   default: return "";
+   }
+}
+
+// ---------------------------------------------------------
+uint32_t CompressedFileWriter::Write(FileStream* pclFile_, const char* pcData_, uint32_t uiLength_)
+{
+   std::vector<char>& vBuffer = mMyBuffers[pclFile_];
+   if (vBuffer.capacity() < uiMyBufferSize)
+   {
+      vBuffer.reserve(uiMyBufferSize);
+   }
+   vBuffer.insert(vBuffer.end(), pcData_, pcData_ + uiLength_);
+   if (vBuffer.size() >= uiMyBufferSize)
+   {
+      Submit(pclFile_, JOB_TYPE::WRITE);
+   }
+   return uiLength_;
+}
+
+// ---------------------------------------------------------
+void CompressedFileWriter::Close(FileStream* pclFile_)
+{
+   Submit(pclFile_, JOB_TYPE::CLOSE);
+}
+
+// ---------------------------------------------------------
+void CompressedFileWriter::Suspend(FileStream* pclFile_)
+{
+   Submit(pclFile_, JOB_TYPE::SUSPEND);
+}
+
+// ---------------------------------------------------------
+void CompressedFileWriter::Flush()
+{
+   for (auto& itBuffer : mMyBuffers)
+   {
+      Submit(itBuffer.first, JOB_TYPE::FLUSH);
+   }
+
+   std::unique_lock<std::mutex> clLock(clMyMutex);
+   clMyJobDone.wait(clLock, [this] { return dMyJobs.empty() && !bMyBusy; });
+   if (bMyFailed)
+   {
+      throw nExcept("compressed write failed");
+   }
+}
+
+// ---------------------------------------------------------
+void CompressedFileWriter::Submit(FileStream* pclFile_, JOB_TYPE eType_)
+{
+   std::vector<char>& vBuffer = mMyBuffers[pclFile_];
+   const bool bLastJob = eType_ == JOB_TYPE::FINISH || eType_ == JOB_TYPE::CLOSE;
+   {
+      std::unique_lock<std::mutex> clLock(clMyMutex);
+      // Closing a file must always reach the compression thread, which owns it.
+      clMyJobDone.wait(clLock, [this, bLastJob] { return bLastJob || bMyFailed || ullMyQueuedBytes < ullMyMaxQueuedBytes; });
+      if (bMyFailed && !bLastJob)
+      {
+         throw nExcept("compressed write failed");
+      }
+
+      ullMyQueuedBytes += vBuffer.size();
+      dMyJobs.push_back(Job{ pclFile_, std::move(vBuffer), eType_ });
+      vBuffer.clear();
+      if (!bLastJob && !vMyFreeBuffers.empty())
+      {
+         vBuffer = std::move(vMyFreeBuffers.back());
+         vMyFreeBuffers.pop_back();
+      }
+   }
+   clMyJobQueued.notify_one();
+
+   if (bLastJob)
+   {
+      mMyBuffers.erase(pclFile_);
+   }
+}
+
+// ---------------------------------------------------------
+void CompressedFileWriter::CompressLoop()
+{
+   while (true)
+   {
+      Job stJob;
+      bool bFailed = false;
+      {
+         std::unique_lock<std::mutex> clLock(clMyMutex);
+         clMyJobQueued.wait(clLock, [this] { return bMyStop || !dMyJobs.empty(); });
+         if (dMyJobs.empty())
+         {
+            return;
+         }
+         stJob = std::move(dMyJobs.front());
+         dMyJobs.pop_front();
+         bMyBusy = true;
+         bFailed = bMyFailed;
+      }
+
+      // Once a write has failed the remaining data is dropped, but files are
+      // still closed.
+      try
+      {
+         if (!bFailed)
+         {
+            Process(stJob);
+         }
+      }
+      catch (...)
+      {
+         bFailed = true;
+      }
+      if (stJob.eType == JOB_TYPE::FINISH || stJob.eType == JOB_TYPE::CLOSE)
+      {
+         mMyEncoders.erase(stJob.pclFile);
+      }
+      if (stJob.eType == JOB_TYPE::CLOSE)
+      {
+         delete stJob.pclFile;
+      }
+
+      {
+         std::lock_guard<std::mutex> clLock(clMyMutex);
+         ullMyQueuedBytes -= stJob.vData.size();
+         bMyBusy = false;
+         bMyFailed = bMyFailed || bFailed;
+         if (vMyFreeBuffers.size() < ullMAX_FREE_BUFFERS)
+         {
+            stJob.vData.clear();
+            vMyFreeBuffers.push_back(std::move(stJob.vData));
+         }
+      }
+      clMyJobDone.notify_all();
+   }
+}
+
+// ---------------------------------------------------------
+void CompressedFileWriter::Process(Job& stJob_)
+{
+   auto itEncoder = mMyEncoders.find(stJob_.pclFile);
+   if (itEncoder == mMyEncoders.end())
+   {
+      itEncoder = mMyEncoders.emplace(stJob_.pclFile, std::make_unique<Encoder>(eMyCompression, iMyLevel)).first;
+   }
+   if (!stJob_.pclFile->GetMyFileStream()->is_open())
+   {
+      stJob_.pclFile->OpenFile(FileStream::FILEMODES::APPEND);
+   }
+
+   JOB_TYPE eType = stJob_.eType;
+   if (eType == JOB_TYPE::CLOSE)
+   {
+      eType = JOB_TYPE::FINISH;
+   }
+   else if (eType == JOB_TYPE::SUSPEND)
+   {
+      eType = JOB_TYPE::WRITE;
+   }
+   itEncoder->second->Compress(stJob_.pclFile, stJob_.vData.data(), stJob_.vData.size(), eType, vMyOutput);
+
+   if (stJob_.eType == JOB_TYPE::SUSPEND)
+   {
+      stJob_.pclFile->CloseFile();
+   }
+}
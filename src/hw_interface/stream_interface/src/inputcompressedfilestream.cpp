@@ -0,0 +1,463 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include "inputcompressedfilestream.hpp"
+#include "decoders/common/api/nexcept.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+// code
+// Number of compressed bytes read from the file at a time.
+constexpr uint32_t uiCOMPRESSED_READ_SIZE = 256 * 1024;
+
+// ---------------------------------------------------------
+struct InputCompressedFileStream::Decoder
+{
+   explicit Decoder(COMPRESSION eCompression_);
+   ~Decoder();
+
+   // Decompress as much of the input as fits in the output. Returns false if
+   // the input is corrupt.
+   bool Decompress(const char* pcInput_, size_t ullInputSize_, size_t& ullConsumed_, char* pcOutput_, size_t ullOutputSize_, size_t& ullProduced_);
+
+   COMPRESSION eCompression;
+   z_stream stZlib{};
+#ifdef HAVE_ZSTD
+   ZSTD_DStream* pstZstd{ nullptr };
+#endif
+};
+
+// ---------------------------------------------------------
+InputCompressedFileStream::Decoder::Decoder(COMPRESSION eCompression_)
+   : eCompression(eCompression_)
+{
+   if (eCompression == COMPRESSION::GZIP)
+   {
+      // 15 window bits, plus 32 to accept either a gzip or a zlib header.
+      if (inflateInit2(&stZlib, 15 + 32) != Z_OK)
+      {
+         throw nExcept("zlib initialisation failed");
+      }
+   }
+#ifdef HAVE_ZSTD
+   else if (eCompression == COMPRESSION::ZSTD)
+   {
+      pstZstd = ZSTD_createDStream();
+      if (pstZstd == nullptr || ZSTD_isError(ZSTD_initDStream(pstZstd)))
+      {
+         ZSTD_freeDStream(pstZstd);
+         throw nExcept("zstd initialisation failed");
+      }
+   }
+#endif
+}
+
+// ---------------------------------------------------------
+InputCompressedFileStream::Decoder::~Decoder()
+{
+   if (eCompression == COMPRESSION::GZIP)
+   {
+      inflateEnd(&stZlib);
+   }
+#ifdef HAVE_ZSTD
+   ZSTD_freeDStream(pstZstd);
+#endif
+}
+
+// ---------------------------------------------------------
+bool InputCompressedFileStream::Decoder::Decompress(const char* pcInput_, size_t ullInputSize_, size_t& ullConsumed_, char* pcOutput_, size_t ullOutputSize_, size_t& ullProduced_)
+{
+   switch (eCompression)
+   {
+   case COMPRESSION::GZIP:
+   {
+      stZlib.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(pcInput_));
+      stZlib.avail_in = static_cast<uInt>(ullInputSize_);
+      stZlib.next_out = reinterpret_cast<Bytef*>(pcOutput_);
+      stZlib.avail_out = static_cast<uInt>(ullOutputSize_);
+      const int32_t iResult = inflate(&stZlib, Z_NO_FLUSH);
+      ullConsumed_ = ullInputSize_ - stZlib.avail_in;
+      ullProduced_ = ullOutputSize_ - stZlib.avail_out;
+      if (iResult == Z_STREAM_END)
+      {
+         // Another member may follow, as written by pigz or by concatenating files.
+         return inflateReset(&stZlib) == Z_OK;
+      }
+      // Z_BUF_ERROR only means no progress was possible with the bytes given.
+      return iResult == Z_OK || iResult == Z_BUF_ERROR;
+   }
+#ifdef HAVE_ZSTD
+   case COMPRESSION::ZSTD:
+   {
+      ZSTD_inBuffer stInput{ pcInput_, ullInputSize_, 0 };
+      ZSTD_outBuffer stOutput{ pcOutput_, ullOutputSize_, 0 };
+      const size_t ullResult = ZSTD_decompressStream(pstZstd, &stOutput, &stInput);
+      ullConsumed_ = stInput.pos;
+      ullProduced_ = stOutput.pos;
+      return !ZSTD_isError(ullResult);
+   }
+#endif
+   default:
+      ullConsumed_ = ullProduced_ = std::min(ullInputSize_, ullOutputSize_);
+      memcpy(pcOutput_, pcInput_, ullProduced_);
+      return true;
+   }
+}
+
+// ---------------------------------------------------------
+InputCompressedFileStream::InputCompressedFileStream(const char* pcFileName_, uint32_t uiBlockSize_, uint32_t uiBlockCount_)
+   : InputFileStream(pcFileName_)
+{
+   Initialize(uiBlockSize_, uiBlockCount_);
+}
+
+// ---------------------------------------------------------
+InputCompressedFileStream::InputCompressedFileStream(const std::u32string s32FileName_, uint32_t uiBlockSize_, uint32_t uiBlockCount_)
+   : InputFileStream(s32FileName_)
+{
+   Initialize(uiBlockSize_, uiBlockCount_);
+}
+
+// ---------------------------------------------------------
+InputCompressedFileStream::~InputCompressedFileStream()
+{
+   StopDecompression();
+}
+
+// ---------------------------------------------------------
+void InputCompressedFileStream::Initialize(uint32_t uiBlockSize_, uint32_t uiBlockCount_)
+{
+   ullMyCompressedLength = pInFileStream->GetFileLength();
+
+   unsigned char aucSignature[4] = {};
+   const StreamReadStatus stReadStatus = pInFileStream->ReadFile(reinterpret_cast<char*>(aucSignature), sizeof(aucSignature));
+   eMyCompression = DetectCompression(aucSignature, stReadStatus.uiCurrentStreamRead);
+#ifndef HAVE_ZSTD
+   if (eMyCompression == COMPRESSION::ZSTD)
+   {
+      throw nExcept("zstd support is not built in");
+   }
+#endif
+
+   vMyBlocks.resize(std::max(uiBlockCount_, 1U));
+   for (DecompressedBlock& stBlock : vMyBlocks)
+   {
+      stBlock.vData.resize(std::max(uiBlockSize_, 1U));
+   }
+
+   StartDecompression();
+}
+
+// ---------------------------------------------------------
+COMPRESSION InputCompressedFileStream::DetectCompression(const unsigned char* pucData_, uint32_t uiLength_)
+{
+   if (uiLength_ >= 2 && pucData_[0] == 0x1F && pucData_[1] == 0x8B)
+   {
+      return COMPRESSION::GZIP;
+   }
+   if (uiLength_ >= 4 && pucData_[0] == 0x28 && pucData_[1] == 0xB5 && pucData_[2] == 0x2F && pucData_[3] == 0xFD)
+   {
+      return COMPRESSION::ZSTD;
+   }
+   return COMPRESSION::NONE;
+}
+
+// ---------------------------------------------------------
+void InputCompressedFileStream::StartDecompression()
+{
+   pInFileStream->SetFilePosition(0, std::ios::beg);
+   pclMyDecoder = std::make_unique<Decoder>(eMyCompression);
+
+   uiMyHead = uiMyTail = uiMyFilledBlocks = 0;
+   bMyHoldingBlock = false;
+   uiMyBlockOffset = 0;
+   ullMyPosition = 0;
+   ullMyCompressedPosition = 0;
+   bMyStop = false;
+   clMyThread = std::thread(&InputCompressedFileStream::DecompressLoop, this);
+}
+
+// ---------------------------------------------------------
+void InputCompressedFileStream::StopDecompression()
+{
+   {
+      std::lock_guard<std::mutex> clLock(clMyMutex);
+      bMyStop = true;
+   }
+   clMyBlockFreed.notify_all();
+   if (clMyThread.joinable())
+   {
+      clMyThread.join();
+   }
+}
+
+// ---------------------------------------------------------
+void InputCompressedFileStream::DecompressLoop()
+{
+   std::vector<char> vInput(uiCOMPRESSED_READ_SIZE);
+   size_t ullInputOffset = 0;
+   size_t ullInputSize = 0;
+   uint64_t ullCompressedRead = 0;
+   bool bInputEnd = false;
+   bool bLast = false;
+
+   while (!bLast)
+   {
+      {
+         std::unique_lock<std::mutex> clLock(clMyMutex);
+         clMyBlockFreed.wait(clLock, [this] { return bMyStop || uiMyFilledBlocks < vMyBlocks.size(); });
+         if (bMyStop)
+         {
+            return;
+         }
+      }
+
+      DecompressedBlock& stBlock = vMyBlocks[uiMyTail];
+      stBlock.uiSize = 0;
+      stBlock.bFailed = false;
+      stBlock.ullCompressedBegin = ullCompressedRead - (ullInputSize - ullInputOffset);
+
+      while (stBlock.uiSize < stBlock.vData.size() && !bLast && !bMyStop)
+      {
+         size_t ullConsumed = 0;
+         size_t ullProduced = 0;
+         try
+         {
+            if (ullInputOffset == ullInputSize && !bInputEnd)
+            {
+               const StreamReadStatus stReadStatus = pInFileStream->ReadFile(vInput.data(), uiCOMPRESSED_READ_SIZE);
+               ullInputOffset = 0;
+               ullInputSize = stReadStatus.uiCurrentStreamRead;
+               ullCompressedRead += ullInputSize;
+               bInputEnd = stReadStatus.bEOS || ullInputSize == 0;
+            }
+
+            stBlock.bFailed = !pclMyDecoder->Decompress(vInput.data() + ullInputOffset, ullInputSize - ullInputOffset, ullConsumed,
+                                                        stBlock.vData.data() + stBlock.uiSize, stBlock.vData.size() - stBlock.uiSize, ullProduced);
+         }
+         catch (...)
+         {
+            stBlock.bFailed = true;
+         }
+
+         ullInputOffset += ullConsumed;
+         stBlock.uiSize += static_cast<uint32_t>(ullProduced);
+         // A truncated file also ends here, with the decoder still waiting for bytes.
+         bLast = stBlock.bFailed || (bInputEnd && ullInputOffset == ullInputSize && ullConsumed == 0 && ullProduced == 0);
+      }
+      stBlock.ullCompressedEnd = ullCompressedRead - (ullInputSize - ullInputOffset);
+      stBlock.bLast = bLast;
+
+      {
+         std::lock_guard<std::mutex> clLock(clMyMutex);
+         if (bMyStop)
+         {
+            return;
+         }
+         uiMyTail = (uiMyTail + 1) % static_cast<uint32_t>(vMyBlocks.size());
+         uiMyFilledBlocks++;
+      }
+      clMyBlockFilled.notify_one();
+   }
+}
+
+// ---------------------------------------------------------
+InputCompressedFileStream::DecompressedBlock* InputCompressedFileStream::AcquireBlock()
+{
+   if (!bMyHoldingBlock)
+   {
+      std::unique_lock<std::mutex> clLock(clMyMutex);
+      clMyBlockFilled.wait(clLock, [this] { return uiMyFilledBlocks > 0; });
+      bMyHoldingBlock = true;
+      uiMyBlockOffset = 0;
+   }
+
+   DecompressedBlock& stBlock = vMyBlocks[uiMyHead];
+   if (uiMyBlockOffset < stBlock.uiSize)
+   {
+      return &stBlock;
+   }
+   // Only the last block is held once it is empty.
+   if (stBlock.bFailed)
+   {
+      throw nExcept("decompression failed");
+   }
+   return nullptr;
+}
+
+// ---------------------------------------------------------
+void InputCompressedFileStream::ReleaseBlock()
+{
+   ullMyCompressedPosition = vMyBlocks[uiMyHead].ullCompressedEnd;
+   {
+      std::lock_guard<std::mutex> clLock(clMyMutex);
+      uiMyHead = (uiMyHead + 1) % static_cast<uint32_t>(vMyBlocks.size());
+      uiMyFilledBlocks--;
+   }
+   bMyHoldingBlock = false;
+   clMyBlockFreed.notify_one();
+}
+
+// ---------------------------------------------------------
+uint32_t InputCompressedFileStream::Consume(char* pcData_, uint32_t uiSize_)
+{
+   uint32_t uiConsumed = 0;
+   while (uiConsumed < uiSize_)
+   {
+      DecompressedBlock* pstBlock = AcquireBlock();
+      if (pstBlock == nullptr)
+      {
+         break;
+      }
+
+      const uint32_t uiCount = std::min(uiSize_ - uiConsumed, pstBlock->uiSize - uiMyBlockOffset);
+      if (pcData_ != nullptr)
+      {
+         memcpy(pcData_ + uiConsumed, pstBlock->vData.data() + uiMyBlockOffset, uiCount);
+      }
+      uiMyBlockOffset += uiCount;
+      uiConsumed += uiCount;
+
+      if (uiMyBlockOffset == pstBlock->uiSize && !pstBlock->bLast)
+      {
+         ReleaseBlock();
+      }
+   }
+   ullMyPosition += uiConsumed;
+   return uiConsumed;
+}
+
+// ---------------------------------------------------------
+StreamReadStatus InputCompressedFileStream::GetReadStatus(uint32_t uiRead_)
+{
+   StreamReadStatus stReadStatus;
+   uint64_t ullCompressedPosition = ullMyCompressedPosition;
+   if (bMyHoldingBlock)
+   {
+      // Interpolate across the compressed bytes the current block came from.
+      const DecompressedBlock& stBlock = vMyBlocks[uiMyHead];
+      const uint64_t ullCompressedSize = stBlock.ullCompressedEnd - stBlock.ullCompressedBegin;
+      ullCompressedPosition = stBlock.ullCompressedBegin
+         + (stBlock.uiSize == 0 ? ullCompressedSize : ullCompressedSize * uiMyBlockOffset / stBlock.uiSize);
+      stReadStatus.bEOS = stBlock.bLast && uiMyBlockOffset == stBlock.uiSize;
+   }
+
+   stReadStatus.uiCurrentStreamRead = uiRead_;
+   stReadStatus.uiPercentStreamRead = ullMyCompressedLength == 0 ? 100 : static_cast<uint32_t>(ullCompressedPosition * 100 / ullMyCompressedLength);
+   stReadStatus.ullStreamLength = ullMyCompressedLength;
+   return stReadStatus;
+}
+
+// ---------------------------------------------------------
+StreamReadStatus InputCompressedFileStream::ReadData(ReadDataStructure& pReadDataStructure)
+{
+   return GetReadStatus(Consume(pReadDataStructure.cData, pReadDataStructure.uiDataSize));
+}
+
+// ---------------------------------------------------------
+StreamReadStatus InputCompressedFileStream::ReadLine(std::string& szLine)
+{
+   szLine.clear();
+   while (true)
+   {
+      DecompressedBlock* pstBlock = AcquireBlock();
+      if (pstBlock == nullptr)
+      {
+         StreamReadStatus stReadStatus = GetReadStatus(static_cast<uint32_t>(szLine.length()));
+         stReadStatus.bEOS = true;
+         return stReadStatus;
+      }
+
+      const char* pcStart = pstBlock->vData.data() + uiMyBlockOffset;
+      const uint32_t uiAvailable = pstBlock->uiSize - uiMyBlockOffset;
+      const char* pcEnd = static_cast<const char*>(memchr(pcStart, '\n', uiAvailable));
+      const uint32_t uiCount = pcEnd != nullptr ? static_cast<uint32_t>(pcEnd - pcStart) + 1 : uiAvailable;
+      szLine.append(pcStart, pcEnd != nullptr ? uiCount - 1 : uiCount);
+      uiMyBlockOffset += uiCount;
+      ullMyPosition += uiCount;
+
+      if (uiMyBlockOffset == pstBlock->uiSize && !pstBlock->bLast)
+      {
+         ReleaseBlock();
+      }
+      if (pcEnd != nullptr)
+      {
+         return GetReadStatus(static_cast<uint32_t>(szLine.length()));
+      }
+   }
+}
+
+// ---------------------------------------------------------
+void InputCompressedFileStream::Reset(std::streamoff offset, std::ios_base::seekdir dir)
+{
+   int64_t llTarget = 0;
+   if (dir == std::ios::beg)
+   {
+      llTarget = offset;
+   }
+   else if (dir == std::ios::cur)
+   {
+      llTarget = static_cast<int64_t>(ullMyPosition) + offset;
+   }
+   else
+   {
+      throw nExcept("seek from end not supported");
+   }
+   const uint64_t ullTarget = static_cast<uint64_t>(std::max<int64_t>(llTarget, 0));
+
+   if (ullTarget < ullMyPosition)
+   {
+      StopDecompression();
+      StartDecompression();
+   }
+   while (ullMyPosition < ullTarget
+          && Consume(nullptr, static_cast<uint32_t>(std::min<uint64_t>(ullTarget - ullMyPosition, std::numeric_limits<uint32_t>::max()))) > 0)
+   {
+   }
+}
+
+// ---------------------------------------------------------
+uint64_t InputCompressedFileStream::GetCurrentFilePosition()
+{
+   return ullMyPosition;
+}
+
+// ---------------------------------------------------------
+bool InputCompressedFileStream::IsRandomAccess() const
+{
+   return false;
+}
+
+// ---------------------------------------------------------
+COMPRESSION InputCompressedFileStream::GetCompression() const
+{
+   return eMyCompression;
+}
@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include "inputfdstream.hpp"
+#include "decoders/common/api/nexcept.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// code
+// ---------------------------------------------------------
+InputFdStream::InputFdStream(int32_t iFd_, bool bOwnsFd_)
+   : iMyFd(iFd_), bMyOwnsFd(bOwnsFd_)
+{
+   const int32_t iFlags = fcntl(iMyFd, F_GETFL);
+   if (iFlags < 0 || fcntl(iMyFd, F_SETFL, iFlags | O_NONBLOCK) < 0)
+   {
+      throw nExcept("File descriptor %d not valid", iMyFd);
+   }
+
+   int32_t iSocketType = 0;
+   socklen_t uiSocketTypeLength = sizeof(iSocketType);
+   bMyDatagram = getsockopt(iMyFd, SOL_SOCKET, SO_TYPE, &iSocketType, &uiSocketTypeLength) == 0 && iSocketType == SOCK_DGRAM;
+}
+
+// ---------------------------------------------------------
+InputFdStream::~InputFdStream()
+{
+   if (bMyOwnsFd)
+   {
+      close(iMyFd);
+   }
+}
+
+// ---------------------------------------------------------
+StreamReadStatus InputFdStream::ReadData(ReadDataStructure& pReadDataStructure)
+{
+   StreamReadStatus stReadStatus;
+   if (bMyEOS)
+   {
+      stReadStatus.bEOS = true;
+      return stReadStatus;
+   }
+
+   ssize_t iRead = -1;
+   do
+   {
+      iRead = read(iMyFd, pReadDataStructure.cData, pReadDataStructure.uiDataSize);
+   } while (iRead < 0 && errno == EINTR);
+
+   if (iRead > 0)
+   {
+      stReadStatus.uiCurrentStreamRead = static_cast<uint32_t>(iRead);
+      ullMyBytesRead += static_cast<uint64_t>(iRead);
+   }
+   else if (iRead == 0)
+   {
+      // An empty datagram is not the end of a datagram socket.
+      bMyEOS = !bMyDatagram;
+   }
+   else if (errno != EAGAIN && errno != EWOULDBLOCK)
+   {
+      // The descriptor failed.
+      bMyEOS = true;
+   }
+
+   stReadStatus.ullStreamLength = ullMyBytesRead;
+   stReadStatus.bEOS = bMyEOS;
+   return stReadStatus;
+}
+
+// ---------------------------------------------------------
+bool InputFdStream::IsStreamAvailable()
+{
+   return !bMyEOS;
+}
+
+// ---------------------------------------------------------
+int32_t InputFdStream::GetFileDescriptor() const
+{
+   return iMyFd;
+}
+
+// ---------------------------------------------------------
+uint64_t InputFdStream::GetCurrentFileOffset() const
+{
+   return ullMyBytesRead;
+}
@@ -90,6 +90,12 @@ uint64_t  InputFileStream::GetCurrentFileOffset(void) const
    return pInFileStream->GetCurrentFileOffset();
 }
 
+// ---------------------------------------------------------
+bool InputFileStream::IsRandomAccess() const
+{
+   return true;
+}
+
 // ---------------------------------------------------------
 std::string InputFileStream::FileExtension()
 {
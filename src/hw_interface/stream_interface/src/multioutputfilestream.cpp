@@ -51,9 +51,19 @@ void MultiOutputFileStream::SelectFileStream(std::u32string s32FileName_)
    }
    else
    {
-      pLocalFileStream = new FileStream(s32FileName_);
+      const std::string sExtension = CompressedFileWriter::GetExtension(eMyCompression);
+      pLocalFileStream = new FileStream(s32FileName_ + std::u32string(sExtension.begin(), sExtension.end()));
       pLocalFileStream->OpenFile(FileStream::FILEMODES::OUTPUT);
       wmMyFstreamMap.emplace(std::pair <std::u32string, FileStream*>(s32FileName_, pLocalFileStream));
+      if (pMyAsyncFileWriter && !pMyCompressedFileWriter)
+      {
+         // The writer thread appends through its own descriptor.
+         pLocalFileStream->CloseFile();
+      }
+      if (uiMyMaxOpenFiles > 0)
+      {
+         KeepFileStreamOpen(pLocalFileStream);
+      }
    }
 }
 //#endif
@@ -67,9 +77,18 @@ void MultiOutputFileStream::SelectFileStream(std::string stFileName)
    }
    else
    {
-      pLocalFileStream = new FileStream(stFileName.c_str());
+      pLocalFileStream = new FileStream((stFileName + CompressedFileWriter::GetExtension(eMyCompression)).c_str());
       pLocalFileStream->OpenFile(FileStream::FILEMODES::OUTPUT);
       mMyFstreamMap.emplace(std::pair <std::string, FileStream*>(stFileName, pLocalFileStream));
+      if (pMyAsyncFileWriter && !pMyCompressedFileWriter)
+      {
+         // The writer thread appends through its own descriptor.
+         pLocalFileStream->CloseFile();
+      }
+      if (uiMyMaxOpenFiles > 0)
+      {
+         KeepFileStreamOpen(pLocalFileStream);
+      }
    }
 }
 
@@ -77,11 +96,12 @@ void MultiOutputFileStream::SelectFileStream(std::string stFileName)
 // ---------------------------------------------------------
 void MultiOutputFileStream::ClearWCFileStreamMap()
 {
+   umMyLogFiles.clear();
    for (WCFstreamMap::iterator itFstreamMapIterator = wmMyFstreamMap.begin(); itFstreamMapIterator != wmMyFstreamMap.end();)
    {
       if (itFstreamMapIterator->second)
       {
-         delete itFstreamMapIterator->second;
+         CloseFileStream(itFstreamMapIterator->second);
       }
       itFstreamMapIterator = wmMyFstreamMap.erase(itFstreamMapIterator);
    }
@@ -91,19 +111,182 @@ void MultiOutputFileStream::ClearWCFileStreamMap()
 // ---------------------------------------------------------
 void MultiOutputFileStream::ClearFileStreamMap()
 {
+   umMyLogFiles.clear();
    for (FstreamMap::iterator itFstreamMapIterator = mMyFstreamMap.begin(); itFstreamMapIterator != mMyFstreamMap.end();)
    {
       if (itFstreamMapIterator->second)
       {
-         delete itFstreamMapIterator->second;
+         CloseFileStream(itFstreamMapIterator->second);
       }
       itFstreamMapIterator = mMyFstreamMap.erase(itFstreamMapIterator);
    }
 }
 
+// ---------------------------------------------------------
+void MultiOutputFileStream::CloseFileStream(FileStream* pclFileStream_)
+{
+   const auto itOpenFile = umMyOpenFiles.find(pclFileStream_);
+   if (itOpenFile != umMyOpenFiles.end())
+   {
+      lMyOpenFiles.erase(itOpenFile->second);
+      umMyOpenFiles.erase(itOpenFile);
+   }
+
+   if (pMyCompressedFileWriter)
+   {
+      // Finishing the compressed stream is left to the compression thread.
+      pMyCompressedFileWriter->Close(pclFileStream_);
+   }
+   else if (pMyAsyncFileWriter)
+   {
+      pMyAsyncFileWriter->Close(pclFileStream_);
+   }
+   else
+   {
+      delete pclFileStream_;
+   }
+}
+
+// ---------------------------------------------------------
+void MultiOutputFileStream::KeepFileStreamOpen(FileStream* pclFileStream_)
+{
+   const auto itOpenFile = umMyOpenFiles.find(pclFileStream_);
+   if (itOpenFile != umMyOpenFiles.end())
+   {
+      lMyOpenFiles.splice(lMyOpenFiles.begin(), lMyOpenFiles, itOpenFile->second);
+      return;
+   }
+
+   // Background writers reopen a file themselves when they next write to it.
+   if (!pMyCompressedFileWriter && !pMyAsyncFileWriter && !pclFileStream_->GetMyFileStream()->is_open())
+   {
+      pclFileStream_->OpenFile(FileStream::FILEMODES::APPEND);
+   }
+   lMyOpenFiles.push_front(pclFileStream_);
+   umMyOpenFiles.emplace(pclFileStream_, lMyOpenFiles.begin());
+
+   while (lMyOpenFiles.size() > uiMyMaxOpenFiles)
+   {
+      EvictLeastRecent();
+   }
+}
+
+// ---------------------------------------------------------
+void MultiOutputFileStream::EvictLeastRecent()
+{
+   FileStream* pclLeastRecent = lMyOpenFiles.back();
+   lMyOpenFiles.pop_back();
+   umMyOpenFiles.erase(pclLeastRecent);
+   if (pMyCompressedFileWriter)
+   {
+      pMyCompressedFileWriter->Suspend(pclLeastRecent);
+   }
+   else if (pMyAsyncFileWriter)
+   {
+      pMyAsyncFileWriter->Suspend(pclLeastRecent);
+   }
+   else
+   {
+      pclLeastRecent->CloseFile();
+   }
+}
+
+// ---------------------------------------------------------
+void MultiOutputFileStream::ConfigureMaxOpenFiles(uint32_t uiMaxOpenFiles_)
+{
+   uiMyMaxOpenFiles = uiMaxOpenFiles_;
+   if (uiMyMaxOpenFiles > 0)
+   {
+      // Files opened while there was no limit are not tracked yet.  Treat
+      // them as the least recently used ones.
+      const auto TrackOpenFile = [this](FileStream* pclFileStream_) {
+         if (umMyOpenFiles.find(pclFileStream_) == umMyOpenFiles.end())
+         {
+            lMyOpenFiles.push_back(pclFileStream_);
+            umMyOpenFiles.emplace(pclFileStream_, std::prev(lMyOpenFiles.end()));
+         }
+      };
+      for (auto& itFile : mMyFstreamMap)
+      {
+         TrackOpenFile(itFile.second);
+      }
+      for (auto& itFile : wmMyFstreamMap)
+      {
+         TrackOpenFile(itFile.second);
+      }
+
+      // Close the least recently used files if too many are already open.
+      while (lMyOpenFiles.size() > uiMyMaxOpenFiles)
+      {
+         EvictLeastRecent();
+      }
+      return;
+   }
+
+   lMyOpenFiles.clear();
+   umMyOpenFiles.clear();
+   if (!pMyCompressedFileWriter && !pMyAsyncFileWriter)
+   {
+      for (auto& itFile : mMyFstreamMap)
+      {
+         if (!itFile.second->GetMyFileStream()->is_open())
+            itFile.second->OpenFile(FileStream::FILEMODES::APPEND);
+      }
+      for (auto& itFile : wmMyFstreamMap)
+      {
+         if (!itFile.second->GetMyFileStream()->is_open())
+            itFile.second->OpenFile(FileStream::FILEMODES::APPEND);
+      }
+   }
+}
+
+// ---------------------------------------------------------
+void MultiOutputFileStream::ConfigureCompression(COMPRESSION eCompression_, int32_t iLevel_)
+{
+   ClearWCFileStreamMap();
+   ClearFileStreamMap();
+   pLocalFileStream = nullptr;
+
+   pMyCompressedFileWriter.reset();
+   if (eCompression_ != COMPRESSION::NONE)
+   {
+      pMyCompressedFileWriter = std::make_unique<CompressedFileWriter>(eCompression_, iLevel_);
+   }
+   eMyCompression = eCompression_;
+}
+
+// ---------------------------------------------------------
+void MultiOutputFileStream::ConfigureAsyncWrite(bool bEnable_, uint64_t ullMaxQueuedBytes_)
+{
+   ClearWCFileStreamMap();
+   ClearFileStreamMap();
+   pLocalFileStream = nullptr;
+
+   pMyAsyncFileWriter.reset();
+   if (bEnable_)
+   {
+      pMyAsyncFileWriter = std::make_unique<AsyncFileWriter>(ullMaxQueuedBytes_);
+   }
+}
+
+// ---------------------------------------------------------
+void MultiOutputFileStream::Flush()
+{
+   if (pMyCompressedFileWriter)
+   {
+      pMyCompressedFileWriter->Flush();
+   }
+   else if (pMyAsyncFileWriter)
+   {
+      pMyAsyncFileWriter->Flush();
+   }
+   // Otherwise every write is flushed as it is made.
+}
+
 // ---------------------------------------------------------
 void MultiOutputFileStream::ConfigureSplitByLog(bool bStatus)
 {
+   umMyLogFiles.clear();
    if (bStatus)
    {
       bMyFileSplit = true;
@@ -119,6 +302,7 @@ void MultiOutputFileStream::ConfigureSplitByLog(bool bStatus)
 // ---------------------------------------------------------
 void MultiOutputFileStream::ConfigureBaseFileName(std::u32string s32FileName_)
 {
+   umMyLogFiles.clear();
    bEnableWideCharSupport = true;
    size_t BaseNameLength = s32FileName_.find_last_of(U".");
    if (BaseNameLength != std::u32string::npos)
@@ -134,6 +318,7 @@ void MultiOutputFileStream::ConfigureBaseFileName(std::u32string s32FileName_)
 
 void MultiOutputFileStream::ConfigureBaseFileName(std::string stFileName)
 {
+   umMyLogFiles.clear();
    size_t BaseNameLength = stFileName.find_last_of(".");
    if (BaseNameLength != std::string::npos)
    {
@@ -398,8 +583,56 @@ uint32_t MultiOutputFileStream::WriteData(
    return WriteData(pcData_, uiDataLength_);
 }
 
+// ---------------------------------------------------------
+uint32_t MultiOutputFileStream::WriteData(
+   char* pcData_,
+   uint32_t uiDataLength_,
+   uint32_t uiMessageId_,
+   const std::string& strMsgName_,
+   uint32_t uiSize_,
+   novatel::edie::TIME_STATUS eStatus_,
+   uint16_t usWeek_,
+   double dMilliseconds_)
+{
+   if (!bMyFileSplit || eMyFileSplitMethodEnum != SPLIT_LOG)
+   {
+      return WriteData(pcData_, uiDataLength_, strMsgName_, uiSize_, eStatus_, usWeek_, dMilliseconds_);
+   }
+
+   const auto itLogFile = umMyLogFiles.find(uiMessageId_);
+   if (itLogFile != umMyLogFiles.end())
+   {
+      pLocalFileStream = itLogFile->second;
+   }
+   else
+   {
+      if (bEnableWideCharSupport)
+         SelectWCLogFile(strMsgName_);
+      else
+         SelectLogFile(strMsgName_);
+      umMyLogFiles.emplace(uiMessageId_, pLocalFileStream);
+   }
+   return WriteData(pcData_, uiDataLength_);
+}
+
 // ---------------------------------------------------------
 uint32_t MultiOutputFileStream::WriteData(char* pcData_, uint32_t uiDataLength_)
 {
-   return pLocalFileStream ? pLocalFileStream->WriteFile(pcData_, uiDataLength_) : 0;
+   if (!pLocalFileStream)
+   {
+      return 0;
+   }
+   if (uiMyMaxOpenFiles > 0)
+   {
+      KeepFileStreamOpen(pLocalFileStream);
+   }
+   if (pMyCompressedFileWriter)
+   {
+      return pMyCompressedFileWriter->Write(pLocalFileStream, pcData_, uiDataLength_);
+   }
+   if (pMyAsyncFileWriter)
+   {
+      return pMyAsyncFileWriter->Write(pLocalFileStream, pcData_, uiDataLength_);
+   }
+   return pLocalFileStream->WriteFile(pcData_, uiDataLength_);
 }
@@ -43,6 +43,7 @@ OutputFileStream::OutputFileStream(const char* pcFileName)
 // ---------------------------------------------------------
 OutputFileStream::~OutputFileStream()
 {
+   pMyAsyncFileWriter.reset();
    pOutFileStream->CloseFile();
    delete pOutFileStream;
 }
@@ -50,5 +51,36 @@ OutputFileStream::~OutputFileStream()
 // ---------------------------------------------------------
 uint32_t OutputFileStream::WriteData(char* cData, uint32_t uiSize)
 {
+   if (pMyAsyncFileWriter)
+   {
+      return pMyAsyncFileWriter->Write(pOutFileStream, cData, uiSize);
+   }
    return pOutFileStream->WriteFile(cData, uiSize);
 }
+
+// ---------------------------------------------------------
+void OutputFileStream::ConfigureAsyncWrite(bool bEnable_, uint64_t ullMaxQueuedBytes_)
+{
+   // Everything queued so far is written before the writer is replaced.
+   pMyAsyncFileWriter.reset();
+   if (bEnable_)
+   {
+      // The writer thread appends through its own descriptor.
+      pOutFileStream->CloseFile();
+      pMyAsyncFileWriter = std::make_unique<AsyncFileWriter>(ullMaxQueuedBytes_);
+   }
+   else if (!pOutFileStream->GetMyFileStream()->is_open())
+   {
+      pOutFileStream->OpenFile(FileStream::FILEMODES::APPEND);
+   }
+}
+
+// ---------------------------------------------------------
+void OutputFileStream::Flush()
+{
+   if (pMyAsyncFileWriter)
+   {
+      pMyAsyncFileWriter->Flush();
+   }
+   // Otherwise every write is flushed as it is made.
+}
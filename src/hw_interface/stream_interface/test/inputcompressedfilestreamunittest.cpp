@@ -0,0 +1,201 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include "hw_interface/stream_interface/api/inputcompressedfilestream.hpp"
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+class InputCompressedFileStreamTest : public ::testing::Test {
+public:
+   virtual void SetUp() {
+      // Enough lines to span many small read-ahead blocks.
+      for (uint32_t i = 0; i < 20000; i++)
+      {
+         sMyPlain += "#BESTPOSA,COM1,0,73.0,FINESTEERING,2072," + std::to_string(i) + ".000;SOL_COMPUTED,SINGLE\r\n";
+      }
+   }
+
+   virtual void TearDown() {
+      std::filesystem::remove(clMyPath);
+   }
+
+protected:
+   void WriteGzip(const std::string& sData_, const char* pcMode_ = "wb")
+   {
+      gzFile pstFile = gzopen(clMyPath.string().c_str(), pcMode_);
+      ASSERT_NE(pstFile, nullptr);
+      ASSERT_EQ(gzwrite(pstFile, sData_.data(), static_cast<unsigned>(sData_.size())), static_cast<int>(sData_.size()));
+      ASSERT_EQ(gzclose(pstFile), Z_OK);
+   }
+
+   void WriteFile(const std::string& sData_)
+   {
+      std::ofstream clFile(clMyPath, std::ios::binary);
+      clFile.write(sData_.data(), static_cast<std::streamsize>(sData_.size()));
+   }
+
+   std::string ReadAll(InputCompressedFileStream& clStream_, uint32_t uiReadSize_)
+   {
+      std::string sResult;
+      std::vector<char> vBuffer(uiReadSize_);
+      ReadDataStructure stReadData;
+      stReadData.cData = vBuffer.data();
+      stReadData.uiDataSize = uiReadSize_;
+      uint32_t uiLastPercent = 0;
+      StreamReadStatus stStatus;
+      do
+      {
+         stStatus = clStream_.ReadData(stReadData);
+         sResult.append(vBuffer.data(), stStatus.uiCurrentStreamRead);
+         EXPECT_GE(stStatus.uiPercentStreamRead, uiLastPercent);
+         uiLastPercent = stStatus.uiPercentStreamRead;
+      } while (stStatus.uiCurrentStreamRead > 0);
+      EXPECT_TRUE(stStatus.bEOS);
+      EXPECT_EQ(stStatus.uiPercentStreamRead, 100U);
+      return sResult;
+   }
+
+   std::filesystem::path clMyPath{ std::filesystem::temp_directory_path() / "inputcompressedfilestream_test.gz" };
+   std::string sMyPlain;
+};
+
+TEST_F(InputCompressedFileStreamTest, DetectCompression)
+{
+   const unsigned char aucGzip[] = { 0x1F, 0x8B, 0x08, 0x00 };
+   const unsigned char aucZstd[] = { 0x28, 0xB5, 0x2F, 0xFD };
+   const unsigned char aucPlain[] = { '#', 'B', 'E', 'S' };
+   ASSERT_EQ(InputCompressedFileStream::DetectCompression(aucGzip, 4), COMPRESSION::GZIP);
+   ASSERT_EQ(InputCompressedFileStream::DetectCompression(aucZstd, 4), COMPRESSION::ZSTD);
+   ASSERT_EQ(InputCompressedFileStream::DetectCompression(aucPlain, 4), COMPRESSION::NONE);
+   ASSERT_EQ(InputCompressedFileStream::DetectCompression(aucGzip, 1), COMPRESSION::NONE);
+}
+
+TEST_F(InputCompressedFileStreamTest, ReadGzip)
+{
+   WriteGzip(sMyPlain);
+   InputCompressedFileStream clStream(clMyPath.string().c_str(), 4096, 3);
+   ASSERT_EQ(clStream.GetCompression(), COMPRESSION::GZIP);
+   ASSERT_FALSE(clStream.IsRandomAccess());
+   ASSERT_EQ(ReadAll(clStream, 1000), sMyPlain);
+   ASSERT_EQ(clStream.GetCurrentFilePosition(), sMyPlain.size());
+}
+
+TEST_F(InputCompressedFileStreamTest, ReadConcatenatedGzip)
+{
+   const std::string sFirst = sMyPlain.substr(0, sMyPlain.size() / 3);
+   WriteGzip(sFirst);
+   WriteGzip(sMyPlain.substr(sFirst.size()), "ab");
+   InputCompressedFileStream clStream(clMyPath.string().c_str(), 4096, 2);
+   ASSERT_EQ(ReadAll(clStream, 65536), sMyPlain);
+}
+
+TEST_F(InputCompressedFileStreamTest, ReadPlain)
+{
+   WriteFile(sMyPlain);
+   InputCompressedFileStream clStream(clMyPath.string().c_str(), 4096, 2);
+   ASSERT_EQ(clStream.GetCompression(), COMPRESSION::NONE);
+   ASSERT_EQ(ReadAll(clStream, 777), sMyPlain);
+}
+
+TEST_F(InputCompressedFileStreamTest, ReadLine)
+{
+   WriteGzip("first line\nsecond line\nlast");
+   InputCompressedFileStream clStream(clMyPath.string().c_str(), 5, 2);
+   std::string sLine;
+   ASSERT_FALSE(clStream.ReadLine(sLine).bEOS);
+   ASSERT_EQ(sLine, "first line");
+   ASSERT_FALSE(clStream.ReadLine(sLine).bEOS);
+   ASSERT_EQ(sLine, "second line");
+   ASSERT_TRUE(clStream.ReadLine(sLine).bEOS);
+   ASSERT_EQ(sLine, "last");
+}
+
+TEST_F(InputCompressedFileStreamTest, Reset)
+{
+   WriteGzip(sMyPlain);
+   InputCompressedFileStream clStream(clMyPath.string().c_str(), 4096, 2);
+   char acBuffer[64] = {};
+   ReadDataStructure stReadData;
+   stReadData.cData = acBuffer;
+   stReadData.uiDataSize = sizeof(acBuffer);
+
+   // Forward, then backward, then relative to the current position.
+   for (const uint64_t ullOffset : { 100000ULL, 50ULL, 1000000ULL, 0ULL })
+   {
+      clStream.Reset(static_cast<std::streamoff>(ullOffset), std::ios::beg);
+      ASSERT_EQ(clStream.GetCurrentFilePosition(), ullOffset);
+      ASSERT_EQ(clStream.ReadData(stReadData).uiCurrentStreamRead, sizeof(acBuffer));
+      ASSERT_EQ(std::string(acBuffer, sizeof(acBuffer)), sMyPlain.substr(ullOffset, sizeof(acBuffer)));
+   }
+   clStream.Reset(-32, std::ios::cur);
+   ASSERT_EQ(clStream.ReadData(stReadData).uiCurrentStreamRead, sizeof(acBuffer));
+   ASSERT_EQ(std::string(acBuffer, sizeof(acBuffer)), sMyPlain.substr(32, sizeof(acBuffer)));
+   ASSERT_ANY_THROW(clStream.Reset(0, std::ios::end));
+}
+
+TEST_F(InputCompressedFileStreamTest, TruncatedGzip)
+{
+   WriteGzip(sMyPlain);
+   std::filesystem::resize_file(clMyPath, std::filesystem::file_size(clMyPath) / 2);
+   InputCompressedFileStream clStream(clMyPath.string().c_str(), 4096, 2);
+   const std::string sResult = ReadAll(clStream, 1000);
+   ASSERT_GT(sResult.size(), 0U);
+   ASSERT_LT(sResult.size(), sMyPlain.size());
+   ASSERT_EQ(sResult, sMyPlain.substr(0, sResult.size()));
+}
+
+TEST_F(InputCompressedFileStreamTest, CorruptGzip)
+{
+   WriteGzip(sMyPlain);
+   {
+      std::fstream clFile(clMyPath, std::ios::in | std::ios::out | std::ios::binary);
+      clFile.seekp(100);
+      clFile.write("\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF", 8);
+   }
+   InputCompressedFileStream clStream(clMyPath.string().c_str(), 4096, 2);
+   std::vector<char> vBuffer(4096);
+   ReadDataStructure stReadData;
+   stReadData.cData = vBuffer.data();
+   stReadData.uiDataSize = static_cast<uint32_t>(vBuffer.size());
+   ASSERT_ANY_THROW(while (clStream.ReadData(stReadData).uiCurrentStreamRead > 0) {});
+}
+
+#ifdef HAVE_ZSTD
+TEST_F(InputCompressedFileStreamTest, ReadZstd)
+{
+   std::string sCompressed(ZSTD_compressBound(sMyPlain.size()), '\0');
+   sCompressed.resize(ZSTD_compress(sCompressed.data(), sCompressed.size(), sMyPlain.data(), sMyPlain.size(), 3));
+   WriteFile(sCompressed);
+   InputCompressedFileStream clStream(clMyPath.string().c_str(), 4096, 3);
+   ASSERT_EQ(clStream.GetCompression(), COMPRESSION::ZSTD);
+   ASSERT_EQ(ReadAll(clStream, 1000), sMyPlain);
+}
+#endif
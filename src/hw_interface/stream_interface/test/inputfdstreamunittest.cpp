@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include "hw_interface/stream_interface/api/inputfdstream.hpp"
+#include <cstring>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+class InputFdStreamTest : public ::testing::Test {
+public:
+   virtual void SetUp() {
+      ASSERT_EQ(pipe(aiFds), 0);
+   }
+
+   virtual void TearDown() {
+      if (aiFds[1] >= 0)
+      {
+         close(aiFds[1]);
+      }
+   }
+
+protected:
+   int aiFds[2]{ -1, -1 };
+};
+
+TEST_F(InputFdStreamTest, ReadData)
+{
+   InputFdStream clStream(aiFds[0], true);
+   char acBuffer[32] = {};
+   ReadDataStructure stReadDataStructure;
+   stReadDataStructure.cData = acBuffer;
+   stReadDataStructure.uiDataSize = sizeof(acBuffer);
+
+   // Nothing written yet, so the read returns straight away.
+   StreamReadStatus stStatus = clStream.ReadData(stReadDataStructure);
+   ASSERT_EQ(stStatus.uiCurrentStreamRead, 0U);
+   ASSERT_FALSE(stStatus.bEOS);
+   ASSERT_TRUE(clStream.IsStreamAvailable());
+
+   ASSERT_EQ(write(aiFds[1], "This is a test.", 15), 15);
+   stStatus = clStream.ReadData(stReadDataStructure);
+   ASSERT_EQ(stStatus.uiCurrentStreamRead, 15U);
+   ASSERT_EQ(0, memcmp(acBuffer, "This is a test.", 15));
+   ASSERT_EQ(clStream.GetCurrentFileOffset(), 15U);
+
+   close(aiFds[1]);
+   aiFds[1] = -1;
+   stStatus = clStream.ReadData(stReadDataStructure);
+   ASSERT_EQ(stStatus.uiCurrentStreamRead, 0U);
+   ASSERT_TRUE(stStatus.bEOS);
+   ASSERT_FALSE(clStream.IsStreamAvailable());
+}
+
+TEST_F(InputFdStreamTest, InvalidDescriptor)
+{
+   ASSERT_ANY_THROW(InputFdStream(-1));
+   close(aiFds[0]);
+}
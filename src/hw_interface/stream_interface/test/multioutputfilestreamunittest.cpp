@@ -29,8 +29,13 @@
 
 // Includes
 #include "hw_interface/stream_interface/api/multioutputfilestream.hpp"
+#ifdef HAVE_ZLIB
+#include "hw_interface/stream_interface/api/inputcompressedfilestream.hpp"
+#endif
 #include "string"
 #include <filesystem>
+#include <fstream>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -64,6 +69,24 @@ public:
   uint32_t GetStartWeek() { return pMyTestCommand->ulMyStartWeek; }
   FstreamMap GetMap() { return pMyTestCommand->GetFileMap(); }
   MultiOutputFileStream::WCFstreamMap Get32StringMap() { return pMyTestCommand->Get32FileMap(); }
+  uint32_t GetOpenFileCount()
+  {
+     uint32_t uiOpen = 0;
+     for (const auto& itFile : pMyTestCommand->GetFileMap())
+        uiOpen += itFile.second->GetMyFileStream()->is_open() ? 1 : 0;
+     return uiOpen;
+  }
+  // Wait until the writer thread has written everything queued so far.
+  static void WaitUntilWritten(AsyncFileWriter& clWriter_)
+  {
+     std::unique_lock<std::mutex> clLock(clWriter_.clMyMutex);
+     clWriter_.clMyBatchDone.wait(clLock, [&clWriter_] { return clWriter_.ullMyQueuedBytes == 0; });
+  }
+  static bool IsWaitingForSync(AsyncFileWriter& clWriter_, const std::string& strFileName_)
+  {
+     std::lock_guard<std::mutex> clLock(clWriter_.clMyMutex);
+     return clWriter_.usMyUnsyncedFiles.count(strFileName_) != 0;
+  }
 private:
 
 protected:
@@ -318,3 +341,259 @@ TEST_F(MultiOutputFileStreamTest, SelectTimeFile)
 
    delete pMyTestCommand;
 }
+
+// Write a line to each of uiLogs_ logs in turn, returning what went to each log.
+static std::vector<std::string> WriteLogsById(MultiOutputFileStream* pclStream_, uint32_t uiLogs_, uint32_t uiRounds_)
+{
+   std::vector<std::string> vWritten(uiLogs_);
+   for (uint32_t uiRound = 0; uiRound < uiRounds_; uiRound++)
+   {
+      for (uint32_t uiLog = 0; uiLog < uiLogs_; uiLog++)
+      {
+         std::string sLine = "#LOG" + std::to_string(uiLog) + "A,COM1,0,73.0,FINESTEERING,2072," + std::to_string(uiRound) + ".000;SOL_COMPUTED\r\n";
+         EXPECT_EQ(pclStream_->WriteData(sLine.data(), static_cast<uint32_t>(sLine.size()), uiLog, "LOG" + std::to_string(uiLog), static_cast<uint32_t>(sLine.size()), novatel::edie::TIME_STATUS::UNKNOWN, 0, 0.0), sLine.size());
+         vWritten[uiLog] += sLine;
+      }
+   }
+   return vWritten;
+}
+
+TEST_F(MultiOutputFileStreamTest, SplitByLogIdMaxOpenFiles)
+{
+   const std::filesystem::path clDirectory = std::filesystem::temp_directory_path() / "multioutputfilestream_maxopen";
+   std::filesystem::remove_all(clDirectory);
+   std::filesystem::create_directory(clDirectory);
+
+   pMyTestCommand = new MultiOutputFileStream();
+   pMyTestCommand->ConfigureMaxOpenFiles(8);
+   pMyTestCommand->ConfigureSplitByLog(true);
+   pMyTestCommand->ConfigureBaseFileName((clDirectory / "Log.txt").string());
+   const std::vector<std::string> vWritten = WriteLogsById(pMyTestCommand, 50, 4);
+   ASSERT_EQ(GetMap().size(), 50U);
+   ASSERT_EQ(GetOpenFileCount(), 8U);
+
+   // Lifting the limit reopens the closed files.
+   pMyTestCommand->ConfigureMaxOpenFiles(0);
+   ASSERT_EQ(GetOpenFileCount(), 50U);
+   delete pMyTestCommand;
+
+   // Every file was appended to, not truncated, when it was reopened.
+   for (uint32_t uiLog = 0; uiLog < vWritten.size(); uiLog++)
+   {
+      std::ifstream clFile(clDirectory / ("Log_LOG" + std::to_string(uiLog) + ".txt"), std::ios::binary);
+      ASSERT_EQ(std::string(std::istreambuf_iterator<char>(clFile), std::istreambuf_iterator<char>()), vWritten[uiLog]);
+   }
+   std::filesystem::remove_all(clDirectory);
+}
+
+TEST_F(MultiOutputFileStreamTest, SplitByLogIdLowerMaxOpenFiles)
+{
+   const std::filesystem::path clDirectory = std::filesystem::temp_directory_path() / "multioutputfilestream_lowermax";
+   std::filesystem::remove_all(clDirectory);
+   std::filesystem::create_directory(clDirectory);
+
+   pMyTestCommand = new MultiOutputFileStream();
+   pMyTestCommand->ConfigureMaxOpenFiles(20);
+   pMyTestCommand->ConfigureSplitByLog(true);
+   pMyTestCommand->ConfigureBaseFileName((clDirectory / "Log.txt").string());
+   std::vector<std::string> vWritten = WriteLogsById(pMyTestCommand, 12, 2);
+   ASSERT_EQ(GetOpenFileCount(), 12U);
+
+   // Lowering the limit below the number of open files closes the extra ones.
+   pMyTestCommand->ConfigureMaxOpenFiles(5);
+   ASSERT_EQ(GetOpenFileCount(), 5U);
+
+   pMyTestCommand->ConfigureMaxOpenFiles(0);
+   ASSERT_EQ(GetOpenFileCount(), 12U);
+   const std::vector<std::string> vMore = WriteLogsById(pMyTestCommand, 12, 1);
+
+   // Files opened without a limit are closed too once one is set.
+   pMyTestCommand->ConfigureMaxOpenFiles(3);
+   ASSERT_EQ(GetOpenFileCount(), 3U);
+   delete pMyTestCommand;
+
+   for (uint32_t uiLog = 0; uiLog < vWritten.size(); uiLog++)
+   {
+      std::ifstream clFile(clDirectory / ("Log_LOG" + std::to_string(uiLog) + ".txt"), std::ios::binary);
+      ASSERT_EQ(std::string(std::istreambuf_iterator<char>(clFile), std::istreambuf_iterator<char>()), vWritten[uiLog] + vMore[uiLog]);
+   }
+   std::filesystem::remove_all(clDirectory);
+}
+
+TEST_F(MultiOutputFileStreamTest, AsyncSplitByLogIdMaxOpenFiles)
+{
+   const std::filesystem::path clDirectory = std::filesystem::temp_directory_path() / "multioutputfilestream_async";
+   std::filesystem::remove_all(clDirectory);
+   std::filesystem::create_directory(clDirectory);
+
+   pMyTestCommand = new MultiOutputFileStream();
+   pMyTestCommand->ConfigureAsyncWrite(true, 4096);
+   pMyTestCommand->ConfigureMaxOpenFiles(8);
+   pMyTestCommand->ConfigureSplitByLog(true);
+   pMyTestCommand->ConfigureBaseFileName((clDirectory / "Log.txt").string());
+   const std::vector<std::string> vWritten = WriteLogsById(pMyTestCommand, 50, 4);
+
+   // Everything written is in the files once Flush returns.
+   pMyTestCommand->Flush();
+   for (uint32_t uiLog = 0; uiLog < vWritten.size(); uiLog++)
+   {
+      std::ifstream clFile(clDirectory / ("Log_LOG" + std::to_string(uiLog) + ".txt"), std::ios::binary);
+      ASSERT_EQ(std::string(std::istreambuf_iterator<char>(clFile), std::istreambuf_iterator<char>()), vWritten[uiLog]);
+   }
+   delete pMyTestCommand;
+   std::filesystem::remove_all(clDirectory);
+}
+
+TEST_F(MultiOutputFileStreamTest, AsyncFileWriterFlushSyncsClosedFiles)
+{
+   const std::filesystem::path clDirectory = std::filesystem::temp_directory_path() / "asyncfilewriter_flush";
+   std::filesystem::remove_all(clDirectory);
+   std::filesystem::create_directory(clDirectory);
+   const std::string strSuspended = (clDirectory / "Suspended.txt").string();
+   const std::string strRotated = (clDirectory / "Rotated.txt").string();
+   const std::string strOpen = (clDirectory / "Open.txt").string();
+
+   FileStream clSuspended(strSuspended.c_str());
+   FileStream* pclRotated = new FileStream(strRotated.c_str());
+   FileStream clOpen(strOpen.c_str());
+   char acData[] = "#BESTPOSA,COM1,0,73.0,FINESTEERING;SOL_COMPUTED\r\n";
+   const uint32_t uiLength = sizeof(acData) - 1;
+
+   AsyncFileWriter clWriter;
+   clWriter.Write(&clSuspended, acData, uiLength);
+   clWriter.Suspend(&clSuspended);
+   clWriter.Write(pclRotated, acData, uiLength);
+   clWriter.Close(pclRotated);
+   clWriter.Write(&clOpen, acData, uiLength);
+
+   // Files closed before a Flush are synced by the Flush.
+   WaitUntilWritten(clWriter);
+   ASSERT_TRUE(IsWaitingForSync(clWriter, strSuspended));
+   ASSERT_TRUE(IsWaitingForSync(clWriter, strRotated));
+   clWriter.Flush();
+   ASSERT_FALSE(IsWaitingForSync(clWriter, strSuspended));
+   ASSERT_FALSE(IsWaitingForSync(clWriter, strRotated));
+
+   // A suspended file that is written again is synced through its new descriptor.
+   clWriter.Suspend(&clOpen);
+   clWriter.Write(&clSuspended, acData, uiLength);
+   WaitUntilWritten(clWriter);
+   ASSERT_TRUE(IsWaitingForSync(clWriter, strOpen));
+   ASSERT_FALSE(IsWaitingForSync(clWriter, strSuspended));
+   clWriter.Flush();
+   ASSERT_FALSE(IsWaitingForSync(clWriter, strOpen));
+
+   for (const auto& [strFileName, uiWrites] : { std::pair<std::string, uint32_t>{ strSuspended, 2 }, { strRotated, 1 }, { strOpen, 1 } })
+   {
+      std::ifstream clFile(strFileName, std::ios::binary);
+      std::string strExpected;
+      for (uint32_t i = 0; i < uiWrites; i++)
+         strExpected += acData;
+      ASSERT_EQ(std::string(std::istreambuf_iterator<char>(clFile), std::istreambuf_iterator<char>()), strExpected);
+   }
+   std::filesystem::remove_all(clDirectory);
+}
+
+#ifdef HAVE_ZLIB
+static std::string ReadCompressedFile(const std::filesystem::path& clPath_)
+{
+   InputCompressedFileStream clStream(clPath_.string().c_str());
+   std::string sContents;
+   char acBuffer[4096];
+   ReadDataStructure stReadData;
+   stReadData.cData = acBuffer;
+   stReadData.uiDataSize = sizeof(acBuffer);
+   StreamReadStatus stStatus;
+   while ((stStatus = clStream.ReadData(stReadData)).uiCurrentStreamRead > 0)
+   {
+      sContents.append(acBuffer, stStatus.uiCurrentStreamRead);
+   }
+   return sContents;
+}
+
+TEST_F(MultiOutputFileStreamTest, CompressedSplitBySize)
+{
+   const std::filesystem::path clDirectory = std::filesystem::temp_directory_path() / "multioutputfilestream_compressed";
+   std::filesystem::remove_all(clDirectory);
+   std::filesystem::create_directory(clDirectory);
+
+   std::string sWritten;
+   pMyTestCommand = new MultiOutputFileStream();
+   pMyTestCommand->ConfigureCompression(COMPRESSION::GZIP);
+   pMyTestCommand->ConfigureSplitBySize(1);
+   pMyTestCommand->ConfigureBaseFileName((clDirectory / "Log.txt").string());
+   // Three full parts and a partial one.
+   for (uint32_t i = 0; sWritten.size() < 3 * MBYTE_TO_BYTE + 100000; i++)
+   {
+      std::string sLine = "#BESTPOSA,COM1,0,73.0,FINESTEERING,2072," + std::to_string(i) + ".000;SOL_COMPUTED,SINGLE,51.15043711386,-114.03067767000\r\n";
+      ASSERT_EQ(pMyTestCommand->WriteData(sLine.data(), static_cast<uint32_t>(sLine.size()), "", static_cast<uint32_t>(sLine.size()), novatel::edie::TIME_STATUS::UNKNOWN, 0, 0.0), sLine.size());
+      sWritten += sLine;
+   }
+   ASSERT_EQ(GetFileCount(), 3U);
+   delete pMyTestCommand;
+
+   // Every part, including the ones rotated out, is a complete gzip stream.
+   std::string sRead;
+   for (uint32_t uiPart = 0; uiPart <= 3; uiPart++)
+   {
+      const std::filesystem::path clPart = clDirectory / ("Log_Part" + std::to_string(uiPart) + ".txt.gz");
+      ASSERT_TRUE(std::filesystem::exists(clPart));
+      const std::string sPart = ReadCompressedFile(clPart);
+      ASSERT_LT(std::filesystem::file_size(clPart), sPart.size() / 4);
+      sRead += sPart;
+   }
+   ASSERT_EQ(sRead, sWritten);
+   std::filesystem::remove_all(clDirectory);
+}
+
+TEST_F(MultiOutputFileStreamTest, CompressedFileWriterFlush)
+{
+   const std::filesystem::path clPath = std::filesystem::temp_directory_path() / "compressedfilewriter_flush.gz";
+   FileStream* pclFile = new FileStream(clPath.string().c_str());
+   pclFile->OpenFile(FileStream::FILEMODES::OUTPUT);
+
+   CompressedFileWriter clWriter(COMPRESSION::GZIP);
+   char acData[] = "#BESTPOSA,COM1,0,73.0,FINESTEERING;SOL_COMPUTED\r\n";
+   ASSERT_EQ(clWriter.Write(pclFile, acData, sizeof(acData) - 1), sizeof(acData) - 1);
+
+   // Flushed data can be read before the stream is finished.
+   clWriter.Flush();
+   ASSERT_EQ(ReadCompressedFile(clPath), acData);
+
+   clWriter.Write(pclFile, acData, sizeof(acData) - 1);
+   clWriter.Close(pclFile);
+   clWriter.Flush();
+   ASSERT_EQ(ReadCompressedFile(clPath), std::string(acData) + acData);
+   std::filesystem::remove(clPath);
+}
+
+TEST_F(MultiOutputFileStreamTest, CompressedSplitByLogIdMaxOpenFiles)
+{
+   const std::filesystem::path clDirectory = std::filesystem::temp_directory_path() / "multioutputfilestream_compressed_maxopen";
+   std::filesystem::remove_all(clDirectory);
+   std::filesystem::create_directory(clDirectory);
+
+   pMyTestCommand = new MultiOutputFileStream();
+   pMyTestCommand->ConfigureCompression(COMPRESSION::GZIP);
+   pMyTestCommand->ConfigureMaxOpenFiles(4);
+   pMyTestCommand->ConfigureSplitByLog(true);
+   pMyTestCommand->ConfigureBaseFileName((clDirectory / "Log.txt").string());
+   const std::vector<std::string> vWritten = WriteLogsById(pMyTestCommand, 20, 3);
+   delete pMyTestCommand;
+
+   // Each file is one gzip stream, continued across the times it was suspended.
+   for (uint32_t uiLog = 0; uiLog < vWritten.size(); uiLog++)
+   {
+      ASSERT_EQ(ReadCompressedFile(clDirectory / ("Log_LOG" + std::to_string(uiLog) + ".txt.gz")), vWritten[uiLog]);
+   }
+   std::filesystem::remove_all(clDirectory);
+}
+#endif
+
+#ifndef HAVE_ZSTD
+TEST_F(MultiOutputFileStreamTest, CompressionNotSupported)
+{
+   MultiOutputFileStream clStream;
+   ASSERT_THROW(clStream.ConfigureCompression(COMPRESSION::ZSTD), nExcept);
+}
+#endif
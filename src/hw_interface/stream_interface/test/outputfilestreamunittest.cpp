@@ -27,6 +27,7 @@
 #include "paths.hpp"
 #include <string>
 #include <filesystem>
+#include <fstream>
 #include <gtest/gtest.h>
 
 class OutputFileStreamTest : public ::testing::Test {
@@ -61,3 +62,35 @@ TEST_F(OutputFileStreamTest, ConstructorWideChar)
    delete pMyTestCommand;
    std::cout<<"Made it past ASSERT and Delete. Output Stream Test, Constructor WC"<<std::endl;
 }
+
+static std::string ReadFile(const std::filesystem::path& clPath_)
+{
+   std::ifstream clFile(clPath_, std::ios::binary);
+   return std::string(std::istreambuf_iterator<char>(clFile), std::istreambuf_iterator<char>());
+}
+
+// Asynchronous writes, with a queue small enough that WriteData has to wait
+TEST_F(OutputFileStreamTest, AsyncWrite)
+{
+   const std::filesystem::path clPath = std::filesystem::temp_directory_path() / "outputfilestream_async.asc";
+   OutputFileStream* pMyTestCommand = new OutputFileStream(clPath.string().c_str());
+   pMyTestCommand->ConfigureAsyncWrite(true, 1024);
+
+   std::string sWritten;
+   for (uint32_t i = 0; i < 10000; i++)
+   {
+      std::string sLine = "#BESTPOSA,COM1,0,73.0,FINESTEERING,2072," + std::to_string(i) + ".000;SOL_COMPUTED\r\n";
+      ASSERT_EQ(pMyTestCommand->WriteData(sLine.data(), static_cast<uint32_t>(sLine.size())), sLine.size());
+      sWritten += sLine;
+   }
+   pMyTestCommand->Flush();
+   ASSERT_EQ(ReadFile(clPath), sWritten);
+
+   // Writing carries on at the end of the file once asynchronous writes are turned off.
+   std::string sLine = "#BESTPOSA,COM1,0,73.0,FINESTEERING,2072,10000.000;SOL_COMPUTED\r\n";
+   pMyTestCommand->ConfigureAsyncWrite(false);
+   pMyTestCommand->WriteData(sLine.data(), static_cast<uint32_t>(sLine.size()));
+   delete pMyTestCommand;
+   ASSERT_EQ(ReadFile(clPath), sWritten + sLine);
+   std::filesystem::remove(clPath);
+}
@@ -0,0 +1,45 @@
+#include <string>
+#include <string.h>
+
+#define RELEASE_VERSION "3.2.24"
+#define GIT_SHA "b4d1ea884661cb9d2952cea749536691f4aeb982"
+#define GIT_BRANCH "master"
+#define GIT_IS_DIRTY true
+#define BUILD_TIMESTAMP "2026-10-18T16:26:13"
+
+constexpr const char* get_version()
+{
+   return RELEASE_VERSION;
+}
+
+constexpr const char* get_git_sha()
+{
+   return GIT_SHA;
+}
+
+constexpr const char* get_git_branch()
+{
+   return GIT_BRANCH;
+}
+
+constexpr bool get_git_is_dirty()
+{
+   return GIT_IS_DIRTY;
+}
+
+constexpr const char* get_build_timestamp()
+{
+   return BUILD_TIMESTAMP;
+}
+
+constexpr const char* caPrettyPrint = []
+{
+   return GIT_IS_DIRTY 
+      ? "Version: " RELEASE_VERSION "-Dirty\nBranch: " GIT_BRANCH "\nSHA: " GIT_SHA
+      : "Version: " RELEASE_VERSION "\nBranch: " GIT_BRANCH "\nSHA: " GIT_SHA;
+}();
+
+constexpr const char* get_pretty_version()
+{
+   return caPrettyPrint;
+}